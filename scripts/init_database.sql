@@ -177,14 +177,33 @@ CREATE TABLE IF NOT EXISTS attendance (
     INDEX idx_attendance_scheduled_time (scheduled_time)
 );
 
+-- Помесячные агрегаты для статистики: одна строка на (месяц, филиал, метрика).
+-- Обновляются инкрементально при записи; branch_id = нулевой UUID для метрик без филиала
+-- (новые клиенты, выручка от абонементов)
+CREATE TABLE IF NOT EXISTS monthly_rollups (
+    month DATE NOT NULL, -- первое число месяца
+    branch_id UUID NOT NULL,
+    metric VARCHAR(50) NOT NULL,
+    value NUMERIC(14,2) NOT NULL DEFAULT 0,
+    PRIMARY KEY (month, branch_id, metric)
+);
+
+-- Позиция пакетного пересчета агрегатов: задание продолжается с месяца, следующего за last_month
+CREATE TABLE IF NOT EXISTS rollup_jobs (
+    job_name VARCHAR(100) PRIMARY KEY,
+    last_month DATE NOT NULL,
+    updated_at TIMESTAMP NOT NULL DEFAULT CURRENT_TIMESTAMP
+);
+
 -- Индексы для улучшения производительности
 CREATE INDEX idx_bookings_client_id ON bookings(client_id);
-CREATE INDEX idx_bookings_hall_id ON bookings(hall_id);
+-- Расписание зала или филиала за период: равенство по залу, диапазон по времени начала
+CREATE INDEX idx_bookings_hall_start ON bookings(hall_id, start_time);
 CREATE INDEX idx_bookings_start_time ON bookings(start_time);
 CREATE INDEX idx_clients_email ON clients(email);
 CREATE INDEX idx_subscriptions_client_id ON subscriptions(client_id);
 CREATE INDEX idx_lessons_trainer_id ON lessons(trainer_id);
-CREATE INDEX idx_lessons_hall_id ON lessons(hall_id);
+CREATE INDEX idx_lessons_hall_start ON lessons(hall_id, start_time);
 CREATE INDEX idx_lessons_start_time ON lessons(start_time);
 CREATE INDEX idx_lessons_status ON lessons(status);
 CREATE INDEX idx_enrollments_client_id ON enrollments(client_id);
@@ -200,6 +219,10 @@ CREATE INDEX IF NOT EXISTS idx_attendance_client_status ON attendance(client_id,
 -- Индекс для статистических запросов
 CREATE INDEX IF NOT EXISTS idx_attendance_type_client ON attendance(type, client_id, status);
 
+-- Индексы для пересчета помесячных агрегатов по диапазону дат
+CREATE INDEX IF NOT EXISTS idx_clients_registration_date ON clients(registration_date);
+CREATE INDEX IF NOT EXISTS idx_subscriptions_purchase_date ON subscriptions(purchase_date);
+
 -- Права доступа
 GRANT ALL PRIVILEGES ON ALL TABLES IN SCHEMA public TO dance_user;
 GRANT ALL PRIVILEGES ON ALL SEQUENCES IN SCHEMA public TO dance_user;
\ No newline at end of file
@@ -0,0 +1,50 @@
+#include "core/Config.hpp"
+#include "data/MongoDBGlobalInstance.hpp"
+#include "data/MongoDBRepositoryFactory.hpp"
+#include "data/MongoDBDateConverter.hpp"
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+// Разовый перевод строковых дат в BSON date. Запуск: ConvertMongoDates [--dry-run]
+int main(int argc, char* argv[]) {
+    bool dryRun = argc > 1 && std::string(argv[1]) == "--dry-run";
+
+    try {
+        auto& config = Config::getInstance();
+        std::vector<std::string> configPaths = {
+            "config/config.properties",
+            "../config/config.properties",
+            "../../config/config.properties",
+            "./config.properties"
+        };
+        for (const auto& path : configPaths) {
+            if (fs::exists(path)) {
+                config.loadFromFile(path);
+                std::cout << "✅ Конфигурация загружена из: " << path << std::endl;
+                break;
+            }
+        }
+
+        MongoDBGlobalInstance::initialize();
+        MongoDBRepositoryFactory factory(config.getMongoConnectionString(), config.getMongoDatabaseName());
+        MongoDBDateConverter converter(factory);
+
+        auto results = dryRun ? converter.countPending() : converter.convertAll();
+        bool failed = false;
+        for (const auto& result : results) {
+            if (dryRun) {
+                std::cout << "   " << result.collection << "." << result.field
+                          << ": строковых значений " << result.modified << std::endl;
+            }
+            failed = failed || result.failed;
+        }
+        return failed ? 1 : 0;
+    } catch (const std::exception& e) {
+        std::cerr << "💥 Ошибка конвертации дат: " << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,101 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+// Ограниченная lock-free очередь (схема Д. Вьюкова) для асинхронного логгера.
+// Пишут многие потоки, читает фоновый поток записи; при политике DropOldest
+// производитель тоже может извлечь самую старую запись, поэтому извлечение
+// также безопасно для нескольких потоков.
+template <typename T>
+class LogRingBuffer {
+private:
+    struct Cell {
+        std::atomic<std::size_t> sequence;
+        T value;
+    };
+
+    static constexpr std::size_t CACHE_LINE_SIZE = 64;
+
+    std::unique_ptr<Cell[]> cells_;
+    std::size_t mask_;
+    alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> enqueuePos_{0};
+    alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> dequeuePos_{0};
+
+public:
+    // Фактическая емкость буфера для запрошенной
+    static std::size_t roundUpToPowerOfTwo(std::size_t value) {
+        std::size_t result = 2;
+        while (result < value) {
+            result <<= 1;
+        }
+        return result;
+    }
+
+    // Емкость округляется вверх до степени двойки
+    explicit LogRingBuffer(std::size_t capacity)
+        : cells_(new Cell[roundUpToPowerOfTwo(capacity)]),
+          mask_(roundUpToPowerOfTwo(capacity) - 1) {
+        for (std::size_t i = 0; i <= mask_; ++i) {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    LogRingBuffer(const LogRingBuffer&) = delete;
+    LogRingBuffer& operator=(const LogRingBuffer&) = delete;
+
+    // Перемещает value в очередь; при переполнении возвращает false и не трогает value
+    bool tryPush(T& value) {
+        Cell* cell;
+        std::size_t pos = enqueuePos_.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &cells_[pos & mask_];
+            std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos);
+            if (diff == 0) {
+                if (enqueuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = enqueuePos_.load(std::memory_order_relaxed);
+            }
+        }
+        cell->value = std::move(value);
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool tryPop(T& value) {
+        Cell* cell;
+        std::size_t pos = dequeuePos_.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &cells_[pos & mask_];
+            std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos + 1);
+            if (diff == 0) {
+                if (dequeuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = dequeuePos_.load(std::memory_order_relaxed);
+            }
+        }
+        value = std::move(cell->value);
+        cell->sequence.store(pos + mask_ + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Приблизительный размер: используется только для порогов пробуждения
+    std::size_t sizeApprox() const {
+        std::size_t enqueued = enqueuePos_.load(std::memory_order_relaxed);
+        std::size_t dequeued = dequeuePos_.load(std::memory_order_relaxed);
+        return enqueued > dequeued ? enqueued - dequeued : 0;
+    }
+
+    std::size_t capacity() const { return mask_ + 1; }
+};
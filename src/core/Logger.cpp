@@ -1,10 +1,14 @@
 #include "Logger.hpp"
-#include <iomanip>
-#include <sstream>
 #include <ctime>
+#include <algorithm>
+#include <cstdio>
 #include <sys/stat.h>
 #include <unistd.h>
 
+#ifdef LOGGER_HAVE_ZLIB
+#include <zlib.h>
+#endif
+
 std::unique_ptr<Logger> Logger::instance_ = nullptr;
 
 Logger::Logger() : currentLevel_(LogLevel::INFO) {
@@ -21,7 +25,28 @@ Logger& Logger::getInstance() {
     return *instance_;
 }
 
-void Logger::initialize(const std::string& filePath, LogLevel level) { 
+LogOverflowPolicy LoggerOptions::parseOverflowPolicy(const std::string& value) {
+    if (value == "block") return LogOverflowPolicy::Block;
+    if (value == "drop_oldest") return LogOverflowPolicy::DropOldest;
+    return LogOverflowPolicy::DropDebug;
+}
+
+LogLevel Logger::parseLevel(const std::string& value) {
+    if (value == "DEBUG") return LogLevel::DEBUG;
+    if (value == "WARNING") return LogLevel::WARNING;
+    if (value == "ERROR") return LogLevel::ERROR;
+    return LogLevel::INFO;
+}
+
+void Logger::initialize(const std::string& filePath, LogLevel level, const LoggerOptions& options) {
+    // Фоновые потоки работают с logFile_, поэтому останавливаем их до переоткрытия файла
+    stopAsyncWriter();
+    stopRotationWorker();
+    // До захвата logMutex_: производитель, оставшийся в enqueue, может ждать его в drainBuffer
+    if (options.async) {
+        reserveBuffer(options.bufferCapacity);
+    }
+
     std::lock_guard<std::mutex> lock(logMutex_);
     
     struct stat fileStat;
@@ -46,7 +71,8 @@ void Logger::initialize(const std::string& filePath, LogLevel level) {
         throw std::runtime_error("Cannot open log file: " + filePath);
     }
     
-    logFile_ << "[INIT] Logger initialized successfully" << std::endl;
+    static const std::string initLine = "[INIT] Logger initialized successfully";
+    logFile_ << initLine << std::endl;
     if (logFile_.fail()) {
         logFile_.close();
         throw std::runtime_error("Cannot write to log file: " + filePath);
@@ -54,16 +80,310 @@ void Logger::initialize(const std::string& filePath, LogLevel level) {
     
     logFilePath_ = filePath;
     currentLevel_ = level;
+    options_ = options;
+    // Единственный stat при открытии; дальше размер ведется по записанным байтам
+    bytesWritten_ = (stat(filePath.c_str(), &fileStat) == 0) ? static_cast<std::size_t>(fileStat.st_size) : initLine.size() + 1;
     
     logFile_.flush();
+
+    if (options_.maxFileSizeBytes > 0) {
+        startRotationWorker();
+    }
+    if (options_.async) {
+        startAsyncWriter();
+    }
 }
 
 void Logger::shutdown() {
+    stopAsyncWriter();
+
+    {
+        std::lock_guard<std::mutex> lock(logMutex_);
+        if (logFile_.is_open()) {
+            if (droppedRecords_ > 0) {
+                logFile_ << "[SHUTDOWN] Dropped log records: " << droppedRecords_ << std::endl;
+            }
+            logFile_ << "[SHUTDOWN] Logger shutting down" << std::endl;
+            logFile_.close();
+        }
+    }
+
+    // Дожидаемся сдвига и сжатия уже ротированных файлов
+    stopRotationWorker();
+}
+
+void Logger::reserveBuffer(std::size_t capacity) {
+    if (buffer_ && buffer_->capacity() == LogRingBuffer<LogRecord>::roundUpToPowerOfTwo(capacity)) {
+        return;
+    }
+
+    // asyncActive_ уже сброшен, поэтому новые вызовы log() к буферу не обращаются;
+    // дожидаемся тех, кто вошел раньше, и дописываем оставленные ими записи
+    while (activeProducers_.load() > 0) {
+        std::this_thread::yield();
+    }
+    if (buffer_) {
+        drainBuffer();
+    }
+    buffer_ = std::make_unique<LogRingBuffer<LogRecord>>(capacity);
+}
+
+void Logger::startAsyncWriter() {
+    // Порог пробуждения не может превышать половину буфера, иначе при малой емкости поток ждал бы только таймаута
+    wakeThreshold_ = std::max<std::size_t>(1, std::min(options_.flushBatchSize, buffer_->capacity() / 2));
+    stopRequested_ = false;
+    asyncActive_ = true;
+    writerThread_ = std::thread(&Logger::writerLoop, this);
+}
+
+void Logger::stopAsyncWriter() {
+    if (!asyncActive_.exchange(false)) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(writerMutex_);
+        stopRequested_ = true;
+    }
+    writerCondition_.notify_all();
+
+    if (writerThread_.joinable()) {
+        writerThread_.join();
+    }
+
+    // Производитель мог проверить asyncActive_ до остановки и положить запись после последнего прохода потока
+    drainBuffer();
+}
+
+void Logger::drainBuffer() {
+    LogRecord record;
     std::lock_guard<std::mutex> lock(logMutex_);
-    if (logFile_.is_open()) {
-        logFile_ << "[SHUTDOWN] Logger shutting down" << std::endl;
-        logFile_.close();
+    bool written = false;
+    while (buffer_->tryPop(record)) {
+        if (logFile_.is_open()) {
+            logFile_ << record.text << '\n';
+            bytesWritten_ += record.text.size() + 1;
+            written = true;
+        }
+        if (record.level >= LogLevel::WARNING) {
+            std::cerr << record.text << '\n';
+        }
+    }
+    if (written) {
+        logFile_.flush();
+    }
+}
+
+void Logger::writerLoop() {
+    LogRecord record;
+    std::size_t unflushedBytes = 0;
+    auto lastFlush = std::chrono::steady_clock::now();
+
+    for (;;) {
+        // Флаг читаем до опустошения буфера: после остановки дописываем все, что успели положить
+        bool stopping = stopRequested_;
+        bool urgent = false;
+
+        if (buffer_->sizeApprox() > 0) {
+            std::lock_guard<std::mutex> lock(logMutex_);
+            // Пачка прерывается, как только файл достиг предела ротации
+            while (!rotationNeeded() && buffer_->tryPop(record)) {
+                if (logFile_.is_open()) {
+                    logFile_ << record.text << '\n';
+                    unflushedBytes += record.text.size() + 1;
+                    bytesWritten_ += record.text.size() + 1;
+                }
+                if (record.level >= LogLevel::WARNING) {
+                    std::cerr << record.text << '\n';
+                    urgent = urgent || record.level >= LogLevel::ERROR;
+                }
+            }
+        }
+
+        auto now = std::chrono::steady_clock::now();
+        if (unflushedBytes > 0 &&
+            (stopping || urgent || unflushedBytes >= options_.flushBytes || now - lastFlush >= options_.flushInterval)) {
+            std::lock_guard<std::mutex> lock(logMutex_);
+            if (logFile_.is_open()) {
+                logFile_.flush();
+            }
+            unflushedBytes = 0;
+            lastFlush = now;
+        }
+
+        // В асинхронном режиме ротацию выполняет только этот поток
+        if (rotationNeeded()) {
+            rotateLogFile();
+            unflushedBytes = 0;  // прежний поток сброшен при закрытии
+            continue;
+        }
+
+        if (stopping) {
+            break;
+        }
+
+        std::unique_lock<std::mutex> lock(writerMutex_);
+        writerCondition_.wait_for(lock, options_.flushInterval, [this]() {
+            return stopRequested_ || buffer_->sizeApprox() >= wakeThreshold_;
+        });
+    }
+}
+
+bool Logger::rotationNeeded() const {
+    return options_.maxFileSizeBytes > 0 && bytesWritten_ >= options_.maxFileSizeBytes;
+}
+
+void Logger::rotateLogFile() {
+    // Ротацию выполняет один поток; остальные продолжают писать в текущий файл
+    bool expected = false;
+    if (!rotating_.compare_exchange_strong(expected, true)) {
+        return;
+    }
+
+    // Открытый файл переименовывается атомарно: записи до подмены потока попадут в него же
+    std::string pendingPath = logFilePath_ + ".rotating." + std::to_string(++rotationSequence_);
+    if (std::rename(logFilePath_.c_str(), pendingPath.c_str()) != 0) {
+        std::cerr << "[LOGGER ERROR] Cannot rotate log file: " << logFilePath_ << std::endl;
+        bytesWritten_ = 0;  // не повторяем попытку на каждой записи
+        rotating_ = false;
+        return;
+    }
+
+    std::ofstream freshFile(logFilePath_, std::ios::app);
+    if (!freshFile.is_open()) {
+        std::rename(pendingPath.c_str(), logFilePath_.c_str());
+        std::cerr << "[LOGGER ERROR] Cannot open new log file: " << logFilePath_ << std::endl;
+        bytesWritten_ = 0;
+        rotating_ = false;
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(logMutex_);
+        logFile_.swap(freshFile);
+        bytesWritten_ = 0;
+    }
+    // Теперь freshFile - прежний поток: дописываем буфер и закрываем вне блокировки
+    freshFile.close();
+
+    {
+        std::lock_guard<std::mutex> lock(rotationMutex_);
+        pendingRotations_.push_back(pendingPath);
+    }
+    rotationCondition_.notify_one();
+
+    ++rotationCount_;
+    rotating_ = false;
+}
+
+void Logger::startRotationWorker() {
+    {
+        std::lock_guard<std::mutex> lock(rotationMutex_);
+        rotationStopRequested_ = false;
     }
+    rotationThread_ = std::thread(&Logger::rotationLoop, this);
+}
+
+void Logger::stopRotationWorker() {
+    {
+        std::lock_guard<std::mutex> lock(rotationMutex_);
+        rotationStopRequested_ = true;
+    }
+    rotationCondition_.notify_all();
+
+    if (rotationThread_.joinable()) {
+        rotationThread_.join();
+    }
+}
+
+void Logger::rotationLoop() {
+    for (;;) {
+        std::vector<std::string> batch;
+        bool stopping;
+        {
+            std::unique_lock<std::mutex> lock(rotationMutex_);
+            rotationCondition_.wait(lock, [this]() {
+                return rotationStopRequested_ || !pendingRotations_.empty();
+            });
+            batch.swap(pendingRotations_);
+            stopping = rotationStopRequested_;
+        }
+
+        for (const auto& pendingPath : batch) {
+            finalizeRotatedFile(pendingPath);
+        }
+
+        if (stopping) {
+            break;
+        }
+    }
+}
+
+void Logger::finalizeRotatedFile(const std::string& pendingPath) {
+#ifdef LOGGER_HAVE_ZLIB
+    const bool compress = options_.compressBackups;
+#else
+    const bool compress = false;
+#endif
+    const std::string suffix = compress ? ".gz" : "";
+    auto backupPath = [&](int index) {
+        return logFilePath_ + "." + std::to_string(index) + suffix;
+    };
+
+    if (options_.backupCount <= 0) {
+        std::remove(pendingPath.c_str());
+        return;
+    }
+
+    // Удаляем самую старую копию и сдвигаем остальные: .1 -> .2 -> ... -> .N
+    std::remove(backupPath(options_.backupCount).c_str());
+    for (int index = options_.backupCount - 1; index >= 1; --index) {
+        std::rename(backupPath(index).c_str(), backupPath(index + 1).c_str());
+    }
+
+    if (compress) {
+        // Сжимаем во временный файл, чтобы .1.gz появлялся целиком
+        std::string tempPath = backupPath(1) + ".tmp";
+        if (compressFile(pendingPath, tempPath) && std::rename(tempPath.c_str(), backupPath(1).c_str()) == 0) {
+            std::remove(pendingPath.c_str());
+            return;
+        }
+        std::remove(tempPath.c_str());
+        std::cerr << "[LOGGER ERROR] Cannot compress rotated log: " << pendingPath << std::endl;
+        std::rename(pendingPath.c_str(), (logFilePath_ + ".1").c_str());
+        return;
+    }
+
+    std::rename(pendingPath.c_str(), backupPath(1).c_str());
+}
+
+bool Logger::compressFile(const std::string& sourcePath, const std::string& targetPath) {
+#ifdef LOGGER_HAVE_ZLIB
+    std::ifstream source(sourcePath, std::ios::binary);
+    if (!source.is_open()) {
+        return false;
+    }
+
+    gzFile target = gzopen(targetPath.c_str(), "wb6");
+    if (!target) {
+        return false;
+    }
+
+    char buffer[64 * 1024];
+    bool ok = true;
+    while (ok && source) {
+        source.read(buffer, sizeof(buffer));
+        auto count = source.gcount();
+        if (count > 0 && gzwrite(target, buffer, static_cast<unsigned>(count)) != count) {
+            ok = false;
+        }
+    }
+    return gzclose(target) == Z_OK && ok;
+#else
+    (void)sourcePath;
+    (void)targetPath;
+    return false;
+#endif
 }
 
 std::string Logger::levelToString(LogLevel level) {
@@ -77,59 +397,143 @@ std::string Logger::levelToString(LogLevel level) {
 }
 
 std::string Logger::getCurrentTimestamp() {
-    try {
-        auto now = std::chrono::system_clock::now();
-        auto time_t = std::chrono::system_clock::to_time_t(now);
-        
-        
-        std::tm tm_buf;
-        std::tm* tm = std::localtime(&time_t);
-        if (!tm) {
-            return "0000-00-00 00:00:00.000";
-        }
-        tm_buf = *tm; // Копируем для безопасности
-        
-        auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(
-            now.time_since_epoch()) % 1000;
-        
-        std::ostringstream oss;
-        oss << std::put_time(&tm_buf, "%Y-%m-%d %H:%M:%S");
-        oss << "." << std::setfill('0') << std::setw(3) << ms.count();
-        
-        return oss.str();
-    } catch (const std::exception& e) {
-        
+    auto now = std::chrono::system_clock::now();
+    auto time_t = std::chrono::system_clock::to_time_t(now);
+
+    std::tm tm_buf;
+    if (!localtime_r(&time_t, &tm_buf)) {
         return "0000-00-00 00:00:00.000";
     }
+
+    auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+        now.time_since_epoch()) % 1000;
+
+    char buffer[80];
+    std::snprintf(buffer, sizeof(buffer), "%04d-%02d-%02d %02d:%02d:%02d.%03d",
+                  tm_buf.tm_year + 1900, tm_buf.tm_mon + 1, tm_buf.tm_mday,
+                  tm_buf.tm_hour, tm_buf.tm_min, tm_buf.tm_sec, static_cast<int>(ms.count()));
+    return buffer;
+}
+
+std::string Logger::formatRecord(LogLevel level, const std::string& message, const std::string& module) {
+    std::string entry;
+    entry.reserve(48 + module.size() + message.size());
+    entry += '[';
+    entry += getCurrentTimestamp();
+    entry += "] [";
+    entry += levelToString(level);
+    entry += "] ";
+    if (!module.empty()) {
+        entry += '[';
+        entry += module;
+        entry += "] ";
+    }
+    entry += message;
+    return entry;
 }
 
+// Отмечает поток, работающий с буфером асинхронной записи
+class ProducerScope {
+public:
+    explicit ProducerScope(std::atomic<int>& counter) : counter_(counter) { counter_.fetch_add(1); }
+    ~ProducerScope() { counter_.fetch_sub(1); }
+
+    ProducerScope(const ProducerScope&) = delete;
+    ProducerScope& operator=(const ProducerScope&) = delete;
+
+private:
+    std::atomic<int>& counter_;
+};
+
 void Logger::log(LogLevel level, const std::string& message, const std::string& module) {
     if (level < currentLevel_) return;
-    
-    std::lock_guard<std::mutex> lock(logMutex_);
-    
+
     try {
-        std::ostringstream logEntry;
-        logEntry << "[" << getCurrentTimestamp() << "] "
-                 << "[" << levelToString(level) << "] ";
-        
-        if (!module.empty()) {
-            logEntry << "[" << module << "] ";
-        }
-        
-        logEntry << message;
-        
-       
+        // Форматирование выполняется до захвата блокировки и до постановки в очередь
+        std::string entry = formatRecord(level, message, module);
+
+        // Счетчик увеличивается до проверки asyncActive_ и держится до выхода из enqueue
+        {
+            ProducerScope producer(activeProducers_);
+            if (asyncActive_) {
+                enqueue(level, std::move(entry));
+                return;
+            }
+        }
+        logSync(level, std::move(entry));
+    } catch (const std::exception& e) {
+        std::cerr << "[LOGGER ERROR] " << e.what() << std::endl;
+    }
+}
+
+void Logger::logSync(LogLevel level, std::string text) {
+    {
+        std::lock_guard<std::mutex> lock(logMutex_);
+
         if (logFile_.is_open()) {
-            logFile_ << logEntry.str() << std::endl;
-            logFile_.flush();
+            logFile_ << text << std::endl;
+            bytesWritten_ += text.size() + 1;
         }
-        
+
         if (level >= LogLevel::WARNING) {
-            std::cerr << logEntry.str() << std::endl;
+            std::cerr << text << std::endl;
         }
-    } catch (const std::exception& e) {
-        std::cerr << "[LOGGER ERROR] " << e.what() << std::endl;
+    }
+
+    if (rotationNeeded()) {
+        rotateLogFile();
+    }
+}
+
+void Logger::enqueue(LogLevel level, std::string text) {
+    LogRecord record{level, std::move(text)};
+
+    if (!buffer_->tryPush(record)) {
+        switch (options_.overflowPolicy) {
+            case LogOverflowPolicy::DropOldest: {
+                LogRecord discarded;
+                do {
+                    if (buffer_->tryPop(discarded)) {
+                        ++droppedRecords_;
+                    }
+                } while (!buffer_->tryPush(record));
+                break;
+            }
+            case LogOverflowPolicy::DropDebug:
+                if (level == LogLevel::DEBUG) {
+                    ++droppedRecords_;
+                    return;
+                }
+                // Остальные уровни ждут, как при Block
+                [[fallthrough]];
+            case LogOverflowPolicy::Block:
+            default:
+                ++blockedPushes_;
+                for (int attempt = 0; !buffer_->tryPush(record); ++attempt) {
+                    // Фоновый поток уже остановлен: пишем напрямую, чтобы не ждать бесконечно
+                    if (!asyncActive_) {
+                        logSync(level, std::move(record.text));
+                        return;
+                    }
+                    writerCondition_.notify_one();
+                    if (attempt < 16) {
+                        std::this_thread::yield();
+                    } else {
+                        std::this_thread::sleep_for(std::chrono::microseconds(50));
+                    }
+                }
+                break;
+        }
+    }
+
+    // Фоновый поток мог завершиться между проверкой asyncActive_ в log() и записью в буфер
+    if (!asyncActive_) {
+        drainBuffer();
+        return;
+    }
+
+    if (level >= LogLevel::ERROR || buffer_->sizeApprox() >= wakeThreshold_) {
+        writerCondition_.notify_one();
     }
 }
 
@@ -4,6 +4,15 @@
 #include <mutex>
 #include <memory>
 #include <iostream>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include <sstream>
+#include "LogRingBuffer.hpp"
 
 enum class LogLevel {
     DEBUG = 0,
@@ -12,33 +21,145 @@ enum class LogLevel {
     ERROR = 3
 };
 
+// Поведение асинхронного логгера при заполненном буфере
+enum class LogOverflowPolicy {
+    Block,      // ждать освобождения места
+    DropDebug,  // отбрасывать DEBUG, остальные записи ждут
+    DropOldest  // вытеснять самую старую запись
+};
+
+struct LoggerOptions {
+    bool async = false;
+    std::size_t bufferCapacity = 8192;
+    LogOverflowPolicy overflowPolicy = LogOverflowPolicy::DropDebug;
+    // Фоновый поток пробуждается при накоплении flushBatchSize записей или по истечении flushInterval
+    std::size_t flushBatchSize = 256;
+    std::chrono::milliseconds flushInterval{200};
+    // Объем записанных, но не сброшенных на диск данных, после которого выполняется flush
+    std::size_t flushBytes = 64 * 1024;
+
+    // Ротация по размеру: 0 - размер файла не ограничен
+    std::size_t maxFileSizeBytes = 0;
+    int backupCount = 5;
+    // Сжимать ротированные файлы в .gz (только при сборке с zlib)
+    bool compressBackups = false;
+
+    static LogOverflowPolicy parseOverflowPolicy(const std::string& value);
+};
+
 class Logger {
 private:
+    // Запись, полностью отформатированная в потоке-производителе
+    struct LogRecord {
+        LogLevel level = LogLevel::INFO;
+        std::string text;
+    };
+
     static std::unique_ptr<Logger> instance_;
     std::ofstream logFile_;
     std::mutex logMutex_;
-    LogLevel currentLevel_;
+    std::atomic<LogLevel> currentLevel_;
     std::string logFilePath_;
-    
+
+    // Асинхронный режим
+    LoggerOptions options_;
+    // Создается при первом запуске асинхронной записи и переиспользуется при повторной инициализации
+    std::unique_ptr<LogRingBuffer<LogRecord>> buffer_;
+    std::atomic<bool> asyncActive_{false};
+    // Потоки, которые могут обращаться к buffer_ (от проверки asyncActive_ до выхода из enqueue)
+    std::atomic<int> activeProducers_{0};
+    std::atomic<bool> stopRequested_{false};
+    std::thread writerThread_;
+    std::mutex writerMutex_;
+    std::condition_variable writerCondition_;
+    std::size_t wakeThreshold_ = 1;
+    std::atomic<std::uint64_t> droppedRecords_{0};
+    std::atomic<std::uint64_t> blockedPushes_{0};
+
+    // Ротация: размер считается по записанным байтам, без stat на каждую запись.
+    // Вызывающий поток только переименовывает файл и подменяет поток вывода,
+    // сдвиг резервных копий и сжатие выполняет фоновый поток.
+    std::atomic<std::size_t> bytesWritten_{0};
+    std::atomic<bool> rotating_{false};
+    std::uint64_t rotationSequence_ = 0;
+    std::thread rotationThread_;
+    std::mutex rotationMutex_;
+    std::condition_variable rotationCondition_;
+    std::vector<std::string> pendingRotations_;
+    bool rotationStopRequested_ = false;
+    std::atomic<std::uint64_t> rotationCount_{0};
+
     Logger();
     std::string levelToString(LogLevel level);
     std::string getCurrentTimestamp();
-    
+    std::string formatRecord(LogLevel level, const std::string& message, const std::string& module);
+
+    void logSync(LogLevel level, std::string text);
+    void enqueue(LogLevel level, std::string text);
+    void writerLoop();
+    // Синхронно дописывает записи, оставшиеся в буфере после остановки фонового потока
+    void drainBuffer();
+    // Создает буфер или, при смене емкости, заменяет его, когда к нему не обращается ни один производитель
+    void reserveBuffer(std::size_t capacity);
+    void startAsyncWriter();
+    void stopAsyncWriter();
+
+    bool rotationNeeded() const;
+    void rotateLogFile();
+    void startRotationWorker();
+    void stopRotationWorker();
+    void rotationLoop();
+    void finalizeRotatedFile(const std::string& pendingPath);
+    static bool compressFile(const std::string& sourcePath, const std::string& targetPath);
+
 public:
     ~Logger();
-    
+
     static Logger& getInstance();
-    void initialize(const std::string& filePath, LogLevel level);
+    void initialize(const std::string& filePath, LogLevel level, const LoggerOptions& options = LoggerOptions());
     void log(LogLevel level, const std::string& message, const std::string& module = "");
+    // Останавливает фоновый поток, дописав все накопленные записи
     void shutdown();
-    
+
     void debug(const std::string& message, const std::string& module = "");
     void info(const std::string& message, const std::string& module = "");
     void warning(const std::string& message, const std::string& module = "");
     void error(const std::string& message, const std::string& module = "");
     void error(const std::exception& e, const std::string& module = "");
-    
+
     LogLevel getLogLevel() const { return currentLevel_; }
+    // Смена уровня на лету (например, при перезагрузке конфигурации)
+    void setLogLevel(LogLevel level) { currentLevel_ = level; }
+    static LogLevel parseLevel(const std::string& value);  // DEBUG | INFO | WARNING | ERROR
+    bool isEnabled(LogLevel level) const { return level >= currentLevel_.load(std::memory_order_relaxed); }
     std::string getLogFilePath() const { return logFilePath_; }
     bool isInitialized() const { return logFile_.is_open(); }
-};
\ No newline at end of file
+    bool isAsync() const { return asyncActive_; }
+
+    // Счетчики асинхронного режима
+    std::uint64_t getDroppedRecords() const { return droppedRecords_; }
+    std::uint64_t getBlockedPushes() const { return blockedPushes_; }
+    std::uint64_t getRotationCount() const { return rotationCount_; }
+};
+
+// Минимальный уровень, компилируемый в программу: 0 - DEBUG, 1 - INFO, 2 - WARNING, 3 - ERROR.
+// Например, -DLOG_MIN_LEVEL=1 полностью удаляет LOG_DEBUG из сборки.
+#ifndef LOG_MIN_LEVEL
+#define LOG_MIN_LEVEL 0
+#endif
+
+// Выражение в потоковом синтаксисе вычисляется и форматируется только для включенного уровня:
+//   LOG_DEBUG("BookingService", "Найдено слотов: " << slots.size());
+#define LOG_AT(level, module, expression)                                                   \
+    do {                                                                                    \
+        if (static_cast<int>(level) >= LOG_MIN_LEVEL && Logger::getInstance().isEnabled(level)) { \
+            std::ostringstream logStream_;                                                  \
+            logStream_ << expression;                                                       \
+            Logger::getInstance().log(level, logStream_.str(), module);                     \
+        }                                                                                   \
+    } while (0)
+
+#define LOG_DEBUG(module, expression) LOG_AT(LogLevel::DEBUG, module, expression)
+#define LOG_INFO(module, expression) LOG_AT(LogLevel::INFO, module, expression)
+#define LOG_WARNING(module, expression) LOG_AT(LogLevel::WARNING, module, expression)
+#define LOG_ERROR(module, expression) LOG_AT(LogLevel::ERROR, module, expression)
@@ -0,0 +1,115 @@
+#include "CachingRepositoryFactory.hpp"
+#include "../core/Logger.hpp"
+
+static CachePolicy makePolicy(const RepositoryCacheSettings& settings, int ttlSeconds) {
+    CachePolicy policy;
+    policy.capacity = static_cast<std::size_t>(settings.capacity);
+    policy.shards = static_cast<std::size_t>(settings.shards);
+    policy.ttl = std::chrono::seconds(ttlSeconds);
+    policy.negativeTtl = std::chrono::seconds(settings.negativeTtlSeconds);
+    return policy;
+}
+
+CachePolicy CachingRepositoryFactory::clientPolicy(const RepositoryCacheSettings& settings) {
+    return makePolicy(settings, settings.clientTtlSeconds);
+}
+
+CachePolicy CachingRepositoryFactory::lessonPolicy(const RepositoryCacheSettings& settings) {
+    return makePolicy(settings, settings.lessonTtlSeconds);
+}
+
+CachingRepositoryFactory::CachingRepositoryFactory(std::shared_ptr<IRepositoryFactory> inner,
+                                                   const RepositoryCacheSettings& settings)
+    : inner_(std::move(inner)), settings_(settings) {
+    LOG_INFO("CachingRepositoryFactory", "🗃️ Кеш репозиториев включен: емкость " << settings_.capacity
+             << ", сегментов " << settings_.shards
+             << ", TTL клиентов " << settings_.clientTtlSeconds << " с, занятий " << settings_.lessonTtlSeconds << " с");
+}
+
+std::shared_ptr<IClientRepository> CachingRepositoryFactory::createClientRepository() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!clientRepository_) {
+        clientRepository_ = std::make_shared<CachingClientRepository>(
+            inner_->createClientRepository(), clientPolicy(settings_));
+    }
+    return clientRepository_;
+}
+
+std::shared_ptr<ILessonRepository> CachingRepositoryFactory::createLessonRepository() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!lessonRepository_) {
+        lessonRepository_ = std::make_shared<CachingLessonRepository>(
+            inner_->createLessonRepository(), lessonPolicy(settings_));
+    }
+    return lessonRepository_;
+}
+
+std::shared_ptr<IDanceHallRepository> CachingRepositoryFactory::createDanceHallRepository() {
+    return inner_->createDanceHallRepository();
+}
+
+std::shared_ptr<IBookingRepository> CachingRepositoryFactory::createBookingRepository() {
+    return inner_->createBookingRepository();
+}
+
+std::shared_ptr<ITrainerRepository> CachingRepositoryFactory::createTrainerRepository() {
+    return inner_->createTrainerRepository();
+}
+
+std::shared_ptr<IEnrollmentRepository> CachingRepositoryFactory::createEnrollmentRepository() {
+    return inner_->createEnrollmentRepository();
+}
+
+std::shared_ptr<ISubscriptionRepository> CachingRepositoryFactory::createSubscriptionRepository() {
+    return inner_->createSubscriptionRepository();
+}
+
+std::shared_ptr<ISubscriptionTypeRepository> CachingRepositoryFactory::createSubscriptionTypeRepository() {
+    return inner_->createSubscriptionTypeRepository();
+}
+
+std::shared_ptr<IReviewRepository> CachingRepositoryFactory::createReviewRepository() {
+    return inner_->createReviewRepository();
+}
+
+std::shared_ptr<IBranchRepository> CachingRepositoryFactory::createBranchRepository() {
+    return inner_->createBranchRepository();
+}
+
+std::shared_ptr<IStudioRepository> CachingRepositoryFactory::createStudioRepository() {
+    return inner_->createStudioRepository();
+}
+
+std::shared_ptr<IAttendanceRepository> CachingRepositoryFactory::createAttendanceRepository() {
+    return inner_->createAttendanceRepository();
+}
+
+std::shared_ptr<IMonthlyRollupRepository> CachingRepositoryFactory::createMonthlyRollupRepository() {
+    return inner_->createMonthlyRollupRepository();
+}
+
+bool CachingRepositoryFactory::testConnection() const {
+    return inner_->testConnection();
+}
+
+void CachingRepositoryFactory::reconnect() {
+    inner_->reconnect();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (clientRepository_) {
+        clientRepository_->clearCache();
+    }
+    if (lessonRepository_) {
+        lessonRepository_->clearCache();
+    }
+}
+
+CacheStats CachingRepositoryFactory::getClientCacheStats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return clientRepository_ ? clientRepository_->getCacheStats() : CacheStats{};
+}
+
+CacheStats CachingRepositoryFactory::getLessonCacheStats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return lessonRepository_ ? lessonRepository_->getCacheStats() : CacheStats{};
+}
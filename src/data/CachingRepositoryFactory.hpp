@@ -0,0 +1,55 @@
+#ifndef CACHING_REPOSITORY_FACTORY_HPP
+#define CACHING_REPOSITORY_FACTORY_HPP
+
+#include "IRepositoryFactory.hpp"
+#include "ShardedLruCache.hpp"
+#include "../core/Config.hpp"
+#include "../repositories/impl/CachingRepositories.hpp"
+#include <memory>
+#include <mutex>
+
+// Фабрика-декоратор: репозитории клиентов и занятий оборачиваются в CachingRepository,
+// остальные создаются исходной фабрикой. Кеширующий репозиторий создается один раз
+// и возвращается при каждом вызове, чтобы все записи процесса сбрасывали один кеш.
+class CachingRepositoryFactory : public IRepositoryFactory {
+public:
+    CachingRepositoryFactory(std::shared_ptr<IRepositoryFactory> inner, const RepositoryCacheSettings& settings);
+
+    CachingRepositoryFactory(const CachingRepositoryFactory&) = delete;
+    CachingRepositoryFactory& operator=(const CachingRepositoryFactory&) = delete;
+
+    std::shared_ptr<IClientRepository> createClientRepository() override;
+    std::shared_ptr<IDanceHallRepository> createDanceHallRepository() override;
+    std::shared_ptr<IBookingRepository> createBookingRepository() override;
+    std::shared_ptr<ILessonRepository> createLessonRepository() override;
+    std::shared_ptr<ITrainerRepository> createTrainerRepository() override;
+    std::shared_ptr<IEnrollmentRepository> createEnrollmentRepository() override;
+    std::shared_ptr<ISubscriptionRepository> createSubscriptionRepository() override;
+    std::shared_ptr<ISubscriptionTypeRepository> createSubscriptionTypeRepository() override;
+    std::shared_ptr<IReviewRepository> createReviewRepository() override;
+    std::shared_ptr<IBranchRepository> createBranchRepository() override;
+    std::shared_ptr<IStudioRepository> createStudioRepository() override;
+    std::shared_ptr<IAttendanceRepository> createAttendanceRepository() override;
+    std::shared_ptr<IMonthlyRollupRepository> createMonthlyRollupRepository() override;
+
+    bool testConnection() const override;
+    // После переподключения кеши очищаются
+    void reconnect() override;
+
+    // Нулевые значения, если соответствующий репозиторий еще не создавался
+    CacheStats getClientCacheStats() const;
+    CacheStats getLessonCacheStats() const;
+
+    static CachePolicy clientPolicy(const RepositoryCacheSettings& settings);
+    static CachePolicy lessonPolicy(const RepositoryCacheSettings& settings);
+
+private:
+    std::shared_ptr<IRepositoryFactory> inner_;
+    RepositoryCacheSettings settings_;
+
+    mutable std::mutex mutex_;
+    std::shared_ptr<CachingClientRepository> clientRepository_;
+    std::shared_ptr<CachingLessonRepository> lessonRepository_;
+};
+
+#endif // CACHING_REPOSITORY_FACTORY_HPP
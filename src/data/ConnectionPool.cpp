@@ -0,0 +1,266 @@
+#include "ConnectionPool.hpp"
+#include "exceptions/DataAccessException.hpp"
+#include "../core/Config.hpp"
+#include <algorithm>
+#include <iterator>
+
+ConnectionPoolOptions ConnectionPoolOptions::fromConfig(const Config& config) {
+    ConnectionPoolOptions options;
+    options.maxConnections = static_cast<std::size_t>(std::max(1, config.getPostgresMaxConnections()));
+    options.acquireTimeout = std::chrono::seconds(std::max(1, config.getPostgresConnectionTimeoutSeconds()));
+    return options;
+}
+
+// ===== PooledConnection =====
+
+PooledConnection::PooledConnection(std::shared_ptr<ConnectionPool> pool,
+                                   std::unique_ptr<pqxx::connection> connection,
+                                   std::unordered_set<std::string> preparedStatements,
+                                   std::chrono::steady_clock::duration idleTime,
+                                   bool readOnlySession)
+    : pool_(std::move(pool)),
+      connection_(std::move(connection)),
+      preparedStatements_(std::move(preparedStatements)),
+      idleTime_(idleTime),
+      readOnlySession_(readOnlySession) {}
+
+PooledConnection::~PooledConnection() {
+    release();
+}
+
+PooledConnection::PooledConnection(PooledConnection&& other) noexcept
+    : pool_(std::move(other.pool_)),
+      connection_(std::move(other.connection_)),
+      preparedStatements_(std::move(other.preparedStatements_)),
+      idleTime_(other.idleTime_),
+      readOnlySession_(other.readOnlySession_),
+      broken_(other.broken_) {}
+
+PooledConnection& PooledConnection::operator=(PooledConnection&& other) noexcept {
+    if (this != &other) {
+        release();
+        pool_ = std::move(other.pool_);
+        connection_ = std::move(other.connection_);
+        preparedStatements_ = std::move(other.preparedStatements_);
+        idleTime_ = other.idleTime_;
+        readOnlySession_ = other.readOnlySession_;
+        broken_ = other.broken_;
+    }
+    return *this;
+}
+
+void PooledConnection::release() {
+    if (pool_ && connection_) {
+        pool_->release(std::move(connection_), std::move(preparedStatements_), readOnlySession_, broken_);
+    }
+    pool_.reset();
+    connection_.reset();
+    preparedStatements_.clear();
+    readOnlySession_ = false;
+    broken_ = false;
+}
+
+// ===== ConnectionPool =====
+
+ConnectionPool::ConnectionPool(const std::string& connectionString, const ConnectionPoolOptions& options)
+    : connectionString_(connectionString), options_(options) {
+    if (options_.maxConnections == 0) {
+        options_.maxConnections = 1;
+    }
+    options_.minIdleConnections = std::min(options_.minIdleConnections, options_.maxConnections);
+}
+
+ConnectionPool::~ConnectionPool() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto& idle : idle_) {
+        if (idle.connection && idle.connection->is_open()) {
+            idle.connection->close();
+        }
+    }
+    idle_.clear();
+}
+
+void ConnectionPool::warmUp() {
+    std::vector<std::unique_ptr<pqxx::connection>> created;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (totalConnections_ >= options_.minIdleConnections) {
+            return;
+        }
+    }
+
+    for (std::size_t i = 0; i < options_.minIdleConnections; ++i) {
+        created.push_back(openConnection());
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto now = std::chrono::steady_clock::now();
+    for (auto& connection : created) {
+        if (totalConnections_ >= options_.maxConnections) {
+            break;
+        }
+        idle_.push_back({std::move(connection), {}, now});
+        totalConnections_++;
+        stats_.createdCount++;
+    }
+    available_.notify_all();
+}
+
+std::unique_ptr<pqxx::connection> ConnectionPool::openConnection() {
+    try {
+        auto connection = std::make_unique<pqxx::connection>(connectionString_);
+        if (!connection->is_open()) {
+            throw std::runtime_error("Failed to connect to database");
+        }
+        return connection;
+    } catch (const std::exception& e) {
+        throw ConnectionException(std::string("Database connection failed: ") + e.what());
+    }
+}
+
+PooledConnection ConnectionPool::acquire() {
+    auto waitStart = std::chrono::steady_clock::now();
+    auto deadline = waitStart + options_.acquireTimeout;
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    const std::uint64_t ticket = nextTicket_++;
+    waitQueue_.push_back(ticket);
+
+    // Очередь FIFO: обслуживается только тот, чей билет первый
+    bool ready = available_.wait_until(lock, deadline, [this, ticket]() {
+        return waitQueue_.front() == ticket &&
+               (!idle_.empty() || totalConnections_ < options_.maxConnections);
+    });
+
+    if (!ready) {
+        waitQueue_.erase(std::find(waitQueue_.begin(), waitQueue_.end(), ticket));
+        stats_.timeoutCount++;
+        available_.notify_all();
+        throw ConnectionPoolTimeoutException("Timed out waiting for a database connection (pool size " +
+                                  std::to_string(options_.maxConnections) + ")");
+    }
+
+    waitQueue_.pop_front();
+
+    auto waited = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - waitStart);
+    stats_.acquiredCount++;
+    stats_.totalWaitTime += waited;
+    stats_.maxWaitTime = std::max(stats_.maxWaitTime, waited);
+
+    std::unique_ptr<pqxx::connection> connection;
+    std::unordered_set<std::string> preparedStatements;
+    std::chrono::steady_clock::duration idleTime{};
+    bool readOnlySession = false;
+    if (!idle_.empty()) {
+        // Берем самое "теплое" соединение, старые остаются в начале для reaper'а
+        connection = std::move(idle_.back().connection);
+        preparedStatements = std::move(idle_.back().preparedStatements);
+        idleTime = std::chrono::steady_clock::now() - idle_.back().idleSince;
+        readOnlySession = idle_.back().readOnlySession;
+        idle_.pop_back();
+    } else {
+        totalConnections_++;
+    }
+
+    // Следующий в очереди может продолжить, пока мы открываем соединение
+    available_.notify_all();
+    lock.unlock();
+
+    if (connection && connection->is_open()) {
+        return PooledConnection(shared_from_this(), std::move(connection),
+                                std::move(preparedStatements), idleTime, readOnlySession);
+    }
+
+    if (connection) {
+        // Соединение из пула оказалось закрытым сервером - заменяем его новым
+        lock.lock();
+        stats_.brokenCount++;
+        lock.unlock();
+        connection.reset();
+    }
+
+    try {
+        connection = openConnection();
+    } catch (...) {
+        lock.lock();
+        totalConnections_--;
+        available_.notify_all();
+        throw;
+    }
+
+    lock.lock();
+    stats_.createdCount++;
+    lock.unlock();
+
+    return PooledConnection(shared_from_this(), std::move(connection));
+}
+
+void ConnectionPool::release(std::unique_ptr<pqxx::connection> connection,
+                             std::unordered_set<std::string> preparedStatements, bool readOnlySession,
+                             bool broken) {
+    std::vector<std::unique_ptr<pqxx::connection>> toClose;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto now = std::chrono::steady_clock::now();
+
+        if (broken || !connection->is_open()) {
+            totalConnections_--;
+            stats_.brokenCount++;
+            toClose.push_back(std::move(connection));
+        } else {
+            idle_.push_back({std::move(connection), std::move(preparedStatements), now, readOnlySession});
+        }
+
+        auto expired = collectExpiredLocked(now);
+        std::move(expired.begin(), expired.end(), std::back_inserter(toClose));
+        available_.notify_all();
+    }
+    // Закрытие соединений выполняется вне блокировки
+    toClose.clear();
+}
+
+std::vector<std::unique_ptr<pqxx::connection>> ConnectionPool::collectExpiredLocked(
+    std::chrono::steady_clock::time_point now) {
+    std::vector<std::unique_ptr<pqxx::connection>> expired;
+
+    // idle_ упорядочен по времени возврата: самые старые в начале
+    auto it = idle_.begin();
+    while (it != idle_.end() && idle_.size() > options_.minIdleConnections) {
+        if (now - it->idleSince < options_.idleTimeout) {
+            break;
+        }
+        expired.push_back(std::move(it->connection));
+        it = idle_.erase(it);
+        totalConnections_--;
+        stats_.reapedCount++;
+    }
+    return expired;
+}
+
+std::size_t ConnectionPool::reapIdleConnections() {
+    std::vector<std::unique_ptr<pqxx::connection>> expired;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        expired = collectExpiredLocked(std::chrono::steady_clock::now());
+        if (!expired.empty()) {
+            available_.notify_all();
+        }
+    }
+    return expired.size();
+}
+
+ConnectionPoolStats ConnectionPool::getStats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ConnectionPoolStats stats = stats_;
+    stats.totalConnections = totalConnections_;
+    stats.idleConnections = idle_.size();
+    stats.inUseConnections = totalConnections_ - idle_.size();
+    stats.waitingRequests = waitQueue_.size();
+    return stats;
+}
+
+bool ConnectionPool::hasOpenConnections() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return totalConnections_ > 0;
+}
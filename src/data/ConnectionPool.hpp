@@ -0,0 +1,138 @@
+#ifndef CONNECTIONPOOL_HPP
+#define CONNECTIONPOOL_HPP
+
+#include <pqxx/pqxx>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+class Config;
+class ConnectionPool;
+
+struct ConnectionPoolOptions {
+    std::size_t maxConnections = 10;
+    std::size_t minIdleConnections = 1;
+    std::chrono::milliseconds acquireTimeout = std::chrono::seconds(30);
+    std::chrono::milliseconds idleTimeout = std::chrono::minutes(5);
+
+    // database.postgres.max_connections / database.postgres.connection_timeout_seconds
+    static ConnectionPoolOptions fromConfig(const Config& config);
+};
+
+struct ConnectionPoolStats {
+    std::size_t totalConnections = 0;
+    std::size_t idleConnections = 0;
+    std::size_t inUseConnections = 0;
+    std::size_t waitingRequests = 0;
+    std::uint64_t acquiredCount = 0;
+    std::uint64_t createdCount = 0;
+    std::uint64_t reapedCount = 0;
+    std::uint64_t brokenCount = 0;
+    std::uint64_t timeoutCount = 0;
+    std::chrono::microseconds totalWaitTime{0};
+    std::chrono::microseconds maxWaitTime{0};
+};
+
+// RAII-аренда соединения: при разрушении соединение возвращается в пул
+class PooledConnection {
+public:
+    PooledConnection() = default;
+    PooledConnection(std::shared_ptr<ConnectionPool> pool, std::unique_ptr<pqxx::connection> connection,
+                     std::unordered_set<std::string> preparedStatements = {},
+                     std::chrono::steady_clock::duration idleTime = {},
+                     bool readOnlySession = false);
+    ~PooledConnection();
+
+    PooledConnection(PooledConnection&& other) noexcept;
+    PooledConnection& operator=(PooledConnection&& other) noexcept;
+
+    PooledConnection(const PooledConnection&) = delete;
+    PooledConnection& operator=(const PooledConnection&) = delete;
+
+    pqxx::connection& operator*() const { return *connection_; }
+    pqxx::connection* operator->() const { return connection_.get(); }
+    pqxx::connection& get() const { return *connection_; }
+    explicit operator bool() const { return connection_ != nullptr; }
+
+    // Соединение будет закрыто вместо возврата в пул
+    void markBroken() { broken_ = true; }
+
+    // Именованные запросы, уже подготовленные на этом соединении
+    bool isPrepared(const std::string& name) const { return preparedStatements_.count(name) > 0; }
+    void markPrepared(const std::string& name) { preparedStatements_.insert(name); }
+
+    // Установлен ли на сессии default_transaction_read_only = on
+    bool isReadOnlySession() const { return readOnlySession_; }
+    void setReadOnlySession(bool readOnly) { readOnlySession_ = readOnly; }
+
+    // Сколько соединение простаивало в пуле до выдачи (0 для только что открытого)
+    std::chrono::steady_clock::duration idleTime() const { return idleTime_; }
+
+private:
+    std::shared_ptr<ConnectionPool> pool_;
+    std::unique_ptr<pqxx::connection> connection_;
+    std::unordered_set<std::string> preparedStatements_;
+    std::chrono::steady_clock::duration idleTime_{};
+    bool readOnlySession_ = false;
+    bool broken_ = false;
+
+    void release();
+};
+
+class ConnectionPool : public std::enable_shared_from_this<ConnectionPool> {
+public:
+    ConnectionPool(const std::string& connectionString, const ConnectionPoolOptions& options);
+    ~ConnectionPool();
+
+    ConnectionPool(const ConnectionPool&) = delete;
+    ConnectionPool& operator=(const ConnectionPool&) = delete;
+
+    // Создает minIdleConnections соединений заранее; бросает ConnectionException при неудаче
+    void warmUp();
+
+    // Ожидает свободное соединение в порядке очереди не дольше acquireTimeout,
+    // иначе бросает ConnectionPoolTimeoutException
+    PooledConnection acquire();
+
+    // Закрывает соединения, простаивающие дольше idleTimeout (сверх minIdleConnections)
+    std::size_t reapIdleConnections();
+
+    ConnectionPoolStats getStats() const;
+    const ConnectionPoolOptions& getOptions() const { return options_; }
+    bool hasOpenConnections() const;
+
+private:
+    friend class PooledConnection;
+
+    struct IdleConnection {
+        std::unique_ptr<pqxx::connection> connection;
+        std::unordered_set<std::string> preparedStatements;
+        std::chrono::steady_clock::time_point idleSince;
+        bool readOnlySession = false;
+    };
+
+    std::string connectionString_;
+    ConnectionPoolOptions options_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable available_;
+    std::vector<IdleConnection> idle_;
+    std::deque<std::uint64_t> waitQueue_;
+    std::uint64_t nextTicket_ = 0;
+    std::size_t totalConnections_ = 0;
+    ConnectionPoolStats stats_;
+
+    std::unique_ptr<pqxx::connection> openConnection();
+    void release(std::unique_ptr<pqxx::connection> connection,
+                 std::unordered_set<std::string> preparedStatements, bool readOnlySession, bool broken);
+    std::vector<std::unique_ptr<pqxx::connection>> collectExpiredLocked(
+        std::chrono::steady_clock::time_point now);
+};
+
+#endif // CONNECTIONPOOL_HPP
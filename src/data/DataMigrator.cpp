@@ -1,6 +1,18 @@
 #include "DataMigrator.hpp"
 #include "../core/Logger.hpp"
 #include <iostream>
+#include <vector>
+
+// Идентификаторы коллекции для пакетной проверки existsMany
+template <typename Entity, typename Getter>
+static std::vector<UUID> collectIds(const std::vector<Entity>& entities, Getter getter) {
+    std::vector<UUID> ids;
+    ids.reserve(entities.size());
+    for (const auto& entity : entities) {
+        ids.push_back((entity.*getter)());
+    }
+    return ids;
+}
 
 DataMigrator::DataMigrator(std::shared_ptr<IRepositoryFactory> sourceFactory, 
                          std::shared_ptr<IRepositoryFactory> targetFactory, 
@@ -53,13 +65,17 @@ bool DataMigrator::migrateStudios() {
         auto targetRepo = targetFactory_->createStudioRepository();
         
         auto studios = sourceRepo->findAll();
+
+        // Существование проверяем одним запросом на коллекцию, а не на каждую запись
+        auto existingIds = targetRepo->existsMany(collectIds(studios, &Studio::getId));
+
         int migratedCount = 0;
         int updatedCount = 0;
         int skippedCount = 0;
         
         for (const auto& studio : studios) {
             // Проверяем, существует ли уже студия в целевой БД
-            bool exists = targetRepo->exists(studio.getId());
+            bool exists = existingIds.count(studio.getId()) > 0;
             
             if (exists) {
                 if (migrationStrategy_ == "overwrite") {
@@ -104,20 +120,24 @@ bool DataMigrator::migrateBranches() {
         auto targetRepo = targetFactory_->createBranchRepository();
         
         auto branches = sourceRepo->findAll();
+
+        // Существование проверяем одним запросом на коллекцию, а не на каждую запись
+        auto existingIds = targetRepo->existsMany(collectIds(branches, &Branch::getId));
+        auto studioIds = targetFactory_->createStudioRepository()->existsMany(collectIds(branches, &Branch::getStudioId));
+
         int migratedCount = 0;
         int updatedCount = 0;
         int skippedCount = 0;
         
         for (const auto& branch : branches) {
             // Проверяем существование студии в целевой БД
-            auto studioRepo = targetFactory_->createStudioRepository();
-            if (!studioRepo->exists(branch.getStudioId())) {
+            if (studioIds.count(branch.getStudioId()) == 0) {
                 std::cerr << "❌ Referenced studio not found: " << branch.getStudioId().toString() 
                          << " for branch: " << branch.getName() << std::endl;
                 return false;
             }
             
-            bool exists = targetRepo->exists(branch.getId());
+            bool exists = existingIds.count(branch.getId()) > 0;
             
             if (exists) {
                 if (migrationStrategy_ == "overwrite") {
@@ -159,20 +179,24 @@ bool DataMigrator::migrateDanceHalls() {
         auto targetRepo = targetFactory_->createDanceHallRepository();
         
         auto halls = sourceRepo->findAll();
+
+        // Существование проверяем одним запросом на коллекцию, а не на каждую запись
+        auto existingIds = targetRepo->existsMany(collectIds(halls, &DanceHall::getId));
+        auto branchIds = targetFactory_->createBranchRepository()->existsMany(collectIds(halls, &DanceHall::getBranchId));
+
         int migratedCount = 0;
         int updatedCount = 0;
         int skippedCount = 0;
         
         for (const auto& hall : halls) {
             // Проверяем существование филиала
-            auto branchRepo = targetFactory_->createBranchRepository();
-            if (!branchRepo->exists(hall.getBranchId())) {
+            if (branchIds.count(hall.getBranchId()) == 0) {
                 std::cerr << "❌ Referenced branch not found: " << hall.getBranchId().toString() 
                          << " for hall: " << hall.getName() << std::endl;
                 return false;
             }
             
-            bool exists = targetRepo->exists(hall.getId());
+            bool exists = existingIds.count(hall.getId()) > 0;
             
             if (exists) {
                 if (migrationStrategy_ == "overwrite") {
@@ -214,12 +238,16 @@ bool DataMigrator::migrateTrainers() {
         auto targetRepo = targetFactory_->createTrainerRepository();
         
         auto trainers = sourceRepo->findAll();
+
+        // Существование проверяем одним запросом на коллекцию, а не на каждую запись
+        auto existingIds = targetRepo->existsMany(collectIds(trainers, &Trainer::getId));
+
         int migratedCount = 0;
         int updatedCount = 0;
         int skippedCount = 0;
         
         for (const auto& trainer : trainers) {
-            bool exists = targetRepo->exists(trainer.getId());
+            bool exists = existingIds.count(trainer.getId()) > 0;
             
             if (exists) {
                 if (migrationStrategy_ == "overwrite") {
@@ -262,6 +290,10 @@ bool DataMigrator::migrateClients() {
         auto targetRepo = targetFactory_->createClientRepository();
         
         auto clients = sourceRepo->findAll();
+
+        // Существование проверяем одним запросом на коллекцию, а не на каждую запись
+        auto existingIds = targetRepo->existsMany(collectIds(clients, &Client::getId));
+
         int migratedCount = 0;
         int updatedCount = 0;
         int skippedCount = 0;
@@ -275,7 +307,7 @@ bool DataMigrator::migrateClients() {
                 std::string conflictReason;
                 
                 // Проверяем существование по ID
-                bool existsById = targetRepo->exists(client.getId());
+                bool existsById = existingIds.count(client.getId()) > 0;
                 
                 // Проверяем существование по email (уникальное поле)
                 bool existsByEmail = false;
@@ -368,12 +400,16 @@ bool DataMigrator::migrateSubscriptionTypes() {
         auto targetRepo = targetFactory_->createSubscriptionTypeRepository();
         
         auto subscriptionTypes = sourceRepo->findAll();
+
+        // Существование проверяем одним запросом на коллекцию, а не на каждую запись
+        auto existingIds = targetRepo->existsMany(collectIds(subscriptionTypes, &SubscriptionType::getId));
+
         int migratedCount = 0;
         int updatedCount = 0;
         int skippedCount = 0;
         
         for (const auto& subscriptionType : subscriptionTypes) {
-            bool exists = targetRepo->exists(subscriptionType.getId());
+            bool exists = existingIds.count(subscriptionType.getId()) > 0;
             
             if (exists) {
                 if (migrationStrategy_ == "overwrite") {
@@ -415,28 +451,31 @@ bool DataMigrator::migrateSubscriptions() {
         auto targetRepo = targetFactory_->createSubscriptionRepository();
         
         auto subscriptions = sourceRepo->findAll();
+
+        // Существование проверяем одним запросом на коллекцию, а не на каждую запись
+        auto existingIds = targetRepo->existsMany(collectIds(subscriptions, &Subscription::getId));
+        auto clientIds = targetFactory_->createClientRepository()->existsMany(collectIds(subscriptions, &Subscription::getClientId));
+        auto typeIds = targetFactory_->createSubscriptionTypeRepository()->existsMany(collectIds(subscriptions, &Subscription::getSubscriptionTypeId));
+
         int migratedCount = 0;
         int updatedCount = 0;
         int skippedCount = 0;
         
         for (const auto& subscription : subscriptions) {
             // Проверяем существование клиента и типа подписки
-            auto clientRepo = targetFactory_->createClientRepository();
-            auto typeRepo = targetFactory_->createSubscriptionTypeRepository();
-            
-            if (!clientRepo->exists(subscription.getClientId())) {
+            if (clientIds.count(subscription.getClientId()) == 0) {
                 std::cerr << "❌ Referenced client not found: " << subscription.getClientId().toString() 
                          << " for subscription" << std::endl;
                 return false;
             }
             
-            if (!typeRepo->exists(subscription.getSubscriptionTypeId())) {
+            if (typeIds.count(subscription.getSubscriptionTypeId()) == 0) {
                 std::cerr << "❌ Referenced subscription type not found: " 
                          << subscription.getSubscriptionTypeId().toString() << " for subscription" << std::endl;
                 return false;
             }
             
-            bool exists = targetRepo->exists(subscription.getId());
+            bool exists = existingIds.count(subscription.getId()) > 0;
             
             if (exists) {
                 if (migrationStrategy_ == "overwrite") {
@@ -478,28 +517,31 @@ bool DataMigrator::migrateLessons() {
         auto targetRepo = targetFactory_->createLessonRepository();
         
         auto lessons = sourceRepo->findAll();
+
+        // Существование проверяем одним запросом на коллекцию, а не на каждую запись
+        auto existingIds = targetRepo->existsMany(collectIds(lessons, &Lesson::getId));
+        auto trainerIds = targetFactory_->createTrainerRepository()->existsMany(collectIds(lessons, &Lesson::getTrainerId));
+        auto hallIds = targetFactory_->createDanceHallRepository()->existsMany(collectIds(lessons, &Lesson::getHallId));
+
         int migratedCount = 0;
         int updatedCount = 0;
         int skippedCount = 0;
         
         for (const auto& lesson : lessons) {
             // Проверяем существование тренера и зала
-            auto trainerRepo = targetFactory_->createTrainerRepository();
-            auto hallRepo = targetFactory_->createDanceHallRepository();
-            
-            if (!trainerRepo->exists(lesson.getTrainerId())) {
+            if (trainerIds.count(lesson.getTrainerId()) == 0) {
                 std::cerr << "❌ Referenced trainer not found: " << lesson.getTrainerId().toString() 
                          << " for lesson: " << lesson.getName() << std::endl;
                 return false;
             }
             
-            if (!hallRepo->exists(lesson.getHallId())) {
+            if (hallIds.count(lesson.getHallId()) == 0) {
                 std::cerr << "❌ Referenced hall not found: " << lesson.getHallId().toString() 
                          << " for lesson: " << lesson.getName() << std::endl;
                 return false;
             }
             
-            bool exists = targetRepo->exists(lesson.getId());
+            bool exists = existingIds.count(lesson.getId()) > 0;
             
             if (exists) {
                 if (migrationStrategy_ == "overwrite") {
@@ -541,28 +583,31 @@ bool DataMigrator::migrateEnrollments() {
         auto targetRepo = targetFactory_->createEnrollmentRepository();
         
         auto enrollments = sourceRepo->findAll();
+
+        // Существование проверяем одним запросом на коллекцию, а не на каждую запись
+        auto existingIds = targetRepo->existsMany(collectIds(enrollments, &Enrollment::getId));
+        auto clientIds = targetFactory_->createClientRepository()->existsMany(collectIds(enrollments, &Enrollment::getClientId));
+        auto lessonIds = targetFactory_->createLessonRepository()->existsMany(collectIds(enrollments, &Enrollment::getLessonId));
+
         int migratedCount = 0;
         int updatedCount = 0;
         int skippedCount = 0;
         
         for (const auto& enrollment : enrollments) {
             // Проверяем существование клиента и занятия
-            auto clientRepo = targetFactory_->createClientRepository();
-            auto lessonRepo = targetFactory_->createLessonRepository();
-            
-            if (!clientRepo->exists(enrollment.getClientId())) {
+            if (clientIds.count(enrollment.getClientId()) == 0) {
                 std::cerr << "❌ Referenced client not found: " << enrollment.getClientId().toString() 
                          << " for enrollment" << std::endl;
                 return false;
             }
             
-            if (!lessonRepo->exists(enrollment.getLessonId())) {
+            if (lessonIds.count(enrollment.getLessonId()) == 0) {
                 std::cerr << "❌ Referenced lesson not found: " << enrollment.getLessonId().toString() 
                          << " for enrollment" << std::endl;
                 return false;
             }
             
-            bool exists = targetRepo->exists(enrollment.getId());
+            bool exists = existingIds.count(enrollment.getId()) > 0;
             
             if (exists) {
                 if (migrationStrategy_ == "overwrite") {
@@ -604,28 +649,31 @@ bool DataMigrator::migrateBookings() {
         auto targetRepo = targetFactory_->createBookingRepository();
         
         auto bookings = sourceRepo->findAll();
+
+        // Существование проверяем одним запросом на коллекцию, а не на каждую запись
+        auto existingIds = targetRepo->existsMany(collectIds(bookings, &Booking::getId));
+        auto clientIds = targetFactory_->createClientRepository()->existsMany(collectIds(bookings, &Booking::getClientId));
+        auto hallIds = targetFactory_->createDanceHallRepository()->existsMany(collectIds(bookings, &Booking::getHallId));
+
         int migratedCount = 0;
         int updatedCount = 0;
         int skippedCount = 0;
         
         for (const auto& booking : bookings) {
             // Проверяем существование клиента и зала
-            auto clientRepo = targetFactory_->createClientRepository();
-            auto hallRepo = targetFactory_->createDanceHallRepository();
-            
-            if (!clientRepo->exists(booking.getClientId())) {
+            if (clientIds.count(booking.getClientId()) == 0) {
                 std::cerr << "❌ Referenced client not found: " << booking.getClientId().toString() 
                          << " for booking" << std::endl;
                 return false;
             }
             
-            if (!hallRepo->exists(booking.getHallId())) {
+            if (hallIds.count(booking.getHallId()) == 0) {
                 std::cerr << "❌ Referenced hall not found: " << booking.getHallId().toString() 
                          << " for booking" << std::endl;
                 return false;
             }
             
-            bool exists = targetRepo->exists(booking.getId());
+            bool exists = existingIds.count(booking.getId()) > 0;
             
             if (exists) {
                 if (migrationStrategy_ == "overwrite") {
@@ -667,28 +715,31 @@ bool DataMigrator::migrateReviews() {
         auto targetRepo = targetFactory_->createReviewRepository();
         
         auto reviews = sourceRepo->findAll();
+
+        // Существование проверяем одним запросом на коллекцию, а не на каждую запись
+        auto existingIds = targetRepo->existsMany(collectIds(reviews, &Review::getId));
+        auto clientIds = targetFactory_->createClientRepository()->existsMany(collectIds(reviews, &Review::getClientId));
+        auto lessonIds = targetFactory_->createLessonRepository()->existsMany(collectIds(reviews, &Review::getLessonId));
+
         int migratedCount = 0;
         int updatedCount = 0;
         int skippedCount = 0;
         
         for (const auto& review : reviews) {
             // Проверяем существование клиента и занятия
-            auto clientRepo = targetFactory_->createClientRepository();
-            auto lessonRepo = targetFactory_->createLessonRepository();
-            
-            if (!clientRepo->exists(review.getClientId())) {
+            if (clientIds.count(review.getClientId()) == 0) {
                 std::cerr << "❌ Referenced client not found: " << review.getClientId().toString() 
                          << " for review" << std::endl;
                 return false;
             }
             
-            if (!lessonRepo->exists(review.getLessonId())) {
+            if (lessonIds.count(review.getLessonId()) == 0) {
                 std::cerr << "❌ Referenced lesson not found: " << review.getLessonId().toString() 
                          << " for review" << std::endl;
                 return false;
             }
             
-            bool exists = targetRepo->exists(review.getId());
+            bool exists = existingIds.count(review.getId()) > 0;
             
             if (exists) {
                 if (migrationStrategy_ == "overwrite") {
@@ -730,20 +781,24 @@ bool DataMigrator::migrateAttendance() {
         auto targetRepo = targetFactory_->createAttendanceRepository();
         
         auto attendances = sourceRepo->findAll();
+
+        // Существование проверяем одним запросом на коллекцию, а не на каждую запись
+        auto existingIds = targetRepo->existsMany(collectIds(attendances, &Attendance::getId));
+        auto clientIds = targetFactory_->createClientRepository()->existsMany(collectIds(attendances, &Attendance::getClientId));
+
         int migratedCount = 0;
         int updatedCount = 0;
         int skippedCount = 0;
         
         for (const auto& attendance : attendances) {
             // Проверяем существование клиента
-            auto clientRepo = targetFactory_->createClientRepository();
-            if (!clientRepo->exists(attendance.getClientId())) {
+            if (clientIds.count(attendance.getClientId()) == 0) {
                 std::cerr << "❌ Referenced client not found: " << attendance.getClientId().toString() 
                          << " for attendance" << std::endl;
                 return false;
             }
             
-            bool exists = targetRepo->exists(attendance.getId());
+            bool exists = existingIds.count(attendance.getId()) > 0;
             
             if (exists) {
                 if (migrationStrategy_ == "overwrite") {
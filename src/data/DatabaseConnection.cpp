@@ -1,50 +1,62 @@
 #include "DatabaseConnection.hpp"
+#include "../core/Config.hpp"
 #include <stdexcept>
 
-DatabaseConnection::DatabaseConnection(const std::string& connectionString) 
-    : connectionString_(connectionString) {
-    try {
-        connection_ = std::make_unique<pqxx::connection>(connectionString_);
-        if (!connection_->is_open()) {
-            throw std::runtime_error("Failed to connect to database");
-        }
-    } catch (const std::exception& e) {
-        throw std::runtime_error(std::string("Database connection failed: ") + e.what());
-    }
-}
+DatabaseConnection::DatabaseConnection(const std::string& connectionString)
+    : DatabaseConnection(connectionString, ConnectionPoolOptions::fromConfig(Config::getInstance())) {}
 
-DatabaseConnection::~DatabaseConnection() {
-    if (connection_ && connection_->is_open()) {
-        connection_->close();
-    }
-}
+DatabaseConnection::DatabaseConnection(const std::string& connectionString,
+                                       const ConnectionPoolOptions& poolOptions)
+    : DatabaseConnection(connectionString, poolOptions, StartupMode::WarmUp) {}
 
-pqxx::connection& DatabaseConnection::getConnection() {
-    if (!connection_ || !connection_->is_open()) {
+DatabaseConnection::DatabaseConnection(const std::string& connectionString,
+                                       const ConnectionPoolOptions& poolOptions,
+                                       StartupMode startupMode)
+    : pool_(std::make_shared<ConnectionPool>(connectionString, poolOptions)),
+      connectionString_(connectionString) {
+    if (startupMode == StartupMode::WarmUp) {
         try {
-            connection_ = std::make_unique<pqxx::connection>(connectionString_);
-            if (!connection_->is_open()) {
-                throw std::runtime_error("Failed to reconnect to database");
-            }
+            warmUpPool();
         } catch (const std::exception& e) {
-            throw std::runtime_error(std::string("Database reconnection failed: ") + e.what());
+            throw std::runtime_error(std::string("Database connection failed: ") + e.what());
         }
     }
-    return *connection_;
+}
+
+void DatabaseConnection::warmUpPool() {
+    pool_->warmUp();
+}
+
+DatabaseConnection::~DatabaseConnection() = default;
+
+PooledConnection DatabaseConnection::acquireConnection() {
+    return pool_->acquire();
 }
 
 bool DatabaseConnection::isConnected() const {
-    return connection_ && connection_->is_open();
+    return pool_ && pool_->hasOpenConnections();
+}
+
+DatabaseTransaction DatabaseConnection::beginTransaction() {
+    return DatabaseTransaction(acquireConnection());
 }
 
-pqxx::work DatabaseConnection::beginTransaction() {
-    return pqxx::work(getConnection()); 
+DatabaseTransaction DatabaseConnection::beginReadTransaction() {
+    return DatabaseTransaction(acquireConnection(), DatabaseTransaction::Mode::ReadOnly);
 }
 
-void DatabaseConnection::commitTransaction(pqxx::work& transaction) {
+void DatabaseConnection::commitTransaction(DatabaseTransaction& transaction) {
     transaction.commit();
 }
 
-void DatabaseConnection::rollbackTransaction(pqxx::work& transaction) {
+void DatabaseConnection::rollbackTransaction(DatabaseTransaction& transaction) {
     transaction.abort();
-}
\ No newline at end of file
+}
+
+ConnectionPoolStats DatabaseConnection::getPoolStats() const {
+    return pool_->getStats();
+}
+
+std::size_t DatabaseConnection::reapIdleConnections() {
+    return pool_->reapIdleConnections();
+}
@@ -4,28 +4,47 @@
 #include <pqxx/pqxx>
 #include <memory>
 #include <string>
+#include "ConnectionPool.hpp"
+#include "DatabaseTransaction.hpp"
 
 class DatabaseConnection {
 public:
+    // Размер пула и таймаут ожидания берутся из Config (database.postgres.*)
     explicit DatabaseConnection(const std::string& connectionString);
+    DatabaseConnection(const std::string& connectionString, const ConnectionPoolOptions& poolOptions);
     virtual ~DatabaseConnection(); 
 
     // Запрещаем копирование
     DatabaseConnection(const DatabaseConnection&) = delete;
     DatabaseConnection& operator=(const DatabaseConnection&) = delete;
 
-    // Получение соединения
-    virtual pqxx::connection& getConnection();  
+    // Получение соединения из пула (возвращается в пул при разрушении)
+    virtual PooledConnection acquireConnection();
     virtual bool isConnected() const;
 
     // Транзакции
-    virtual pqxx::work beginTransaction();
-    virtual void commitTransaction(pqxx::work& transaction);
-    virtual void rollbackTransaction(pqxx::work& transaction);
+    virtual DatabaseTransaction beginTransaction();
+    // Для поисковых запросов: без BEGIN/COMMIT
+    virtual DatabaseTransaction beginReadTransaction();
+    virtual void commitTransaction(DatabaseTransaction& transaction);
+    virtual void rollbackTransaction(DatabaseTransaction& transaction);
+
+    // Мониторинг пула
+    ConnectionPoolStats getPoolStats() const;
+    std::size_t reapIdleConnections();
+
+protected:
+    // Пул без предварительного открытия соединений; прогрев - через warmUpPool()
+    enum class StartupMode { WarmUp, Deferred };
+    DatabaseConnection(const std::string& connectionString, const ConnectionPoolOptions& poolOptions,
+                       StartupMode startupMode);
+
+    // Открывает minIdleConnections соединений; бросает ConnectionException при неудаче
+    void warmUpPool();
 
 private:
-    std::unique_ptr<pqxx::connection> connection_;
+    std::shared_ptr<ConnectionPool> pool_;
     std::string connectionString_;
 };
 
-#endif // DATABASECONNECTION_HPP
\ No newline at end of file
+#endif // DATABASECONNECTION_HPP
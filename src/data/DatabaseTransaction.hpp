@@ -0,0 +1,129 @@
+#ifndef DATABASETRANSACTION_HPP
+#define DATABASETRANSACTION_HPP
+
+#include "ConnectionPool.hpp"
+#include "PreparedStatementRegistry.hpp"
+#include "../services/DatabaseHealthService.hpp"
+#include <pqxx/pqxx>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <utility>
+
+// Транзакция, удерживающая арендованное из пула соединение до своего завершения.
+// Интерфейс повторяет используемую репозиториями часть pqxx::work.
+class DatabaseTransaction {
+public:
+    enum class Mode {
+        ReadWrite,  // pqxx::work: BEGIN ... COMMIT
+        ReadOnly    // pqxx::nontransaction: autocommit, без BEGIN/COMMIT, сессия в режиме только чтения
+    };
+
+    explicit DatabaseTransaction(PooledConnection connection, Mode mode = Mode::ReadWrite)
+        : connection_(std::move(connection)),
+          transaction_(openTransaction(connection_, mode)),
+          mode_(mode) {}
+
+    DatabaseTransaction(const DatabaseTransaction&) = delete;
+    DatabaseTransaction& operator=(const DatabaseTransaction&) = delete;
+
+    pqxx::result exec(const std::string& query) {
+        return guarded([&]() { return transaction_->exec(query); });
+    }
+
+    template <typename... Args>
+    pqxx::result exec_params(const std::string& query, Args&&... args) {
+        return guarded([&]() {
+            return transaction_->exec_params(query, std::forward<Args>(args)...);
+        });
+    }
+
+    // Выполняет запрос из PreparedStatementRegistry, подготавливая его на соединении при первом обращении
+    template <typename... Args>
+    pqxx::result exec_prepared(const std::string& name, Args&&... args) {
+        auto& registry = PreparedStatementRegistry::getInstance();
+        return guarded([&]() {
+            if (!connection_.isPrepared(name)) {
+                registry.prepare(connection_.get(), name);
+                connection_.markPrepared(name);
+            }
+
+            auto start = std::chrono::steady_clock::now();
+            try {
+                auto result = transaction_->exec_prepared(name, std::forward<Args>(args)...);
+                registry.recordExecution(name, elapsedSince(start), false);
+                return result;
+            } catch (...) {
+                registry.recordExecution(name, elapsedSince(start), true);
+                throw;
+            }
+        });
+    }
+
+    void commit() {
+        guarded([&]() { transaction_->commit(); return 0; });
+        DatabaseHealthService::recordSuccess();
+    }
+
+    void abort() {
+        transaction_->abort();
+    }
+
+    Mode mode() const { return mode_; }
+    bool isReadOnly() const { return mode_ != Mode::ReadWrite; }
+
+    pqxx::transaction_base& raw() { return *transaction_; }
+
+private:
+    // Соединение объявлено первым: оно должно пережить transaction_
+    PooledConnection connection_;
+    std::unique_ptr<pqxx::transaction_base> transaction_;
+    Mode mode_;
+
+    static std::unique_ptr<pqxx::transaction_base> openTransaction(PooledConnection& connection, Mode mode) {
+        setReadOnlySession(connection, mode == Mode::ReadOnly);
+        switch (mode) {
+            case Mode::ReadOnly:
+                return std::make_unique<pqxx::nontransaction>(connection.get());
+            case Mode::ReadWrite:
+            default:
+                return std::make_unique<pqxx::work>(connection.get());
+        }
+    }
+
+    // Автокоммитные чтения без BEGIN иначе не защищены от записи: запрет задается на уровне сессии.
+    // Состояние хранится вместе с соединением в пуле, поэтому SET выполняется только при смене режима
+    static void setReadOnlySession(PooledConnection& connection, bool readOnly) {
+        if (connection.isReadOnlySession() == readOnly) {
+            return;
+        }
+        try {
+            pqxx::nontransaction session(connection.get());
+            session.exec(readOnly ? "SET SESSION default_transaction_read_only = on"
+                                  : "SET SESSION default_transaction_read_only = off");
+        } catch (const pqxx::broken_connection&) {
+            connection.markBroken();
+            DatabaseHealthService::reportConnectionFailure();
+            throw;
+        }
+        connection.setReadOnlySession(readOnly);
+    }
+
+    static std::chrono::microseconds elapsedSince(std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+    }
+
+    template <typename Operation>
+    auto guarded(Operation&& operation) -> decltype(operation()) {
+        try {
+            return operation();
+        } catch (const pqxx::broken_connection&) {
+            // Разорванное соединение не возвращаем в пул, а доступность БД проверит фоновый поток
+            connection_.markBroken();
+            DatabaseHealthService::reportConnectionFailure();
+            throw;
+        }
+    }
+};
+
+#endif // DATABASETRANSACTION_HPP
@@ -1,150 +1,221 @@
 #include "DateTimeUtils.hpp"
-#include <iomanip>
-#include <sstream>
-#include <ctime>
+#include <stdexcept>
 
-// Реализация timegm для систем, где она отсутствует
-#ifndef _WIN32
-std::time_t DateTimeUtils::timegm(std::tm* tm) {
-    // На Unix-системах используем стандартную timegm
-    return ::timegm(tm);
+// Запись числа фиксированной ширины с ведущими нулями
+static char* writeDigits(char* out, std::int64_t value, int width) {
+    for (int i = width - 1; i >= 0; --i) {
+        out[i] = static_cast<char>('0' + value % 10);
+        value /= 10;
+    }
+    return out + width;
 }
-#else
-// На Windows реализуем timegm самостоятельно
-std::time_t DateTimeUtils::timegm(std::tm* tm) {
-    std::time_t t = std::mktime(tm);
-    if (t == -1) {
-        return -1;
+
+// Чтение числа фиксированной ширины; false, если встретился не цифровой символ
+static bool readDigits(std::string_view str, std::size_t pos, std::size_t width, int& value) {
+    value = 0;
+    for (std::size_t i = pos; i < pos + width; ++i) {
+        unsigned digit = static_cast<unsigned char>(str[i]) - '0';
+        if (digit > 9) {
+            return false;
+        }
+        value = value * 10 + static_cast<int>(digit);
+    }
+    return true;
+}
+
+// Разбор YYYY-MM-DD<sep>HH:MM:SS; хвост (доли секунды, суффикс зоны) не учитывается
+static bool parseFixedTimestamp(std::string_view str, char dateTimeSeparator, std::int64_t& secondsSinceEpoch) {
+    if (str.size() < DateTimeUtils::POSTGRES_TIMESTAMP_LENGTH ||
+        str[4] != '-' || str[7] != '-' || str[10] != dateTimeSeparator ||
+        str[13] != ':' || str[16] != ':') {
+        return false;
     }
-    
-    // Получаем локальное время для этой временной точки
-    std::tm* local_tm = std::localtime(&t);
-    if (!local_tm) {
-        return -1;
+
+    int year, month, day, hour, minute, second;
+    if (!readDigits(str, 0, 4, year) || !readDigits(str, 5, 2, month) || !readDigits(str, 8, 2, day) ||
+        !readDigits(str, 11, 2, hour) || !readDigits(str, 14, 2, minute) || !readDigits(str, 17, 2, second)) {
+        return false;
     }
-    
-    // Вычисляем разницу между локальным временем и UTC
-    int offset = local_tm->tm_hour - tm->tm_hour;
-    if (offset > 12) {
-        offset -= 24;
-    } else if (offset < -12) {
-        offset += 24;
+    if (month < 1 || month > 12 || day < 1 || day > 31 || hour > 23 || minute > 59 || second > 60) {
+        return false;
     }
-    
-    // Корректируем время на смещение
-    return t - offset * 3600;
+
+    secondsSinceEpoch = DateTimeUtils::daysFromCivil(year, month, day) * 86400 +
+                        hour * 3600 + minute * 60 + second;
+    return true;
+}
+
+static std::int64_t floorDiv(std::int64_t value, std::int64_t divisor) {
+    std::int64_t quotient = value / divisor;
+    return (value % divisor < 0) ? quotient - 1 : quotient;
+}
+
+static std::int64_t toSeconds(const std::chrono::system_clock::time_point& timePoint) {
+    return std::chrono::floor<std::chrono::seconds>(timePoint.time_since_epoch()).count();
+}
+
+// Алгоритм days_from_civil (H. Hinnant)
+std::int64_t DateTimeUtils::daysFromCivil(std::int64_t year, unsigned month, unsigned day) {
+    year -= month <= 2;
+    const std::int64_t era = floorDiv(year, 400);
+    const unsigned yearOfEra = static_cast<unsigned>(year - era * 400);
+    const unsigned dayOfYear = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+    const unsigned dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+    return era * 146097 + static_cast<std::int64_t>(dayOfEra) - 719468;
+}
+
+// Алгоритм civil_from_days (H. Hinnant)
+void DateTimeUtils::civilFromDays(std::int64_t days, std::int64_t& year, unsigned& month, unsigned& day) {
+    days += 719468;
+    const std::int64_t era = floorDiv(days, 146097);
+    const unsigned dayOfEra = static_cast<unsigned>(days - era * 146097);
+    const unsigned yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+    const unsigned dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+    const unsigned monthPart = (5 * dayOfYear + 2) / 153;
+    day = dayOfYear - (153 * monthPart + 2) / 5 + 1;
+    month = monthPart < 10 ? monthPart + 3 : monthPart - 9;
+    year = static_cast<std::int64_t>(yearOfEra) + era * 400 + (month <= 2);
+}
+
+// Собственная реализация timegm: не зависит от платформы и не меняет глобальное состояние
+std::time_t DateTimeUtils::timegm(std::tm* tm) {
+    // Нормализуем месяц так же, как это делает стандартная timegm
+    std::int64_t year = static_cast<std::int64_t>(tm->tm_year) + 1900 + floorDiv(tm->tm_mon, 12);
+    int month = tm->tm_mon - static_cast<int>(floorDiv(tm->tm_mon, 12)) * 12;
+
+    std::int64_t days = daysFromCivil(year, static_cast<unsigned>(month + 1), 1) + tm->tm_mday - 1;
+    return static_cast<std::time_t>(days * 86400 + static_cast<std::int64_t>(tm->tm_hour) * 3600 +
+                                    static_cast<std::int64_t>(tm->tm_min) * 60 + tm->tm_sec);
+}
+
+std::tm DateTimeUtils::toUtcTm(const TimePoint& timePoint) {
+    std::int64_t seconds = toSeconds(timePoint);
+    std::int64_t days = floorDiv(seconds, 86400);
+    std::int64_t secondOfDay = seconds - days * 86400;
+
+    std::int64_t year;
+    unsigned month, day;
+    civilFromDays(days, year, month, day);
+
+    std::tm tm = {};
+    tm.tm_year = static_cast<int>(year - 1900);
+    tm.tm_mon = static_cast<int>(month) - 1;
+    tm.tm_mday = static_cast<int>(day);
+    tm.tm_hour = static_cast<int>(secondOfDay / 3600);
+    tm.tm_min = static_cast<int>(secondOfDay / 60 % 60);
+    tm.tm_sec = static_cast<int>(secondOfDay % 60);
+    tm.tm_wday = static_cast<int>((days % 7 + 11) % 7);  // 1970-01-01 - четверг
+    tm.tm_yday = static_cast<int>(days - daysFromCivil(year, 1, 1));
+    return tm;
 }
+
+std::tm DateTimeUtils::toLocalTm(const TimePoint& timePoint) {
+    auto time_t = std::chrono::system_clock::to_time_t(timePoint);
+    std::tm tm = {};
+#ifdef _WIN32
+    localtime_s(&tm, &time_t);
+#else
+    localtime_r(&time_t, &tm);
 #endif
+    return tm;
+}
+
+std::size_t DateTimeUtils::formatTimeForPostgres(const TimePoint& timePoint, char* buffer) {
+    std::tm tm = toUtcTm(timePoint);  // Используем GMT для хранения в БД
+
+    char* out = writeDigits(buffer, tm.tm_year + 1900, 4);
+    *out++ = '-';
+    out = writeDigits(out, tm.tm_mon + 1, 2);
+    *out++ = '-';
+    out = writeDigits(out, tm.tm_mday, 2);
+    *out++ = ' ';
+    out = writeDigits(out, tm.tm_hour, 2);
+    *out++ = ':';
+    out = writeDigits(out, tm.tm_min, 2);
+    *out++ = ':';
+    out = writeDigits(out, tm.tm_sec, 2);
+    return static_cast<std::size_t>(out - buffer);
+}
+
+std::size_t DateTimeUtils::formatTimeForMongoDB(const TimePoint& timePoint, char* buffer) {
+    std::size_t length = formatTimeForPostgres(timePoint, buffer);
+    buffer[10] = 'T';
+    buffer[length] = 'Z';
+    return length + 1;
+}
 
 std::string DateTimeUtils::formatTimeForPostgres(const std::chrono::system_clock::time_point& time_point) {
-    auto time_t = std::chrono::system_clock::to_time_t(time_point);
-    std::tm tm = *std::gmtime(&time_t);  // Используем GMT для хранения в БД
-    
-    std::ostringstream oss;
-    oss << std::put_time(&tm, "%Y-%m-%d %H:%M:%S");
-    return oss.str();
+    char buffer[POSTGRES_TIMESTAMP_LENGTH];
+    return std::string(buffer, formatTimeForPostgres(time_point, buffer));
 }
 
-std::chrono::system_clock::time_point DateTimeUtils::parseTimeFromPostgres(const std::string& timeStr) {
-    std::tm tm = {};
-    std::istringstream ss(timeStr);
-    ss >> std::get_time(&tm, "%Y-%m-%d %H:%M:%S");
-    
-    if (ss.fail()) {
-        throw std::runtime_error("Failed to parse time from PostgreSQL: " + timeStr);
+std::chrono::system_clock::time_point DateTimeUtils::parseTimeFromPostgres(std::string_view timeStr) {
+    std::int64_t seconds;
+    if (!parseFixedTimestamp(timeStr, ' ', seconds)) {
+        throw std::runtime_error("Failed to parse time from PostgreSQL: " + std::string(timeStr));
     }
 
-    // Явно указываем, что время в UTC
-    tm.tm_isdst = -1; // Не учитываем летнее время
-    auto utc_time_t = timegm(&tm); // Используем timegm для UTC
-    
-    if (utc_time_t == -1) {
-        throw std::runtime_error("Invalid time value from PostgreSQL: " + timeStr);
-    }
-    
-    return std::chrono::system_clock::from_time_t(utc_time_t);
+    // Время в БД хранится в UTC
+    return std::chrono::system_clock::time_point(std::chrono::seconds(seconds));
 }
 
 std::string DateTimeUtils::formatTimeForMongoDB(const std::chrono::system_clock::time_point& time) {
-    auto time_t = std::chrono::system_clock::to_time_t(time);
-    std::tm* tm = std::gmtime(&time_t);
-    
-    std::ostringstream oss;
-    oss << std::put_time(tm, "%Y-%m-%dT%H:%M:%SZ");
-    return oss.str();
+    char buffer[MONGODB_TIMESTAMP_LENGTH];
+    return std::string(buffer, formatTimeForMongoDB(time, buffer));
 }
 
-std::chrono::system_clock::time_point DateTimeUtils::parseTimeFromMongoDB(const std::string& timeStr) {
-    std::tm tm = {};
-    std::istringstream ss(timeStr);
-    ss >> std::get_time(&tm, "%Y-%m-%dT%H:%M:%SZ");
-    
-    if (ss.fail()) {
-        throw std::runtime_error("Failed to parse MongoDB time string: " + timeStr);
+std::chrono::system_clock::time_point DateTimeUtils::parseTimeFromMongoDB(std::string_view timeStr) {
+    std::int64_t seconds;
+    if (!parseFixedTimestamp(timeStr, 'T', seconds)) {
+        throw std::runtime_error("Failed to parse MongoDB time string: " + std::string(timeStr));
     }
-    
-    return std::chrono::system_clock::from_time_t(std::mktime(&tm));
+
+    // Строка записана formatTimeForMongoDB в UTC (суффикс Z)
+    return std::chrono::system_clock::time_point(std::chrono::seconds(seconds));
 }
 
 std::string DateTimeUtils::formatTime(const std::chrono::system_clock::time_point& timePoint) {
-    auto time_t = std::chrono::system_clock::to_time_t(timePoint);
-    std::tm* tm = std::localtime(&time_t);
-    
-    char buffer[80];
-    std::strftime(buffer, sizeof(buffer), "%H:%M", tm);
-    return std::string(buffer);
+    std::tm tm = toLocalTm(timePoint);
+
+    char buffer[5];
+    char* out = writeDigits(buffer, tm.tm_hour, 2);
+    *out++ = ':';
+    out = writeDigits(out, tm.tm_min, 2);
+    return std::string(buffer, out);
 }
 
 std::string DateTimeUtils::formatDateTime(const std::chrono::system_clock::time_point& timePoint) {
-    auto time_t = std::chrono::system_clock::to_time_t(timePoint);
-    std::tm* tm = std::localtime(&time_t);
-    
-    char buffer[80];
-    std::strftime(buffer, sizeof(buffer), "%d.%m.%Y %H:%M", tm);
-    return std::string(buffer);
+    return formatDate(timePoint) + " " + formatTime(timePoint);
 }
 
 std::string DateTimeUtils::formatDate(const std::chrono::system_clock::time_point& timePoint) {
-    auto time_t = std::chrono::system_clock::to_time_t(timePoint);
-    std::tm* tm = std::localtime(&time_t);
-    
-    char buffer[80];
-    std::strftime(buffer, sizeof(buffer), "%d.%m.%Y", tm);
-    return std::string(buffer);
+    std::tm tm = toLocalTm(timePoint);
+
+    char buffer[10];
+    char* out = writeDigits(buffer, tm.tm_mday, 2);
+    *out++ = '.';
+    out = writeDigits(out, tm.tm_mon + 1, 2);
+    *out++ = '.';
+    out = writeDigits(out, tm.tm_year + 1900, 4);
+    return std::string(buffer, out);
 }
 
 std::string DateTimeUtils::formatTimeSlot(const std::chrono::system_clock::time_point& startTime, int durationMinutes) {
-    auto endTime = startTime + std::chrono::minutes(durationMinutes);
-    
-    // Используем gmtime для консистентности
-    auto start_time_t = std::chrono::system_clock::to_time_t(startTime);
-    auto end_time_t = std::chrono::system_clock::to_time_t(endTime);
-    
-    std::tm start_tm = *std::gmtime(&start_time_t);  // Используем gmtime
-    std::tm end_tm = *std::gmtime(&end_time_t);      // Используем gmtime
-    
-    char startBuffer[80], endBuffer[80];
-    std::strftime(startBuffer, sizeof(startBuffer), "%H:%M", &start_tm);
-    std::strftime(endBuffer, sizeof(endBuffer), "%H:%M", &end_tm);
-    
-    return std::string(startBuffer) + " - " + std::string(endBuffer) + 
-           " (" + std::to_string(durationMinutes) + " мин)";
+    // Используем UTC для консистентности
+    return formatTimeSlotWithOffset(startTime, durationMinutes, std::chrono::minutes(0));
 }
 
-bool DateTimeUtils::isSameDay(const std::chrono::system_clock::time_point& time1, 
+bool DateTimeUtils::isSameDay(const std::chrono::system_clock::time_point& time1,
                              const std::chrono::system_clock::time_point& time2) {
-    auto time1_t = std::chrono::system_clock::to_time_t(time1);
-    auto time2_t = std::chrono::system_clock::to_time_t(time2);
-    
-    std::tm tm1 = *std::localtime(&time1_t);
-    std::tm tm2 = *std::localtime(&time2_t);
-    
+    std::tm tm1 = toLocalTm(time1);
+    std::tm tm2 = toLocalTm(time2);
+
     return tm1.tm_year == tm2.tm_year &&
            tm1.tm_mon == tm2.tm_mon &&
            tm1.tm_mday == tm2.tm_mday;
 }
 
-std::chrono::system_clock::time_point DateTimeUtils::createDateTime(int year, int month, int day, 
+std::chrono::system_clock::time_point DateTimeUtils::createDateTime(int year, int month, int day,
                                                                    int hour, int minute, int second) {
     std::tm tm = {0};
     tm.tm_year = year - 1900;
@@ -154,64 +225,58 @@ std::chrono::system_clock::time_point DateTimeUtils::createDateTime(int year, in
     tm.tm_min = minute;
     tm.tm_sec = second;
     tm.tm_isdst = -1; // Определять автоматически
-    
+
     std::time_t time = std::mktime(&tm);
     return std::chrono::system_clock::from_time_t(time);
 }
 
 bool DateTimeUtils::isTimeInRange(const std::chrono::system_clock::time_point& time,
-                                 const std::chrono::hours& startHour, 
+                                 const std::chrono::hours& startHour,
                                  const std::chrono::hours& endHour) {
-    auto time_t = std::chrono::system_clock::to_time_t(time);
-    std::tm* tm = std::localtime(&time_t);
-    
-    int currentHour = tm->tm_hour;
+    int currentHour = toLocalTm(time).tm_hour;
     int startHourValue = startHour.count();
     int endHourValue = endHour.count();
-    
+
     return currentHour >= startHourValue && currentHour < endHourValue;
 }
 
-std::string DateTimeUtils::formatDateTimeWithOffset(const std::chrono::system_clock::time_point& timePoint, 
+std::string DateTimeUtils::formatDateTimeWithOffset(const std::chrono::system_clock::time_point& timePoint,
                                                    const std::chrono::minutes& offset) {
     // Время уже в UTC, просто добавляем смещение для отображения
-    auto localTime = timePoint + offset;
-    auto time_t = std::chrono::system_clock::to_time_t(localTime);
-    std::tm tm = *std::gmtime(&time_t); // Используем gmtime для консистентности
-    
-    char buffer[80];
-    std::strftime(buffer, sizeof(buffer), "%d.%m.%Y %H:%M", &tm);
-    return std::string(buffer);
+    std::tm tm = toUtcTm(timePoint + offset);
+
+    char buffer[16];
+    char* out = writeDigits(buffer, tm.tm_mday, 2);
+    *out++ = '.';
+    out = writeDigits(out, tm.tm_mon + 1, 2);
+    *out++ = '.';
+    out = writeDigits(out, tm.tm_year + 1900, 4);
+    *out++ = ' ';
+    out = writeDigits(out, tm.tm_hour, 2);
+    *out++ = ':';
+    out = writeDigits(out, tm.tm_min, 2);
+    return std::string(buffer, out);
 }
 
-std::string DateTimeUtils::formatTimeWithOffset(const std::chrono::system_clock::time_point& timePoint, 
+std::string DateTimeUtils::formatTimeWithOffset(const std::chrono::system_clock::time_point& timePoint,
                                                const std::chrono::minutes& offset) {
-    auto localTime = timePoint + offset;
-    auto time_t = std::chrono::system_clock::to_time_t(localTime);
-    std::tm tm = *std::gmtime(&time_t);
-    
-    char buffer[80];
-    std::strftime(buffer, sizeof(buffer), "%H:%M", &tm);
-    return std::string(buffer);
+    std::tm tm = toUtcTm(timePoint + offset);
+
+    char buffer[5];
+    char* out = writeDigits(buffer, tm.tm_hour, 2);
+    *out++ = ':';
+    out = writeDigits(out, tm.tm_min, 2);
+    return std::string(buffer, out);
 }
 
 // Добавим новый метод для форматирования временного слота с учетом смещения
-std::string DateTimeUtils::formatTimeSlotWithOffset(const std::chrono::system_clock::time_point& startTime, 
+std::string DateTimeUtils::formatTimeSlotWithOffset(const std::chrono::system_clock::time_point& startTime,
                                                    int durationMinutes,
                                                    const std::chrono::minutes& offset) {
     auto localStartTime = startTime + offset;
     auto localEndTime = localStartTime + std::chrono::minutes(durationMinutes);
-    
-    auto start_time_t = std::chrono::system_clock::to_time_t(localStartTime);
-    auto end_time_t = std::chrono::system_clock::to_time_t(localEndTime);
-    
-    std::tm start_tm = *std::gmtime(&start_time_t);
-    std::tm end_tm = *std::gmtime(&end_time_t);
-    
-    char startBuffer[80], endBuffer[80];
-    std::strftime(startBuffer, sizeof(startBuffer), "%H:%M", &start_tm);
-    std::strftime(endBuffer, sizeof(endBuffer), "%H:%M", &end_tm);
-    
-    return std::string(startBuffer) + " - " + std::string(endBuffer) + 
+
+    return formatTimeWithOffset(localStartTime, std::chrono::minutes(0)) + " - " +
+           formatTimeWithOffset(localEndTime, std::chrono::minutes(0)) +
            " (" + std::to_string(durationMinutes) + " мин)";
-}
\ No newline at end of file
+}
@@ -2,50 +2,97 @@
 #define DATETIMEUTILS_HPP
 
 #include <string>
+#include <string_view>
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <ctime>
+#include <vector>
 
+// Разбор и форматирование фиксированных форматов выполняются арифметикой по дням
+// (civil-from-days), без потоков, std::get_time и нереентерабельных gmtime/localtime.
 class DateTimeUtils {
 public:
+    using TimePoint = std::chrono::system_clock::time_point;
+
+    // Длины строк фиксированных форматов (без завершающего нуля)
+    static constexpr std::size_t POSTGRES_TIMESTAMP_LENGTH = 19;  // YYYY-MM-DD HH:MM:SS
+    static constexpr std::size_t MONGODB_TIMESTAMP_LENGTH = 20;   // YYYY-MM-DDTHH:MM:SSZ
+
     // Основные методы для работы с PostgreSQL
     static std::string formatTimeForPostgres(const std::chrono::system_clock::time_point& time_point);
-    static std::chrono::system_clock::time_point parseTimeFromPostgres(const std::string& timeStr);
+    static std::chrono::system_clock::time_point parseTimeFromPostgres(std::string_view timeStr);
 
     // Основные методы для работы с MongoDB
     static std::string formatTimeForMongoDB(const std::chrono::system_clock::time_point& time);
-    static std::chrono::system_clock::time_point parseTimeFromMongoDB(const std::string& timeStr);
-    
+    static std::chrono::system_clock::time_point parseTimeFromMongoDB(std::string_view timeStr);
+
+    // Форматирование в буфер вызывающего без выделения памяти, возвращает число записанных символов
+    static std::size_t formatTimeForPostgres(const TimePoint& timePoint, char* buffer);
+    static std::size_t formatTimeForMongoDB(const TimePoint& timePoint, char* buffer);
+
+    // Пакетный разбор столбца результата PostgreSQL (pqxx::result или любой диапазон строк с operator[])
+    template <typename Rows>
+    static std::vector<TimePoint> parseColumnFromPostgres(const Rows& rows, const char* column) {
+        std::vector<TimePoint> values;
+        values.reserve(rows.size());
+        for (const auto& row : rows) {
+            values.push_back(parseTimeFromPostgres(row[column].c_str()));
+        }
+        return values;
+    }
+
+    // Пакетный разбор строк MongoDB (любой диапазон значений, приводимых к std::string_view)
+    template <typename Range>
+    static std::vector<TimePoint> parseTimesFromMongoDB(const Range& timeStrings) {
+        std::vector<TimePoint> values;
+        values.reserve(timeStrings.size());
+        for (const auto& timeStr : timeStrings) {
+            values.push_back(parseTimeFromMongoDB(timeStr));
+        }
+        return values;
+    }
+
     // Методы для форматирования времени (работают с локальным временем системы)
     static std::string formatTime(const std::chrono::system_clock::time_point& timePoint);
     static std::string formatDateTime(const std::chrono::system_clock::time_point& timePoint);
     static std::string formatDate(const std::chrono::system_clock::time_point& timePoint);
     static std::string formatTimeSlot(const std::chrono::system_clock::time_point& startTime, int durationMinutes);
-    
+
     // Методы для работы с датами
-    static bool isSameDay(const std::chrono::system_clock::time_point& time1, 
+    static bool isSameDay(const std::chrono::system_clock::time_point& time1,
                          const std::chrono::system_clock::time_point& time2);
-    static std::chrono::system_clock::time_point createDateTime(int year, int month, int day, 
+    static std::chrono::system_clock::time_point createDateTime(int year, int month, int day,
                                                                int hour, int minute, int second = 0);
-    
+
     // Методы для проверки временных интервалов (работают с локальным временем)
     static bool isTimeInRange(const std::chrono::system_clock::time_point& time,
-                             const std::chrono::hours& startHour, 
+                             const std::chrono::hours& startHour,
                              const std::chrono::hours& endHour);
-    
+
     // Новый метод для форматирования времени с учетом смещения часового пояса
-    static std::string formatDateTimeWithOffset(const std::chrono::system_clock::time_point& timePoint, 
+    static std::string formatDateTimeWithOffset(const std::chrono::system_clock::time_point& timePoint,
                                                const std::chrono::minutes& offset);
-    
+
     // Метод для форматирования времени с учетом смещения
-    static std::string formatTimeWithOffset(const std::chrono::system_clock::time_point& timePoint, 
+    static std::string formatTimeWithOffset(const std::chrono::system_clock::time_point& timePoint,
                                            const std::chrono::minutes& offset);
 
-    static std::string formatTimeSlotWithOffset(const std::chrono::system_clock::time_point& startTime, 
+    static std::string formatTimeSlotWithOffset(const std::chrono::system_clock::time_point& startTime,
                                            int durationMinutes,
                                            const std::chrono::minutes& offset);
 
     // Вспомогательные функции для работы с временем
     static std::time_t timegm(std::tm* tm);
+
+    // Календарная арифметика пролептического григорианского календаря (дни от 1970-01-01)
+    static std::int64_t daysFromCivil(std::int64_t year, unsigned month, unsigned day);
+    static void civilFromDays(std::int64_t days, std::int64_t& year, unsigned& month, unsigned& day);
+
+private:
+    // Разложение момента времени на поля UTC и локального времени (потокобезопасно)
+    static std::tm toUtcTm(const TimePoint& timePoint);
+    static std::tm toLocalTm(const TimePoint& timePoint);
 };
 
-#endif // DATETIMEUTILS_HPP
\ No newline at end of file
+#endif // DATETIMEUTILS_HPP
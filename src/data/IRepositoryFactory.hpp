@@ -12,6 +12,7 @@
 #include "../repositories/IBranchRepository.hpp"
 #include "../repositories/IStudioRepository.hpp"
 #include "../repositories/IAttendanceRepository.hpp"
+#include "../repositories/IMonthlyRollupRepository.hpp"
 
 class IRepositoryFactory {
 public:
@@ -29,6 +30,7 @@ public:
     virtual std::shared_ptr<IBranchRepository> createBranchRepository() = 0;
     virtual std::shared_ptr<IStudioRepository> createStudioRepository() = 0;
     virtual std::shared_ptr<IAttendanceRepository> createAttendanceRepository() = 0;
+    virtual std::shared_ptr<IMonthlyRollupRepository> createMonthlyRollupRepository() = 0;
     
     virtual bool testConnection() const = 0;
     virtual void reconnect() = 0;
@@ -0,0 +1,133 @@
+#include "MongoDBClientPool.hpp"
+#include "exceptions/DataAccessException.hpp"
+#include "../core/Config.hpp"
+#include <mongocxx/uri.hpp>
+#include <algorithm>
+
+MongoDBPoolOptions MongoDBPoolOptions::fromConfig(const Config& config) {
+    auto settings = config.snapshot()->database;
+    MongoDBPoolOptions options;
+    options.maxPoolSize = static_cast<std::size_t>(std::max(1, settings.mongoPoolSize));
+    options.acquireTimeout = std::chrono::milliseconds(std::max(1, settings.mongoTimeoutMs));
+    return options;
+}
+
+// ===== MongoDBClientLease =====
+
+MongoDBClientLease::MongoDBClientLease(std::shared_ptr<MongoDBClientPool> pool, mongocxx::pool::entry entry)
+    : pool_(std::move(pool)), entry_(std::move(entry)) {}
+
+MongoDBClientLease::~MongoDBClientLease() {
+    release();
+}
+
+MongoDBClientLease::MongoDBClientLease(MongoDBClientLease&& other) noexcept
+    : pool_(std::move(other.pool_)), entry_(std::move(other.entry_)) {}
+
+MongoDBClientLease& MongoDBClientLease::operator=(MongoDBClientLease&& other) noexcept {
+    if (this != &other) {
+        release();
+        pool_ = std::move(other.pool_);
+        entry_ = std::move(other.entry_);
+    }
+    return *this;
+}
+
+void MongoDBClientLease::release() {
+    if (!pool_) {
+        return;
+    }
+    // Клиент возвращается в mongocxx::pool до освобождения слота,
+    // чтобы следующий ожидающий поток не заблокировался внутри драйвера
+    entry_.reset();
+    pool_->releaseSlot();
+    pool_.reset();
+}
+
+// ===== MongoDBPooledCollection =====
+
+MongoDBPooledCollection::MongoDBPooledCollection(MongoDBClientLease clientLease, const std::string& databaseName,
+                                                 const std::string& collectionName)
+    : MongoDBClientLeaseHolder{std::move(clientLease), databaseName},
+      mongocxx::collection((*lease)[databaseName][collectionName]) {}
+
+mongocxx::collection MongoDBPooledCollection::sibling(const std::string& collectionName) const {
+    return (*lease)[databaseName][collectionName];
+}
+
+// ===== MongoDBClientPool =====
+
+MongoDBClientPool::MongoDBClientPool(const std::string& connectionString, const MongoDBPoolOptions& options)
+    : pool_(std::make_unique<mongocxx::pool>(mongocxx::uri(withPoolSize(connectionString, options.maxPoolSize)))),
+      options_(options) {
+    stats_.maxPoolSize = options_.maxPoolSize;
+}
+
+std::string MongoDBClientPool::withPoolSize(const std::string& connectionString, std::size_t maxPoolSize) {
+    if (connectionString.find("maxPoolSize=") != std::string::npos) {
+        return connectionString;
+    }
+
+    std::string result = connectionString;
+    if (result.find('?') == std::string::npos) {
+        // Опции указываются после пути: mongodb://host:port/?option=value
+        auto hostStart = result.find("://");
+        hostStart = (hostStart == std::string::npos) ? 0 : hostStart + 3;
+        if (result.find('/', hostStart) == std::string::npos) {
+            result += '/';
+        }
+        result += '?';
+    } else if (result.back() != '?' && result.back() != '&') {
+        result += '&';
+    }
+    return result + "maxPoolSize=" + std::to_string(maxPoolSize);
+}
+
+MongoDBClientLease MongoDBClientPool::acquire() {
+    auto waitStart = std::chrono::steady_clock::now();
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        waiting_++;
+        bool ready = available_.wait_for(lock, options_.acquireTimeout, [this]() {
+            return inUse_ < options_.maxPoolSize;
+        });
+        waiting_--;
+
+        if (!ready) {
+            stats_.timeoutCount++;
+            throw ConnectionPoolTimeoutException("Timed out waiting for a MongoDB client (pool size " +
+                                                 std::to_string(options_.maxPoolSize) + ")");
+        }
+
+        inUse_++;
+        auto waited = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - waitStart);
+        stats_.acquiredCount++;
+        stats_.totalWaitTime += waited;
+        stats_.maxWaitTime = std::max(stats_.maxWaitTime, waited);
+    }
+
+    try {
+        // Слот уже занят, поэтому драйвер выдает клиента без ожидания
+        return MongoDBClientLease(shared_from_this(), pool_->acquire());
+    } catch (const std::exception& e) {
+        releaseSlot();
+        throw ConnectionException(std::string("MongoDB client acquisition failed: ") + e.what());
+    }
+}
+
+void MongoDBClientPool::releaseSlot() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        inUse_--;
+    }
+    available_.notify_one();
+}
+
+MongoDBPoolStats MongoDBClientPool::getStats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    MongoDBPoolStats stats = stats_;
+    stats.inUseClients = inUse_;
+    stats.waitingRequests = waiting_;
+    return stats;
+}
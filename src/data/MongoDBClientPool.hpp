@@ -0,0 +1,107 @@
+#ifndef MONGODB_CLIENT_POOL_HPP
+#define MONGODB_CLIENT_POOL_HPP
+
+#include <mongocxx/client.hpp>
+#include <mongocxx/collection.hpp>
+#include <mongocxx/pool.hpp>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+
+class Config;
+class MongoDBClientPool;
+
+struct MongoDBPoolOptions {
+    std::size_t maxPoolSize = 10;
+    std::chrono::milliseconds acquireTimeout = std::chrono::seconds(5);
+
+    // database.mongodb.pool_size / database.mongodb.timeout_ms
+    static MongoDBPoolOptions fromConfig(const Config& config);
+};
+
+struct MongoDBPoolStats {
+    std::size_t maxPoolSize = 0;
+    std::size_t inUseClients = 0;
+    std::size_t waitingRequests = 0;
+    std::uint64_t acquiredCount = 0;
+    std::uint64_t timeoutCount = 0;
+    std::chrono::microseconds totalWaitTime{0};
+    std::chrono::microseconds maxWaitTime{0};
+};
+
+// RAII-аренда клиента: mongocxx::client не потокобезопасен, поэтому каждая операция
+// репозитория берет собственный клиент из пула и возвращает его при разрушении
+class MongoDBClientLease {
+public:
+    MongoDBClientLease() = default;
+    MongoDBClientLease(std::shared_ptr<MongoDBClientPool> pool, mongocxx::pool::entry entry);
+    ~MongoDBClientLease();
+
+    MongoDBClientLease(MongoDBClientLease&& other) noexcept;
+    MongoDBClientLease& operator=(MongoDBClientLease&& other) noexcept;
+
+    MongoDBClientLease(const MongoDBClientLease&) = delete;
+    MongoDBClientLease& operator=(const MongoDBClientLease&) = delete;
+
+    mongocxx::client& operator*() const { return *entry_; }
+    mongocxx::client* operator->() const { return entry_.get(); }
+    explicit operator bool() const { return entry_ != nullptr; }
+
+private:
+    std::shared_ptr<MongoDBClientPool> pool_;
+    mongocxx::pool::entry entry_;
+
+    void release();
+};
+
+// Аренда объявлена базой раньше коллекции: клиент создается до коллекции и освобождается после нее
+struct MongoDBClientLeaseHolder {
+    MongoDBClientLease lease;
+    std::string databaseName;
+};
+
+// Коллекция вместе с арендованным клиентом. Используется как обычная mongocxx::collection;
+// курсоры, полученные из нее, действительны, пока объект жив
+class MongoDBPooledCollection : private MongoDBClientLeaseHolder, public mongocxx::collection {
+public:
+    MongoDBPooledCollection(MongoDBClientLease clientLease, const std::string& databaseName,
+                            const std::string& collectionName);
+
+    // Другая коллекция той же базы на том же клиенте (без повторной аренды из пула)
+    mongocxx::collection sibling(const std::string& collectionName) const;
+};
+
+class MongoDBClientPool : public std::enable_shared_from_this<MongoDBClientPool> {
+public:
+    MongoDBClientPool(const std::string& connectionString, const MongoDBPoolOptions& options);
+
+    MongoDBClientPool(const MongoDBClientPool&) = delete;
+    MongoDBClientPool& operator=(const MongoDBClientPool&) = delete;
+
+    // Ждет свободного клиента не дольше acquireTimeout, иначе ConnectionPoolTimeoutException
+    MongoDBClientLease acquire();
+    MongoDBPoolStats getStats() const;
+    const MongoDBPoolOptions& getOptions() const { return options_; }
+
+    // Добавляет maxPoolSize в строку подключения, если он не задан явно
+    static std::string withPoolSize(const std::string& connectionString, std::size_t maxPoolSize);
+
+private:
+    friend class MongoDBClientLease;
+
+    std::unique_ptr<mongocxx::pool> pool_;
+    MongoDBPoolOptions options_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable available_;
+    std::size_t inUse_ = 0;
+    std::size_t waiting_ = 0;
+    MongoDBPoolStats stats_;
+
+    void releaseSlot();
+};
+
+#endif // MONGODB_CLIENT_POOL_HPP
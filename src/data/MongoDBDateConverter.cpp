@@ -0,0 +1,66 @@
+#include "MongoDBDateConverter.hpp"
+#include "MongoDBRepositoryFactory.hpp"
+#include "MongoDBTime.hpp"
+#include <bsoncxx/builder/basic/document.hpp>
+#include <bsoncxx/builder/basic/kvp.hpp>
+#include <mongocxx/pipeline.hpp>
+#include <iostream>
+
+using bsoncxx::builder::basic::kvp;
+using bsoncxx::builder::basic::make_document;
+
+static bsoncxx::document::value stringTypeFilter(const std::string& field) {
+    return make_document(kvp(field, make_document(kvp("$type", "string"))));
+}
+
+MongoDBDateConverter::MongoDBDateConverter(const MongoDBRepositoryFactory& factory) : factory_(factory) {}
+
+std::vector<MongoDBDateConversionResult> MongoDBDateConverter::countPending() const {
+    std::vector<MongoDBDateConversionResult> results;
+    for (const auto& [collectionName, fields] : MongoDBTime::timeFields()) {
+        auto collection = factory_.getCollection(collectionName);
+        for (const auto& field : fields) {
+            MongoDBDateConversionResult result{collectionName, field};
+            try {
+                result.modified = collection.count_documents(stringTypeFilter(field).view());
+            } catch (const std::exception& e) {
+                std::cerr << "❌ Ошибка подсчета " << collectionName << "." << field << ": " << e.what() << std::endl;
+                result.failed = true;
+            }
+            results.push_back(result);
+        }
+    }
+    return results;
+}
+
+std::vector<MongoDBDateConversionResult> MongoDBDateConverter::convertAll() const {
+    std::vector<MongoDBDateConversionResult> results;
+    std::int64_t total = 0;
+
+    std::cout << "🔄 Конвертация дат MongoDB в BSON date..." << std::endl;
+
+    for (const auto& [collectionName, fields] : MongoDBTime::timeFields()) {
+        auto collection = factory_.getCollection(collectionName);
+        for (const auto& field : fields) {
+            MongoDBDateConversionResult result{collectionName, field};
+            try {
+                mongocxx::pipeline update;
+                update.add_fields(make_document(kvp(field, make_document(kvp("$toDate", "$" + field)))));
+
+                auto updateResult = collection.update_many(stringTypeFilter(field).view(), update);
+                if (updateResult) {
+                    result.modified = updateResult->modified_count();
+                }
+                total += result.modified;
+                std::cout << "   " << collectionName << "." << field << ": " << result.modified << std::endl;
+            } catch (const std::exception& e) {
+                std::cerr << "❌ Ошибка конвертации " << collectionName << "." << field << ": " << e.what() << std::endl;
+                result.failed = true;
+            }
+            results.push_back(result);
+        }
+    }
+
+    std::cout << "✅ Сконвертировано значений: " << total << std::endl;
+    return results;
+}
@@ -0,0 +1,32 @@
+#ifndef MONGODB_DATE_CONVERTER_HPP
+#define MONGODB_DATE_CONVERTER_HPP
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class MongoDBRepositoryFactory;
+
+struct MongoDBDateConversionResult {
+    std::string collection;
+    std::string field;
+    std::int64_t modified = 0;
+    bool failed = false;
+};
+
+// Разовая конвертация строковых дат (YYYY-MM-DDTHH:MM:SSZ) в BSON date на месте.
+// Выполняется на сервере через update с pipeline ($toDate, MongoDB 4.2+); повторный запуск
+// ничего не меняет, так как фильтр выбирает только документы, где поле еще строка
+class MongoDBDateConverter {
+public:
+    explicit MongoDBDateConverter(const MongoDBRepositoryFactory& factory);
+
+    // Число документов, в которых поле еще хранится строкой
+    std::vector<MongoDBDateConversionResult> countPending() const;
+    std::vector<MongoDBDateConversionResult> convertAll() const;
+
+private:
+    const MongoDBRepositoryFactory& factory_;
+};
+
+#endif // MONGODB_DATE_CONVERTER_HPP
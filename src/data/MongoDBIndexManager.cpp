@@ -0,0 +1,244 @@
+#include "MongoDBIndexManager.hpp"
+#include "MongoDBRepositoryFactory.hpp"
+#include <bsoncxx/builder/basic/document.hpp>
+#include <bsoncxx/builder/basic/kvp.hpp>
+#include <bsoncxx/types.hpp>
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <set>
+
+using bsoncxx::builder::basic::kvp;
+
+// Индекс, прочитанный из базы через listIndexes
+struct LiveIndex {
+    std::vector<std::pair<std::string, int>> keys;
+    bool unique = false;
+};
+
+static int keyOrder(const bsoncxx::document::element& element) {
+    switch (element.type()) {
+        case bsoncxx::type::k_int32: return element.get_int32().value;
+        case bsoncxx::type::k_int64: return static_cast<int>(element.get_int64().value);
+        case bsoncxx::type::k_double: return element.get_double().value < 0 ? -1 : 1;
+        default: return 0;  // text, 2dsphere и т.п. - заведомо не совпадут с объявленными
+    }
+}
+
+static std::map<std::string, LiveIndex> readLiveIndexes(mongocxx::collection& collection) {
+    std::map<std::string, LiveIndex> indexes;
+    auto cursor = collection.list_indexes();
+    for (auto&& doc : cursor) {
+        LiveIndex index;
+        for (auto&& element : doc["key"].get_document().value) {
+            index.keys.emplace_back(element.key().to_string(), keyOrder(element));
+        }
+        auto uniqueElement = doc["unique"];
+        index.unique = uniqueElement && uniqueElement.type() == bsoncxx::type::k_bool && uniqueElement.get_bool().value;
+        indexes[doc["name"].get_string().value.to_string()] = std::move(index);
+    }
+    return indexes;
+}
+
+static std::string qualifiedName(const MongoDBIndexSpec& spec) {
+    return spec.collection + "." + spec.name();
+}
+
+// Объявленные индексы, сгруппированные по коллекциям с сохранением порядка объявления
+static std::vector<std::pair<std::string, std::vector<const MongoDBIndexSpec*>>> groupByCollection(
+        const std::vector<MongoDBIndexSpec>& specs) {
+    std::vector<std::pair<std::string, std::vector<const MongoDBIndexSpec*>>> groups;
+    for (const auto& spec : specs) {
+        auto it = std::find_if(groups.begin(), groups.end(),
+                               [&spec](const auto& group) { return group.first == spec.collection; });
+        if (it == groups.end()) {
+            groups.emplace_back(spec.collection, std::vector<const MongoDBIndexSpec*>{});
+            it = std::prev(groups.end());
+        }
+        it->second.push_back(&spec);
+    }
+    return groups;
+}
+
+std::string MongoDBIndexSpec::name() const {
+    std::string result;
+    for (const auto& [field, order] : keys) {
+        if (!result.empty()) {
+            result += '_';
+        }
+        result += field + "_" + std::to_string(order);
+    }
+    return result;
+}
+
+MongoDBIndexManager::MongoDBIndexManager(const MongoDBRepositoryFactory& factory) : factory_(factory) {}
+
+const std::vector<MongoDBIndexSpec>& MongoDBIndexManager::declaredIndexes() {
+    static const std::vector<MongoDBIndexSpec> indexes = [] {
+        std::vector<MongoDBIndexSpec> specs;
+
+        // Прикладной идентификатор: все findById/exists/update/delete ищут по полю id
+        for (const char* collection : {"clients", "dance_halls", "bookings", "lessons", "trainers",
+                                       "enrollments", "subscriptions", "subscription_types", "reviews",
+                                       "branches", "studios", "attendance"}) {
+            specs.push_back({collection, {{"id", 1}}, true});
+        }
+
+        specs.push_back({"clients", {{"email", 1}}, true});
+        specs.push_back({"dance_halls", {{"branchId", 1}}, false});
+        specs.push_back({"branches", {{"studioId", 1}}, false});
+        specs.push_back({"trainers", {{"specializations", 1}, {"isActive", 1}}, false});
+
+        // Проверка конфликтов: равенство по залу и статусу, диапазон по времени начала
+        specs.push_back({"bookings", {{"hallId", 1}, {"status", 1}, {"startTime", 1}}, false});
+        specs.push_back({"bookings", {{"clientId", 1}}, false});
+        // Расписание зала или филиала за период (любой статус)
+        specs.push_back({"bookings", {{"hallId", 1}, {"startTime", 1}}, false});
+
+        specs.push_back({"lessons", {{"hallId", 1}, {"status", 1}, {"startTime", 1}}, false});
+        specs.push_back({"lessons", {{"status", 1}, {"startTime", 1}}, false});
+        specs.push_back({"lessons", {{"trainerId", 1}}, false});
+        specs.push_back({"lessons", {{"hallId", 1}, {"startTime", 1}}, false});
+
+        // UNIQUE(client_id, lesson_id) в PostgreSQL
+        specs.push_back({"enrollments", {{"clientId", 1}, {"lessonId", 1}}, true});
+        specs.push_back({"enrollments", {{"lessonId", 1}, {"status", 1}}, false});
+        specs.push_back({"reviews", {{"clientId", 1}, {"lessonId", 1}}, true});
+        specs.push_back({"reviews", {{"lessonId", 1}, {"status", 1}}, false});
+        specs.push_back({"reviews", {{"status", 1}}, false});
+
+        specs.push_back({"subscriptions", {{"clientId", 1}}, false});
+        specs.push_back({"subscriptions", {{"status", 1}, {"endDate", 1}}, false});
+
+        specs.push_back({"attendance", {{"clientId", 1}, {"scheduledTime", 1}}, false});
+        specs.push_back({"attendance", {{"clientId", 1}, {"status", 1}}, false});
+        specs.push_back({"attendance", {{"entityId", 1}}, false});
+        specs.push_back({"attendance", {{"type", 1}, {"status", 1}}, false});
+
+        // PRIMARY KEY(month, branch_id, metric) и rollup_jobs.job_name в PostgreSQL
+        specs.push_back({"monthly_rollups", {{"month", 1}, {"branchId", 1}, {"metric", 1}}, true});
+        specs.push_back({"rollup_jobs", {{"jobName", 1}}, true});
+        specs.push_back({"clients", {{"registrationDate", 1}}, false});
+        specs.push_back({"subscriptions", {{"purchaseDate", 1}}, false});
+
+        return specs;
+    }();
+    return indexes;
+}
+
+MongoDBIndexReport MongoDBIndexManager::ensureIndexes() {
+    MongoDBIndexReport report;
+    const auto& specs = declaredIndexes();
+    std::size_t position = 0;
+
+    std::cout << "🔧 Проверка индексов MongoDB (" << specs.size() << " объявлено)" << std::endl;
+
+    for (const auto& [collectionName, collectionSpecs] : groupByCollection(specs)) {
+        std::map<std::string, LiveIndex> live;
+        std::size_t collectionStart = position;
+        position += collectionSpecs.size();
+        try {
+            auto collection = factory_.getCollection(collectionName);
+            live = readLiveIndexes(collection);
+
+            for (std::size_t i = 0; i < collectionSpecs.size(); ++i) {
+                const auto* spec = collectionSpecs[i];
+                std::string name = qualifiedName(*spec);
+                if (live.count(spec->name()) > 0) {
+                    report.existing.push_back(name);
+                    continue;
+                }
+
+                std::cout << "   [" << collectionStart + i + 1 << "/" << specs.size() << "] создание " << name
+                          << (spec->unique ? " (unique)" : "") << "..." << std::flush;
+                auto started = std::chrono::steady_clock::now();
+                try {
+                    bsoncxx::builder::basic::document keys;
+                    for (const auto& [field, order] : spec->keys) {
+                        keys.append(kvp(field, order));
+                    }
+                    bsoncxx::builder::basic::document options;
+                    options.append(kvp("name", spec->name()));
+                    if (spec->unique) {
+                        options.append(kvp("unique", true));
+                    }
+
+                    collection.create_index(keys.view(), options.view());
+
+                    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+                        std::chrono::steady_clock::now() - started);
+                    std::cout << " ✅ " << elapsed.count() << " мс" << std::endl;
+                    report.created.push_back(name);
+                } catch (const std::exception& e) {
+                    std::cout << " ❌" << std::endl;
+                    std::cerr << "❌ Не удалось создать индекс " << name << ": " << e.what() << std::endl;
+                    report.failed.push_back(name);
+                }
+            }
+        } catch (const std::exception& e) {
+            std::cerr << "❌ Ошибка чтения индексов коллекции " << collectionName << ": " << e.what() << std::endl;
+            for (const auto* spec : collectionSpecs) {
+                if (live.count(spec->name()) == 0) {
+                    report.failed.push_back(qualifiedName(*spec));
+                }
+            }
+        }
+    }
+
+    std::cout << "✅ Индексы MongoDB: создано " << report.created.size()
+              << ", уже было " << report.existing.size()
+              << ", ошибок " << report.failed.size() << std::endl;
+    return report;
+}
+
+MongoDBIndexReport MongoDBIndexManager::verifyIndexes() {
+    MongoDBIndexReport report;
+
+    for (const auto& [collectionName, collectionSpecs] : groupByCollection(declaredIndexes())) {
+        try {
+            auto collection = factory_.getCollection(collectionName);
+            auto live = readLiveIndexes(collection);
+
+            std::set<std::string> declaredNames;
+            for (const auto* spec : collectionSpecs) {
+                declaredNames.insert(spec->name());
+                auto it = live.find(spec->name());
+                if (it == live.end()) {
+                    report.missing.push_back(qualifiedName(*spec));
+                } else if (it->second.keys != spec->keys || it->second.unique != spec->unique) {
+                    report.mismatched.push_back(qualifiedName(*spec));
+                } else {
+                    report.existing.push_back(qualifiedName(*spec));
+                }
+            }
+
+            for (const auto& [name, index] : live) {
+                if (name != "_id_" && declaredNames.count(name) == 0) {
+                    report.extra.push_back(collectionName + "." + name);
+                }
+            }
+        } catch (const std::exception& e) {
+            std::cerr << "❌ Ошибка чтения индексов коллекции " << collectionName << ": " << e.what() << std::endl;
+            for (const auto* spec : collectionSpecs) {
+                report.failed.push_back(qualifiedName(*spec));
+            }
+        }
+    }
+
+    std::cout << "🔍 Сверка индексов MongoDB: совпадает " << report.existing.size()
+              << ", отсутствует " << report.missing.size()
+              << ", отличается " << report.mismatched.size()
+              << ", лишних " << report.extra.size() << std::endl;
+    for (const auto& name : report.missing) {
+        std::cout << "   ⚠️  отсутствует: " << name << std::endl;
+    }
+    for (const auto& name : report.mismatched) {
+        std::cout << "   ⚠️  отличается от объявленного: " << name << std::endl;
+    }
+    for (const auto& name : report.extra) {
+        std::cout << "   ℹ️  не объявлен: " << name << std::endl;
+    }
+    return report;
+}
@@ -0,0 +1,49 @@
+#ifndef MONGODB_INDEX_MANAGER_HPP
+#define MONGODB_INDEX_MANAGER_HPP
+
+#include <string>
+#include <utility>
+#include <vector>
+
+class MongoDBRepositoryFactory;
+
+// Объявление индекса: поля в порядке ключа (1 - по возрастанию, -1 - по убыванию)
+struct MongoDBIndexSpec {
+    std::string collection;
+    std::vector<std::pair<std::string, int>> keys;
+    bool unique = false;
+
+    // Имя по соглашению MongoDB (clientId_1_lessonId_1), чтобы совпадать с индексами, созданными вручную
+    std::string name() const;
+};
+
+struct MongoDBIndexReport {
+    std::vector<std::string> created;
+    std::vector<std::string> existing;
+    std::vector<std::string> missing;     // объявлен, но отсутствует в базе
+    std::vector<std::string> mismatched;  // имя совпадает, ключи или unique - нет
+    std::vector<std::string> extra;       // есть в базе, но не объявлен (кроме _id_)
+    std::vector<std::string> failed;
+
+    bool isConsistent() const { return missing.empty() && mismatched.empty() && failed.empty(); }
+};
+
+// Индексы под фильтры репозиториев MongoDB. Уникальные индексы повторяют ограничения PostgreSQL:
+// clients.email, enrollments/reviews (clientId, lessonId), а также прикладной id каждой коллекции.
+class MongoDBIndexManager {
+public:
+    explicit MongoDBIndexManager(const MongoDBRepositoryFactory& factory);
+
+    static const std::vector<MongoDBIndexSpec>& declaredIndexes();
+
+    // Создает недостающие индексы; существующие с тем же именем пропускаются. Не выбрасывает:
+    // ошибка построения (например, дубликаты под уникальным индексом) попадает в report.failed
+    MongoDBIndexReport ensureIndexes();
+    // Сравнивает индексы в базе с объявленными, ничего не изменяя
+    MongoDBIndexReport verifyIndexes();
+
+private:
+    const MongoDBRepositoryFactory& factory_;
+};
+
+#endif // MONGODB_INDEX_MANAGER_HPP
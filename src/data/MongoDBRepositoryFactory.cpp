@@ -1,5 +1,6 @@
 #include "MongoDBRepositoryFactory.hpp"
 #include "MongoDBGlobalInstance.hpp"
+#include "../core/Config.hpp"
 #include "../repositories/impl/MongoDBClientRepository.hpp"
 #include "../repositories/impl/MongoDBDanceHallRepository.hpp"
 #include "../repositories/impl/MongoDBBookingRepository.hpp"
@@ -12,27 +13,43 @@
 #include "../repositories/impl/MongoDBEnrollmentRepository.hpp"
 #include "../repositories/impl/MongoDBReviewRepository.hpp"
 #include "../repositories/impl/MongoDBAttendanceRepository.hpp"
+#include "../repositories/impl/MongoDBMonthlyRollupRepository.hpp"
+#include <bsoncxx/builder/basic/array.hpp>
 #include <iostream>
 
 MongoDBRepositoryFactory::MongoDBRepositoryFactory(const std::string& connection_string, 
                                                  const std::string& database_name)
+    : MongoDBRepositoryFactory(connection_string, database_name, MongoDBPoolOptions::fromConfig(Config::getInstance())) {
+    auto settings = Config::getInstance().snapshot()->database;
+    if (settings.mongoCreateIndexes) {
+        ensureIndexes();
+    }
+    if (settings.mongoVerifyIndexes) {
+        verifyIndexes();
+    }
+}
+
+MongoDBRepositoryFactory::MongoDBRepositoryFactory(const std::string& connection_string,
+                                                 const std::string& database_name,
+                                                 const MongoDBPoolOptions& pool_options)
     : database_name_(database_name) {
     
     try {
         // Инициализируем глобальный instance (безопасно для многократного вызова)
         MongoDBGlobalInstance::initialize();
         
-        // Initialize MongoDB client
-        client_ = std::make_shared<mongocxx::client>(mongocxx::uri(connection_string));
+        // mongocxx::client не потокобезопасен: каждая операция берет клиента из пула
+        pool_ = std::make_shared<MongoDBClientPool>(connection_string, pool_options);
         
         // Test connection
-        auto admin_db = client_->database("admin");
+        auto client = pool_->acquire();
+        auto admin_db = client->database("admin");
         auto result = admin_db.run_command(bsoncxx::builder::stream::document{} 
             << "ping" << 1 
             << bsoncxx::builder::stream::finalize);
         
         std::cout << "✅ MongoDB connection established successfully to database: " 
-                  << database_name_ << std::endl;
+                  << database_name_ << " (pool size " << pool_options.maxPoolSize << ")" << std::endl;
         
     } catch (const std::exception& e) {
         std::cerr << "❌ MongoDB connection failed: " << e.what() << std::endl;
@@ -41,8 +58,8 @@ MongoDBRepositoryFactory::MongoDBRepositoryFactory(const std::string& connection
 }
 
 MongoDBRepositoryFactory::~MongoDBRepositoryFactory() {
-    // Просто уничтожаем клиент, глобальный instance остается жить
-    client_.reset();
+    // Пул живет, пока есть арендованные клиенты; глобальный instance остается жить
+    pool_.reset();
     std::cout << "✅ MongoDBRepositoryFactory destroyed" << std::endl;
 }
 
@@ -94,9 +111,14 @@ std::shared_ptr<IAttendanceRepository> MongoDBRepositoryFactory::createAttendanc
     return std::make_shared<MongoDBAttendanceRepository>(shared_from_this());
 }
 
+std::shared_ptr<IMonthlyRollupRepository> MongoDBRepositoryFactory::createMonthlyRollupRepository() {
+    return std::make_shared<MongoDBMonthlyRollupRepository>(shared_from_this());
+}
+
 bool MongoDBRepositoryFactory::testConnection() const {
     try {
-        auto admin_db = client_->database("admin");
+        auto client = pool_->acquire();
+        auto admin_db = client->database("admin");
         auto result = admin_db.run_command(bsoncxx::builder::stream::document{} 
             << "ping" << 1 
             << bsoncxx::builder::stream::finalize);
@@ -110,10 +132,42 @@ void MongoDBRepositoryFactory::reconnect() {
     // MongoDB client handles reconnection automatically
 }
 
-mongocxx::database MongoDBRepositoryFactory::getDatabase() const {
-    return client_->database(database_name_);
+MongoDBPooledCollection MongoDBRepositoryFactory::getCollection(const std::string& name) const {
+    return MongoDBPooledCollection(pool_->acquire(), database_name_, name);
+}
+
+MongoDBClientLease MongoDBRepositoryFactory::acquireClient() const {
+    return pool_->acquire();
+}
+
+MongoDBPoolStats MongoDBRepositoryFactory::getPoolStats() const {
+    return pool_->getStats();
 }
 
-mongocxx::client& MongoDBRepositoryFactory::getClient() const {
-    return *client_;
-}
\ No newline at end of file
+MongoDBIndexReport MongoDBRepositoryFactory::ensureIndexes() const {
+    return MongoDBIndexManager(*this).ensureIndexes();
+}
+
+MongoDBIndexReport MongoDBRepositoryFactory::verifyIndexes() const {
+    return MongoDBIndexManager(*this).verifyIndexes();
+}
+
+bsoncxx::document::value MongoDBRepositoryFactory::makeIdInFilter(const std::vector<UUID>& ids) {
+    auto idArray = bsoncxx::builder::basic::array{};
+    for (const auto& id : ids) {
+        idArray.append(id.toString());
+    }
+    
+    return bsoncxx::builder::stream::document{}
+        << "id" << bsoncxx::builder::stream::open_document
+            << "$in" << idArray.view()
+        << bsoncxx::builder::stream::close_document
+        << bsoncxx::builder::stream::finalize;
+}
+
+bsoncxx::document::value MongoDBRepositoryFactory::makeIdProjection() {
+    return bsoncxx::builder::stream::document{}
+        << "id" << 1
+        << "_id" << 0
+        << bsoncxx::builder::stream::finalize;
+}
@@ -3,7 +3,11 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 #include "IRepositoryFactory.hpp"
+#include "MongoDBClientPool.hpp"
+#include "MongoDBIndexManager.hpp"
+#include "../types/uuid.hpp"
 
 // MongoDB includes
 #include <mongocxx/client.hpp>
@@ -22,18 +26,23 @@ class MongoDBSubscriptionRepository;
 class MongoDBLessonRepository;
 class MongoDBEnrollmentRepository;
 class MongoDBAttendanceRepository;
+class MongoDBMonthlyRollupRepository;
 
 class MongoDBRepositoryFactory : 
     public IRepositoryFactory, 
     public std::enable_shared_from_this<MongoDBRepositoryFactory>  
 {
 private:
-    std::shared_ptr<mongocxx::client> client_;
+    std::shared_ptr<MongoDBClientPool> pool_;
     std::string database_name_;
 
 public:
+    // Размер пула, таймаут ожидания клиента и создание индексов берутся из Config (database.mongodb.*)
     explicit MongoDBRepositoryFactory(const std::string& connection_string, 
                                     const std::string& database_name);
+    MongoDBRepositoryFactory(const std::string& connection_string,
+                             const std::string& database_name,
+                             const MongoDBPoolOptions& pool_options);
     ~MongoDBRepositoryFactory() override;
 
     // Фабричные методы
@@ -49,14 +58,28 @@ public:
     std::shared_ptr<IBranchRepository> createBranchRepository() override;
     std::shared_ptr<IStudioRepository> createStudioRepository() override;
     std::shared_ptr<IAttendanceRepository> createAttendanceRepository() override;
+    std::shared_ptr<IMonthlyRollupRepository> createMonthlyRollupRepository() override;
 
     // Управление соединением
     bool testConnection() const override;
     void reconnect() override;
     
-    // Получение MongoDB-specific объектов
-    mongocxx::database getDatabase() const;
-    mongocxx::client& getClient() const;
+    // Коллекция на клиенте, арендованном из пула на время жизни возвращаемого объекта
+    MongoDBPooledCollection getCollection(const std::string& name) const;
+    MongoDBClientLease acquireClient() const;
+    const std::string& getDatabaseName() const { return database_name_; }
+
+    // Мониторинг пула
+    MongoDBPoolStats getPoolStats() const;
+
+    // Индексы под фильтры репозиториев (см. MongoDBIndexManager::declaredIndexes)
+    MongoDBIndexReport ensureIndexes() const;
+    MongoDBIndexReport verifyIndexes() const;
+
+    // Фильтр { id: { $in: [...] } } для пакетных запросов findByIds/existsMany
+    static bsoncxx::document::value makeIdInFilter(const std::vector<UUID>& ids);
+    // Проекция { id: 1, _id: 0 }: для проверки существования документ целиком не нужен
+    static bsoncxx::document::value makeIdProjection();
 };
 
 #endif // MONGODB_REPOSITORY_FACTORY_HPP
\ No newline at end of file
@@ -0,0 +1,51 @@
+#include "MongoDBTime.hpp"
+#include "DateTimeUtils.hpp"
+#include <bsoncxx/builder/basic/array.hpp>
+#include <bsoncxx/builder/basic/document.hpp>
+#include <bsoncxx/builder/basic/kvp.hpp>
+#include <string_view>
+
+bsoncxx::types::b_date MongoDBTime::toDate(const TimePoint& timePoint) {
+    return bsoncxx::types::b_date(std::chrono::duration_cast<std::chrono::milliseconds>(timePoint.time_since_epoch()));
+}
+
+MongoDBTime::TimePoint MongoDBTime::fromElement(const bsoncxx::document::element& element) {
+    if (element.type() == bsoncxx::type::k_date) {
+        return TimePoint(std::chrono::duration_cast<TimePoint::duration>(element.get_date().value));
+    }
+
+    // Документ еще не сконвертирован: разбираем строку без копирования
+    auto text = element.get_string().value;
+    return DateTimeUtils::parseTimeFromMongoDB(std::string_view(text.data(), text.size()));
+}
+
+bsoncxx::document::value MongoDBTime::rangeCondition(
+    const std::string& field, std::initializer_list<std::pair<const char*, TimePoint>> bounds) {
+    using bsoncxx::builder::basic::kvp;
+    using bsoncxx::builder::basic::make_array;
+    using bsoncxx::builder::basic::make_document;
+
+    bsoncxx::builder::basic::document asDate;
+    bsoncxx::builder::basic::document asString;
+    for (const auto& [op, timePoint] : bounds) {
+        asDate.append(kvp(op, toDate(timePoint)));
+        asString.append(kvp(op, DateTimeUtils::formatTimeForMongoDB(timePoint)));
+    }
+
+    return make_document(kvp("$or", make_array(
+        make_document(kvp(field, asDate.extract())),
+        make_document(kvp(field, asString.extract())))));
+}
+
+const std::vector<std::pair<std::string, std::vector<std::string>>>& MongoDBTime::timeFields() {
+    static const std::vector<std::pair<std::string, std::vector<std::string>>> fields = {
+        {"bookings", {"startTime", "endTime", "createdAt"}},
+        {"lessons", {"startTime", "endTime"}},
+        {"attendance", {"scheduledTime", "actualTime"}},
+        {"clients", {"registrationDate"}},
+        {"enrollments", {"enrollmentDate"}},
+        {"reviews", {"publicationDate"}},
+        {"subscriptions", {"startDate", "endDate", "purchaseDate"}}
+    };
+    return fields;
+}
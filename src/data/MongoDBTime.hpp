@@ -0,0 +1,37 @@
+#ifndef MONGODB_TIME_HPP
+#define MONGODB_TIME_HPP
+
+#include <bsoncxx/document/element.hpp>
+#include <bsoncxx/document/value.hpp>
+#include <bsoncxx/types.hpp>
+#include <chrono>
+#include <initializer_list>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Поля времени хранятся в MongoDB как BSON date (8 байт, миллисекунды UTC):
+// диапазонные запросы сравнивают числа, а чтение не разбирает текст.
+class MongoDBTime {
+public:
+    using TimePoint = std::chrono::system_clock::time_point;
+
+    static bsoncxx::types::b_date toDate(const TimePoint& timePoint);
+
+    // Принимает BSON date и, на время перехода, строку прежнего формата YYYY-MM-DDTHH:MM:SSZ
+    static TimePoint fromElement(const bsoncxx::document::element& element);
+
+    // Условие на поле времени для фильтра, например rangeCondition("startTime", {{"$lt", to}}).
+    // MongoDB сравнивает только значения одного BSON-типа, поэтому до конвертации
+    // (convert_mongo_dates) условие проверяется и для BSON date, и для строки прежнего формата:
+    // { $or: [ { field: { op: date } }, { field: { op: "YYYY-MM-DDTHH:MM:SSZ" } } ] }.
+    // Строки этого формата упорядочены так же, как моменты времени.
+    // Несколько условий объединяются через $and.
+    static bsoncxx::document::value rangeCondition(
+        const std::string& field, std::initializer_list<std::pair<const char*, TimePoint>> bounds);
+
+    // Поля времени по коллекциям (для конвертации существующих данных)
+    static const std::vector<std::pair<std::string, std::vector<std::string>>>& timeFields();
+};
+
+#endif // MONGODB_TIME_HPP
@@ -12,6 +12,7 @@
 #include "../repositories/impl/PostgreSQLSubscriptionRepository.hpp"
 #include "../repositories/impl/PostgreSQLSubscriptionTypeRepository.hpp"
 #include "../repositories/impl/PostgreSQLAttendanceRepository.hpp"
+#include "../repositories/impl/PostgreSQLMonthlyRollupRepository.hpp"
 
 PostgreSQLRepositoryFactory::PostgreSQLRepositoryFactory(const std::string& connectionString) {
     dbConnection_ = std::make_shared<DatabaseConnection>(connectionString);
@@ -65,10 +66,14 @@ std::shared_ptr<IAttendanceRepository> PostgreSQLRepositoryFactory::createAttend
     return std::make_shared<PostgreSQLAttendanceRepository>(dbConnection_);
 }
 
+std::shared_ptr<IMonthlyRollupRepository> PostgreSQLRepositoryFactory::createMonthlyRollupRepository() {
+    return std::make_shared<PostgreSQLMonthlyRollupRepository>(dbConnection_);
+}
+
 bool PostgreSQLRepositoryFactory::testConnection() const {
     try {
-        pqxx::connection& conn = dbConnection_->getConnection();
-        return conn.is_open();
+        auto conn = dbConnection_->acquireConnection();
+        return conn->is_open();
     } catch (...) {
         return false;
     }
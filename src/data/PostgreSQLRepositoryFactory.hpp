@@ -18,6 +18,7 @@
 #include "../repositories/ISubscriptionRepository.hpp"
 #include "../repositories/ISubscriptionTypeRepository.hpp"
 #include "../repositories/IAttendanceRepository.hpp"
+#include "../repositories/IMonthlyRollupRepository.hpp"
 
 // Forward declaration
 class DatabaseConnection;
@@ -47,6 +48,7 @@ public:
     std::shared_ptr<ISubscriptionRepository> createSubscriptionRepository() override;
     std::shared_ptr<ISubscriptionTypeRepository> createSubscriptionTypeRepository() override;
     std::shared_ptr<IAttendanceRepository> createAttendanceRepository() override;
+    std::shared_ptr<IMonthlyRollupRepository> createMonthlyRollupRepository() override;
 
     // Управление соединением 
     bool testConnection() const override;
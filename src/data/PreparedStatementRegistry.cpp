@@ -0,0 +1,99 @@
+#include "PreparedStatementRegistry.hpp"
+#include "exceptions/DataAccessException.hpp"
+#include <algorithm>
+#include <mutex>
+
+PreparedStatementRegistry& PreparedStatementRegistry::getInstance() {
+    static PreparedStatementRegistry instance;
+    return instance;
+}
+
+void PreparedStatementRegistry::registerStatement(const std::string& name, const std::string& sql) {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    auto it = statements_.find(name);
+    if (it != statements_.end()) {
+        if (it->second->sql != sql) {
+            throw QueryException("Prepared statement '" + name + "' is already registered with different SQL");
+        }
+        return;
+    }
+
+    auto entry = std::make_unique<Entry>();
+    entry->sql = sql;
+    statements_.emplace(name, std::move(entry));
+}
+
+bool PreparedStatementRegistry::isRegistered(const std::string& name) const {
+    return findEntry(name) != nullptr;
+}
+
+PreparedStatementRegistry::Entry* PreparedStatementRegistry::findEntry(const std::string& name) const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    auto it = statements_.find(name);
+    // Записи не удаляются, поэтому указатель остается валидным после снятия блокировки
+    return it != statements_.end() ? it->second.get() : nullptr;
+}
+
+void PreparedStatementRegistry::prepare(pqxx::connection& connection, const std::string& name) {
+    Entry* entry = findEntry(name);
+    if (!entry) {
+        throw QueryException("Unknown prepared statement: " + name);
+    }
+    connection.prepare(name, entry->sql);
+    entry->preparations.fetch_add(1, std::memory_order_relaxed);
+}
+
+void PreparedStatementRegistry::recordExecution(const std::string& name,
+                                                std::chrono::microseconds elapsed,
+                                                bool failed) {
+    Entry* entry = findEntry(name);
+    if (!entry) {
+        return;
+    }
+
+    auto micros = static_cast<std::uint64_t>(std::max<std::int64_t>(0, elapsed.count()));
+    entry->executions.fetch_add(1, std::memory_order_relaxed);
+    entry->totalMicros.fetch_add(micros, std::memory_order_relaxed);
+    if (failed) {
+        entry->failures.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    auto currentMax = entry->maxMicros.load(std::memory_order_relaxed);
+    while (micros > currentMax &&
+           !entry->maxMicros.compare_exchange_weak(currentMax, micros, std::memory_order_relaxed)) {
+    }
+}
+
+std::vector<PreparedStatementStats> PreparedStatementRegistry::getStats() const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    std::vector<PreparedStatementStats> result;
+    result.reserve(statements_.size());
+
+    for (const auto& [name, entry] : statements_) {
+        PreparedStatementStats stats;
+        stats.name = name;
+        stats.executions = entry->executions.load(std::memory_order_relaxed);
+        stats.preparations = entry->preparations.load(std::memory_order_relaxed);
+        stats.failures = entry->failures.load(std::memory_order_relaxed);
+        stats.totalTime = std::chrono::microseconds(entry->totalMicros.load(std::memory_order_relaxed));
+        stats.maxTime = std::chrono::microseconds(entry->maxMicros.load(std::memory_order_relaxed));
+        result.push_back(std::move(stats));
+    }
+
+    // Самые "дорогие" запросы - первыми
+    std::sort(result.begin(), result.end(), [](const auto& a, const auto& b) {
+        return a.totalTime > b.totalTime;
+    });
+    return result;
+}
+
+void PreparedStatementRegistry::resetStats() {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    for (auto& [name, entry] : statements_) {
+        entry->executions = 0;
+        entry->preparations = 0;
+        entry->failures = 0;
+        entry->totalMicros = 0;
+        entry->maxMicros = 0;
+    }
+}
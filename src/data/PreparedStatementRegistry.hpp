@@ -0,0 +1,62 @@
+#ifndef PREPAREDSTATEMENTREGISTRY_HPP
+#define PREPAREDSTATEMENTREGISTRY_HPP
+
+#include <pqxx/pqxx>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+struct PreparedStatementStats {
+    std::string name;
+    std::uint64_t executions = 0;
+    std::uint64_t preparations = 0;
+    std::uint64_t failures = 0;
+    std::chrono::microseconds totalTime{0};
+    std::chrono::microseconds maxTime{0};
+};
+
+// Реестр именованных запросов. Текст регистрируется один раз на процесс,
+// а на каждом соединении запрос подготавливается при первом использовании.
+class PreparedStatementRegistry {
+public:
+    static PreparedStatementRegistry& getInstance();
+
+    PreparedStatementRegistry(const PreparedStatementRegistry&) = delete;
+    PreparedStatementRegistry& operator=(const PreparedStatementRegistry&) = delete;
+
+    // Повторная регистрация с тем же текстом игнорируется, с другим - QueryException
+    void registerStatement(const std::string& name, const std::string& sql);
+    bool isRegistered(const std::string& name) const;
+
+    // Выполняет PREPARE на соединении; бросает QueryException для незарегистрированного имени
+    void prepare(pqxx::connection& connection, const std::string& name);
+
+    void recordExecution(const std::string& name, std::chrono::microseconds elapsed, bool failed);
+
+    std::vector<PreparedStatementStats> getStats() const;
+    void resetStats();
+
+private:
+    struct Entry {
+        std::string sql;
+        std::atomic<std::uint64_t> executions{0};
+        std::atomic<std::uint64_t> preparations{0};
+        std::atomic<std::uint64_t> failures{0};
+        std::atomic<std::uint64_t> totalMicros{0};
+        std::atomic<std::uint64_t> maxMicros{0};
+    };
+
+    PreparedStatementRegistry() = default;
+
+    Entry* findEntry(const std::string& name) const;
+
+    mutable std::shared_mutex mutex_;
+    std::unordered_map<std::string, std::unique_ptr<Entry>> statements_;
+};
+
+#endif // PREPAREDSTATEMENTREGISTRY_HPP
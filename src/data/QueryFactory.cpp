@@ -1,4 +1,6 @@
 #include "QueryFactory.hpp"
+#include "PreparedStatementRegistry.hpp"
+#include <mutex>
 
 // Все методы уже реализованы как статические в .cpp файле
 // Компилятор понимает это по объявлению в .hpp
@@ -12,6 +14,18 @@ std::string QueryFactory::createFindConflictingBookingsQuery() {
         "OVERLAPS ($2::timestamp, $2::timestamp + ($3 * interval '1 minute'))";
 }
 
+// $1 - массив залов, [$2, $3) - интервал. Продолжительность не превышает суток,
+// поэтому нижняя граница start_time позволяет использовать индекс по start_time
+std::string QueryFactory::createFindConflictingBookingsInRangeQuery() {
+    return 
+        "SELECT id, client_id, hall_id, start_time, duration_minutes, purpose, status, created_at "
+        "FROM bookings "
+        "WHERE hall_id = ANY($1::uuid[]) AND status IN ('PENDING', 'CONFIRMED') "
+        "AND start_time > $2::timestamp - interval '1 day' AND start_time < $3::timestamp "
+        "AND start_time + (duration_minutes * interval '1 minute') > $2::timestamp "
+        "ORDER BY hall_id, start_time";
+}
+
 std::string QueryFactory::createFindConflictingLessonsQuery() {
     return 
         "SELECT id, type, name, description, start_time, duration_minutes, "
@@ -23,6 +37,18 @@ std::string QueryFactory::createFindConflictingLessonsQuery() {
         "OVERLAPS ($2::timestamp, $2::timestamp + ($3 * interval '1 minute'))";
 }
 
+std::string QueryFactory::createFindConflictingLessonsInRangeQuery() {
+    return 
+        "SELECT id, type, name, description, start_time, duration_minutes, "
+        "difficulty, max_participants, current_participants, price, status, "
+        "trainer_id, hall_id "
+        "FROM lessons "
+        "WHERE hall_id = ANY($1::uuid[]) AND status IN ('SCHEDULED', 'ONGOING') "
+        "AND start_time > $2::timestamp - interval '1 day' AND start_time < $3::timestamp "
+        "AND start_time + (duration_minutes * interval '1 minute') > $2::timestamp "
+        "ORDER BY hall_id, start_time";
+}
+
 std::string QueryFactory::createFindUpcomingLessonsQuery() {
     return 
         "SELECT id, type, name, description, start_time, duration_minutes, "
@@ -119,4 +145,28 @@ std::string QueryFactory::createFindAttendanceByClientAndPeriodQuery() {
         AND scheduled_time BETWEEN $2 AND $3
         ORDER BY scheduled_time DESC
     )";
-}
\ No newline at end of file
+}
+void QueryFactory::registerPreparedStatements() {
+    static std::once_flag registered;
+    std::call_once(registered, []() {
+        auto& registry = PreparedStatementRegistry::getInstance();
+        registry.registerStatement(Statements::FIND_CONFLICTING_BOOKINGS, createFindConflictingBookingsQuery());
+        registry.registerStatement(Statements::FIND_CONFLICTING_LESSONS, createFindConflictingLessonsQuery());
+        registry.registerStatement(Statements::FIND_CONFLICTING_BOOKINGS_IN_RANGE, createFindConflictingBookingsInRangeQuery());
+        registry.registerStatement(Statements::FIND_CONFLICTING_LESSONS_IN_RANGE, createFindConflictingLessonsInRangeQuery());
+        registry.registerStatement(Statements::FIND_UPCOMING_LESSONS, createFindUpcomingLessonsQuery());
+        registry.registerStatement(Statements::GET_AVERAGE_RATING_FOR_TRAINER, createGetAverageRatingForTrainerQuery());
+        registry.registerStatement(Statements::COUNT_ENROLLMENTS_BY_LESSON, createCountEnrollmentsByLessonQuery());
+        registry.registerStatement(Statements::FIND_EXPIRING_SUBSCRIPTIONS, createFindExpiringSubscriptionsQuery());
+        registry.registerStatement(Statements::FIND_TRAINERS_BY_SPECIALIZATION, createFindBySpecializationQuery());
+        registry.registerStatement(Statements::GET_TRAINER_SPECIALIZATIONS, createGetTrainerSpecializationsQuery());
+        registry.registerStatement(Statements::FIND_BRANCHES_WITH_ADDRESS, createFindBranchesWithAddressQuery());
+        registry.registerStatement(Statements::FIND_MAIN_STUDIO, createFindMainStudioQuery());
+        registry.registerStatement(Statements::FIND_HALLS_BY_BRANCH_ID, createFindByBranchIdQuery());
+        registry.registerStatement(Statements::FIND_REVIEW_BY_CLIENT_AND_LESSON, createFindByClientAndLessonQuery());
+        registry.registerStatement(Statements::FIND_PENDING_MODERATION_REVIEWS, createFindPendingModerationQuery());
+        registry.registerStatement(Statements::FIND_ACTIVE_SUBSCRIPTIONS, createFindActiveSubscriptionsQuery());
+        registry.registerStatement(Statements::FIND_ALL_ACTIVE_SUBSCRIPTION_TYPES, createFindAllActiveSubscriptionTypesQuery());
+        registry.registerStatement(Statements::FIND_ATTENDANCE_BY_CLIENT_AND_PERIOD, createFindAttendanceByClientAndPeriodQuery());
+    });
+}
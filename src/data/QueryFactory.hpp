@@ -5,11 +5,38 @@
 
 class QueryFactory {
 public:
+    // Имена, под которыми запросы регистрируются в PreparedStatementRegistry
+    struct Statements {
+        static constexpr const char* FIND_CONFLICTING_BOOKINGS = "find_conflicting_bookings";
+        static constexpr const char* FIND_CONFLICTING_LESSONS = "find_conflicting_lessons";
+        static constexpr const char* FIND_CONFLICTING_BOOKINGS_IN_RANGE = "find_conflicting_bookings_in_range";
+        static constexpr const char* FIND_CONFLICTING_LESSONS_IN_RANGE = "find_conflicting_lessons_in_range";
+        static constexpr const char* FIND_UPCOMING_LESSONS = "find_upcoming_lessons";
+        static constexpr const char* GET_AVERAGE_RATING_FOR_TRAINER = "get_average_rating_for_trainer";
+        static constexpr const char* COUNT_ENROLLMENTS_BY_LESSON = "count_enrollments_by_lesson";
+        static constexpr const char* FIND_EXPIRING_SUBSCRIPTIONS = "find_expiring_subscriptions";
+        static constexpr const char* FIND_TRAINERS_BY_SPECIALIZATION = "find_trainers_by_specialization";
+        static constexpr const char* GET_TRAINER_SPECIALIZATIONS = "get_trainer_specializations";
+        static constexpr const char* FIND_BRANCHES_WITH_ADDRESS = "find_branches_with_address";
+        static constexpr const char* FIND_MAIN_STUDIO = "find_main_studio";
+        static constexpr const char* FIND_HALLS_BY_BRANCH_ID = "find_halls_by_branch_id";
+        static constexpr const char* FIND_REVIEW_BY_CLIENT_AND_LESSON = "find_review_by_client_and_lesson";
+        static constexpr const char* FIND_PENDING_MODERATION_REVIEWS = "find_pending_moderation_reviews";
+        static constexpr const char* FIND_ACTIVE_SUBSCRIPTIONS = "find_active_subscriptions";
+        static constexpr const char* FIND_ALL_ACTIVE_SUBSCRIPTION_TYPES = "find_all_active_subscription_types";
+        static constexpr const char* FIND_ATTENDANCE_BY_CLIENT_AND_PERIOD = "find_attendance_by_client_and_period";
+    };
+
+    // Регистрирует все запросы фабрики; безопасно вызывать многократно
+    static void registerPreparedStatements();
+
     // Booking queries
     static std::string createFindConflictingBookingsQuery();
+    static std::string createFindConflictingBookingsInRangeQuery();
     
     // Lesson queries  
     static std::string createFindConflictingLessonsQuery();
+    static std::string createFindConflictingLessonsInRangeQuery();
     static std::string createFindUpcomingLessonsQuery();
     
     // Review queries
@@ -6,11 +6,24 @@
 #include "IRepositoryFactory.hpp"
 #include "PostgreSQLRepositoryFactory.hpp"
 #include "MongoDBRepositoryFactory.hpp"
+#include "CachingRepositoryFactory.hpp"
 #include "../core/Config.hpp"
 
 class RepositoryFactoryCreator {
 public:
+    // Фабрика выбранной БД; при cache.repositories.enabled - в обертке CachingRepositoryFactory
     static std::shared_ptr<IRepositoryFactory> createFactory(const Config& config) {
+        auto factory = createDatabaseFactory(config);
+        
+        auto cacheSettings = config.getRepositoryCacheSettings();
+        if (cacheSettings.enabled) {
+            return std::make_shared<CachingRepositoryFactory>(factory, cacheSettings);
+        }
+        return factory;
+    }
+
+private:
+    static std::shared_ptr<IRepositoryFactory> createDatabaseFactory(const Config& config) {
         std::string dbType = config.getDatabaseType();
         
         if (dbType == "postgres") {
@@ -1,10 +1,20 @@
 #include "ResilientDatabaseConnection.hpp"
+#include "exceptions/DataAccessException.hpp"
 #include "../services/DatabaseHealthService.hpp"
+#include "../core/Config.hpp"
 #include <iostream>
 
 ResilientDatabaseConnection::ResilientDatabaseConnection(const std::string& connectionString)
-    : DatabaseConnection(connectionString) {
+    : DatabaseConnection(connectionString, ConnectionPoolOptions::fromConfig(Config::getInstance()),
+                         StartupMode::Deferred) {
     setRetryPolicy(3, std::chrono::milliseconds(2000));
+    try {
+        warmUpPool();
+    } catch (const std::exception& e) {
+        DatabaseHealthService::markDatabaseUnhealthy(retryDelay_);
+        std::cerr << "⚠️ БД недоступна при запуске, подключение будет восстановлено позже: "
+                  << e.what() << std::endl;
+    }
 }
 
 void ResilientDatabaseConnection::setRetryPolicy(int maxRetries, std::chrono::milliseconds retryDelay) {
@@ -12,47 +22,61 @@ void ResilientDatabaseConnection::setRetryPolicy(int maxRetries, std::chrono::mi
     retryDelay_ = retryDelay;
 }
 
-pqxx::connection& ResilientDatabaseConnection::getConnection() {
-    // Проверяем глобальное состояние БД
+void ResilientDatabaseConnection::setValidationInterval(std::chrono::milliseconds interval) {
+    validationInterval_ = interval;
+}
+
+PooledConnection ResilientDatabaseConnection::acquireConnection() {
+    // Проверяем глобальное состояние БД (без ожидания: пока идет backoff, отказываем сразу)
     if (!DatabaseHealthService::shouldRetryConnection()) {
-        throw std::runtime_error("Database is marked as unhealthy. Please wait before retrying.");
+        throw ConnectionException("Database is marked as unhealthy. Please wait before retrying.");
     }
     
     for (int attempt = 1; attempt <= maxRetries_; ++attempt) {
+        PooledConnection conn;
         try {
-            auto& conn = DatabaseConnection::getConnection();
-            
-            // Проверяем, что соединение действительно работает
-            pqxx::work testWork(conn);
-            testWork.exec("SELECT 1");
-            testWork.commit();
-            
-            DatabaseHealthService::markDatabaseHealthy();
-            successCount_++;
-            return conn;
-            
+            conn = DatabaseConnection::acquireConnection();
+        } catch (const ConnectionPoolTimeoutException&) {
+            // Пул исчерпан, но БД доступна - повтор только удлинит ожидание
+            throw;
         } catch (const std::exception& e) {
+            // Новое соединение не открывается: дальнейшие попытки на этом потоке бессмысленны
             retryCount_++;
-            std::cerr << "⚠️ Connection attempt " << attempt << "/" << maxRetries_ 
-                      << " failed: " << e.what() << std::endl;
-            
-            if (attempt == maxRetries_) {
-                // Последняя попытка неудачна - помечаем БД как нездоровую
-                DatabaseHealthService::markDatabaseUnhealthy();
-                std::cerr << "💥 All connection attempts failed. Marking database as unhealthy." << std::endl;
-                throw;
-            } else {
-                std::cout << "🔄 Retrying in " << retryDelay_.count() << "ms..." << std::endl;
-                std::this_thread::sleep_for(retryDelay_);
-            }
+            DatabaseHealthService::markDatabaseUnhealthy(retryDelay_);
+            std::cerr << "💥 Connection attempt failed: " << e.what()
+                      << ". Marking database as unhealthy." << std::endl;
+            throw;
+        }
+        
+        // Недавно использованное соединение выдаем без проверочного запроса:
+        // разрыв обнаружится по ошибке самого запроса (DatabaseTransaction)
+        if (conn.idleTime() < validationInterval_ || isAlive(conn)) {
+            successCount_++;
+            return conn;
         }
+        
+        retryCount_++;
+        conn.markBroken();
+        std::cerr << "⚠️ Stale pooled connection dropped (attempt " << attempt << "/" << maxRetries_ << ")" << std::endl;
     }
     
-    throw std::runtime_error("Failed to establish database connection after " + 
-                           std::to_string(maxRetries_) + " attempts");
+    DatabaseHealthService::reportConnectionFailure();
+    throw ConnectionException("Failed to obtain a live database connection after " + 
+                              std::to_string(maxRetries_) + " attempts");
+}
+
+bool ResilientDatabaseConnection::isAlive(PooledConnection& connection) {
+    try {
+        pqxx::nontransaction probe(connection.get());
+        probe.exec("SELECT 1");
+        DatabaseHealthService::recordSuccess();
+        return true;
+    } catch (const std::exception&) {
+        return false;
+    }
 }
 
-pqxx::work ResilientDatabaseConnection::beginTransaction() {
+DatabaseTransaction ResilientDatabaseConnection::beginTransaction() {
     try {
         return DatabaseConnection::beginTransaction(); 
     } catch (const std::exception& e) {
@@ -61,6 +85,15 @@ pqxx::work ResilientDatabaseConnection::beginTransaction() {
     }
 }
 
+DatabaseTransaction ResilientDatabaseConnection::beginReadTransaction() {
+    try {
+        return DatabaseConnection::beginReadTransaction();
+    } catch (const std::exception& e) {
+        std::cerr << "❌ Read transaction failed: " << e.what() << std::endl;
+        throw;
+    }
+}
+
 bool ResilientDatabaseConnection::executeWithRetry(const std::function<void()>& operation) {
     if (!DatabaseHealthService::shouldRetryConnection()) {
         return false;
@@ -69,20 +102,15 @@ bool ResilientDatabaseConnection::executeWithRetry(const std::function<void()>&
     for (int attempt = 1; attempt <= maxRetries_; ++attempt) {
         try {
             operation();
-            DatabaseHealthService::markDatabaseHealthy();
+            DatabaseHealthService::recordSuccess();
             return true;
         } catch (const std::exception& e) {
+            // Повторяем сразу: разорванное соединение уже исключено из пула
             std::cerr << "⚠️ Operation attempt " << attempt << "/" << maxRetries_ 
                       << " failed: " << e.what() << std::endl;
-            
-            if (attempt == maxRetries_) {
-                DatabaseHealthService::markDatabaseUnhealthy();
-                return false;
-            } else {
-                std::cout << "🔄 Retrying operation in " << retryDelay_.count() << "ms..." << std::endl;
-                std::this_thread::sleep_for(retryDelay_);
-            }
         }
     }
+    
+    DatabaseHealthService::markDatabaseUnhealthy(retryDelay_);
     return false;
-}
\ No newline at end of file
+}
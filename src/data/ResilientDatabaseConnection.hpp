@@ -8,15 +8,21 @@
 
 class ResilientDatabaseConnection : public DatabaseConnection {
 public:
+    // Недоступность БД при старте не является ошибкой: БД помечается нездоровой,
+    // соединения открываются при первом обращении после восстановления
     explicit ResilientDatabaseConnection(const std::string& connectionString);
     ~ResilientDatabaseConnection() override = default;
 
-    // Политика повторных попыток
+    // Политика повторных попыток: retryDelay - базовая задержка backoff после отказа БД.
+    // Повторные попытки не ждут на потоке запроса
     void setRetryPolicy(int maxRetries, std::chrono::milliseconds retryDelay);
+    // Соединение, простаивавшее в пуле дольше интервала, проверяется перед выдачей
+    void setValidationInterval(std::chrono::milliseconds interval);
     
     // Переопределяем методы с устойчивостью к ошибкам
-    pqxx::connection& getConnection() override;
-    pqxx::work beginTransaction() override;
+    PooledConnection acquireConnection() override;
+    DatabaseTransaction beginTransaction() override;
+    DatabaseTransaction beginReadTransaction() override;
     
     // Дополнительные методы для мониторинга
     int getRetryCount() const { return retryCount_; }
@@ -25,10 +31,12 @@ public:
 private:
     int maxRetries_ = 3;
     std::chrono::milliseconds retryDelay_ = std::chrono::milliseconds(1000);
+    std::chrono::milliseconds validationInterval_ = std::chrono::seconds(30);
     std::atomic<int> retryCount_{0};
     std::atomic<int> successCount_{0};
     
     bool executeWithRetry(const std::function<void()>& operation);
+    bool isAlive(PooledConnection& connection);
 };
 
 #endif // RESILIENTDATABASECONNECTION_HPP
\ No newline at end of file
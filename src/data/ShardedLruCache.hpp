@@ -0,0 +1,197 @@
+#ifndef SHARDED_LRU_CACHE_HPP
+#define SHARDED_LRU_CACHE_HPP
+
+#include "../types/uuid.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+// Параметры кеша одного типа сущностей
+struct CachePolicy {
+    std::size_t capacity = 10000;
+    std::size_t shards = 16;
+    std::chrono::seconds ttl{60};
+    // Срок хранения отрицательного результата ("не найдено"); 0 - промахи не кешируются
+    std::chrono::seconds negativeTtl{5};
+};
+
+struct CacheStats {
+    std::uint64_t hits = 0;
+    std::uint64_t negativeHits = 0;  // входят в hits
+    std::uint64_t misses = 0;
+    std::uint64_t evictions = 0;     // вытеснения по LRU при заполнении сегмента
+    std::uint64_t expirations = 0;
+    std::uint64_t invalidations = 0;
+    std::size_t size = 0;
+
+    double hitRate() const {
+        auto total = hits + misses;
+        return total == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(total);
+    }
+};
+
+// LRU-кеш по UUID, разбитый на независимо блокируемые сегменты. Хранит как найденные
+// значения, так и отрицательные результаты поиска (std::nullopt) со своим сроком жизни.
+// Запись, загруженная из БД до инвалидации ключа, не попадает в кеш: put принимает
+// номер версии сегмента, полученный до загрузки (см. version()).
+template <typename Value>
+class ShardedLruCache {
+public:
+    // Результат поиска: пустой - промах; содержит nullopt - закешированное "не найдено"
+    using Lookup = std::optional<std::optional<Value>>;
+
+    explicit ShardedLruCache(const CachePolicy& policy)
+        : policy_(policy),
+          shards_(std::max<std::size_t>(policy.shards, 1)) {
+        shardCapacity_ = std::max<std::size_t>(1, (policy_.capacity + shards_.size() - 1) / shards_.size());
+    }
+
+    ShardedLruCache(const ShardedLruCache&) = delete;
+    ShardedLruCache& operator=(const ShardedLruCache&) = delete;
+
+    Lookup get(const UUID& key) {
+        auto& shard = shardFor(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+
+        auto it = shard.index.find(key);
+        if (it == shard.index.end()) {
+            misses_.fetch_add(1, std::memory_order_relaxed);
+            return std::nullopt;
+        }
+
+        auto entry = it->second;
+        if (entry->expiresAt <= Clock::now()) {
+            shard.entries.erase(entry);
+            shard.index.erase(it);
+            expirations_.fetch_add(1, std::memory_order_relaxed);
+            misses_.fetch_add(1, std::memory_order_relaxed);
+            return std::nullopt;
+        }
+
+        shard.entries.splice(shard.entries.begin(), shard.entries, entry);
+        hits_.fetch_add(1, std::memory_order_relaxed);
+        if (!entry->value) {
+            negativeHits_.fetch_add(1, std::memory_order_relaxed);
+        }
+        return entry->value;
+    }
+
+    // Номер версии сегмента ключа; берется до загрузки значения из БД и передается в put
+    std::uint64_t version(const UUID& key) const {
+        const auto& shard = shardFor(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        return shard.version;
+    }
+
+    // Сохраняет значение (nullopt - "не найдено"), если с момента version() сегмент не инвалидировался
+    void put(const UUID& key, std::optional<Value> value, std::uint64_t expectedVersion) {
+        auto ttl = value ? policy_.ttl : policy_.negativeTtl;
+        if (ttl.count() <= 0) {
+            return;
+        }
+
+        auto& shard = shardFor(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        if (shard.version != expectedVersion) {
+            return;
+        }
+
+        auto it = shard.index.find(key);
+        if (it != shard.index.end()) {
+            shard.entries.erase(it->second);
+            shard.index.erase(it);
+        }
+
+        shard.entries.push_front(Entry{key, std::move(value), Clock::now() + ttl});
+        shard.index[key] = shard.entries.begin();
+
+        while (shard.entries.size() > shardCapacity_) {
+            shard.index.erase(shard.entries.back().key);
+            shard.entries.pop_back();
+            evictions_.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    void invalidate(const UUID& key) {
+        auto& shard = shardFor(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        ++shard.version;
+        auto it = shard.index.find(key);
+        if (it != shard.index.end()) {
+            shard.entries.erase(it->second);
+            shard.index.erase(it);
+        }
+        invalidations_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void clear() {
+        for (auto& shard : shards_) {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            ++shard.version;
+            shard.entries.clear();
+            shard.index.clear();
+        }
+        invalidations_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    CacheStats stats() const {
+        CacheStats stats;
+        stats.hits = hits_.load(std::memory_order_relaxed);
+        stats.negativeHits = negativeHits_.load(std::memory_order_relaxed);
+        stats.misses = misses_.load(std::memory_order_relaxed);
+        stats.evictions = evictions_.load(std::memory_order_relaxed);
+        stats.expirations = expirations_.load(std::memory_order_relaxed);
+        stats.invalidations = invalidations_.load(std::memory_order_relaxed);
+        for (const auto& shard : shards_) {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            stats.size += shard.entries.size();
+        }
+        return stats;
+    }
+
+    const CachePolicy& policy() const { return policy_; }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Entry {
+        UUID key;
+        std::optional<Value> value;
+        Clock::time_point expiresAt;
+    };
+
+    struct Shard {
+        mutable std::mutex mutex;
+        std::list<Entry> entries;  // от недавно использованных к давно использованным
+        std::unordered_map<UUID, typename std::list<Entry>::iterator> index;
+        std::uint64_t version = 0;
+    };
+
+    CachePolicy policy_;
+    std::vector<Shard> shards_;
+    std::size_t shardCapacity_ = 1;
+
+    std::atomic<std::uint64_t> hits_{0};
+    std::atomic<std::uint64_t> negativeHits_{0};
+    std::atomic<std::uint64_t> misses_{0};
+    std::atomic<std::uint64_t> evictions_{0};
+    std::atomic<std::uint64_t> expirations_{0};
+    std::atomic<std::uint64_t> invalidations_{0};
+
+    Shard& shardFor(const UUID& key) {
+        return shards_[std::hash<UUID>{}(key) % shards_.size()];
+    }
+
+    const Shard& shardFor(const UUID& key) const {
+        return shards_[std::hash<UUID>{}(key) % shards_.size()];
+    }
+};
+
+#endif // SHARDED_LRU_CACHE_HPP
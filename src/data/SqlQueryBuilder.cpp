@@ -271,6 +271,34 @@ void SqlQueryBuilder::reset() {
     hasOffset_ = false;
 }
 
+std::string SqlQueryBuilder::arrayLiteral(const std::vector<std::string>& values) {
+    std::string literal = "{";
+    for (size_t i = 0; i < values.size(); ++i) {
+        if (i > 0) {
+            literal += ',';
+        }
+        literal += '"';
+        for (char c : values[i]) {
+            if (c == '"' || c == '\\') {
+                literal += '\\';
+            }
+            literal += c;
+        }
+        literal += '"';
+    }
+    literal += '}';
+    return literal;
+}
+
+std::string SqlQueryBuilder::uuidArrayLiteral(const std::vector<UUID>& ids) {
+    std::vector<std::string> values;
+    values.reserve(ids.size());
+    for (const auto& id : ids) {
+        values.push_back(id.toString());
+    }
+    return arrayLiteral(values);
+}
+
 std::string SqlQueryBuilder::joinTypeToString(JoinType type) {
     switch (type) {
         case JoinType::INNER: return "INNER";
@@ -6,6 +6,7 @@
 #include <map>
 #include <sstream>
 #include <memory>
+#include "../types/uuid.hpp"
 
 class SqlQueryBuilder {
 public:
@@ -54,6 +55,10 @@ public:
     // Очистка билдера для нового запроса
     void reset();
 
+    // Литерал массива PostgreSQL ('{"a","b"}') для параметров вида $1::uuid[]
+    static std::string arrayLiteral(const std::vector<std::string>& values);
+    static std::string uuidArrayLiteral(const std::vector<UUID>& ids);
+
 private:
     std::string queryType_;
     std::vector<std::string> selectColumns_;
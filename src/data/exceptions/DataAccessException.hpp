@@ -16,6 +16,13 @@ public:
         : DataAccessException(message) {}
 };
 
+// Пул исчерпан: свободное соединение не появилось за отведенное время
+class ConnectionPoolTimeoutException : public ConnectionException {
+public:
+    explicit ConnectionPoolTimeoutException(const std::string& message)
+        : ConnectionException(message) {}
+};
+
 class QueryException : public DataAccessException {
 public:
     explicit QueryException(const std::string& message)
@@ -4,7 +4,9 @@
 #include "../types/uuid.hpp"
 #include "../models/TimeSlot.hpp"
 #include "../models/Booking.hpp"
+#include <chrono>
 #include <string>
+#include <vector>
 
 struct BookingRequestDTO {
     UUID clientId;
@@ -40,4 +42,11 @@ struct BookingResponseDTO {
                       const std::string& purpose, const std::string& createdAt);
 };
 
+// Свободные слоты одного зала на одни местные сутки филиала
+struct HallDayAvailabilityDTO {
+    UUID hallId;
+    std::chrono::system_clock::time_point dayStart; // начало суток филиала в UTC
+    std::vector<TimeSlot> availableSlots;
+};
+
 #endif // BOOKINGDTO_HPP
\ No newline at end of file
@@ -2,6 +2,7 @@
 #include <memory>
 #include <filesystem>
 #include <fstream>
+#include <algorithm>
 #include "tech_ui/TechUI.hpp"
 #include "core/Logger.hpp"
 #include "core/Config.hpp"
@@ -57,15 +58,44 @@ void initializeLogging() {
     auto& config = Config::getInstance();
     auto& logger = Logger::getInstance();
     
-    std::string logLevelStr = config.getLogLevel();
-    std::string logFilePath = config.getLogFilePath();
+    auto settings = config.snapshot()->logging;
     
-    LogLevel logLevel = LogLevel::INFO;
-    if (logLevelStr == "DEBUG") logLevel = LogLevel::DEBUG;
-    else if (logLevelStr == "WARNING") logLevel = LogLevel::WARNING;
-    else if (logLevelStr == "ERROR") logLevel = LogLevel::ERROR;
+    LoggerOptions options;
+    options.async = settings.async;
+    options.bufferCapacity = static_cast<std::size_t>(std::max(1, settings.bufferCapacity));
+    options.overflowPolicy = LoggerOptions::parseOverflowPolicy(settings.overflowPolicy);
+    options.flushInterval = std::chrono::milliseconds(std::max(1, settings.flushIntervalMs));
+    options.maxFileSizeBytes = static_cast<std::size_t>(std::max(0, settings.maxFileSizeMB)) * 1024 * 1024;
+    options.backupCount = settings.backupCount;
+    options.compressBackups = settings.compressBackups;
     
-    logger.initialize(logFilePath, logLevel);
+    logger.initialize(settings.filePath, Logger::parseLevel(settings.level), options);
+}
+
+// Горячая перезагрузка: уровень логирования применяется сразу,
+// остальные параметры подключения и логгера требуют перезапуска
+void watchConfiguration() {
+    auto& config = Config::getInstance();
+    if (config.getConfigFilePath().empty()) {
+        return;
+    }
+    
+    config.addChangeListener([](const ConfigSnapshot& previous, const ConfigSnapshot& current) {
+        if (previous.logging.level != current.logging.level) {
+            Logger::getInstance().setLogLevel(Logger::parseLevel(current.logging.level));
+            LOG_INFO("Config", "Уровень логирования изменен: " << previous.logging.level
+                     << " -> " << current.logging.level);
+        }
+        if (previous.database != current.database) {
+            LOG_WARNING("Config", "Параметры базы данных изменены, они вступят в силу после перезапуска");
+        }
+    });
+    
+    try {
+        config.startWatching();
+    } catch (const std::exception& e) {
+        std::cerr << "⚠️  Отслеживание изменений конфигурации недоступно: " << e.what() << std::endl;
+    }
 }
 
 std::string getLastDatabaseType() {
@@ -158,6 +188,7 @@ int main() {
         ensureDirectoriesExist();
         loadConfiguration();
         initializeLogging();
+        watchConfiguration();
         
         auto& logger = Logger::getInstance();
         auto& config = Config::getInstance();
@@ -180,6 +211,8 @@ int main() {
         techUI.run();
         
         logger.info("Приложение завершено", "Main");
+        config.stopWatching();
+        logger.shutdown();
         std::cout << "👋 Завершение работы системы" << std::endl;
         
         return 0;
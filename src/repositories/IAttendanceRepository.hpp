@@ -1,10 +1,53 @@
 #pragma once
 #include "../types/uuid.hpp"
 #include "../models/Attendance.hpp"
+#include <array>
+#include <functional>
+#include <map>
 #include <memory>
 #include <optional>
+#include <set>
 #include <vector>
 
+// Количество записей посещаемости в разрезе тип × статус
+struct AttendanceCounts {
+    std::array<std::array<int, 4>, 2> values{};  // [AttendanceType][AttendanceStatus]
+
+    int get(AttendanceType type, AttendanceStatus status) const {
+        return values[static_cast<std::size_t>(type)][static_cast<std::size_t>(status)];
+    }
+    void add(AttendanceType type, AttendanceStatus status, int count) {
+        values[static_cast<std::size_t>(type)][static_cast<std::size_t>(status)] += count;
+    }
+
+    // Записи с итоговым статусом (без SCHEDULED) по обоим типам
+    int visited() const {
+        return get(AttendanceType::LESSON, AttendanceStatus::VISITED) + get(AttendanceType::BOOKING, AttendanceStatus::VISITED);
+    }
+    int resolved() const {
+        int total = 0;
+        for (const auto& byStatus : values) {
+            total += byStatus[static_cast<std::size_t>(AttendanceStatus::VISITED)]
+                   + byStatus[static_cast<std::size_t>(AttendanceStatus::CANCELLED)]
+                   + byStatus[static_cast<std::size_t>(AttendanceStatus::NO_SHOW)];
+        }
+        return total;
+    }
+};
+
+struct AttendanceBreakdown {
+    AttendanceCounts totals;
+    std::map<UUID, AttendanceCounts> byClient;  // заполняется только при includeClients
+};
+
+struct ClientAttendanceSummary {
+    UUID clientId;
+    std::string clientName;
+    AttendanceCounts counts;
+};
+
+using ClientAttendanceSummaryConsumer = std::function<void(const ClientAttendanceSummary&)>;
+
 class IAttendanceRepository {
 public:
     virtual ~IAttendanceRepository() = default;
@@ -21,9 +64,21 @@ public:
     virtual bool update(const Attendance& attendance) = 0;
     virtual bool remove(const UUID& id) = 0;
     virtual bool exists(const UUID& id) = 0;
+    virtual std::vector<Attendance> findByIds(const std::vector<UUID>& ids) = 0;
+    virtual std::set<UUID> existsMany(const std::vector<UUID>& ids) = 0;
     
     // Статистические методы
     virtual int countByClientAndStatus(const UUID& clientId, AttendanceStatus status) = 0;
     virtual int countByTypeAndStatus(AttendanceType type, AttendanceStatus status) = 0;
     virtual std::vector<std::pair<UUID, int>> getTopClientsByVisits(int limit) = 0;
+
+    // Все счетчики тип × статус одним запросом вместо серии countBy*
+    virtual AttendanceBreakdown aggregateCounts(bool includeClients) = 0;
+    virtual AttendanceCounts aggregateClientCounts(const UUID& clientId) = 0;
+
+    // Сводка по всем клиентам, включая клиентов без посещений: по убыванию доли посещений,
+    // затем по имени. limit <= 0 - без ограничения
+    virtual std::vector<ClientAttendanceSummary> findClientSummaries(int limit) = 0;
+    // Потоковый обход сводок пачками по batchSize клиентов в порядке id: в памяти одна пачка
+    virtual void streamClientSummaries(int batchSize, const ClientAttendanceSummaryConsumer& consumer) = 0;
 };
\ No newline at end of file
@@ -1,8 +1,10 @@
 #pragma once
 #include "../types/uuid.hpp"
 #include "../models/Booking.hpp"
+#include <chrono>
 #include <memory>
 #include <optional>
+#include <set>
 #include <vector>
 
 class IBookingRepository {
@@ -13,9 +15,22 @@ public:
     virtual std::vector<Booking> findByClientId(const UUID&  clientId) = 0;
     virtual std::vector<Booking> findByHallId(const UUID&  hallId) = 0;
     virtual std::vector<Booking> findConflictingBookings(const UUID&  hallId, const TimeSlot& timeSlot) = 0;
+    // Активные бронирования нескольких залов, пересекающие интервал [from, to), одним запросом
+    virtual std::vector<Booking> findConflictingBookingsInRange(const std::vector<UUID>& hallIds,
+                                                                const std::chrono::system_clock::time_point& from,
+                                                                const std::chrono::system_clock::time_point& to) = 0;
+    // Бронирования любого статуса, начинающиеся в [from, to], по времени начала (для расписаний)
+    virtual std::vector<Booking> findByHallsAndRange(const std::vector<UUID>& hallIds,
+                                                     const std::chrono::system_clock::time_point& from,
+                                                     const std::chrono::system_clock::time_point& to) = 0;
+    virtual std::vector<Booking> findByBranchAndRange(const UUID& branchId,
+                                                      const std::chrono::system_clock::time_point& from,
+                                                      const std::chrono::system_clock::time_point& to) = 0;
     virtual std::vector<Booking> findAll() = 0;
     virtual bool save(const Booking& booking) = 0;
     virtual bool update(const Booking& booking) = 0;
     virtual bool remove(const UUID& id) = 0;
     virtual bool exists(const UUID&  id) = 0;
+    virtual std::vector<Booking> findByIds(const std::vector<UUID>& ids) = 0;
+    virtual std::set<UUID> existsMany(const std::vector<UUID>& ids) = 0;
 };
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include "../models/Client.hpp"
 #include <memory>
 #include <optional>
+#include <set>
 
 class IClientRepository {
 public:
@@ -11,8 +12,11 @@ public:
     virtual std::optional<Client> findById(const UUID& id) = 0;
     virtual std::optional<Client> findByEmail(const std::string& email) = 0;
     virtual std::vector<Client> findAll() = 0;
+    virtual int count() = 0;
     virtual bool save(const Client& client) = 0;
     virtual bool update(const Client& client) = 0;
     virtual bool remove(const UUID& id) = 0;
     virtual bool exists(const UUID& id) = 0;
+    virtual std::vector<Client> findByIds(const std::vector<UUID>& ids) = 0;
+    virtual std::set<UUID> existsMany(const std::vector<UUID>& ids) = 0;
 };
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include "../models/DanceHall.hpp"
 #include <memory>
 #include <optional>
+#include <set>
 #include <vector>
 
 class IDanceHallRepository {
@@ -12,6 +13,8 @@ public:
     virtual std::optional<DanceHall> findById(const UUID& id) = 0; 
     virtual std::vector<DanceHall> findByBranchId(const UUID& branchId) = 0;  
     virtual bool exists(const UUID& id) = 0;
+    virtual std::vector<DanceHall> findByIds(const std::vector<UUID>& ids) = 0;
+    virtual std::set<UUID> existsMany(const std::vector<UUID>& ids) = 0;
     virtual std::vector<DanceHall> findAll() = 0; 
     virtual bool save(const DanceHall& hall) = 0;  
     virtual bool update(const DanceHall& hall) = 0; 
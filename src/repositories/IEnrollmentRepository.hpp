@@ -3,6 +3,7 @@
 #include "../models/Enrollment.hpp"
 #include <memory>
 #include <optional>
+#include <set>
 #include <vector>
 
 class IEnrollmentRepository {
@@ -20,4 +21,6 @@ public:
     virtual bool update(const Enrollment& enrollment) = 0;
     virtual bool remove(const UUID& id) = 0;
     virtual bool exists(const UUID& id) = 0;
+    virtual std::vector<Enrollment> findByIds(const std::vector<UUID>& ids) = 0;
+    virtual std::set<UUID> existsMany(const std::vector<UUID>& ids) = 0;
 };
\ No newline at end of file
@@ -2,8 +2,10 @@
 #include "../types/uuid.hpp"
 #include "../models/Lesson.hpp"
 #include "../models/TimeSlot.hpp"
+#include <chrono>
 #include <memory>
 #include <optional>
+#include <set>
 #include <vector>
 
 class ILessonRepository {
@@ -14,10 +16,23 @@ public:
     virtual std::vector<Lesson> findByTrainerId(const UUID& trainerId) = 0;
     virtual std::vector<Lesson> findByHallId(const UUID& hallId) = 0;
     virtual std::vector<Lesson> findConflictingLessons(const UUID& hallId, const TimeSlot& timeSlot) = 0;
+    // Активные занятия нескольких залов, пересекающие интервал [from, to), одним запросом
+    virtual std::vector<Lesson> findConflictingLessonsInRange(const std::vector<UUID>& hallIds,
+                                                              const std::chrono::system_clock::time_point& from,
+                                                              const std::chrono::system_clock::time_point& to) = 0;
+    // Занятия любого статуса, начинающиеся в [from, to], по времени начала (для расписаний)
+    virtual std::vector<Lesson> findByHallsAndRange(const std::vector<UUID>& hallIds,
+                                                    const std::chrono::system_clock::time_point& from,
+                                                    const std::chrono::system_clock::time_point& to) = 0;
+    virtual std::vector<Lesson> findByBranchAndRange(const UUID& branchId,
+                                                     const std::chrono::system_clock::time_point& from,
+                                                     const std::chrono::system_clock::time_point& to) = 0;
     virtual std::vector<Lesson> findUpcomingLessons(int days = 7) = 0;
     virtual std::vector<Lesson> findAll() = 0; 
     virtual bool save(const Lesson& lesson) = 0;
     virtual bool update(const Lesson& lesson) = 0;
     virtual bool remove(const UUID& id) = 0;
     virtual bool exists(const UUID& id) = 0;
+    virtual std::vector<Lesson> findByIds(const std::vector<UUID>& ids) = 0;
+    virtual std::set<UUID> existsMany(const std::vector<UUID>& ids) = 0;
 };
\ No newline at end of file
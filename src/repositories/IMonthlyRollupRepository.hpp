@@ -0,0 +1,76 @@
+#pragma once
+#include "../types/uuid.hpp"
+#include <chrono>
+#include <cstdio>
+#include <ctime>
+#include <optional>
+#include <string>
+#include <vector>
+
+// Календарный месяц (UTC) - ключ помесячных агрегатов
+struct YearMonth {
+    int year = 1970;
+    int month = 1;  // 1..12
+
+    static YearMonth of(const std::chrono::system_clock::time_point& timePoint) {
+        std::time_t time = std::chrono::system_clock::to_time_t(timePoint);
+        std::tm tm{};
+        gmtime_r(&time, &tm);
+        return {tm.tm_year + 1900, tm.tm_mon + 1};
+    }
+
+    YearMonth next() const {
+        return month == 12 ? YearMonth{year + 1, 1} : YearMonth{year, month + 1};
+    }
+
+    // Число вида YYYYMM: удобно как ключ и для сравнения
+    int toInt() const { return year * 100 + month; }
+
+    // YYYY-MM
+    std::string toString() const {
+        char buffer[16];
+        std::snprintf(buffer, sizeof(buffer), "%04d-%02d", year, month);
+        return buffer;
+    }
+
+    bool operator==(const YearMonth& other) const { return toInt() == other.toInt(); }
+    bool operator!=(const YearMonth& other) const { return toInt() != other.toInt(); }
+    bool operator<(const YearMonth& other) const { return toInt() < other.toInt(); }
+    bool operator<=(const YearMonth& other) const { return toInt() <= other.toInt(); }
+};
+
+// Имена метрик в monthly_rollups
+namespace RollupMetric {
+    constexpr const char* LESSONS_HELD = "lessons_held";              // завершенные занятия (COMPLETED), по времени начала
+    constexpr const char* LESSONS_CANCELLED = "lessons_cancelled";
+    constexpr const char* BOOKINGS_USED = "bookings_used";            // посещения по бронированиям (VISITED)
+    constexpr const char* BOOKINGS_CANCELLED = "bookings_cancelled";
+    constexpr const char* NEW_CLIENTS = "new_clients";
+    constexpr const char* SUBSCRIPTION_REVENUE = "subscription_revenue";
+    constexpr const char* ATTENDANCE_VISITED = "attendance_visited";
+    constexpr const char* ATTENDANCE_RESOLVED = "attendance_resolved";  // VISITED + CANCELLED + NO_SHOW
+}
+
+struct MonthlyRollupEntry {
+    YearMonth month;
+    UUID branchId;  // нулевой UUID - метрика без привязки к филиалу
+    std::string metric;
+    double value = 0.0;
+};
+
+class IMonthlyRollupRepository {
+public:
+    virtual ~IMonthlyRollupRepository() = default;
+
+    // Атомарно прибавляет delta к значению метрики (строка создается при первом обращении)
+    virtual void increment(const YearMonth& month, const UUID& branchId,
+                           const std::string& metric, double delta) = 0;
+    // Все строки за месяцы from..to включительно
+    virtual std::vector<MonthlyRollupEntry> findByMonthRange(const YearMonth& from, const YearMonth& to) = 0;
+    // Пересчитывает месяц целиком по исходным таблицам, заменяя накопленные значения
+    virtual void rebuildMonth(const YearMonth& month) = 0;
+
+    // Позиция пакетного пересчета: последний обработанный месяц задания
+    virtual std::optional<YearMonth> getBackfillCursor(const std::string& jobName) = 0;
+    virtual void saveBackfillCursor(const std::string& jobName, const YearMonth& month) = 0;
+};
@@ -3,6 +3,7 @@
 #include "../models/Review.hpp"
 #include <memory>
 #include <optional>
+#include <set>
 #include <vector>
 
 class IReviewRepository {
@@ -20,4 +21,6 @@ public:
     virtual bool update(const Review& review) = 0;
     virtual bool remove(const UUID& id) = 0;
     virtual bool exists(const UUID& id) = 0;
+    virtual std::vector<Review> findByIds(const std::vector<UUID>& ids) = 0;
+    virtual std::set<UUID> existsMany(const std::vector<UUID>& ids) = 0;
 };
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include "../models/Studio.hpp"
 #include <memory>
 #include <optional>
+#include <set>
 #include <vector>
 
 class IStudioRepository {
@@ -16,4 +17,6 @@ public:
     virtual bool update(const Studio& studio) = 0;
     virtual bool remove(const UUID& id) = 0;
     virtual bool exists(const UUID& id) = 0;
+    virtual std::vector<Studio> findByIds(const std::vector<UUID>& ids) = 0;
+    virtual std::set<UUID> existsMany(const std::vector<UUID>& ids) = 0;
 };
\ No newline at end of file
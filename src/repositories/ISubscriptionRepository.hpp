@@ -3,6 +3,7 @@
 #include "../models/Subscription.hpp"
 #include <memory>
 #include <optional>
+#include <set>
 #include <vector>
 
 class ISubscriptionRepository {
@@ -18,4 +19,6 @@ public:
     virtual bool update(const Subscription& subscription) = 0;
     virtual bool remove(const UUID& id) = 0;
     virtual bool exists(const UUID& id) = 0;
+    virtual std::vector<Subscription> findByIds(const std::vector<UUID>& ids) = 0;
+    virtual std::set<UUID> existsMany(const std::vector<UUID>& ids) = 0;
 };
\ No newline at end of file
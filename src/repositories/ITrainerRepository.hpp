@@ -3,6 +3,7 @@
 #include "../models/Trainer.hpp"
 #include <memory>
 #include <optional>
+#include <set>
 #include <vector>
 
 class ITrainerRepository {
@@ -17,4 +18,6 @@ public:
     virtual bool update(const Trainer& trainer) = 0;
     virtual bool remove(const UUID& id) = 0;
     virtual bool exists(const UUID& id) = 0;
+    virtual std::vector<Trainer> findByIds(const std::vector<UUID>& ids) = 0;
+    virtual std::set<UUID> existsMany(const std::vector<UUID>& ids) = 0;
 };
\ No newline at end of file
@@ -0,0 +1,173 @@
+#include "CachedReferenceRepositories.hpp"
+
+// findByIds/existsMany по одиночным поискам в кеше: каждый поиск - обращение к хеш-таблице
+template <typename Entity, typename Lookup>
+static std::vector<Entity> collectByIds(const std::vector<UUID>& ids, Lookup lookup) {
+    std::vector<Entity> entities;
+    std::set<UUID> seen;
+    for (const auto& id : ids) {
+        if (!seen.insert(id).second) {
+            continue;
+        }
+        if (auto entity = lookup(id)) {
+            entities.push_back(std::move(*entity));
+        }
+    }
+    return entities;
+}
+
+template <typename Lookup>
+static std::set<UUID> collectExisting(const std::vector<UUID>& ids, Lookup lookup) {
+    std::set<UUID> existing;
+    for (const auto& id : ids) {
+        if (lookup(id)) {
+            existing.insert(id);
+        }
+    }
+    return existing;
+}
+
+CachedBranchRepository::CachedBranchRepository(std::shared_ptr<IBranchRepository> repository,
+                                               std::shared_ptr<ReferenceDataCache> cache)
+    : repository_(std::move(repository)), cache_(std::move(cache)) {}
+
+std::optional<Branch> CachedBranchRepository::findById(const UUID& id) {
+    return cache_->getBranch(id);
+}
+
+std::vector<Branch> CachedBranchRepository::findByStudioId(const UUID& studioId) {
+    std::vector<Branch> branches;
+    for (auto& branch : cache_->getAllBranches()) {
+        if (branch.getStudioId() == studioId) {
+            branches.push_back(std::move(branch));
+        }
+    }
+    return branches;
+}
+
+std::vector<Branch> CachedBranchRepository::findAll() {
+    return cache_->getAllBranches();
+}
+
+bool CachedBranchRepository::save(const Branch& branch) {
+    bool saved = repository_->save(branch);
+    cache_->invalidate();
+    return saved;
+}
+
+bool CachedBranchRepository::update(const Branch& branch) {
+    bool updated = repository_->update(branch);
+    cache_->invalidate();
+    return updated;
+}
+
+bool CachedBranchRepository::remove(const UUID& id) {
+    bool removed = repository_->remove(id);
+    cache_->invalidate();
+    return removed;
+}
+
+bool CachedBranchRepository::exists(const UUID& id) {
+    return cache_->getBranch(id).has_value();
+}
+
+std::vector<Branch> CachedBranchRepository::findByIds(const std::vector<UUID>& ids) {
+    return collectByIds<Branch>(ids, [this](const UUID& id) { return cache_->getBranch(id); });
+}
+
+std::set<UUID> CachedBranchRepository::existsMany(const std::vector<UUID>& ids) {
+    return collectExisting(ids, [this](const UUID& id) { return cache_->getBranch(id).has_value(); });
+}
+
+CachedDanceHallRepository::CachedDanceHallRepository(std::shared_ptr<IDanceHallRepository> repository,
+                                                     std::shared_ptr<ReferenceDataCache> cache)
+    : repository_(std::move(repository)), cache_(std::move(cache)) {}
+
+std::optional<DanceHall> CachedDanceHallRepository::findById(const UUID& id) {
+    return cache_->getHall(id);
+}
+
+std::vector<DanceHall> CachedDanceHallRepository::findByBranchId(const UUID& branchId) {
+    return cache_->getHallsByBranch(branchId);
+}
+
+bool CachedDanceHallRepository::exists(const UUID& id) {
+    return cache_->getHall(id).has_value();
+}
+
+std::vector<DanceHall> CachedDanceHallRepository::findByIds(const std::vector<UUID>& ids) {
+    return collectByIds<DanceHall>(ids, [this](const UUID& id) { return cache_->getHall(id); });
+}
+
+std::set<UUID> CachedDanceHallRepository::existsMany(const std::vector<UUID>& ids) {
+    return collectExisting(ids, [this](const UUID& id) { return cache_->getHall(id).has_value(); });
+}
+
+std::vector<DanceHall> CachedDanceHallRepository::findAll() {
+    return cache_->getAllHalls();
+}
+
+bool CachedDanceHallRepository::save(const DanceHall& hall) {
+    bool saved = repository_->save(hall);
+    cache_->invalidate();
+    return saved;
+}
+
+bool CachedDanceHallRepository::update(const DanceHall& hall) {
+    bool updated = repository_->update(hall);
+    cache_->invalidate();
+    return updated;
+}
+
+bool CachedDanceHallRepository::remove(const UUID& id) {
+    bool removed = repository_->remove(id);
+    cache_->invalidate();
+    return removed;
+}
+
+CachedSubscriptionTypeRepository::CachedSubscriptionTypeRepository(
+    std::shared_ptr<ISubscriptionTypeRepository> repository,
+    std::shared_ptr<ReferenceDataCache> cache)
+    : repository_(std::move(repository)), cache_(std::move(cache)) {}
+
+std::optional<SubscriptionType> CachedSubscriptionTypeRepository::findById(const UUID& id) {
+    return cache_->getSubscriptionType(id);
+}
+
+std::vector<SubscriptionType> CachedSubscriptionTypeRepository::findAllActive() {
+    return cache_->getActiveSubscriptionTypes();
+}
+
+std::vector<SubscriptionType> CachedSubscriptionTypeRepository::findAll() {
+    return cache_->getAllSubscriptionTypes();
+}
+
+bool CachedSubscriptionTypeRepository::save(const SubscriptionType& subscriptionType) {
+    bool saved = repository_->save(subscriptionType);
+    cache_->invalidate();
+    return saved;
+}
+
+bool CachedSubscriptionTypeRepository::update(const SubscriptionType& subscriptionType) {
+    bool updated = repository_->update(subscriptionType);
+    cache_->invalidate();
+    return updated;
+}
+
+bool CachedSubscriptionTypeRepository::remove(const UUID& id) {
+    bool removed = repository_->remove(id);
+    cache_->invalidate();
+    return removed;
+}
+
+bool CachedSubscriptionTypeRepository::exists(const UUID& id) {
+    return cache_->getSubscriptionType(id).has_value();
+}
+
+std::vector<SubscriptionType> CachedSubscriptionTypeRepository::findByIds(const std::vector<UUID>& ids) {
+    return collectByIds<SubscriptionType>(ids, [this](const UUID& id) { return cache_->getSubscriptionType(id); });
+}
+
+std::set<UUID> CachedSubscriptionTypeRepository::existsMany(const std::vector<UUID>& ids) {
+    return collectExisting(ids, [this](const UUID& id) { return cache_->getSubscriptionType(id).has_value(); });
+}
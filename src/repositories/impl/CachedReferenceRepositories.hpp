@@ -0,0 +1,74 @@
+#ifndef CACHED_REFERENCE_REPOSITORIES_HPP
+#define CACHED_REFERENCE_REPOSITORIES_HPP
+
+#include "../IBranchRepository.hpp"
+#include "../IDanceHallRepository.hpp"
+#include "../ISubscriptionTypeRepository.hpp"
+#include "../../services/ReferenceDataCache.hpp"
+#include <memory>
+
+// Обертки над репозиториями справочных данных: чтение - из ReferenceDataCache,
+// запись - в исходный репозиторий с последующим сбросом кеша.
+// Кеш должен быть построен над теми же исходными репозиториями, а не над обертками.
+
+class CachedBranchRepository : public IBranchRepository {
+public:
+    CachedBranchRepository(std::shared_ptr<IBranchRepository> repository,
+                           std::shared_ptr<ReferenceDataCache> cache);
+
+    std::optional<Branch> findById(const UUID& id) override;
+    std::vector<Branch> findByStudioId(const UUID& studioId) override;
+    std::vector<Branch> findAll() override;
+    bool save(const Branch& branch) override;
+    bool update(const Branch& branch) override;
+    bool remove(const UUID& id) override;
+    bool exists(const UUID& id) override;
+    std::vector<Branch> findByIds(const std::vector<UUID>& ids) override;
+    std::set<UUID> existsMany(const std::vector<UUID>& ids) override;
+
+private:
+    std::shared_ptr<IBranchRepository> repository_;
+    std::shared_ptr<ReferenceDataCache> cache_;
+};
+
+class CachedDanceHallRepository : public IDanceHallRepository {
+public:
+    CachedDanceHallRepository(std::shared_ptr<IDanceHallRepository> repository,
+                              std::shared_ptr<ReferenceDataCache> cache);
+
+    std::optional<DanceHall> findById(const UUID& id) override;
+    std::vector<DanceHall> findByBranchId(const UUID& branchId) override;
+    bool exists(const UUID& id) override;
+    std::vector<DanceHall> findByIds(const std::vector<UUID>& ids) override;
+    std::set<UUID> existsMany(const std::vector<UUID>& ids) override;
+    std::vector<DanceHall> findAll() override;
+    bool save(const DanceHall& hall) override;
+    bool update(const DanceHall& hall) override;
+    bool remove(const UUID& id) override;
+
+private:
+    std::shared_ptr<IDanceHallRepository> repository_;
+    std::shared_ptr<ReferenceDataCache> cache_;
+};
+
+class CachedSubscriptionTypeRepository : public ISubscriptionTypeRepository {
+public:
+    CachedSubscriptionTypeRepository(std::shared_ptr<ISubscriptionTypeRepository> repository,
+                                     std::shared_ptr<ReferenceDataCache> cache);
+
+    std::optional<SubscriptionType> findById(const UUID& id) override;
+    std::vector<SubscriptionType> findAllActive() override;
+    std::vector<SubscriptionType> findAll() override;
+    bool save(const SubscriptionType& subscriptionType) override;
+    bool update(const SubscriptionType& subscriptionType) override;
+    bool remove(const UUID& id) override;
+    bool exists(const UUID& id) override;
+    std::vector<SubscriptionType> findByIds(const std::vector<UUID>& ids) override;
+    std::set<UUID> existsMany(const std::vector<UUID>& ids) override;
+
+private:
+    std::shared_ptr<ISubscriptionTypeRepository> repository_;
+    std::shared_ptr<ReferenceDataCache> cache_;
+};
+
+#endif // CACHED_REFERENCE_REPOSITORIES_HPP
@@ -0,0 +1,54 @@
+#include "CachingRepositories.hpp"
+
+std::optional<Client> CachingClientRepository::findByEmail(const std::string& email) {
+    return inner_->findByEmail(email);
+}
+
+std::vector<Client> CachingClientRepository::findAll() {
+    return inner_->findAll();
+}
+
+int CachingClientRepository::count() {
+    return inner_->count();
+}
+
+std::vector<Lesson> CachingLessonRepository::findByTrainerId(const UUID& trainerId) {
+    return inner_->findByTrainerId(trainerId);
+}
+
+std::vector<Lesson> CachingLessonRepository::findByHallId(const UUID& hallId) {
+    return inner_->findByHallId(hallId);
+}
+
+std::vector<Lesson> CachingLessonRepository::findConflictingLessons(const UUID& hallId, const TimeSlot& timeSlot) {
+    return inner_->findConflictingLessons(hallId, timeSlot);
+}
+
+std::vector<Lesson> CachingLessonRepository::findConflictingLessonsInRange(
+    const std::vector<UUID>& hallIds,
+    const std::chrono::system_clock::time_point& from,
+    const std::chrono::system_clock::time_point& to) {
+    return inner_->findConflictingLessonsInRange(hallIds, from, to);
+}
+
+std::vector<Lesson> CachingLessonRepository::findByHallsAndRange(
+    const std::vector<UUID>& hallIds,
+    const std::chrono::system_clock::time_point& from,
+    const std::chrono::system_clock::time_point& to) {
+    return inner_->findByHallsAndRange(hallIds, from, to);
+}
+
+std::vector<Lesson> CachingLessonRepository::findByBranchAndRange(
+    const UUID& branchId,
+    const std::chrono::system_clock::time_point& from,
+    const std::chrono::system_clock::time_point& to) {
+    return inner_->findByBranchAndRange(branchId, from, to);
+}
+
+std::vector<Lesson> CachingLessonRepository::findUpcomingLessons(int days) {
+    return inner_->findUpcomingLessons(days);
+}
+
+std::vector<Lesson> CachingLessonRepository::findAll() {
+    return inner_->findAll();
+}
@@ -0,0 +1,40 @@
+#ifndef CACHING_REPOSITORIES_HPP
+#define CACHING_REPOSITORIES_HPP
+
+#include "CachingRepository.hpp"
+#include "../IClientRepository.hpp"
+#include "../ILessonRepository.hpp"
+
+// Клиенты: validateClient вызывается почти в каждом сервисе
+class CachingClientRepository : public CachingRepository<IClientRepository, Client> {
+public:
+    using CachingRepository::CachingRepository;
+
+    // Поиск по email не кешируется: ключ кеша - только UUID
+    std::optional<Client> findByEmail(const std::string& email) override;
+    std::vector<Client> findAll() override;
+    int count() override;
+};
+
+// Занятия: списки (по залу, тренеру, периоду) читаются из БД, кешируется поиск по id
+class CachingLessonRepository : public CachingRepository<ILessonRepository, Lesson> {
+public:
+    using CachingRepository::CachingRepository;
+
+    std::vector<Lesson> findByTrainerId(const UUID& trainerId) override;
+    std::vector<Lesson> findByHallId(const UUID& hallId) override;
+    std::vector<Lesson> findConflictingLessons(const UUID& hallId, const TimeSlot& timeSlot) override;
+    std::vector<Lesson> findConflictingLessonsInRange(const std::vector<UUID>& hallIds,
+                                                      const std::chrono::system_clock::time_point& from,
+                                                      const std::chrono::system_clock::time_point& to) override;
+    std::vector<Lesson> findByHallsAndRange(const std::vector<UUID>& hallIds,
+                                            const std::chrono::system_clock::time_point& from,
+                                            const std::chrono::system_clock::time_point& to) override;
+    std::vector<Lesson> findByBranchAndRange(const UUID& branchId,
+                                             const std::chrono::system_clock::time_point& from,
+                                             const std::chrono::system_clock::time_point& to) override;
+    std::vector<Lesson> findUpcomingLessons(int days = 7) override;
+    std::vector<Lesson> findAll() override;
+};
+
+#endif // CACHING_REPOSITORIES_HPP
@@ -0,0 +1,138 @@
+#ifndef CACHING_REPOSITORY_HPP
+#define CACHING_REPOSITORY_HPP
+
+#include "../../data/ShardedLruCache.hpp"
+#include "../../types/uuid.hpp"
+#include <map>
+#include <memory>
+#include <optional>
+#include <set>
+#include <vector>
+
+// Декоратор репозитория с LRU-кешем по UUID. Реализует общие для I*Repository методы
+// (findById, exists, findByIds, existsMany, save, update, remove); остальные методы
+// интерфейса переопределяет наследник для конкретного Interface, пересылая их в inner_.
+// Запись через декоратор сбрасывает ключ в кеше, поэтому все записи сущности в процессе
+// должны идти через один экземпляр декоратора. Изменения из других процессов видны
+// после истечения TTL.
+template <typename Interface, typename Entity>
+class CachingRepository : public Interface {
+public:
+    CachingRepository(std::shared_ptr<Interface> inner, const CachePolicy& policy)
+        : inner_(std::move(inner)), cache_(policy) {}
+
+    std::optional<Entity> findById(const UUID& id) override {
+        if (auto cached = cache_.get(id)) {
+            return *cached;
+        }
+        auto version = cache_.version(id);
+        auto entity = inner_->findById(id);
+        cache_.put(id, entity, version);
+        return entity;
+    }
+
+    bool exists(const UUID& id) override {
+        if (auto cached = cache_.get(id)) {
+            return cached->has_value();
+        }
+        auto version = cache_.version(id);
+        bool found = inner_->exists(id);
+        if (!found) {
+            cache_.put(id, std::nullopt, version);
+        }
+        return found;
+    }
+
+    // Одним запросом к inner_ догружаются только отсутствующие в кеше ключи
+    std::vector<Entity> findByIds(const std::vector<UUID>& ids) override {
+        std::vector<Entity> entities;
+        std::vector<UUID> missing;
+        std::set<UUID> seen;
+        for (const auto& id : ids) {
+            if (!seen.insert(id).second) {
+                continue;
+            }
+            if (auto cached = cache_.get(id)) {
+                if (*cached) {
+                    entities.push_back(std::move(**cached));
+                }
+            } else {
+                missing.push_back(id);
+            }
+        }
+
+        if (!missing.empty()) {
+            std::map<UUID, std::uint64_t> versions;
+            for (const auto& id : missing) {
+                versions[id] = cache_.version(id);
+            }
+
+            for (auto& entity : inner_->findByIds(missing)) {
+                auto it = versions.find(entity.getId());
+                if (it != versions.end()) {
+                    cache_.put(it->first, entity, it->second);
+                    versions.erase(it);
+                }
+                entities.push_back(std::move(entity));
+            }
+            // Оставшиеся ключи не найдены
+            for (const auto& [id, version] : versions) {
+                cache_.put(id, std::nullopt, version);
+            }
+        }
+        return entities;
+    }
+
+    std::set<UUID> existsMany(const std::vector<UUID>& ids) override {
+        std::set<UUID> existing;
+        std::vector<UUID> missing;
+        for (const auto& id : ids) {
+            if (auto cached = cache_.get(id)) {
+                if (*cached) {
+                    existing.insert(id);
+                }
+            } else {
+                missing.push_back(id);
+            }
+        }
+        if (!missing.empty()) {
+            auto found = inner_->existsMany(missing);
+            existing.insert(found.begin(), found.end());
+        }
+        return existing;
+    }
+
+    bool save(const Entity& entity) override {
+        return writeThrough(entity.getId(), [&] { return inner_->save(entity); });
+    }
+
+    bool update(const Entity& entity) override {
+        return writeThrough(entity.getId(), [&] { return inner_->update(entity); });
+    }
+
+    bool remove(const UUID& id) override {
+        return writeThrough(id, [&] { return inner_->remove(id); });
+    }
+
+    CacheStats getCacheStats() const { return cache_.stats(); }
+    void clearCache() { cache_.clear(); }
+
+protected:
+    std::shared_ptr<Interface> inner_;
+    ShardedLruCache<Entity> cache_;
+
+    // Ключ сбрасывается и при исключении: запись могла примениться до ошибки
+    template <typename Write>
+    bool writeThrough(const UUID& id, Write write) {
+        try {
+            bool result = write();
+            cache_.invalidate(id);
+            return result;
+        } catch (...) {
+            cache_.invalidate(id);
+            throw;
+        }
+    }
+};
+
+#endif // CACHING_REPOSITORY_HPP
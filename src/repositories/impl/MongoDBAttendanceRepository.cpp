@@ -1,17 +1,21 @@
 #include "MongoDBAttendanceRepository.hpp"
 #include "../../data/MongoDBRepositoryFactory.hpp"
 #include "../../data/DateTimeUtils.hpp"
+#include "../../core/Logger.hpp"
+#include "../../data/MongoDBTime.hpp"
 #include <bsoncxx/builder/basic/document.hpp>
 #include <bsoncxx/builder/basic/array.hpp>
 #include <bsoncxx/builder/basic/kvp.hpp>
 #include <mongocxx/pipeline.hpp>
+#include <algorithm>
 #include <iostream>
+#include <map>
 
 MongoDBAttendanceRepository::MongoDBAttendanceRepository(std::shared_ptr<MongoDBRepositoryFactory> factory)
     : factory_(std::move(factory)) {}
 
-mongocxx::collection MongoDBAttendanceRepository::getCollection() const {
-    return factory_->getDatabase().collection("attendance");
+MongoDBPooledCollection MongoDBAttendanceRepository::getCollection() const {
+    return factory_->getCollection("attendance");
 }
 
 std::optional<Attendance> MongoDBAttendanceRepository::findById(const UUID& id) {
@@ -24,11 +28,11 @@ std::optional<Attendance> MongoDBAttendanceRepository::findById(const UUID& id)
         auto result = collection.find_one(filter.view());
         
         if (!result) {
-            std::cout << "❌ Запись посещаемости не найдена в MongoDB: " << id.toString() << std::endl;
+            LOG_DEBUG("MongoDBAttendanceRepository", "❌ Запись посещаемости не найдена в MongoDB: " << id.toString());
             return std::nullopt;
         }
         
-        std::cout << "✅ Запись посещаемости найдена в MongoDB: " << id.toString() << std::endl;
+        LOG_DEBUG("MongoDBAttendanceRepository", "✅ Запись посещаемости найдена в MongoDB: " << id.toString());
         return mapDocumentToAttendance(result->view());
         
     } catch (const std::exception& e) {
@@ -41,7 +45,7 @@ std::vector<Attendance> MongoDBAttendanceRepository::findByClientId(const UUID&
     std::vector<Attendance> attendances;
     
     try {
-        std::cout << "🔍 Поиск посещаемости клиента в MongoDB: " << clientId.toString() << std::endl;
+        LOG_DEBUG("MongoDBAttendanceRepository", "🔍 Поиск посещаемости клиента в MongoDB: " << clientId.toString());
         
         auto collection = getCollection();
         auto filter = bsoncxx::builder::stream::document{}
@@ -56,14 +60,14 @@ std::vector<Attendance> MongoDBAttendanceRepository::findByClientId(const UUID&
                 auto attendance = mapDocumentToAttendance(doc);
                 attendances.push_back(attendance);
                 count++;
-                std::cout << "✅ Найдена запись посещаемости клиента: " << attendance.getId().toString() << std::endl;
+                LOG_DEBUG("MongoDBAttendanceRepository", "✅ Найдена запись посещаемости клиента: " << attendance.getId().toString());
             } catch (const std::exception& e) {
                 std::cerr << "❌ Ошибка создания записи посещаемости из MongoDB документа: " << e.what() << std::endl;
                 continue;
             }
         }
         
-        std::cout << "📊 Найдено записей посещаемости клиента в MongoDB: " << count << std::endl;
+        LOG_DEBUG("MongoDBAttendanceRepository", "📊 Найдено записей посещаемости клиента в MongoDB: " << count);
         return attendances;
         
     } catch (const std::exception& e) {
@@ -76,7 +80,7 @@ std::vector<Attendance> MongoDBAttendanceRepository::findByEntityId(const UUID&
     std::vector<Attendance> attendances;
     
     try {
-        std::cout << "🔍 Поиск посещаемости по entity в MongoDB: " << entityId.toString() << std::endl;
+        LOG_DEBUG("MongoDBAttendanceRepository", "🔍 Поиск посещаемости по entity в MongoDB: " << entityId.toString());
         
         auto collection = getCollection();
         auto filter = bsoncxx::builder::stream::document{}
@@ -91,14 +95,14 @@ std::vector<Attendance> MongoDBAttendanceRepository::findByEntityId(const UUID&
                 auto attendance = mapDocumentToAttendance(doc);
                 attendances.push_back(attendance);
                 count++;
-                std::cout << "✅ Найдена запись посещаемости по entity: " << attendance.getId().toString() << std::endl;
+                LOG_DEBUG("MongoDBAttendanceRepository", "✅ Найдена запись посещаемости по entity: " << attendance.getId().toString());
             } catch (const std::exception& e) {
                 std::cerr << "❌ Ошибка создания записи посещаемости из MongoDB документа: " << e.what() << std::endl;
                 continue;
             }
         }
         
-        std::cout << "📊 Найдено записей посещаемости по entity в MongoDB: " << count << std::endl;
+        LOG_DEBUG("MongoDBAttendanceRepository", "📊 Найдено записей посещаемости по entity в MongoDB: " << count);
         return attendances;
         
     } catch (const std::exception& e) {
@@ -115,15 +119,13 @@ std::vector<Attendance> MongoDBAttendanceRepository::findByClientAndPeriod(
     std::vector<Attendance> attendances;
     
     try {
-        std::cout << "🔍 Поиск посещаемости клиента за период в MongoDB: " << clientId.toString() << std::endl;
+        LOG_DEBUG("MongoDBAttendanceRepository", "🔍 Поиск посещаемости клиента за период в MongoDB: " << clientId.toString());
         
         auto collection = getCollection();
         auto filter = bsoncxx::builder::stream::document{}
             << "clientId" << clientId.toString()
-            << "scheduledTime" << bsoncxx::builder::stream::open_document
-                << "$gte" << DateTimeUtils::formatTimeForMongoDB(start)
-                << "$lte" << DateTimeUtils::formatTimeForMongoDB(end)
-            << bsoncxx::builder::stream::close_document
+            << "$and" << bsoncxx::builder::basic::make_array(
+                MongoDBTime::rangeCondition("scheduledTime", {{"$gte", start}, {"$lte", end}})).view()
             << bsoncxx::builder::stream::finalize;
         
         auto cursor = collection.find(filter.view());
@@ -140,7 +142,7 @@ std::vector<Attendance> MongoDBAttendanceRepository::findByClientAndPeriod(
             }
         }
         
-        std::cout << "✅ Успешно загружено записей посещаемости за период из MongoDB: " << count << std::endl;
+        LOG_DEBUG("MongoDBAttendanceRepository", "✅ Успешно загружено записей посещаемости за период из MongoDB: " << count);
         return attendances;
         
     } catch (const std::exception& e) {
@@ -155,7 +157,7 @@ std::vector<Attendance> MongoDBAttendanceRepository::findByTypeAndStatus(
     std::vector<Attendance> attendances;
     
     try {
-        std::cout << "🔍 Поиск посещаемости по типу и статусу в MongoDB" << std::endl;
+        LOG_DEBUG("MongoDBAttendanceRepository", "🔍 Поиск посещаемости по типу и статусу в MongoDB");
         
         auto collection = getCollection();
         auto filter = bsoncxx::builder::stream::document{}
@@ -177,7 +179,7 @@ std::vector<Attendance> MongoDBAttendanceRepository::findByTypeAndStatus(
             }
         }
         
-        std::cout << "✅ Успешно загружено записей посещаемости по типу и статусу из MongoDB: " << count << std::endl;
+        LOG_DEBUG("MongoDBAttendanceRepository", "✅ Успешно загружено записей посещаемости по типу и статусу из MongoDB: " << count);
         return attendances;
         
     } catch (const std::exception& e) {
@@ -190,7 +192,7 @@ std::vector<Attendance> MongoDBAttendanceRepository::findAll() {
     std::vector<Attendance> attendances;
     
     try {
-        std::cout << "🔍 Получение всех записей посещаемости из MongoDB" << std::endl;
+        LOG_DEBUG("MongoDBAttendanceRepository", "🔍 Получение всех записей посещаемости из MongoDB");
         
         auto collection = getCollection();
         auto cursor = collection.find({});
@@ -207,7 +209,7 @@ std::vector<Attendance> MongoDBAttendanceRepository::findAll() {
             }
         }
         
-        std::cout << "✅ Успешно загружено записей посещаемости из MongoDB: " << count << std::endl;
+        LOG_DEBUG("MongoDBAttendanceRepository", "✅ Успешно загружено записей посещаемости из MongoDB: " << count);
         return attendances;
         
     } catch (const std::exception& e) {
@@ -226,7 +228,7 @@ bool MongoDBAttendanceRepository::save(const Attendance& attendance) {
         auto result = collection.insert_one(document.view());
         
         if (result && result->result().inserted_count() > 0) {
-            std::cout << "✅ Запись посещаемости успешно сохранена в MongoDB: " << attendance.getId().toString() << std::endl;
+            LOG_DEBUG("MongoDBAttendanceRepository", "✅ Запись посещаемости успешно сохранена в MongoDB: " << attendance.getId().toString());
             return true;
         }
         
@@ -254,8 +256,8 @@ bool MongoDBAttendanceRepository::update(const Attendance& attendance) {
                 << "entityId" << attendance.getEntityId().toString()
                 << "type" << attendanceTypeToString(attendance.getType())
                 << "status" << attendanceStatusToString(attendance.getStatus())
-                << "scheduledTime" << DateTimeUtils::formatTimeForMongoDB(attendance.getScheduledTime())
-                << "actualTime" << DateTimeUtils::formatTimeForMongoDB(attendance.getActualTime())
+                << "scheduledTime" << MongoDBTime::toDate(attendance.getScheduledTime())
+                << "actualTime" << MongoDBTime::toDate(attendance.getActualTime())
                 << "notes" << attendance.getNotes()
                 << "amountPaid" << attendance.getAmountPaid()
                 << "durationMinutes" << attendance.getDurationMinutes()
@@ -265,11 +267,11 @@ bool MongoDBAttendanceRepository::update(const Attendance& attendance) {
         auto result = collection.update_one(filter.view(), update_doc.view());
         
         if (result && result->modified_count() > 0) {
-            std::cout << "✅ Запись посещаемости успешно обновлена в MongoDB: " << attendance.getId().toString() << std::endl;
+            LOG_DEBUG("MongoDBAttendanceRepository", "✅ Запись посещаемости успешно обновлена в MongoDB: " << attendance.getId().toString());
             return true;
         }
         
-        std::cout << "⚠️  Запись посещаемости не найдена для обновления в MongoDB: " << attendance.getId().toString() << std::endl;
+        LOG_DEBUG("MongoDBAttendanceRepository", "⚠️  Запись посещаемости не найдена для обновления в MongoDB: " << attendance.getId().toString());
         return false;
         
     } catch (const std::exception& e) {
@@ -288,11 +290,11 @@ bool MongoDBAttendanceRepository::remove(const UUID& id) {
         auto result = collection.delete_one(filter.view());
         
         if (result && result->deleted_count() > 0) {
-            std::cout << "✅ Запись посещаемости успешно удалена из MongoDB: " << id.toString() << std::endl;
+            LOG_DEBUG("MongoDBAttendanceRepository", "✅ Запись посещаемости успешно удалена из MongoDB: " << id.toString());
             return true;
         }
         
-        std::cout << "⚠️  Запись посещаемости не найдена для удаления в MongoDB: " << id.toString() << std::endl;
+        LOG_DEBUG("MongoDBAttendanceRepository", "⚠️  Запись посещаемости не найдена для удаления в MongoDB: " << id.toString());
         return false;
         
     } catch (const std::exception& e) {
@@ -317,6 +319,54 @@ bool MongoDBAttendanceRepository::exists(const UUID& id) {
     }
 }
 
+std::vector<Attendance> MongoDBAttendanceRepository::findByIds(const std::vector<UUID>& ids) {
+    std::vector<Attendance> attendances;
+    
+    if (ids.empty()) {
+        return attendances;
+    }
+    
+    try {
+        auto collection = getCollection();
+        auto filter = MongoDBRepositoryFactory::makeIdInFilter(ids);
+        auto cursor = collection.find(filter.view());
+        
+        for (auto&& doc : cursor) {
+            attendances.push_back(mapDocumentToAttendance(doc));
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "❌ MongoDB Error in findByIds: " << e.what() << std::endl;
+        throw DataAccessException(std::string("Failed to find attendance records by IDs: ") + e.what());
+    }
+    
+    return attendances;
+}
+
+std::set<UUID> MongoDBAttendanceRepository::existsMany(const std::vector<UUID>& ids) {
+    std::set<UUID> existing;
+    
+    if (ids.empty()) {
+        return existing;
+    }
+    
+    try {
+        auto collection = getCollection();
+        auto filter = MongoDBRepositoryFactory::makeIdInFilter(ids);
+        
+        mongocxx::options::find options;
+        options.projection(MongoDBRepositoryFactory::makeIdProjection());
+        
+        for (auto&& doc : collection.find(filter.view(), options)) {
+            existing.insert(UUID::fromString(doc["id"].get_string().value.to_string()));
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "❌ MongoDB Error in existsMany: " << e.what() << std::endl;
+        throw DataAccessException(std::string("Failed to check attendance existence: ") + e.what());
+    }
+    
+    return existing;
+}
+
 int MongoDBAttendanceRepository::countByClientAndStatus(const UUID& clientId, AttendanceStatus status) {
     try {
         auto collection = getCollection();
@@ -327,7 +377,7 @@ int MongoDBAttendanceRepository::countByClientAndStatus(const UUID& clientId, At
         
         auto count = collection.count_documents(filter.view());
         
-        std::cout << "📊 Количество записей посещаемости клиента со статусом в MongoDB: " << count << std::endl;
+        LOG_DEBUG("MongoDBAttendanceRepository", "📊 Количество записей посещаемости клиента со статусом в MongoDB: " << count);
         return static_cast<int>(count);
         
     } catch (const std::exception& e) {
@@ -346,7 +396,7 @@ int MongoDBAttendanceRepository::countByTypeAndStatus(AttendanceType type, Atten
         
         auto count = collection.count_documents(filter.view());
         
-        std::cout << "📊 Количество записей посещаемости по типу и статусу в MongoDB: " << count << std::endl;
+        LOG_DEBUG("MongoDBAttendanceRepository", "📊 Количество записей посещаемости по типу и статусу в MongoDB: " << count);
         return static_cast<int>(count);
         
     } catch (const std::exception& e) {
@@ -359,7 +409,7 @@ std::vector<std::pair<UUID, int>> MongoDBAttendanceRepository::getTopClientsByVi
     std::vector<std::pair<UUID, int>> topClients;
     
     try {
-        std::cout << "🔍 Получение топ клиентов по посещениям в MongoDB" << std::endl;
+        LOG_DEBUG("MongoDBAttendanceRepository", "🔍 Получение топ клиентов по посещениям в MongoDB");
         
         auto collection = getCollection();
         
@@ -395,14 +445,14 @@ std::vector<std::pair<UUID, int>> MongoDBAttendanceRepository::getTopClientsByVi
                 UUID clientId = UUID::fromString(doc["_id"].get_string().value.to_string());
                 int visitCount = doc["visitCount"].get_int32();
                 topClients.emplace_back(clientId, visitCount);
-                std::cout << "👤 Клиент " << clientId.toString() << " - " << visitCount << " посещений" << std::endl;
+                LOG_DEBUG("MongoDBAttendanceRepository", "👤 Клиент " << clientId.toString() << " - " << visitCount << " посещений");
             } catch (const std::exception& e) {
                 std::cerr << "❌ Ошибка обработки результата агрегации: " << e.what() << std::endl;
                 continue;
             }
         }
         
-        std::cout << "✅ Успешно получено топ клиентов: " << topClients.size() << std::endl;
+        LOG_DEBUG("MongoDBAttendanceRepository", "✅ Успешно получено топ клиентов: " << topClients.size());
         return topClients;
         
     } catch (const std::exception& e) {
@@ -411,6 +461,231 @@ std::vector<std::pair<UUID, int>> MongoDBAttendanceRepository::getTopClientsByVi
     }
 }
 
+// $sum возвращает int32, а при переполнении - int64
+static int countValue(const bsoncxx::document::element& element) {
+    if (element.type() == bsoncxx::type::k_int64) {
+        return static_cast<int>(element.get_int64().value);
+    }
+    return element.get_int32().value;
+}
+
+AttendanceBreakdown MongoDBAttendanceRepository::aggregateCounts(bool includeClients) {
+    AttendanceBreakdown breakdown;
+
+    try {
+        auto collection = getCollection();
+
+        // Группировка по клиенту сразу дает и итоги: они суммируются на стороне приложения.
+        // $facet с двумя ветками не используется - его результат один документ с лимитом 16 МБ
+        using bsoncxx::builder::basic::kvp;
+        using bsoncxx::builder::basic::make_document;
+
+        bsoncxx::builder::basic::document groupId;
+        if (includeClients) {
+            groupId.append(kvp("clientId", "$clientId"));
+        }
+        groupId.append(kvp("type", "$type"), kvp("status", "$status"));
+
+        mongocxx::pipeline pipeline;
+        pipeline.group(make_document(
+            kvp("_id", groupId.extract()),
+            kvp("count", make_document(kvp("$sum", 1)))));
+
+        auto cursor = collection.aggregate(pipeline);
+
+        for (auto&& doc : cursor) {
+            auto key = doc["_id"].get_document().value;
+            AttendanceType type = stringToAttendanceType(key["type"].get_string().value.to_string());
+            AttendanceStatus status = stringToAttendanceStatus(key["status"].get_string().value.to_string());
+            int count = countValue(doc["count"]);
+
+            breakdown.totals.add(type, status, count);
+            if (includeClients) {
+                UUID clientId = UUID::fromString(key["clientId"].get_string().value.to_string());
+                breakdown.byClient[clientId].add(type, status, count);
+            }
+        }
+
+        LOG_DEBUG("MongoDBAttendanceRepository", "📊 Агрегированы счетчики посещаемости, клиентов: " << breakdown.byClient.size());
+        return breakdown;
+
+    } catch (const std::exception& e) {
+        std::cerr << "❌ MongoDB Error in aggregateCounts: " << e.what() << std::endl;
+        throw DataAccessException(std::string("Failed to aggregate attendance counts: ") + e.what());
+    }
+}
+
+AttendanceCounts MongoDBAttendanceRepository::aggregateClientCounts(const UUID& clientId) {
+    AttendanceCounts counts;
+
+    try {
+        auto collection = getCollection();
+
+        mongocxx::pipeline pipeline;
+        pipeline.match(bsoncxx::builder::stream::document{}
+            << "clientId" << clientId.toString()
+            << bsoncxx::builder::stream::finalize);
+        pipeline.group(bsoncxx::builder::stream::document{}
+            << "_id" << bsoncxx::builder::stream::open_document
+                << "type" << "$type"
+                << "status" << "$status"
+            << bsoncxx::builder::stream::close_document
+            << "count" << bsoncxx::builder::stream::open_document
+                << "$sum" << 1
+            << bsoncxx::builder::stream::close_document
+            << bsoncxx::builder::stream::finalize);
+
+        auto cursor = collection.aggregate(pipeline);
+
+        for (auto&& doc : cursor) {
+            auto key = doc["_id"].get_document().value;
+            counts.add(stringToAttendanceType(key["type"].get_string().value.to_string()),
+                       stringToAttendanceStatus(key["status"].get_string().value.to_string()),
+                       countValue(doc["count"]));
+        }
+
+        return counts;
+
+    } catch (const std::exception& e) {
+        std::cerr << "❌ MongoDB Error in aggregateClientCounts: " << e.what() << std::endl;
+        throw DataAccessException(std::string("Failed to aggregate client attendance counts: ") + e.what());
+    }
+}
+
+static double visitRate(const AttendanceCounts& counts) {
+    int resolved = counts.resolved();
+    return resolved > 0 ? static_cast<double>(counts.visited()) / resolved : 0.0;
+}
+
+static bsoncxx::document::value clientSummaryProjection() {
+    return bsoncxx::builder::stream::document{}
+        << "id" << 1 << "name" << 1 << "_id" << 0
+        << bsoncxx::builder::stream::finalize;
+}
+
+std::vector<ClientAttendanceSummary> MongoDBAttendanceRepository::findClientSummaries(int limit) {
+    std::vector<ClientAttendanceSummary> summaries;
+
+    try {
+        // Счетчики всех клиентов - одна агрегация; имена - один проход по clients с проекцией
+        auto breakdown = aggregateCounts(true);
+
+        auto collection = getCollection();
+        auto clients = collection.sibling("clients");
+        mongocxx::options::find options;
+        options.projection(clientSummaryProjection());
+
+        for (auto&& doc : clients.find({}, options)) {
+            ClientAttendanceSummary summary;
+            summary.clientId = UUID::fromString(doc["id"].get_string().value.to_string());
+            summary.clientName = doc["name"].get_string().value.to_string();
+            auto it = breakdown.byClient.find(summary.clientId);
+            if (it != breakdown.byClient.end()) {
+                summary.counts = it->second;
+            }
+            summaries.push_back(std::move(summary));
+        }
+
+        auto byRate = [](const ClientAttendanceSummary& a, const ClientAttendanceSummary& b) {
+            double rateA = visitRate(a.counts);
+            double rateB = visitRate(b.counts);
+            return rateA != rateB ? rateA > rateB : a.clientName < b.clientName;
+        };
+        if (limit > 0 && static_cast<std::size_t>(limit) < summaries.size()) {
+            std::partial_sort(summaries.begin(), summaries.begin() + limit, summaries.end(), byRate);
+            summaries.resize(limit);
+        } else {
+            std::sort(summaries.begin(), summaries.end(), byRate);
+        }
+
+        return summaries;
+
+    } catch (const DataAccessException&) {
+        throw;
+    } catch (const std::exception& e) {
+        std::cerr << "❌ MongoDB Error in findClientSummaries: " << e.what() << std::endl;
+        throw DataAccessException(std::string("Failed to find client attendance summaries: ") + e.what());
+    }
+}
+
+void MongoDBAttendanceRepository::streamClientSummaries(int batchSize, const ClientAttendanceSummaryConsumer& consumer) {
+    if (batchSize <= 0) {
+        throw std::invalid_argument("Batch size must be positive");
+    }
+
+    std::string lastClientId;
+    std::vector<ClientAttendanceSummary> batch;
+
+    do {
+        batch.clear();
+        try {
+            auto collection = getCollection();
+            auto clients = collection.sibling("clients");
+
+            // Keyset-пагинация по уникальному индексу clients.id
+            mongocxx::options::find options;
+            options.projection(clientSummaryProjection());
+            options.sort(bsoncxx::builder::stream::document{} << "id" << 1 << bsoncxx::builder::stream::finalize);
+            options.limit(batchSize);
+
+            auto filter = bsoncxx::builder::stream::document{}
+                << "id" << bsoncxx::builder::stream::open_document
+                    << "$gt" << lastClientId
+                << bsoncxx::builder::stream::close_document
+                << bsoncxx::builder::stream::finalize;
+
+            std::map<std::string, std::size_t> positions;
+            bsoncxx::builder::basic::array clientIds;
+            for (auto&& doc : clients.find(filter.view(), options)) {
+                std::string id = doc["id"].get_string().value.to_string();
+                positions[id] = batch.size();
+                clientIds.append(id);
+                batch.push_back({UUID::fromString(id), doc["name"].get_string().value.to_string(), {}});
+            }
+
+            if (!batch.empty()) {
+                lastClientId = batch.back().clientId.toString();
+
+                mongocxx::pipeline pipeline;
+                pipeline.match(bsoncxx::builder::stream::document{}
+                    << "clientId" << bsoncxx::builder::stream::open_document
+                        << "$in" << clientIds.view()
+                    << bsoncxx::builder::stream::close_document
+                    << bsoncxx::builder::stream::finalize);
+                pipeline.group(bsoncxx::builder::stream::document{}
+                    << "_id" << bsoncxx::builder::stream::open_document
+                        << "clientId" << "$clientId"
+                        << "type" << "$type"
+                        << "status" << "$status"
+                    << bsoncxx::builder::stream::close_document
+                    << "count" << bsoncxx::builder::stream::open_document
+                        << "$sum" << 1
+                    << bsoncxx::builder::stream::close_document
+                    << bsoncxx::builder::stream::finalize);
+
+                for (auto&& doc : collection.aggregate(pipeline)) {
+                    auto key = doc["_id"].get_document().value;
+                    auto it = positions.find(key["clientId"].get_string().value.to_string());
+                    if (it != positions.end()) {
+                        batch[it->second].counts.add(
+                            stringToAttendanceType(key["type"].get_string().value.to_string()),
+                            stringToAttendanceStatus(key["status"].get_string().value.to_string()),
+                            countValue(doc["count"]));
+                    }
+                }
+            }
+        } catch (const std::exception& e) {
+            std::cerr << "❌ MongoDB Error in streamClientSummaries: " << e.what() << std::endl;
+            throw DataAccessException(std::string("Failed to stream client attendance summaries: ") + e.what());
+        }
+
+        // Потребитель вызывается после возврата клиента в пул
+        for (const auto& summary : batch) {
+            consumer(summary);
+        }
+    } while (batch.size() == static_cast<std::size_t>(batchSize));
+}
+
 Attendance MongoDBAttendanceRepository::mapDocumentToAttendance(const bsoncxx::document::view& doc) const {
     try {
         UUID id = UUID::fromString(doc["id"].get_string().value.to_string());
@@ -420,8 +695,8 @@ Attendance MongoDBAttendanceRepository::mapDocumentToAttendance(const bsoncxx::d
         AttendanceType type = stringToAttendanceType(doc["type"].get_string().value.to_string());
         AttendanceStatus status = stringToAttendanceStatus(doc["status"].get_string().value.to_string());
         
-        auto scheduledTime = DateTimeUtils::parseTimeFromMongoDB(doc["scheduledTime"].get_string().value.to_string());
-        auto actualTime = DateTimeUtils::parseTimeFromMongoDB(doc["actualTime"].get_string().value.to_string());
+        auto scheduledTime = MongoDBTime::fromElement(doc["scheduledTime"]);
+        auto actualTime = MongoDBTime::fromElement(doc["actualTime"]);
         
         std::string notes = doc["notes"].get_string().value.to_string();
         double amountPaid = doc["amountPaid"].get_double().value;
@@ -476,8 +751,8 @@ bsoncxx::document::value MongoDBAttendanceRepository::mapAttendanceToDocument(co
         << "entityId" << attendance.getEntityId().toString()
         << "type" << attendanceTypeToString(attendance.getType())
         << "status" << attendanceStatusToString(attendance.getStatus())
-        << "scheduledTime" << DateTimeUtils::formatTimeForMongoDB(attendance.getScheduledTime())
-        << "actualTime" << DateTimeUtils::formatTimeForMongoDB(attendance.getActualTime())
+        << "scheduledTime" << MongoDBTime::toDate(attendance.getScheduledTime())
+        << "actualTime" << MongoDBTime::toDate(attendance.getActualTime())
         << "notes" << attendance.getNotes()
         << "amountPaid" << attendance.getAmountPaid()
         << "durationMinutes" << attendance.getDurationMinutes()
@@ -5,6 +5,7 @@
 #include "../../data/exceptions/DataAccessException.hpp"
 #include <mongocxx/client.hpp>
 #include <mongocxx/collection.hpp>
+#include "../../data/MongoDBClientPool.hpp"
 #include <bsoncxx/builder/stream/document.hpp>
 #include <bsoncxx/json.hpp>
 #include <iostream>
@@ -15,7 +16,7 @@ class MongoDBRepositoryFactory;
 class MongoDBAttendanceRepository : public IAttendanceRepository {
 private:
     std::shared_ptr<MongoDBRepositoryFactory> factory_;
-    mongocxx::collection getCollection() const;
+    MongoDBPooledCollection getCollection() const;
 
 public:
     explicit MongoDBAttendanceRepository(std::shared_ptr<MongoDBRepositoryFactory> factory);
@@ -32,10 +33,16 @@ public:
     bool update(const Attendance& attendance) override;
     bool remove(const UUID& id) override;
     bool exists(const UUID& id) override;
+    std::vector<Attendance> findByIds(const std::vector<UUID>& ids) override;
+    std::set<UUID> existsMany(const std::vector<UUID>& ids) override;
     
     int countByClientAndStatus(const UUID& clientId, AttendanceStatus status) override;
     int countByTypeAndStatus(AttendanceType type, AttendanceStatus status) override;
     std::vector<std::pair<UUID, int>> getTopClientsByVisits(int limit) override;
+    AttendanceBreakdown aggregateCounts(bool includeClients) override;
+    AttendanceCounts aggregateClientCounts(const UUID& clientId) override;
+    std::vector<ClientAttendanceSummary> findClientSummaries(int limit) override;
+    void streamClientSummaries(int batchSize, const ClientAttendanceSummaryConsumer& consumer) override;
 
 private:
     Attendance mapDocumentToAttendance(const bsoncxx::document::view& doc) const;
@@ -1,13 +1,15 @@
 #include "MongoDBBookingRepository.hpp"
 #include "../../data/DateTimeUtils.hpp"
 #include "../../data/MongoDBRepositoryFactory.hpp"
+#include "../../data/MongoDBTime.hpp"
+#include <bsoncxx/builder/basic/array.hpp>
 #include <iostream>
 
 MongoDBBookingRepository::MongoDBBookingRepository(std::shared_ptr<MongoDBRepositoryFactory> factory)
     : factory_(std::move(factory)) {}
 
-mongocxx::collection MongoDBBookingRepository::getCollection() const {
-    return factory_->getDatabase().collection("bookings");
+MongoDBPooledCollection MongoDBBookingRepository::getCollection() const {
+    return factory_->getCollection("bookings");
 }
 
 std::optional<Booking> MongoDBBookingRepository::findById(const UUID& id) {
@@ -88,16 +90,9 @@ std::vector<Booking> MongoDBBookingRepository::findConflictingBookings(const UUI
                     << "PENDING" << "CONFIRMED"
                 << bsoncxx::builder::stream::close_array
             << bsoncxx::builder::stream::close_document
-            << "$or" << bsoncxx::builder::stream::open_array
-                << bsoncxx::builder::stream::open_document
-                    << "startTime" << bsoncxx::builder::stream::open_document
-                        << "$lt" << DateTimeUtils::formatTimeForMongoDB(timeSlot.getEndTime())
-                    << bsoncxx::builder::stream::close_document
-                    << "endTime" << bsoncxx::builder::stream::open_document
-                        << "$gt" << DateTimeUtils::formatTimeForMongoDB(timeSlot.getStartTime())
-                    << bsoncxx::builder::stream::close_document
-                << bsoncxx::builder::stream::close_document
-            << bsoncxx::builder::stream::close_array
+            << "$and" << bsoncxx::builder::basic::make_array(
+                MongoDBTime::rangeCondition("startTime", {{"$lt", timeSlot.getEndTime()}}),
+                MongoDBTime::rangeCondition("endTime", {{"$gt", timeSlot.getStartTime()}})).view()
             << bsoncxx::builder::stream::finalize;
         
         auto cursor = collection.find(filter.view());
@@ -113,6 +108,126 @@ std::vector<Booking> MongoDBBookingRepository::findConflictingBookings(const UUI
     return bookings;
 }
 
+std::vector<Booking> MongoDBBookingRepository::findConflictingBookingsInRange(
+    const std::vector<UUID>& hallIds,
+    const std::chrono::system_clock::time_point& from,
+    const std::chrono::system_clock::time_point& to) {
+    std::vector<Booking> bookings;
+    
+    if (hallIds.empty() || !(from < to)) {
+        return bookings;
+    }
+    
+    try {
+        auto collection = getCollection();
+        
+        // Один запрос на все залы: hallId $in [...] и пересечение с [from, to)
+        auto filter = bsoncxx::builder::stream::document{}
+            << "hallId" << bsoncxx::builder::stream::open_document
+                << "$in" << [&] {
+                    auto array_builder = bsoncxx::builder::basic::array{};
+                    for (const auto& hallId : hallIds) {
+                        array_builder.append(hallId.toString());
+                    }
+                    return array_builder;
+                }()
+            << bsoncxx::builder::stream::close_document
+            << "status" << bsoncxx::builder::stream::open_document
+                << "$in" << bsoncxx::builder::stream::open_array
+                    << "PENDING" << "CONFIRMED"
+                << bsoncxx::builder::stream::close_array
+            << bsoncxx::builder::stream::close_document
+            << "$and" << bsoncxx::builder::basic::make_array(
+                MongoDBTime::rangeCondition("startTime", {{"$lt", to}}),
+                MongoDBTime::rangeCondition("endTime", {{"$gt", from}})).view()
+            << bsoncxx::builder::stream::finalize;
+        
+        auto cursor = collection.find(filter.view());
+        
+        for (auto&& doc : cursor) {
+            bookings.push_back(mapDocumentToBooking(doc));
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "MongoDB Error in findConflictingBookingsInRange: " << e.what() << std::endl;
+        throw DataAccessException(std::string("Failed to find conflicting bookings in range: ") + e.what());
+    }
+    
+    return bookings;
+}
+
+std::vector<Booking> MongoDBBookingRepository::findByHallsAndRange(
+    const std::vector<UUID>& hallIds,
+    const std::chrono::system_clock::time_point& from,
+    const std::chrono::system_clock::time_point& to) {
+    std::vector<Booking> bookings;
+    
+    if (hallIds.empty() || to < from) {
+        return bookings;
+    }
+    
+    try {
+        auto collection = getCollection();
+        
+        auto halls = bsoncxx::builder::basic::array{};
+        for (const auto& hallId : hallIds) {
+            halls.append(hallId.toString());
+        }
+        
+        // Индекс { hallId: 1, startTime: 1 }: диапазон по времени внутри каждого зала
+        auto filter = bsoncxx::builder::stream::document{}
+            << "hallId" << bsoncxx::builder::stream::open_document
+                << "$in" << halls
+            << bsoncxx::builder::stream::close_document
+            << "$and" << bsoncxx::builder::basic::make_array(
+                MongoDBTime::rangeCondition("startTime", {{"$gte", from}, {"$lte", to}})).view()
+            << bsoncxx::builder::stream::finalize;
+        
+        mongocxx::options::find options;
+        options.sort(bsoncxx::builder::stream::document{} << "startTime" << 1 << bsoncxx::builder::stream::finalize);
+        
+        auto cursor = collection.find(filter.view(), options);
+        
+        for (auto&& doc : cursor) {
+            bookings.push_back(mapDocumentToBooking(doc));
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "MongoDB Error in findByHallsAndRange: " << e.what() << std::endl;
+        throw DataAccessException(std::string("Failed to find bookings by halls and range: ") + e.what());
+    }
+    
+    return bookings;
+}
+
+std::vector<Booking> MongoDBBookingRepository::findByBranchAndRange(
+    const UUID& branchId,
+    const std::chrono::system_clock::time_point& from,
+    const std::chrono::system_clock::time_point& to) {
+    if (to < from) {
+        return {};
+    }
+    
+    std::vector<UUID> hallIds;
+    try {
+        // Соединений между коллекциями нет: сначала идентификаторы залов филиала, затем один запрос по ним
+        auto halls = factory_->getCollection("dance_halls");
+        auto filter = bsoncxx::builder::stream::document{}
+            << "branchId" << branchId.toString()
+            << bsoncxx::builder::stream::finalize;
+        
+        mongocxx::options::find options;
+        options.projection(MongoDBRepositoryFactory::makeIdProjection());
+        
+        for (auto&& doc : halls.find(filter.view(), options)) {
+            hallIds.push_back(UUID::fromString(doc["id"].get_string().value.to_string()));
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "MongoDB Error in findByBranchAndRange: " << e.what() << std::endl;
+        throw DataAccessException(std::string("Failed to find bookings by branch and range: ") + e.what());
+    }
+    
+    return findByHallsAndRange(hallIds, from, to);
+}
+
 std::vector<Booking> MongoDBBookingRepository::findAll() {
     std::vector<Booking> bookings;
     
@@ -155,12 +270,12 @@ bool MongoDBBookingRepository::update(const Booking& booking) {
             << "$set" << bsoncxx::builder::stream::open_document
                 << "clientId" << booking.getClientId().toString()
                 << "hallId" << booking.getHallId().toString()
-                << "startTime" << DateTimeUtils::formatTimeForMongoDB(booking.getTimeSlot().getStartTime())
-                << "endTime" << DateTimeUtils::formatTimeForMongoDB(booking.getTimeSlot().getEndTime())
+                << "startTime" << MongoDBTime::toDate(booking.getTimeSlot().getStartTime())
+                << "endTime" << MongoDBTime::toDate(booking.getTimeSlot().getEndTime())
                 << "durationMinutes" << booking.getTimeSlot().getDurationMinutes()
                 << "purpose" << booking.getPurpose()
                 << "status" << EnumUtils::bookingStatusToString(booking.getStatus())
-                << "createdAt" << DateTimeUtils::formatTimeForMongoDB(booking.getCreatedAt())
+                << "createdAt" << MongoDBTime::toDate(booking.getCreatedAt())
             << bsoncxx::builder::stream::close_document
             << bsoncxx::builder::stream::finalize;
         
@@ -202,13 +317,61 @@ bool MongoDBBookingRepository::exists(const UUID& id) {
     }
 }
 
+std::vector<Booking> MongoDBBookingRepository::findByIds(const std::vector<UUID>& ids) {
+    std::vector<Booking> bookings;
+    
+    if (ids.empty()) {
+        return bookings;
+    }
+    
+    try {
+        auto collection = getCollection();
+        auto filter = MongoDBRepositoryFactory::makeIdInFilter(ids);
+        auto cursor = collection.find(filter.view());
+        
+        for (auto&& doc : cursor) {
+            bookings.push_back(mapDocumentToBooking(doc));
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "MongoDB Error in findByIds: " << e.what() << std::endl;
+        throw DataAccessException(std::string("Failed to find bookings by IDs: ") + e.what());
+    }
+    
+    return bookings;
+}
+
+std::set<UUID> MongoDBBookingRepository::existsMany(const std::vector<UUID>& ids) {
+    std::set<UUID> existing;
+    
+    if (ids.empty()) {
+        return existing;
+    }
+    
+    try {
+        auto collection = getCollection();
+        auto filter = MongoDBRepositoryFactory::makeIdInFilter(ids);
+        
+        mongocxx::options::find options;
+        options.projection(MongoDBRepositoryFactory::makeIdProjection());
+        
+        for (auto&& doc : collection.find(filter.view(), options)) {
+            existing.insert(UUID::fromString(doc["id"].get_string().value.to_string()));
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "MongoDB Error in existsMany: " << e.what() << std::endl;
+        throw DataAccessException(std::string("Failed to check booking existence: ") + e.what());
+    }
+    
+    return existing;
+}
+
 Booking MongoDBBookingRepository::mapDocumentToBooking(const bsoncxx::document::view& doc) const {
     try {
         UUID id = UUID::fromString(doc["id"].get_string().value.to_string());
         UUID clientId = UUID::fromString(doc["clientId"].get_string().value.to_string());
         UUID hallId = UUID::fromString(doc["hallId"].get_string().value.to_string());
         
-        auto startTime = DateTimeUtils::parseTimeFromMongoDB(doc["startTime"].get_string().value.to_string());
+        auto startTime = MongoDBTime::fromElement(doc["startTime"]);
         int durationMinutes = doc["durationMinutes"].get_int32();
         TimeSlot timeSlot(startTime, durationMinutes);
         
@@ -234,11 +397,11 @@ bsoncxx::document::value MongoDBBookingRepository::mapBookingToDocument(const Bo
         << "id" << booking.getId().toString()
         << "clientId" << booking.getClientId().toString()
         << "hallId" << booking.getHallId().toString()
-        << "startTime" << DateTimeUtils::formatTimeForMongoDB(booking.getTimeSlot().getStartTime())
-        << "endTime" << DateTimeUtils::formatTimeForMongoDB(booking.getTimeSlot().getEndTime())
+        << "startTime" << MongoDBTime::toDate(booking.getTimeSlot().getStartTime())
+        << "endTime" << MongoDBTime::toDate(booking.getTimeSlot().getEndTime())
         << "durationMinutes" << booking.getTimeSlot().getDurationMinutes()
         << "purpose" << booking.getPurpose()
         << "status" << EnumUtils::bookingStatusToString(booking.getStatus())
-        << "createdAt" << DateTimeUtils::formatTimeForMongoDB(booking.getCreatedAt())
+        << "createdAt" << MongoDBTime::toDate(booking.getCreatedAt())
         << bsoncxx::builder::stream::finalize;
 }
\ No newline at end of file
@@ -5,13 +5,14 @@
 #include "../../data/exceptions/DataAccessException.hpp" 
 #include <mongocxx/client.hpp>
 #include <mongocxx/collection.hpp>
+#include "../../data/MongoDBClientPool.hpp"
 
 class MongoDBRepositoryFactory;
 
 class MongoDBBookingRepository : public IBookingRepository {
 private:
     std::shared_ptr<MongoDBRepositoryFactory> factory_;
-    mongocxx::collection getCollection() const;
+    MongoDBPooledCollection getCollection() const;
 
 public:
     explicit MongoDBBookingRepository(std::shared_ptr<MongoDBRepositoryFactory> factory);
@@ -20,11 +21,22 @@ public:
     std::vector<Booking> findByClientId(const UUID& clientId) override;
     std::vector<Booking> findByHallId(const UUID& hallId) override;
     std::vector<Booking> findConflictingBookings(const UUID& hallId, const TimeSlot& timeSlot) override;
+    std::vector<Booking> findConflictingBookingsInRange(const std::vector<UUID>& hallIds,
+                                                        const std::chrono::system_clock::time_point& from,
+                                                        const std::chrono::system_clock::time_point& to) override;
+    std::vector<Booking> findByHallsAndRange(const std::vector<UUID>& hallIds,
+                                             const std::chrono::system_clock::time_point& from,
+                                             const std::chrono::system_clock::time_point& to) override;
+    std::vector<Booking> findByBranchAndRange(const UUID& branchId,
+                                              const std::chrono::system_clock::time_point& from,
+                                              const std::chrono::system_clock::time_point& to) override;
     std::vector<Booking> findAll() override;
     bool save(const Booking& booking) override;
     bool update(const Booking& booking) override;
     bool remove(const UUID& id) override;
     bool exists(const UUID& id) override;
+    std::vector<Booking> findByIds(const std::vector<UUID>& ids) override;
+    std::set<UUID> existsMany(const std::vector<UUID>& ids) override;
 
 private:
     Booking mapDocumentToBooking(const bsoncxx::document::view& doc) const;
@@ -1,6 +1,7 @@
 #include "MongoDBBranchRepository.hpp"
 #include "../../data/DateTimeUtils.hpp"
 #include "../../data/MongoDBRepositoryFactory.hpp"
+#include "../../core/Logger.hpp"
 #include <iostream>
 #include <bsoncxx/builder/basic/document.hpp>
 #include <bsoncxx/builder/basic/array.hpp>
@@ -13,8 +14,8 @@ using bsoncxx::builder::basic::sub_document;
 MongoDBBranchRepository::MongoDBBranchRepository(std::shared_ptr<MongoDBRepositoryFactory> factory)
     : factory_(std::move(factory)) {}
 
-mongocxx::collection MongoDBBranchRepository::getCollection() const {
-    return factory_->getDatabase().collection("branches");
+MongoDBPooledCollection MongoDBBranchRepository::getCollection() const {
+    return factory_->getCollection("branches");
 }
 
 std::optional<Branch> MongoDBBranchRepository::findById(const UUID& id) {
@@ -27,11 +28,11 @@ std::optional<Branch> MongoDBBranchRepository::findById(const UUID& id) {
         auto result = collection.find_one(filter.view());
         
         if (!result) {
-            std::cout << "❌ Филиал не найден в MongoDB: " << id.toString() << std::endl;
+            LOG_DEBUG("MongoDBBranchRepository", "❌ Филиал не найден в MongoDB: " << id.toString());
             return std::nullopt;
         }
         
-        std::cout << "✅ Филиал найден в MongoDB: " << id.toString() << std::endl;
+        LOG_DEBUG("MongoDBBranchRepository", "✅ Филиал найден в MongoDB: " << id.toString());
         return mapDocumentToBranch(result->view());
         
     } catch (const std::exception& e) {
@@ -44,7 +45,7 @@ std::vector<Branch> MongoDBBranchRepository::findByStudioId(const UUID& studioId
     std::vector<Branch> branches;
     
     try {
-        std::cout << "🔍 Поиск филиалов для студии в MongoDB: " << studioId.toString() << std::endl;
+        LOG_DEBUG("MongoDBBranchRepository", "🔍 Поиск филиалов для студии в MongoDB: " << studioId.toString());
         
         auto collection = getCollection();
         auto filter = bsoncxx::builder::stream::document{}
@@ -59,15 +60,15 @@ std::vector<Branch> MongoDBBranchRepository::findByStudioId(const UUID& studioId
                 auto branch = mapDocumentToBranch(doc);
                 branches.push_back(branch);
                 count++;
-                std::cout << "✅ Успешно создан филиал из MongoDB: " << branch.getName() 
-                          << " (ID: " << branch.getId().toString() << ")" << std::endl;
+                LOG_DEBUG("MongoDBBranchRepository", "✅ Успешно создан филиал из MongoDB: " << branch.getName() 
+                          << " (ID: " << branch.getId().toString() << ")");
             } catch (const std::exception& e) {
                 std::cerr << "❌ Ошибка создания филиала из MongoDB документа: " << e.what() << std::endl;
                 continue;
             }
         }
         
-        std::cout << "📊 Найдено филиалов в MongoDB: " << count << std::endl;
+        LOG_DEBUG("MongoDBBranchRepository", "📊 Найдено филиалов в MongoDB: " << count);
         return branches;
         
     } catch (const std::exception& e) {
@@ -80,7 +81,7 @@ std::vector<Branch> MongoDBBranchRepository::findAll() {
     std::vector<Branch> branches;
     
     try {
-        std::cout << "🔍 Получение всех филиалов из MongoDB" << std::endl;
+        LOG_DEBUG("MongoDBBranchRepository", "🔍 Получение всех филиалов из MongoDB");
         
         auto collection = getCollection();
         auto cursor = collection.find({});
@@ -97,7 +98,7 @@ std::vector<Branch> MongoDBBranchRepository::findAll() {
             }
         }
         
-        std::cout << "✅ Успешно загружено филиалов из MongoDB: " << count << std::endl;
+        LOG_DEBUG("MongoDBBranchRepository", "✅ Успешно загружено филиалов из MongoDB: " << count);
         return branches;
         
     } catch (const std::exception& e) {
@@ -116,7 +117,7 @@ bool MongoDBBranchRepository::save(const Branch& branch) {
         auto result = collection.insert_one(document.view());
         
         if (result && result->result().inserted_count() > 0) {
-            std::cout << "✅ Филиал успешно сохранен в MongoDB: " << branch.getId().toString() << std::endl;
+            LOG_DEBUG("MongoDBBranchRepository", "✅ Филиал успешно сохранен в MongoDB: " << branch.getId().toString());
             return true;
         }
         
@@ -152,11 +153,11 @@ bool MongoDBBranchRepository::update(const Branch& branch) {
         auto result = collection.update_one(filter.view(), update_doc.view());
         
         if (result && result->modified_count() > 0) {
-            std::cout << "✅ Филиал успешно обновлен в MongoDB: " << branch.getId().toString() << std::endl;
+            LOG_DEBUG("MongoDBBranchRepository", "✅ Филиал успешно обновлен в MongoDB: " << branch.getId().toString());
             return true;
         }
         
-        std::cout << "⚠️  Филиал не найден для обновления в MongoDB: " << branch.getId().toString() << std::endl;
+        LOG_DEBUG("MongoDBBranchRepository", "⚠️  Филиал не найден для обновления в MongoDB: " << branch.getId().toString());
         return false;
         
     } catch (const std::exception& e) {
@@ -175,11 +176,11 @@ bool MongoDBBranchRepository::remove(const UUID& id) {
         auto result = collection.delete_one(filter.view());
         
         if (result && result->deleted_count() > 0) {
-            std::cout << "✅ Филиал успешно удален из MongoDB: " << id.toString() << std::endl;
+            LOG_DEBUG("MongoDBBranchRepository", "✅ Филиал успешно удален из MongoDB: " << id.toString());
             return true;
         }
         
-        std::cout << "⚠️  Филиал не найден для удаления в MongoDB: " << id.toString() << std::endl;
+        LOG_DEBUG("MongoDBBranchRepository", "⚠️  Филиал не найден для удаления в MongoDB: " << id.toString());
         return false;
         
     } catch (const std::exception& e) {
@@ -204,6 +205,54 @@ bool MongoDBBranchRepository::exists(const UUID& id) {
     }
 }
 
+std::vector<Branch> MongoDBBranchRepository::findByIds(const std::vector<UUID>& ids) {
+    std::vector<Branch> branches;
+    
+    if (ids.empty()) {
+        return branches;
+    }
+    
+    try {
+        auto collection = getCollection();
+        auto filter = MongoDBRepositoryFactory::makeIdInFilter(ids);
+        auto cursor = collection.find(filter.view());
+        
+        for (auto&& doc : cursor) {
+            branches.push_back(mapDocumentToBranch(doc));
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "❌ MongoDB Error in findByIds: " << e.what() << std::endl;
+        throw DataAccessException(std::string("Failed to find branches by IDs: ") + e.what());
+    }
+    
+    return branches;
+}
+
+std::set<UUID> MongoDBBranchRepository::existsMany(const std::vector<UUID>& ids) {
+    std::set<UUID> existing;
+    
+    if (ids.empty()) {
+        return existing;
+    }
+    
+    try {
+        auto collection = getCollection();
+        auto filter = MongoDBRepositoryFactory::makeIdInFilter(ids);
+        
+        mongocxx::options::find options;
+        options.projection(MongoDBRepositoryFactory::makeIdProjection());
+        
+        for (auto&& doc : collection.find(filter.view(), options)) {
+            existing.insert(UUID::fromString(doc["id"].get_string().value.to_string()));
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "❌ MongoDB Error in existsMany: " << e.what() << std::endl;
+        throw DataAccessException(std::string("Failed to check branch existence: ") + e.what());
+    }
+    
+    return existing;
+}
+
 bsoncxx::document::value MongoDBBranchRepository::mapBranchToDocument(const Branch& branch) const {
     bsoncxx::builder::basic::document builder;
     
@@ -5,6 +5,7 @@
 #include "../../data/exceptions/DataAccessException.hpp"
 #include <mongocxx/client.hpp>
 #include <mongocxx/collection.hpp>
+#include "../../data/MongoDBClientPool.hpp"
 #include <bsoncxx/builder/stream/document.hpp>
 #include <bsoncxx/json.hpp>
 
@@ -13,7 +14,7 @@ class MongoDBRepositoryFactory;
 class MongoDBBranchRepository : public IBranchRepository {
 private:
     std::shared_ptr<MongoDBRepositoryFactory> factory_;
-    mongocxx::collection getCollection() const;
+    MongoDBPooledCollection getCollection() const;
 
 public:
     explicit MongoDBBranchRepository(std::shared_ptr<MongoDBRepositoryFactory> factory);
@@ -25,6 +26,8 @@ public:
     bool update(const Branch& branch) override;
     bool remove(const UUID& id) override;
     bool exists(const UUID& id) override;
+    std::vector<Branch> findByIds(const std::vector<UUID>& ids) override;
+    std::set<UUID> existsMany(const std::vector<UUID>& ids) override;
 
 private:
     Branch mapDocumentToBranch(const bsoncxx::document::view& doc) const;
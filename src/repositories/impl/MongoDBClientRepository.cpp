@@ -1,13 +1,14 @@
 #include "MongoDBClientRepository.hpp"
 #include "../../data/DateTimeUtils.hpp"
 #include "../../data/MongoDBRepositoryFactory.hpp"
+#include "../../data/MongoDBTime.hpp"
 #include <iostream>
 
 MongoDBClientRepository::MongoDBClientRepository(std::shared_ptr<MongoDBRepositoryFactory> factory)
     : factory_(std::move(factory)) {}
 
-mongocxx::collection MongoDBClientRepository::getCollection() const {
-    return factory_->getDatabase().collection("clients");
+MongoDBPooledCollection MongoDBClientRepository::getCollection() const {
+    return factory_->getCollection("clients");
 }
 
 std::optional<Client> MongoDBClientRepository::findById(const UUID& id) {
@@ -68,6 +69,16 @@ std::vector<Client> MongoDBClientRepository::findAll() {
     return clients;
 }
 
+int MongoDBClientRepository::count() {
+    try {
+        auto collection = getCollection();
+        return static_cast<int>(collection.count_documents({}));
+    } catch (const std::exception& e) {
+        std::cerr << "MongoDB Error in count: " << e.what() << std::endl;
+        throw DataAccessException(std::string("Failed to count clients: ") + e.what());
+    }
+}
+
 bool MongoDBClientRepository::save(const Client& client) {
     try {
         auto collection = getCollection();
@@ -95,7 +106,7 @@ bool MongoDBClientRepository::update(const Client& client) {
                 << "phone" << client.getPhone()
                 << "passwordHash" << client.getPasswordHash()
                 << "accountStatus" << EnumUtils::accountStatusToString(client.getStatus())
-                << "registrationDate" << DateTimeUtils::formatTimeForMongoDB(client.getRegistrationDate())
+                << "registrationDate" << MongoDBTime::toDate(client.getRegistrationDate())
             << bsoncxx::builder::stream::close_document
             << bsoncxx::builder::stream::finalize;
         
@@ -137,6 +148,54 @@ bool MongoDBClientRepository::exists(const UUID& id) {
     }
 }
 
+std::vector<Client> MongoDBClientRepository::findByIds(const std::vector<UUID>& ids) {
+    std::vector<Client> clients;
+    
+    if (ids.empty()) {
+        return clients;
+    }
+    
+    try {
+        auto collection = getCollection();
+        auto filter = MongoDBRepositoryFactory::makeIdInFilter(ids);
+        auto cursor = collection.find(filter.view());
+        
+        for (auto&& doc : cursor) {
+            clients.push_back(mapDocumentToClient(doc));
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "MongoDB Error in findByIds: " << e.what() << std::endl;
+        throw DataAccessException(std::string("Failed to find clients by IDs: ") + e.what());
+    }
+    
+    return clients;
+}
+
+std::set<UUID> MongoDBClientRepository::existsMany(const std::vector<UUID>& ids) {
+    std::set<UUID> existing;
+    
+    if (ids.empty()) {
+        return existing;
+    }
+    
+    try {
+        auto collection = getCollection();
+        auto filter = MongoDBRepositoryFactory::makeIdInFilter(ids);
+        
+        mongocxx::options::find options;
+        options.projection(MongoDBRepositoryFactory::makeIdProjection());
+        
+        for (auto&& doc : collection.find(filter.view(), options)) {
+            existing.insert(UUID::fromString(doc["id"].get_string().value.to_string()));
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "MongoDB Error in existsMany: " << e.what() << std::endl;
+        throw DataAccessException(std::string("Failed to check client existence: ") + e.what());
+    }
+    
+    return existing;
+}
+
 bool MongoDBClientRepository::existsByEmail(const std::string& email) {
     try {
         auto collection = getCollection();
@@ -165,9 +224,7 @@ Client MongoDBClientRepository::mapDocumentToClient(const bsoncxx::document::vie
         if (statusStr == "INACTIVE") status = AccountStatus::INACTIVE;
         else if (statusStr == "SUSPENDED") status = AccountStatus::SUSPENDED;
         
-        auto registrationDate = DateTimeUtils::parseTimeFromMongoDB(
-            doc["registrationDate"].get_string().value.to_string()
-        );
+        auto registrationDate = MongoDBTime::fromElement(doc["registrationDate"]);
         
         Client client(id, name, email, phone);
         client.setPasswordHash(passwordHash);
@@ -195,6 +252,6 @@ bsoncxx::document::value MongoDBClientRepository::mapClientToDocument(const Clie
         << "phone" << client.getPhone()
         << "passwordHash" << client.getPasswordHash()
         << "accountStatus" << EnumUtils::accountStatusToString(client.getStatus())
-        << "registrationDate" << DateTimeUtils::formatTimeForMongoDB(client.getRegistrationDate())
+        << "registrationDate" << MongoDBTime::toDate(client.getRegistrationDate())
         << bsoncxx::builder::stream::finalize;
 }
\ No newline at end of file
@@ -5,6 +5,7 @@
 #include "../../data/exceptions/DataAccessException.hpp" 
 #include <mongocxx/client.hpp>
 #include <mongocxx/collection.hpp>
+#include "../../data/MongoDBClientPool.hpp"
 #include <bsoncxx/builder/stream/document.hpp>
 #include <bsoncxx/json.hpp>
 
@@ -13,7 +14,7 @@ class MongoDBRepositoryFactory;
 class MongoDBClientRepository : public IClientRepository {
 private:
     std::shared_ptr<MongoDBRepositoryFactory> factory_;
-    mongocxx::collection getCollection() const;
+    MongoDBPooledCollection getCollection() const;
 
 public:
     explicit MongoDBClientRepository(std::shared_ptr<MongoDBRepositoryFactory> factory);
@@ -21,10 +22,13 @@ public:
     std::optional<Client> findById(const UUID& id) override;
     std::optional<Client> findByEmail(const std::string& email) override;
     std::vector<Client> findAll() override;
+    int count() override;
     bool save(const Client& client) override;
     bool update(const Client& client) override;
     bool remove(const UUID& id) override;
     bool exists(const UUID& id) override;
+    std::vector<Client> findByIds(const std::vector<UUID>& ids) override;
+    std::set<UUID> existsMany(const std::vector<UUID>& ids) override;
 
 private:
     Client mapDocumentToClient(const bsoncxx::document::view& doc) const;
@@ -1,13 +1,14 @@
 #include "MongoDBDanceHallRepository.hpp"
 #include "../../data/DateTimeUtils.hpp"
 #include "../../data/MongoDBRepositoryFactory.hpp"
+#include "../../core/Logger.hpp"
 #include <iostream>
 
 MongoDBDanceHallRepository::MongoDBDanceHallRepository(std::shared_ptr<MongoDBRepositoryFactory> factory)
     : factory_(std::move(factory)) {}
 
-mongocxx::collection MongoDBDanceHallRepository::getCollection() const {
-    return factory_->getDatabase().collection("dance_halls");
+MongoDBPooledCollection MongoDBDanceHallRepository::getCollection() const {
+    return factory_->getCollection("dance_halls");
 }
 
 std::optional<DanceHall> MongoDBDanceHallRepository::findById(const UUID& id) {
@@ -20,11 +21,11 @@ std::optional<DanceHall> MongoDBDanceHallRepository::findById(const UUID& id) {
         auto result = collection.find_one(filter.view());
         
         if (!result) {
-            std::cout << "❌ Зал не найден в MongoDB: " << id.toString() << std::endl;
+            LOG_DEBUG("MongoDBDanceHallRepository", "❌ Зал не найден в MongoDB: " << id.toString());
             return std::nullopt;
         }
         
-        std::cout << "✅ Зал найден в MongoDB: " << id.toString() << std::endl;
+        LOG_DEBUG("MongoDBDanceHallRepository", "✅ Зал найден в MongoDB: " << id.toString());
         return mapDocumentToDanceHall(result->view());
         
     } catch (const std::exception& e) {
@@ -37,7 +38,7 @@ std::vector<DanceHall> MongoDBDanceHallRepository::findByBranchId(const UUID& br
     std::vector<DanceHall> halls;
     
     try {
-        std::cout << "🔍 Поиск залов для филиала в MongoDB: " << branchId.toString() << std::endl;
+        LOG_DEBUG("MongoDBDanceHallRepository", "🔍 Поиск залов для филиала в MongoDB: " << branchId.toString());
         
         auto collection = getCollection();
         auto filter = bsoncxx::builder::stream::document{}
@@ -52,15 +53,15 @@ std::vector<DanceHall> MongoDBDanceHallRepository::findByBranchId(const UUID& br
                 auto hall = mapDocumentToDanceHall(doc);
                 halls.push_back(hall);
                 count++;
-                std::cout << "✅ Успешно создан зал из MongoDB: " << hall.getName() 
-                          << " (ID: " << hall.getId().toString() << ")" << std::endl;
+                LOG_DEBUG("MongoDBDanceHallRepository", "✅ Успешно создан зал из MongoDB: " << hall.getName() 
+                          << " (ID: " << hall.getId().toString() << ")");
             } catch (const std::exception& e) {
                 std::cerr << "❌ Ошибка создания зала из MongoDB документа: " << e.what() << std::endl;
                 continue;
             }
         }
         
-        std::cout << "📊 Найдено залов в MongoDB: " << count << std::endl;
+        LOG_DEBUG("MongoDBDanceHallRepository", "📊 Найдено залов в MongoDB: " << count);
         return halls;
         
     } catch (const std::exception& e) {
@@ -85,11 +86,59 @@ bool MongoDBDanceHallRepository::exists(const UUID& id) {
     }
 }
 
+std::vector<DanceHall> MongoDBDanceHallRepository::findByIds(const std::vector<UUID>& ids) {
+    std::vector<DanceHall> halls;
+    
+    if (ids.empty()) {
+        return halls;
+    }
+    
+    try {
+        auto collection = getCollection();
+        auto filter = MongoDBRepositoryFactory::makeIdInFilter(ids);
+        auto cursor = collection.find(filter.view());
+        
+        for (auto&& doc : cursor) {
+            halls.push_back(mapDocumentToDanceHall(doc));
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "❌ MongoDB Error in findByIds: " << e.what() << std::endl;
+        throw DataAccessException(std::string("Failed to find dance halls by IDs: ") + e.what());
+    }
+    
+    return halls;
+}
+
+std::set<UUID> MongoDBDanceHallRepository::existsMany(const std::vector<UUID>& ids) {
+    std::set<UUID> existing;
+    
+    if (ids.empty()) {
+        return existing;
+    }
+    
+    try {
+        auto collection = getCollection();
+        auto filter = MongoDBRepositoryFactory::makeIdInFilter(ids);
+        
+        mongocxx::options::find options;
+        options.projection(MongoDBRepositoryFactory::makeIdProjection());
+        
+        for (auto&& doc : collection.find(filter.view(), options)) {
+            existing.insert(UUID::fromString(doc["id"].get_string().value.to_string()));
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "❌ MongoDB Error in existsMany: " << e.what() << std::endl;
+        throw DataAccessException(std::string("Failed to check hall existence: ") + e.what());
+    }
+    
+    return existing;
+}
+
 std::vector<DanceHall> MongoDBDanceHallRepository::findAll() {
     std::vector<DanceHall> halls;
     
     try {
-        std::cout << "🔍 Получение всех залов из MongoDB" << std::endl;
+        LOG_DEBUG("MongoDBDanceHallRepository", "🔍 Получение всех залов из MongoDB");
         
         auto collection = getCollection();
         auto cursor = collection.find({});
@@ -106,7 +155,7 @@ std::vector<DanceHall> MongoDBDanceHallRepository::findAll() {
             }
         }
         
-        std::cout << "✅ Успешно загружено залов из MongoDB: " << count << std::endl;
+        LOG_DEBUG("MongoDBDanceHallRepository", "✅ Успешно загружено залов из MongoDB: " << count);
         return halls;
         
     } catch (const std::exception& e) {
@@ -125,7 +174,7 @@ bool MongoDBDanceHallRepository::save(const DanceHall& hall) {
         auto result = collection.insert_one(document.view());
         
         if (result && result->result().inserted_count() > 0) {
-            std::cout << "✅ Зал успешно сохранен в MongoDB: " << hall.getId().toString() << std::endl;
+            LOG_DEBUG("MongoDBDanceHallRepository", "✅ Зал успешно сохранен в MongoDB: " << hall.getId().toString());
             return true;
         }
         
@@ -161,11 +210,11 @@ bool MongoDBDanceHallRepository::update(const DanceHall& hall) {
         auto result = collection.update_one(filter.view(), update_doc.view());
         
         if (result && result->modified_count() > 0) {
-            std::cout << "✅ Зал успешно обновлен в MongoDB: " << hall.getId().toString() << std::endl;
+            LOG_DEBUG("MongoDBDanceHallRepository", "✅ Зал успешно обновлен в MongoDB: " << hall.getId().toString());
             return true;
         }
         
-        std::cout << "⚠️  Зал не найден для обновления в MongoDB: " << hall.getId().toString() << std::endl;
+        LOG_DEBUG("MongoDBDanceHallRepository", "⚠️  Зал не найден для обновления в MongoDB: " << hall.getId().toString());
         return false;
         
     } catch (const std::exception& e) {
@@ -184,11 +233,11 @@ bool MongoDBDanceHallRepository::remove(const UUID& id) {
         auto result = collection.delete_one(filter.view());
         
         if (result && result->deleted_count() > 0) {
-            std::cout << "✅ Зал успешно удален из MongoDB: " << id.toString() << std::endl;
+            LOG_DEBUG("MongoDBDanceHallRepository", "✅ Зал успешно удален из MongoDB: " << id.toString());
             return true;
         }
         
-        std::cout << "⚠️  Зал не найден для удаления в MongoDB: " << id.toString() << std::endl;
+        LOG_DEBUG("MongoDBDanceHallRepository", "⚠️  Зал не найден для удаления в MongoDB: " << id.toString());
         return false;
         
     } catch (const std::exception& e) {
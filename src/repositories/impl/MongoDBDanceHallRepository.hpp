@@ -5,6 +5,7 @@
 #include "../../data/exceptions/DataAccessException.hpp"
 #include <mongocxx/client.hpp>
 #include <mongocxx/collection.hpp>
+#include "../../data/MongoDBClientPool.hpp"
 #include <bsoncxx/builder/stream/document.hpp>
 #include <bsoncxx/json.hpp>
 
@@ -13,7 +14,7 @@ class MongoDBRepositoryFactory;
 class MongoDBDanceHallRepository : public IDanceHallRepository {
 private:
     std::shared_ptr<MongoDBRepositoryFactory> factory_;
-    mongocxx::collection getCollection() const;
+    MongoDBPooledCollection getCollection() const;
 
 public:
     explicit MongoDBDanceHallRepository(std::shared_ptr<MongoDBRepositoryFactory> factory);
@@ -21,6 +22,8 @@ public:
     std::optional<DanceHall> findById(const UUID& id) override;
     std::vector<DanceHall> findByBranchId(const UUID& branchId) override;
     bool exists(const UUID& id) override;
+    std::vector<DanceHall> findByIds(const std::vector<UUID>& ids) override;
+    std::set<UUID> existsMany(const std::vector<UUID>& ids) override;
     std::vector<DanceHall> findAll() override;
     bool save(const DanceHall& hall) override;
     bool update(const DanceHall& hall) override;
@@ -1,6 +1,8 @@
 #include "MongoDBEnrollmentRepository.hpp"
 #include "../../data/MongoDBRepositoryFactory.hpp"
 #include "../../data/DateTimeUtils.hpp"
+#include "../../core/Logger.hpp"
+#include "../../data/MongoDBTime.hpp"
 #include <bsoncxx/builder/basic/document.hpp>
 #include <bsoncxx/builder/basic/array.hpp>
 #include <bsoncxx/builder/basic/kvp.hpp>
@@ -13,8 +15,8 @@ using bsoncxx::builder::basic::make_array;
 MongoDBEnrollmentRepository::MongoDBEnrollmentRepository(std::shared_ptr<MongoDBRepositoryFactory> factory)
     : factory_(std::move(factory)) {}
 
-mongocxx::collection MongoDBEnrollmentRepository::getCollection() const {
-    return factory_->getDatabase().collection("enrollments");
+MongoDBPooledCollection MongoDBEnrollmentRepository::getCollection() const {
+    return factory_->getCollection("enrollments");
 }
 
 std::optional<Enrollment> MongoDBEnrollmentRepository::findById(const UUID& id) {
@@ -25,11 +27,11 @@ std::optional<Enrollment> MongoDBEnrollmentRepository::findById(const UUID& id)
         auto result = collection.find_one(filter.view());
         
         if (!result) {
-            std::cout << "❌ Запись на занятие не найдена в MongoDB: " << id.toString() << std::endl;
+            LOG_DEBUG("MongoDBEnrollmentRepository", "❌ Запись на занятие не найдена в MongoDB: " << id.toString());
             return std::nullopt;
         }
         
-        std::cout << "✅ Запись на занятие найдена в MongoDB: " << id.toString() << std::endl;
+        LOG_DEBUG("MongoDBEnrollmentRepository", "✅ Запись на занятие найдена в MongoDB: " << id.toString());
         return mapDocumentToEnrollment(result->view());
         
     } catch (const std::exception& e) {
@@ -42,7 +44,7 @@ std::vector<Enrollment> MongoDBEnrollmentRepository::findByClientId(const UUID&
     std::vector<Enrollment> enrollments;
     
     try {
-        std::cout << "🔍 Поиск записей клиента в MongoDB: " << clientId.toString() << std::endl;
+        LOG_DEBUG("MongoDBEnrollmentRepository", "🔍 Поиск записей клиента в MongoDB: " << clientId.toString());
         
         auto collection = getCollection();
         auto filter = make_document(kvp("clientId", clientId.toString()));
@@ -55,14 +57,14 @@ std::vector<Enrollment> MongoDBEnrollmentRepository::findByClientId(const UUID&
                 auto enrollment = mapDocumentToEnrollment(doc);
                 enrollments.push_back(enrollment);
                 count++;
-                std::cout << "✅ Найдена запись клиента: " << enrollment.getId().toString() << std::endl;
+                LOG_DEBUG("MongoDBEnrollmentRepository", "✅ Найдена запись клиента: " << enrollment.getId().toString());
             } catch (const std::exception& e) {
                 std::cerr << "❌ Ошибка создания записи из MongoDB документа: " << e.what() << std::endl;
                 continue;
             }
         }
         
-        std::cout << "📊 Найдено записей клиента в MongoDB: " << count << std::endl;
+        LOG_DEBUG("MongoDBEnrollmentRepository", "📊 Найдено записей клиента в MongoDB: " << count);
         return enrollments;
         
     } catch (const std::exception& e) {
@@ -75,7 +77,7 @@ std::vector<Enrollment> MongoDBEnrollmentRepository::findByLessonId(const UUID&
     std::vector<Enrollment> enrollments;
     
     try {
-        std::cout << "🔍 Поиск записей на занятие в MongoDB: " << lessonId.toString() << std::endl;
+        LOG_DEBUG("MongoDBEnrollmentRepository", "🔍 Поиск записей на занятие в MongoDB: " << lessonId.toString());
         
         auto collection = getCollection();
         auto filter = make_document(kvp("lessonId", lessonId.toString()));
@@ -88,14 +90,14 @@ std::vector<Enrollment> MongoDBEnrollmentRepository::findByLessonId(const UUID&
                 auto enrollment = mapDocumentToEnrollment(doc);
                 enrollments.push_back(enrollment);
                 count++;
-                std::cout << "✅ Найдена запись на занятие: " << enrollment.getId().toString() << std::endl;
+                LOG_DEBUG("MongoDBEnrollmentRepository", "✅ Найдена запись на занятие: " << enrollment.getId().toString());
             } catch (const std::exception& e) {
                 std::cerr << "❌ Ошибка создания записи из MongoDB документа: " << e.what() << std::endl;
                 continue;
             }
         }
         
-        std::cout << "📊 Найдено записей на занятие в MongoDB: " << count << std::endl;
+        LOG_DEBUG("MongoDBEnrollmentRepository", "📊 Найдено записей на занятие в MongoDB: " << count);
         return enrollments;
         
     } catch (const std::exception& e) {
@@ -117,11 +119,11 @@ std::optional<Enrollment> MongoDBEnrollmentRepository::findByClientAndLesson(
         auto result = collection.find_one(filter.view());
         
         if (!result) {
-            std::cout << "❌ Запись клиента на занятие не найдена в MongoDB" << std::endl;
+            LOG_DEBUG("MongoDBEnrollmentRepository", "❌ Запись клиента на занятие не найдена в MongoDB");
             return std::nullopt;
         }
         
-        std::cout << "✅ Запись клиента на занятие найдена в MongoDB" << std::endl;
+        LOG_DEBUG("MongoDBEnrollmentRepository", "✅ Запись клиента на занятие найдена в MongoDB");
         return mapDocumentToEnrollment(result->view());
         
     } catch (const std::exception& e) {
@@ -140,7 +142,7 @@ int MongoDBEnrollmentRepository::countByLessonId(const UUID& lessonId) {
         
         auto count = collection.count_documents(filter.view());
         
-        std::cout << "📊 Количество записей на занятие в MongoDB: " << count << std::endl;
+        LOG_DEBUG("MongoDBEnrollmentRepository", "📊 Количество записей на занятие в MongoDB: " << count);
         return static_cast<int>(count);
         
     } catch (const std::exception& e) {
@@ -153,7 +155,7 @@ std::vector<Enrollment> MongoDBEnrollmentRepository::findAll() {
     std::vector<Enrollment> enrollments;
     
     try {
-        std::cout << "🔍 Получение всех записей из MongoDB" << std::endl;
+        LOG_DEBUG("MongoDBEnrollmentRepository", "🔍 Получение всех записей из MongoDB");
         
         auto collection = getCollection();
         auto cursor = collection.find({});
@@ -170,7 +172,7 @@ std::vector<Enrollment> MongoDBEnrollmentRepository::findAll() {
             }
         }
         
-        std::cout << "✅ Успешно загружено записей из MongoDB: " << count << std::endl;
+        LOG_DEBUG("MongoDBEnrollmentRepository", "✅ Успешно загружено записей из MongoDB: " << count);
         return enrollments;
         
     } catch (const std::exception& e) {
@@ -189,7 +191,7 @@ bool MongoDBEnrollmentRepository::save(const Enrollment& enrollment) {
         auto result = collection.insert_one(document.view());
         
         if (result && result->result().inserted_count() > 0) {
-            std::cout << "✅ Запись на занятие успешно сохранена в MongoDB: " << enrollment.getId().toString() << std::endl;
+            LOG_DEBUG("MongoDBEnrollmentRepository", "✅ Запись на занятие успешно сохранена в MongoDB: " << enrollment.getId().toString());
             return true;
         }
         
@@ -214,18 +216,18 @@ bool MongoDBEnrollmentRepository::update(const Enrollment& enrollment) {
                 kvp("clientId", enrollment.getClientId().toString()),
                 kvp("lessonId", enrollment.getLessonId().toString()),
                 kvp("status", enrollmentStatusToString(enrollment.getStatus())),
-                kvp("enrollmentDate", DateTimeUtils::formatTimeForMongoDB(enrollment.getEnrollmentDate()))
+                kvp("enrollmentDate", MongoDBTime::toDate(enrollment.getEnrollmentDate()))
             ))
         );
         
         auto result = collection.update_one(filter.view(), update_doc.view());
         
         if (result && result->modified_count() > 0) {
-            std::cout << "✅ Запись на занятие успешно обновлена в MongoDB: " << enrollment.getId().toString() << std::endl;
+            LOG_DEBUG("MongoDBEnrollmentRepository", "✅ Запись на занятие успешно обновлена в MongoDB: " << enrollment.getId().toString());
             return true;
         }
         
-        std::cout << "⚠️  Запись на занятие не найдена для обновления в MongoDB: " << enrollment.getId().toString() << std::endl;
+        LOG_DEBUG("MongoDBEnrollmentRepository", "⚠️  Запись на занятие не найдена для обновления в MongoDB: " << enrollment.getId().toString());
         return false;
         
     } catch (const std::exception& e) {
@@ -242,11 +244,11 @@ bool MongoDBEnrollmentRepository::remove(const UUID& id) {
         auto result = collection.delete_one(filter.view());
         
         if (result && result->deleted_count() > 0) {
-            std::cout << "✅ Запись на занятие успешно удалена из MongoDB: " << id.toString() << std::endl;
+            LOG_DEBUG("MongoDBEnrollmentRepository", "✅ Запись на занятие успешно удалена из MongoDB: " << id.toString());
             return true;
         }
         
-        std::cout << "⚠️  Запись на занятие не найдена для удаления в MongoDB: " << id.toString() << std::endl;
+        LOG_DEBUG("MongoDBEnrollmentRepository", "⚠️  Запись на занятие не найдена для удаления в MongoDB: " << id.toString());
         return false;
         
     } catch (const std::exception& e) {
@@ -269,6 +271,54 @@ bool MongoDBEnrollmentRepository::exists(const UUID& id) {
     }
 }
 
+std::vector<Enrollment> MongoDBEnrollmentRepository::findByIds(const std::vector<UUID>& ids) {
+    std::vector<Enrollment> enrollments;
+    
+    if (ids.empty()) {
+        return enrollments;
+    }
+    
+    try {
+        auto collection = getCollection();
+        auto filter = MongoDBRepositoryFactory::makeIdInFilter(ids);
+        auto cursor = collection.find(filter.view());
+        
+        for (auto&& doc : cursor) {
+            enrollments.push_back(mapDocumentToEnrollment(doc));
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "❌ MongoDB Error in findByIds: " << e.what() << std::endl;
+        throw DataAccessException(std::string("Failed to find enrollments by IDs: ") + e.what());
+    }
+    
+    return enrollments;
+}
+
+std::set<UUID> MongoDBEnrollmentRepository::existsMany(const std::vector<UUID>& ids) {
+    std::set<UUID> existing;
+    
+    if (ids.empty()) {
+        return existing;
+    }
+    
+    try {
+        auto collection = getCollection();
+        auto filter = MongoDBRepositoryFactory::makeIdInFilter(ids);
+        
+        mongocxx::options::find options;
+        options.projection(MongoDBRepositoryFactory::makeIdProjection());
+        
+        for (auto&& doc : collection.find(filter.view(), options)) {
+            existing.insert(UUID::fromString(doc["id"].get_string().value.to_string()));
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "❌ MongoDB Error in existsMany: " << e.what() << std::endl;
+        throw DataAccessException(std::string("Failed to check enrollment existence: ") + e.what());
+    }
+    
+    return existing;
+}
+
 Enrollment MongoDBEnrollmentRepository::mapDocumentToEnrollment(const bsoncxx::document::view& doc) const {
     try {
         UUID id = UUID::fromString(doc["id"].get_string().value.to_string());
@@ -318,7 +368,7 @@ bsoncxx::document::value MongoDBEnrollmentRepository::mapEnrollmentToDocument(co
         kvp("clientId", enrollment.getClientId().toString()),
         kvp("lessonId", enrollment.getLessonId().toString()),
         kvp("status", enrollmentStatusToString(enrollment.getStatus())),
-        kvp("enrollmentDate", DateTimeUtils::formatTimeForMongoDB(enrollment.getEnrollmentDate()))
+        kvp("enrollmentDate", MongoDBTime::toDate(enrollment.getEnrollmentDate()))
     );
 }
 
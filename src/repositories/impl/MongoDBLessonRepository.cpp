@@ -1,6 +1,8 @@
 #include "MongoDBLessonRepository.hpp"
 #include "../../data/MongoDBRepositoryFactory.hpp"
 #include "../../data/DateTimeUtils.hpp"
+#include "../../core/Logger.hpp"
+#include "../../data/MongoDBTime.hpp"
 #include <bsoncxx/builder/basic/document.hpp>
 #include <bsoncxx/builder/basic/array.hpp>
 #include <bsoncxx/builder/basic/kvp.hpp>
@@ -13,8 +15,8 @@ using bsoncxx::builder::basic::make_array;
 MongoDBLessonRepository::MongoDBLessonRepository(std::shared_ptr<MongoDBRepositoryFactory> factory)
     : factory_(std::move(factory)) {}
 
-mongocxx::collection MongoDBLessonRepository::getCollection() const {
-    return factory_->getDatabase().collection("lessons");
+MongoDBPooledCollection MongoDBLessonRepository::getCollection() const {
+    return factory_->getCollection("lessons");
 }
 
 std::optional<Lesson> MongoDBLessonRepository::findById(const UUID& id) {
@@ -25,11 +27,11 @@ std::optional<Lesson> MongoDBLessonRepository::findById(const UUID& id) {
         auto result = collection.find_one(filter.view());
         
         if (!result) {
-            std::cout << "❌ Урок не найден в MongoDB: " << id.toString() << std::endl;
+            LOG_DEBUG("MongoDBLessonRepository", "❌ Урок не найден в MongoDB: " << id.toString());
             return std::nullopt;
         }
         
-        std::cout << "✅ Урок найден в MongoDB: " << id.toString() << std::endl;
+        LOG_DEBUG("MongoDBLessonRepository", "✅ Урок найден в MongoDB: " << id.toString());
         return mapDocumentToLesson(result->view());
         
     } catch (const std::exception& e) {
@@ -42,7 +44,7 @@ std::vector<Lesson> MongoDBLessonRepository::findByTrainerId(const UUID& trainer
     std::vector<Lesson> lessons;
     
     try {
-        std::cout << "🔍 Поиск уроков тренера в MongoDB: " << trainerId.toString() << std::endl;
+        LOG_DEBUG("MongoDBLessonRepository", "🔍 Поиск уроков тренера в MongoDB: " << trainerId.toString());
         
         auto collection = getCollection();
         auto filter = make_document(kvp("trainerId", trainerId.toString()));
@@ -55,14 +57,14 @@ std::vector<Lesson> MongoDBLessonRepository::findByTrainerId(const UUID& trainer
                 auto lesson = mapDocumentToLesson(doc);
                 lessons.push_back(lesson);
                 count++;
-                std::cout << "✅ Найден урок тренера: " << lesson.getName() << std::endl;
+                LOG_DEBUG("MongoDBLessonRepository", "✅ Найден урок тренера: " << lesson.getName());
             } catch (const std::exception& e) {
                 std::cerr << "❌ Ошибка создания урока из MongoDB документа: " << e.what() << std::endl;
                 continue;
             }
         }
         
-        std::cout << "📊 Найдено уроков тренера в MongoDB: " << count << std::endl;
+        LOG_DEBUG("MongoDBLessonRepository", "📊 Найдено уроков тренера в MongoDB: " << count);
         return lessons;
         
     } catch (const std::exception& e) {
@@ -75,7 +77,7 @@ std::vector<Lesson> MongoDBLessonRepository::findByHallId(const UUID& hallId) {
     std::vector<Lesson> lessons;
     
     try {
-        std::cout << "🔍 Поиск уроков в зале в MongoDB: " << hallId.toString() << std::endl;
+        LOG_DEBUG("MongoDBLessonRepository", "🔍 Поиск уроков в зале в MongoDB: " << hallId.toString());
         
         auto collection = getCollection();
         auto filter = make_document(kvp("hallId", hallId.toString()));
@@ -88,14 +90,14 @@ std::vector<Lesson> MongoDBLessonRepository::findByHallId(const UUID& hallId) {
                 auto lesson = mapDocumentToLesson(doc);
                 lessons.push_back(lesson);
                 count++;
-                std::cout << "✅ Найден урок в зале: " << lesson.getName() << std::endl;
+                LOG_DEBUG("MongoDBLessonRepository", "✅ Найден урок в зале: " << lesson.getName());
             } catch (const std::exception& e) {
                 std::cerr << "❌ Ошибка создания урока из MongoDB документа: " << e.what() << std::endl;
                 continue;
             }
         }
         
-        std::cout << "📊 Найдено уроков в зале в MongoDB: " << count << std::endl;
+        LOG_DEBUG("MongoDBLessonRepository", "📊 Найдено уроков в зале в MongoDB: " << count);
         return lessons;
         
     } catch (const std::exception& e) {
@@ -108,7 +110,7 @@ std::vector<Lesson> MongoDBLessonRepository::findConflictingLessons(const UUID&
     std::vector<Lesson> lessons;
     
     try {
-        std::cout << "🔍 Поиск конфликтующих уроков в MongoDB для зала: " << hallId.toString() << std::endl;
+        LOG_DEBUG("MongoDBLessonRepository", "🔍 Поиск конфликтующих уроков в MongoDB для зала: " << hallId.toString());
         
         auto collection = getCollection();
         
@@ -119,11 +121,9 @@ std::vector<Lesson> MongoDBLessonRepository::findConflictingLessons(const UUID&
         auto filter = make_document(
             kvp("hallId", hallId.toString()),
             kvp("status", make_document(kvp("$in", make_array("SCHEDULED", "ONGOING")))),
-            kvp("$or", make_array(
-                make_document(
-                    kvp("startTime", make_document(kvp("$lt", DateTimeUtils::formatTimeForMongoDB(endTime)))),
-                    kvp("endTime", make_document(kvp("$gt", DateTimeUtils::formatTimeForMongoDB(startTime))))
-                )
+            kvp("$and", make_array(
+                MongoDBTime::rangeCondition("startTime", {{"$lt", endTime}}),
+                MongoDBTime::rangeCondition("endTime", {{"$gt", startTime}})
             ))
         );
         
@@ -135,14 +135,14 @@ std::vector<Lesson> MongoDBLessonRepository::findConflictingLessons(const UUID&
                 auto lesson = mapDocumentToLesson(doc);
                 lessons.push_back(lesson);
                 count++;
-                std::cout << "⚠️  Найден конфликтующий урок: " << lesson.getName() << std::endl;
+                LOG_DEBUG("MongoDBLessonRepository", "⚠️  Найден конфликтующий урок: " << lesson.getName());
             } catch (const std::exception& e) {
                 std::cerr << "❌ Ошибка создания конфликтующего урока из MongoDB: " << e.what() << std::endl;
                 continue;
             }
         }
         
-        std::cout << "📊 Найдено конфликтующих уроков в MongoDB: " << count << std::endl;
+        LOG_DEBUG("MongoDBLessonRepository", "📊 Найдено конфликтующих уроков в MongoDB: " << count);
         return lessons;
         
     } catch (const std::exception& e) {
@@ -151,11 +151,137 @@ std::vector<Lesson> MongoDBLessonRepository::findConflictingLessons(const UUID&
     }
 }
 
+std::vector<Lesson> MongoDBLessonRepository::findConflictingLessonsInRange(
+    const std::vector<UUID>& hallIds,
+    const std::chrono::system_clock::time_point& from,
+    const std::chrono::system_clock::time_point& to) {
+    std::vector<Lesson> lessons;
+    
+    if (hallIds.empty() || !(from < to)) {
+        return lessons;
+    }
+    
+    try {
+        auto collection = getCollection();
+        
+        bsoncxx::builder::basic::array halls;
+        for (const auto& hallId : hallIds) {
+            halls.append(hallId.toString());
+        }
+        
+        // Один запрос на все залы: hallId $in [...] и пересечение с [from, to)
+        auto filter = make_document(
+            kvp("hallId", make_document(kvp("$in", halls.view()))),
+            kvp("status", make_document(kvp("$in", make_array("SCHEDULED", "ONGOING")))),
+            kvp("$and", make_array(
+                MongoDBTime::rangeCondition("startTime", {{"$lt", to}}),
+                MongoDBTime::rangeCondition("endTime", {{"$gt", from}})
+            ))
+        );
+        
+        auto cursor = collection.find(filter.view());
+        
+        for (auto&& doc : cursor) {
+            try {
+                lessons.push_back(mapDocumentToLesson(doc));
+            } catch (const std::exception& e) {
+                std::cerr << "❌ Ошибка создания конфликтующего урока из MongoDB: " << e.what() << std::endl;
+                continue;
+            }
+        }
+        
+        LOG_DEBUG("MongoDBLessonRepository", "📊 Найдено конфликтующих уроков в MongoDB: " << lessons.size() 
+                  << " (залов: " << hallIds.size() << ")");
+        return lessons;
+        
+    } catch (const std::exception& e) {
+        std::cerr << "❌ MongoDB Error in findConflictingLessonsInRange: " << e.what() << std::endl;
+        throw DataAccessException(std::string("Failed to find conflicting lessons in range: ") + e.what());
+    }
+}
+
+std::vector<Lesson> MongoDBLessonRepository::findByHallsAndRange(
+    const std::vector<UUID>& hallIds,
+    const std::chrono::system_clock::time_point& from,
+    const std::chrono::system_clock::time_point& to) {
+    std::vector<Lesson> lessons;
+    
+    if (hallIds.empty() || to < from) {
+        return lessons;
+    }
+    
+    try {
+        auto collection = getCollection();
+        
+        bsoncxx::builder::basic::array halls;
+        for (const auto& hallId : hallIds) {
+            halls.append(hallId.toString());
+        }
+        
+        // Индекс { hallId: 1, startTime: 1 }: диапазон по времени внутри каждого зала
+        auto filter = make_document(
+            kvp("hallId", make_document(kvp("$in", halls.view()))),
+            kvp("$and", make_array(
+                MongoDBTime::rangeCondition("startTime", {{"$gte", from}, {"$lte", to}})
+            ))
+        );
+        
+        mongocxx::options::find options;
+        options.sort(make_document(kvp("startTime", 1)));
+        
+        auto cursor = collection.find(filter.view(), options);
+        
+        for (auto&& doc : cursor) {
+            try {
+                lessons.push_back(mapDocumentToLesson(doc));
+            } catch (const std::exception& e) {
+                std::cerr << "❌ Ошибка создания урока из MongoDB: " << e.what() << std::endl;
+                continue;
+            }
+        }
+        
+        LOG_DEBUG("MongoDBLessonRepository", "📊 Найдено уроков в MongoDB за период: " << lessons.size() 
+                  << " (залов: " << hallIds.size() << ")");
+        return lessons;
+        
+    } catch (const std::exception& e) {
+        std::cerr << "❌ MongoDB Error in findByHallsAndRange: " << e.what() << std::endl;
+        throw DataAccessException(std::string("Failed to find lessons by halls and range: ") + e.what());
+    }
+}
+
+std::vector<Lesson> MongoDBLessonRepository::findByBranchAndRange(
+    const UUID& branchId,
+    const std::chrono::system_clock::time_point& from,
+    const std::chrono::system_clock::time_point& to) {
+    if (to < from) {
+        return {};
+    }
+    
+    std::vector<UUID> hallIds;
+    try {
+        // Соединений между коллекциями нет: сначала идентификаторы залов филиала, затем один запрос по ним
+        auto halls = factory_->getCollection("dance_halls");
+        
+        mongocxx::options::find options;
+        options.projection(MongoDBRepositoryFactory::makeIdProjection());
+        
+        for (auto&& doc : halls.find(make_document(kvp("branchId", branchId.toString())).view(), options)) {
+            hallIds.push_back(UUID::fromString(doc["id"].get_string().value.to_string()));
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "❌ MongoDB Error in findByBranchAndRange: " << e.what() << std::endl;
+        throw DataAccessException(std::string("Failed to find lessons by branch and range: ") + e.what());
+    }
+    
+    return findByHallsAndRange(hallIds, from, to);
+}
+
 std::vector<Lesson> MongoDBLessonRepository::findUpcomingLessons(int days) {
     std::vector<Lesson> lessons;
     
     try {
-        std::cout << "🔍 Поиск предстоящих уроков в MongoDB (дней: " << days << ")" << std::endl;
+        LOG_DEBUG("MongoDBLessonRepository", "🔍 Поиск предстоящих уроков в MongoDB (дней: " << days << ")");
         
         auto collection = getCollection();
         
@@ -164,9 +290,8 @@ std::vector<Lesson> MongoDBLessonRepository::findUpcomingLessons(int days) {
         
         // Уроки, которые начнутся в течение указанного количества дней
         auto filter = make_document(
-            kvp("startTime", make_document(
-                kvp("$gte", DateTimeUtils::formatTimeForMongoDB(now)),
-                kvp("$lte", DateTimeUtils::formatTimeForMongoDB(futureDate))
+            kvp("$and", make_array(
+                MongoDBTime::rangeCondition("startTime", {{"$gte", now}, {"$lte", futureDate}})
             )),
             kvp("status", make_document(kvp("$in", make_array("SCHEDULED", "ONGOING"))))
         );
@@ -185,7 +310,7 @@ std::vector<Lesson> MongoDBLessonRepository::findUpcomingLessons(int days) {
             }
         }
         
-        std::cout << "✅ Успешно загружено предстоящих уроков из MongoDB: " << count << std::endl;
+        LOG_DEBUG("MongoDBLessonRepository", "✅ Успешно загружено предстоящих уроков из MongoDB: " << count);
         return lessons;
         
     } catch (const std::exception& e) {
@@ -198,7 +323,7 @@ std::vector<Lesson> MongoDBLessonRepository::findAll() {
     std::vector<Lesson> lessons;
     
     try {
-        std::cout << "🔍 Получение всех уроков из MongoDB" << std::endl;
+        LOG_DEBUG("MongoDBLessonRepository", "🔍 Получение всех уроков из MongoDB");
         
         auto collection = getCollection();
         auto cursor = collection.find({});
@@ -215,7 +340,7 @@ std::vector<Lesson> MongoDBLessonRepository::findAll() {
             }
         }
         
-        std::cout << "✅ Успешно загружено уроков из MongoDB: " << count << std::endl;
+        LOG_DEBUG("MongoDBLessonRepository", "✅ Успешно загружено уроков из MongoDB: " << count);
         return lessons;
         
     } catch (const std::exception& e) {
@@ -234,7 +359,7 @@ bool MongoDBLessonRepository::save(const Lesson& lesson) {
         auto result = collection.insert_one(document.view());
         
         if (result && result->result().inserted_count() > 0) {
-            std::cout << "✅ Урок успешно сохранен в MongoDB: " << lesson.getId().toString() << std::endl;
+            LOG_DEBUG("MongoDBLessonRepository", "✅ Урок успешно сохранен в MongoDB: " << lesson.getId().toString());
             return true;
         }
         
@@ -259,8 +384,8 @@ bool MongoDBLessonRepository::update(const Lesson& lesson) {
                 kvp("type", lessonTypeToString(lesson.getType())),
                 kvp("name", lesson.getName()),
                 kvp("description", lesson.getDescription()),
-                kvp("startTime", DateTimeUtils::formatTimeForMongoDB(lesson.getStartTime())),
-                kvp("endTime", DateTimeUtils::formatTimeForMongoDB(lesson.getTimeSlot().getEndTime())),
+                kvp("startTime", MongoDBTime::toDate(lesson.getStartTime())),
+                kvp("endTime", MongoDBTime::toDate(lesson.getTimeSlot().getEndTime())),
                 kvp("durationMinutes", lesson.getDurationMinutes()),
                 kvp("difficulty", difficultyLevelToString(lesson.getDifficulty())),
                 kvp("maxParticipants", lesson.getMaxParticipants()),
@@ -275,11 +400,11 @@ bool MongoDBLessonRepository::update(const Lesson& lesson) {
         auto result = collection.update_one(filter.view(), update_doc.view());
         
         if (result && result->modified_count() > 0) {
-            std::cout << "✅ Урок успешно обновлен в MongoDB: " << lesson.getId().toString() << std::endl;
+            LOG_DEBUG("MongoDBLessonRepository", "✅ Урок успешно обновлен в MongoDB: " << lesson.getId().toString());
             return true;
         }
         
-        std::cout << "⚠️  Урок не найден для обновления в MongoDB: " << lesson.getId().toString() << std::endl;
+        LOG_DEBUG("MongoDBLessonRepository", "⚠️  Урок не найден для обновления в MongoDB: " << lesson.getId().toString());
         return false;
         
     } catch (const std::exception& e) {
@@ -296,11 +421,11 @@ bool MongoDBLessonRepository::remove(const UUID& id) {
         auto result = collection.delete_one(filter.view());
         
         if (result && result->deleted_count() > 0) {
-            std::cout << "✅ Урок успешно удален из MongoDB: " << id.toString() << std::endl;
+            LOG_DEBUG("MongoDBLessonRepository", "✅ Урок успешно удален из MongoDB: " << id.toString());
             return true;
         }
         
-        std::cout << "⚠️  Урок не найден для удаления в MongoDB: " << id.toString() << std::endl;
+        LOG_DEBUG("MongoDBLessonRepository", "⚠️  Урок не найден для удаления в MongoDB: " << id.toString());
         return false;
         
     } catch (const std::exception& e) {
@@ -323,6 +448,54 @@ bool MongoDBLessonRepository::exists(const UUID& id) {
     }
 }
 
+std::vector<Lesson> MongoDBLessonRepository::findByIds(const std::vector<UUID>& ids) {
+    std::vector<Lesson> lessons;
+    
+    if (ids.empty()) {
+        return lessons;
+    }
+    
+    try {
+        auto collection = getCollection();
+        auto filter = MongoDBRepositoryFactory::makeIdInFilter(ids);
+        auto cursor = collection.find(filter.view());
+        
+        for (auto&& doc : cursor) {
+            lessons.push_back(mapDocumentToLesson(doc));
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "❌ MongoDB Error in findByIds: " << e.what() << std::endl;
+        throw DataAccessException(std::string("Failed to find lessons by IDs: ") + e.what());
+    }
+    
+    return lessons;
+}
+
+std::set<UUID> MongoDBLessonRepository::existsMany(const std::vector<UUID>& ids) {
+    std::set<UUID> existing;
+    
+    if (ids.empty()) {
+        return existing;
+    }
+    
+    try {
+        auto collection = getCollection();
+        auto filter = MongoDBRepositoryFactory::makeIdInFilter(ids);
+        
+        mongocxx::options::find options;
+        options.projection(MongoDBRepositoryFactory::makeIdProjection());
+        
+        for (auto&& doc : collection.find(filter.view(), options)) {
+            existing.insert(UUID::fromString(doc["id"].get_string().value.to_string()));
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "❌ MongoDB Error in existsMany: " << e.what() << std::endl;
+        throw DataAccessException(std::string("Failed to check lesson existence: ") + e.what());
+    }
+    
+    return existing;
+}
+
 Lesson MongoDBLessonRepository::mapDocumentToLesson(const bsoncxx::document::view& doc) const {
     try {
         UUID id = UUID::fromString(doc["id"].get_string().value.to_string());
@@ -330,7 +503,7 @@ Lesson MongoDBLessonRepository::mapDocumentToLesson(const bsoncxx::document::vie
         LessonType type = stringToLessonType(doc["type"].get_string().value.to_string());
         std::string name = doc["name"].get_string().value.to_string();
         std::string description = doc["description"].get_string().value.to_string();
-        auto startTime = DateTimeUtils::parseTimeFromMongoDB(doc["startTime"].get_string().value.to_string());
+        auto startTime = MongoDBTime::fromElement(doc["startTime"]);
         int durationMinutes = doc["durationMinutes"].get_int32();
         DifficultyLevel difficulty = stringToDifficultyLevel(doc["difficulty"].get_string().value.to_string());
         int maxParticipants = doc["maxParticipants"].get_int32();
@@ -376,8 +549,8 @@ bsoncxx::document::value MongoDBLessonRepository::mapLessonToDocument(const Less
         kvp("type", lessonTypeToString(lesson.getType())),
         kvp("name", lesson.getName()),
         kvp("description", lesson.getDescription()),
-        kvp("startTime", DateTimeUtils::formatTimeForMongoDB(lesson.getStartTime())),
-        kvp("endTime", DateTimeUtils::formatTimeForMongoDB(lesson.getTimeSlot().getEndTime())),
+        kvp("startTime", MongoDBTime::toDate(lesson.getStartTime())),
+        kvp("endTime", MongoDBTime::toDate(lesson.getTimeSlot().getEndTime())),
         kvp("durationMinutes", lesson.getDurationMinutes()),
         kvp("difficulty", difficultyLevelToString(lesson.getDifficulty())),
         kvp("maxParticipants", lesson.getMaxParticipants()),
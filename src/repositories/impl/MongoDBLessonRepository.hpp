@@ -5,6 +5,7 @@
 #include "../../data/exceptions/DataAccessException.hpp"
 #include <mongocxx/client.hpp>
 #include <mongocxx/collection.hpp>
+#include "../../data/MongoDBClientPool.hpp"
 #include <bsoncxx/builder/basic/document.hpp>
 #include <bsoncxx/json.hpp>
 #include <iostream>
@@ -15,7 +16,7 @@ class MongoDBRepositoryFactory;
 class MongoDBLessonRepository : public ILessonRepository {
 private:
     std::shared_ptr<MongoDBRepositoryFactory> factory_;
-    mongocxx::collection getCollection() const;
+    MongoDBPooledCollection getCollection() const;
 
 public:
     explicit MongoDBLessonRepository(std::shared_ptr<MongoDBRepositoryFactory> factory);
@@ -24,12 +25,23 @@ public:
     std::vector<Lesson> findByTrainerId(const UUID& trainerId) override;
     std::vector<Lesson> findByHallId(const UUID& hallId) override;
     std::vector<Lesson> findConflictingLessons(const UUID& hallId, const TimeSlot& timeSlot) override;
+    std::vector<Lesson> findConflictingLessonsInRange(const std::vector<UUID>& hallIds,
+                                                      const std::chrono::system_clock::time_point& from,
+                                                      const std::chrono::system_clock::time_point& to) override;
+    std::vector<Lesson> findByHallsAndRange(const std::vector<UUID>& hallIds,
+                                            const std::chrono::system_clock::time_point& from,
+                                            const std::chrono::system_clock::time_point& to) override;
+    std::vector<Lesson> findByBranchAndRange(const UUID& branchId,
+                                             const std::chrono::system_clock::time_point& from,
+                                             const std::chrono::system_clock::time_point& to) override;
     std::vector<Lesson> findUpcomingLessons(int days = 7) override;
     std::vector<Lesson> findAll() override;
     bool save(const Lesson& lesson) override;
     bool update(const Lesson& lesson) override;
     bool remove(const UUID& id) override;
     bool exists(const UUID& id) override;
+    std::vector<Lesson> findByIds(const std::vector<UUID>& ids) override;
+    std::set<UUID> existsMany(const std::vector<UUID>& ids) override;
 
 private:
     Lesson mapDocumentToLesson(const bsoncxx::document::view& doc) const;
@@ -0,0 +1,311 @@
+#include "MongoDBMonthlyRollupRepository.hpp"
+#include "../../data/MongoDBRepositoryFactory.hpp"
+#include "../../data/MongoDBTime.hpp"
+#include "../../core/Logger.hpp"
+#include <bsoncxx/builder/basic/document.hpp>
+#include <bsoncxx/builder/basic/kvp.hpp>
+#include <mongocxx/options/find.hpp>
+#include <mongocxx/options/update.hpp>
+#include <mongocxx/pipeline.hpp>
+#include <ctime>
+#include <iostream>
+
+using bsoncxx::builder::basic::kvp;
+using bsoncxx::builder::basic::make_document;
+
+static const UUID NO_BRANCH;
+
+// Полуинтервал [начало месяца, начало следующего) в UTC
+static std::pair<MongoDBTime::TimePoint, MongoDBTime::TimePoint> monthBounds(const YearMonth& month) {
+    auto toTimePoint = [](const YearMonth& value) {
+        std::tm tm{};
+        tm.tm_year = value.year - 1900;
+        tm.tm_mon = value.month - 1;
+        tm.tm_mday = 1;
+        return std::chrono::system_clock::from_time_t(timegm(&tm));
+    };
+    return {toTimePoint(month), toTimePoint(month.next())};
+}
+
+static bsoncxx::document::value inMonth(const YearMonth& month) {
+    auto [start, end] = monthBounds(month);
+    return make_document(kvp("$gte", MongoDBTime::toDate(start)), kvp("$lt", MongoDBTime::toDate(end)));
+}
+
+static YearMonth monthFromInt(int value) {
+    return {value / 100, value % 100};
+}
+
+static double numericValue(const bsoncxx::document::element& element) {
+    switch (element.type()) {
+        case bsoncxx::type::k_int32: return element.get_int32().value;
+        case bsoncxx::type::k_int64: return static_cast<double>(element.get_int64().value);
+        default: return element.get_double().value;
+    }
+}
+
+// Зал -> филиал по всем залам (справочник небольшой)
+static std::map<UUID, UUID> loadHallBranches(const MongoDBPooledCollection& collection) {
+    std::map<UUID, UUID> hallBranches;
+    mongocxx::options::find options;
+    options.projection(make_document(kvp("id", 1), kvp("branchId", 1), kvp("_id", 0)));
+    auto halls = collection.sibling("dance_halls");
+    auto cursor = halls.find({}, options);
+    for (auto&& doc : cursor) {
+        hallBranches.emplace(UUID::fromString(doc["id"].get_string().value.to_string()),
+                             UUID::fromString(doc["branchId"].get_string().value.to_string()));
+    }
+    return hallBranches;
+}
+
+MongoDBMonthlyRollupRepository::MongoDBMonthlyRollupRepository(std::shared_ptr<MongoDBRepositoryFactory> factory)
+    : factory_(std::move(factory)) {}
+
+MongoDBPooledCollection MongoDBMonthlyRollupRepository::getCollection() const {
+    return factory_->getCollection("monthly_rollups");
+}
+
+void MongoDBMonthlyRollupRepository::increment(const YearMonth& month, const UUID& branchId,
+                                               const std::string& metric, double delta) {
+    try {
+        auto collection = getCollection();
+
+        // $inc с upsert атомарен на уровне документа; уникальный индекс (month, branchId, metric)
+        // не дает параллельным upsert создать дубликаты
+        mongocxx::options::update options;
+        options.upsert(true);
+        collection.update_one(
+            make_document(kvp("month", month.toInt()), kvp("branchId", branchId.toString()), kvp("metric", metric)),
+            make_document(kvp("$inc", make_document(kvp("value", delta)))),
+            options);
+
+    } catch (const std::exception& e) {
+        std::cerr << "❌ MongoDB Error in increment: " << e.what() << std::endl;
+        throw DataAccessException(std::string("Failed to increment monthly rollup: ") + e.what());
+    }
+}
+
+std::vector<MonthlyRollupEntry> MongoDBMonthlyRollupRepository::findByMonthRange(const YearMonth& from,
+                                                                                 const YearMonth& to) {
+    try {
+        auto collection = getCollection();
+        auto cursor = collection.find(make_document(
+            kvp("month", make_document(kvp("$gte", from.toInt()), kvp("$lte", to.toInt())))));
+
+        std::vector<MonthlyRollupEntry> entries;
+        for (auto&& doc : cursor) {
+            MonthlyRollupEntry entry;
+            entry.month = monthFromInt(doc["month"].get_int32().value);
+            entry.branchId = UUID::fromString(doc["branchId"].get_string().value.to_string());
+            entry.metric = doc["metric"].get_string().value.to_string();
+            entry.value = numericValue(doc["value"]);
+            entries.push_back(std::move(entry));
+        }
+        return entries;
+
+    } catch (const std::exception& e) {
+        std::cerr << "❌ MongoDB Error in findByMonthRange: " << e.what() << std::endl;
+        throw DataAccessException(std::string("Failed to find monthly rollups: ") + e.what());
+    }
+}
+
+void MongoDBMonthlyRollupRepository::countLessons(const MongoDBPooledCollection& collection, const YearMonth& month,
+                                                  const std::map<UUID, UUID>& hallBranches,
+                                                  std::map<MetricKey, double>& values) const {
+    mongocxx::pipeline pipeline;
+    pipeline.match(make_document(kvp("startTime", inMonth(month))));
+    pipeline.group(make_document(
+        kvp("_id", make_document(kvp("hallId", "$hallId"), kvp("status", "$status"))),
+        kvp("count", make_document(kvp("$sum", 1)))));
+
+    auto lessons = collection.sibling("lessons");
+    auto cursor = lessons.aggregate(pipeline);
+    for (auto&& doc : cursor) {
+        auto key = doc["_id"].get_document().value;
+        auto hall = hallBranches.find(UUID::fromString(key["hallId"].get_string().value.to_string()));
+        if (hall == hallBranches.end()) {
+            continue;
+        }
+        std::string status = key["status"].get_string().value.to_string();
+        if (status == "COMPLETED") {
+            values[{hall->second, RollupMetric::LESSONS_HELD}] += numericValue(doc["count"]);
+        } else if (status == "CANCELLED") {
+            values[{hall->second, RollupMetric::LESSONS_CANCELLED}] += numericValue(doc["count"]);
+        }
+    }
+}
+
+void MongoDBMonthlyRollupRepository::countAttendance(const MongoDBPooledCollection& collection,
+                                                     const YearMonth& month,
+                                                     const std::map<UUID, UUID>& hallBranches,
+                                                     std::map<MetricKey, double>& values) const {
+    struct EntityCounts {
+        std::string type;
+        std::string status;
+        double count;
+    };
+
+    mongocxx::pipeline pipeline;
+    pipeline.match(make_document(kvp("scheduledTime", inMonth(month))));
+    pipeline.group(make_document(
+        kvp("_id", make_document(kvp("entityId", "$entityId"), kvp("type", "$type"), kvp("status", "$status"))),
+        kvp("count", make_document(kvp("$sum", 1)))));
+
+    std::vector<std::pair<UUID, EntityCounts>> grouped;
+    std::vector<UUID> lessonIds;
+    std::vector<UUID> bookingIds;
+    auto attendance = collection.sibling("attendance");
+    auto cursor = attendance.aggregate(pipeline);
+    for (auto&& doc : cursor) {
+        auto key = doc["_id"].get_document().value;
+        UUID entityId = UUID::fromString(key["entityId"].get_string().value.to_string());
+        EntityCounts counts{key["type"].get_string().value.to_string(),
+                            key["status"].get_string().value.to_string(),
+                            numericValue(doc["count"])};
+        (counts.type == "LESSON" ? lessonIds : bookingIds).push_back(entityId);
+        grouped.emplace_back(entityId, std::move(counts));
+    }
+
+    // Зал занятия или бронирования - одним запросом $in на коллекцию
+    std::map<UUID, UUID> entityHalls;
+    mongocxx::options::find options;
+    options.projection(make_document(kvp("id", 1), kvp("hallId", 1), kvp("_id", 0)));
+    for (const auto& [name, ids] : {std::make_pair("lessons", &lessonIds), std::make_pair("bookings", &bookingIds)}) {
+        if (ids->empty()) {
+            continue;
+        }
+        auto entities = collection.sibling(name);
+        for (auto&& doc : entities.find(MongoDBRepositoryFactory::makeIdInFilter(*ids).view(), options)) {
+            entityHalls.emplace(UUID::fromString(doc["id"].get_string().value.to_string()),
+                                UUID::fromString(doc["hallId"].get_string().value.to_string()));
+        }
+    }
+
+    for (const auto& [entityId, counts] : grouped) {
+        auto hall = entityHalls.find(entityId);
+        if (hall == entityHalls.end()) {
+            continue;
+        }
+        auto branch = hallBranches.find(hall->second);
+        if (branch == hallBranches.end()) {
+            continue;
+        }
+        const UUID& branchId = branch->second;
+
+        if (counts.type == "BOOKING" && counts.status == "VISITED") {
+            values[{branchId, RollupMetric::BOOKINGS_USED}] += counts.count;
+        } else if (counts.type == "BOOKING" && counts.status == "CANCELLED") {
+            values[{branchId, RollupMetric::BOOKINGS_CANCELLED}] += counts.count;
+        }
+        if (counts.status == "VISITED") {
+            values[{branchId, RollupMetric::ATTENDANCE_VISITED}] += counts.count;
+        }
+        if (counts.status != "SCHEDULED") {
+            values[{branchId, RollupMetric::ATTENDANCE_RESOLVED}] += counts.count;
+        }
+    }
+}
+
+void MongoDBMonthlyRollupRepository::sumSubscriptions(const MongoDBPooledCollection& collection,
+                                                      const YearMonth& month,
+                                                      std::map<MetricKey, double>& values) const {
+    std::map<std::string, double> prices;
+    mongocxx::options::find options;
+    options.projection(make_document(kvp("id", 1), kvp("price", 1), kvp("_id", 0)));
+    auto types = collection.sibling("subscription_types");
+    for (auto&& doc : types.find({}, options)) {
+        prices.emplace(doc["id"].get_string().value.to_string(), numericValue(doc["price"]));
+    }
+
+    mongocxx::pipeline pipeline;
+    pipeline.match(make_document(kvp("purchaseDate", inMonth(month))));
+    pipeline.group(make_document(
+        kvp("_id", "$subscriptionTypeId"),
+        kvp("count", make_document(kvp("$sum", 1)))));
+
+    auto subscriptions = collection.sibling("subscriptions");
+    auto cursor = subscriptions.aggregate(pipeline);
+    for (auto&& doc : cursor) {
+        auto price = prices.find(doc["_id"].get_string().value.to_string());
+        if (price != prices.end()) {
+            values[{NO_BRANCH, RollupMetric::SUBSCRIPTION_REVENUE}] += price->second * numericValue(doc["count"]);
+        }
+    }
+}
+
+void MongoDBMonthlyRollupRepository::rebuildMonth(const YearMonth& month) {
+    try {
+        auto collection = getCollection();
+        auto hallBranches = loadHallBranches(collection);
+
+        std::map<MetricKey, double> values;
+        countLessons(collection, month, hallBranches, values);
+        countAttendance(collection, month, hallBranches, values);
+        sumSubscriptions(collection, month, values);
+
+        auto clients = collection.sibling("clients");
+        auto newClients = clients.count_documents(
+            make_document(kvp("registrationDate", inMonth(month))));
+        if (newClients > 0) {
+            values[{NO_BRANCH, RollupMetric::NEW_CLIENTS}] = static_cast<double>(newClients);
+        }
+
+        std::vector<bsoncxx::document::value> documents;
+        documents.reserve(values.size());
+        for (const auto& [key, value] : values) {
+            documents.push_back(make_document(
+                kvp("month", month.toInt()),
+                kvp("branchId", key.first.toString()),
+                kvp("metric", key.second),
+                kvp("value", value)));
+        }
+
+        collection.delete_many(make_document(kvp("month", month.toInt())));
+        if (!documents.empty()) {
+            collection.insert_many(documents);
+        }
+
+        LOG_DEBUG("MongoDBMonthlyRollupRepository", "📊 Пересчитан месяц " << month.toString()
+                  << ", строк: " << documents.size());
+
+    } catch (const std::exception& e) {
+        std::cerr << "❌ MongoDB Error in rebuildMonth: " << e.what() << std::endl;
+        throw DataAccessException(std::string("Failed to rebuild monthly rollups for ") + month.toString() + ": " + e.what());
+    }
+}
+
+std::optional<YearMonth> MongoDBMonthlyRollupRepository::getBackfillCursor(const std::string& jobName) {
+    try {
+        auto collection = getCollection();
+        auto jobs = collection.sibling("rollup_jobs");
+        auto result = jobs.find_one(make_document(kvp("jobName", jobName)));
+        if (!result) {
+            return std::nullopt;
+        }
+        return monthFromInt(result->view()["lastMonth"].get_int32().value);
+
+    } catch (const std::exception& e) {
+        std::cerr << "❌ MongoDB Error in getBackfillCursor: " << e.what() << std::endl;
+        throw DataAccessException(std::string("Failed to read rollup job cursor: ") + e.what());
+    }
+}
+
+void MongoDBMonthlyRollupRepository::saveBackfillCursor(const std::string& jobName, const YearMonth& month) {
+    try {
+        auto collection = getCollection();
+
+        mongocxx::options::update options;
+        options.upsert(true);
+        auto jobs = collection.sibling("rollup_jobs");
+        jobs.update_one(
+            make_document(kvp("jobName", jobName)),
+            make_document(kvp("$set", make_document(
+                kvp("lastMonth", month.toInt()),
+                kvp("updatedAt", MongoDBTime::toDate(std::chrono::system_clock::now()))))),
+            options);
+
+    } catch (const std::exception& e) {
+        std::cerr << "❌ MongoDB Error in saveBackfillCursor: " << e.what() << std::endl;
+        throw DataAccessException(std::string("Failed to save rollup job cursor: ") + e.what());
+    }
+}
@@ -1,6 +1,8 @@
 #include "MongoDBReviewRepository.hpp"
 #include "../../data/MongoDBRepositoryFactory.hpp"
 #include "../../data/DateTimeUtils.hpp"
+#include "../../core/Logger.hpp"
+#include "../../data/MongoDBTime.hpp"
 #include <bsoncxx/builder/basic/document.hpp>
 #include <bsoncxx/builder/basic/array.hpp>
 #include <bsoncxx/builder/basic/kvp.hpp>
@@ -9,8 +11,8 @@
 MongoDBReviewRepository::MongoDBReviewRepository(std::shared_ptr<MongoDBRepositoryFactory> factory)
     : factory_(std::move(factory)) {}
 
-mongocxx::collection MongoDBReviewRepository::getCollection() const {
-    return factory_->getDatabase().collection("reviews");
+MongoDBPooledCollection MongoDBReviewRepository::getCollection() const {
+    return factory_->getCollection("reviews");
 }
 
 std::optional<Review> MongoDBReviewRepository::findById(const UUID& id) {
@@ -23,11 +25,11 @@ std::optional<Review> MongoDBReviewRepository::findById(const UUID& id) {
         auto result = collection.find_one(filter.view());
         
         if (!result) {
-            std::cout << "❌ Отзыв не найден в MongoDB: " << id.toString() << std::endl;
+            LOG_DEBUG("MongoDBReviewRepository", "❌ Отзыв не найден в MongoDB: " << id.toString());
             return std::nullopt;
         }
         
-        std::cout << "✅ Отзыв найден в MongoDB: " << id.toString() << std::endl;
+        LOG_DEBUG("MongoDBReviewRepository", "✅ Отзыв найден в MongoDB: " << id.toString());
         return mapDocumentToReview(result->view());
         
     } catch (const std::exception& e) {
@@ -40,7 +42,7 @@ std::vector<Review> MongoDBReviewRepository::findByClientId(const UUID& clientId
     std::vector<Review> reviews;
     
     try {
-        std::cout << "🔍 Поиск отзывов клиента в MongoDB: " << clientId.toString() << std::endl;
+        LOG_DEBUG("MongoDBReviewRepository", "🔍 Поиск отзывов клиента в MongoDB: " << clientId.toString());
         
         auto collection = getCollection();
         auto filter = bsoncxx::builder::stream::document{}
@@ -55,14 +57,14 @@ std::vector<Review> MongoDBReviewRepository::findByClientId(const UUID& clientId
                 auto review = mapDocumentToReview(doc);
                 reviews.push_back(review);
                 count++;
-                std::cout << "✅ Найден отзыв клиента: " << review.getId().toString() << std::endl;
+                LOG_DEBUG("MongoDBReviewRepository", "✅ Найден отзыв клиента: " << review.getId().toString());
             } catch (const std::exception& e) {
                 std::cerr << "❌ Ошибка создания отзыва из MongoDB документа: " << e.what() << std::endl;
                 continue;
             }
         }
         
-        std::cout << "📊 Найдено отзывов клиента в MongoDB: " << count << std::endl;
+        LOG_DEBUG("MongoDBReviewRepository", "📊 Найдено отзывов клиента в MongoDB: " << count);
         return reviews;
         
     } catch (const std::exception& e) {
@@ -75,7 +77,7 @@ std::vector<Review> MongoDBReviewRepository::findByLessonId(const UUID& lessonId
     std::vector<Review> reviews;
     
     try {
-        std::cout << "🔍 Поиск отзывов на занятие в MongoDB: " << lessonId.toString() << std::endl;
+        LOG_DEBUG("MongoDBReviewRepository", "🔍 Поиск отзывов на занятие в MongoDB: " << lessonId.toString());
         
         auto collection = getCollection();
         auto filter = bsoncxx::builder::stream::document{}
@@ -90,14 +92,14 @@ std::vector<Review> MongoDBReviewRepository::findByLessonId(const UUID& lessonId
                 auto review = mapDocumentToReview(doc);
                 reviews.push_back(review);
                 count++;
-                std::cout << "✅ Найден отзыв на занятие: " << review.getId().toString() << std::endl;
+                LOG_DEBUG("MongoDBReviewRepository", "✅ Найден отзыв на занятие: " << review.getId().toString());
             } catch (const std::exception& e) {
                 std::cerr << "❌ Ошибка создания отзыва из MongoDB документа: " << e.what() << std::endl;
                 continue;
             }
         }
         
-        std::cout << "📊 Найдено отзывов на занятие в MongoDB: " << count << std::endl;
+        LOG_DEBUG("MongoDBReviewRepository", "📊 Найдено отзывов на занятие в MongoDB: " << count);
         return reviews;
         
     } catch (const std::exception& e) {
@@ -119,11 +121,11 @@ std::optional<Review> MongoDBReviewRepository::findByClientAndLesson(
         auto result = collection.find_one(filter.view());
         
         if (!result) {
-            std::cout << "❌ Отзыв клиента на занятие не найден в MongoDB" << std::endl;
+            LOG_DEBUG("MongoDBReviewRepository", "❌ Отзыв клиента на занятие не найден в MongoDB");
             return std::nullopt;
         }
         
-        std::cout << "✅ Отзыв клиента на занятие найдена в MongoDB" << std::endl;
+        LOG_DEBUG("MongoDBReviewRepository", "✅ Отзыв клиента на занятие найдена в MongoDB");
         return mapDocumentToReview(result->view());
         
     } catch (const std::exception& e) {
@@ -136,7 +138,7 @@ std::vector<Review> MongoDBReviewRepository::findPendingModeration() {
     std::vector<Review> reviews;
     
     try {
-        std::cout << "🔍 Поиск отзывов на модерации в MongoDB" << std::endl;
+        LOG_DEBUG("MongoDBReviewRepository", "🔍 Поиск отзывов на модерации в MongoDB");
         
         auto collection = getCollection();
         auto filter = bsoncxx::builder::stream::document{}
@@ -157,7 +159,7 @@ std::vector<Review> MongoDBReviewRepository::findPendingModeration() {
             }
         }
         
-        std::cout << "✅ Успешно загружено отзывов на модерации из MongoDB: " << count << std::endl;
+        LOG_DEBUG("MongoDBReviewRepository", "✅ Успешно загружено отзывов на модерации из MongoDB: " << count);
         return reviews;
         
     } catch (const std::exception& e) {
@@ -170,7 +172,7 @@ std::vector<Review> MongoDBReviewRepository::findAll() {
     std::vector<Review> reviews;
     
     try {
-        std::cout << "🔍 Получение всех отзывов из MongoDB" << std::endl;
+        LOG_DEBUG("MongoDBReviewRepository", "🔍 Получение всех отзывов из MongoDB");
         
         auto collection = getCollection();
         auto cursor = collection.find({});
@@ -187,7 +189,7 @@ std::vector<Review> MongoDBReviewRepository::findAll() {
             }
         }
         
-        std::cout << "✅ Успешно загружено отзывов из MongoDB: " << count << std::endl;
+        LOG_DEBUG("MongoDBReviewRepository", "✅ Успешно загружено отзывов из MongoDB: " << count);
         return reviews;
         
     } catch (const std::exception& e) {
@@ -206,7 +208,7 @@ double MongoDBReviewRepository::getAverageRatingForTrainer(const UUID& trainerId
         
         // Этап 1: Получаем все занятия тренера (нужен доступ к коллекции lessons)
         // Для простоты сделаем два запроса
-        auto lessonsCollection = factory_->getDatabase().collection("lessons");
+        auto lessonsCollection = collection.sibling("lessons");
         auto lessonsFilter = bsoncxx::builder::stream::document{}
             << "trainerId" << trainerId.toString()
             << bsoncxx::builder::stream::finalize;
@@ -262,8 +264,8 @@ double MongoDBReviewRepository::getAverageRatingForTrainer(const UUID& trainerId
         }
         
         double averageRating = totalRating / reviewCount;
-        std::cout << "📊 Средний рейтинг тренера в MongoDB: " << averageRating 
-                  << " (на основе " << reviewCount << " отзывов)" << std::endl;
+        LOG_DEBUG("MongoDBReviewRepository", "📊 Средний рейтинг тренера в MongoDB: " << averageRating 
+                  << " (на основе " << reviewCount << " отзывов)");
         
         return averageRating;
         
@@ -283,7 +285,7 @@ bool MongoDBReviewRepository::save(const Review& review) {
         auto result = collection.insert_one(document.view());
         
         if (result && result->result().inserted_count() > 0) {
-            std::cout << "✅ Отзыв успешно сохранен в MongoDB: " << review.getId().toString() << std::endl;
+            LOG_DEBUG("MongoDBReviewRepository", "✅ Отзыв успешно сохранен в MongoDB: " << review.getId().toString());
             return true;
         }
         
@@ -311,7 +313,7 @@ bool MongoDBReviewRepository::update(const Review& review) {
                 << "lessonId" << review.getLessonId().toString()
                 << "rating" << review.getRating()
                 << "comment" << review.getComment()
-                << "publicationDate" << DateTimeUtils::formatTimeForMongoDB(review.getPublicationDate())
+                << "publicationDate" << MongoDBTime::toDate(review.getPublicationDate())
                 << "status" << reviewStatusToString(review.getStatus())
             << bsoncxx::builder::stream::close_document
             << bsoncxx::builder::stream::finalize;
@@ -319,11 +321,11 @@ bool MongoDBReviewRepository::update(const Review& review) {
         auto result = collection.update_one(filter.view(), update_doc.view());
         
         if (result && result->modified_count() > 0) {
-            std::cout << "✅ Отзыв успешно обновлен в MongoDB: " << review.getId().toString() << std::endl;
+            LOG_DEBUG("MongoDBReviewRepository", "✅ Отзыв успешно обновлен в MongoDB: " << review.getId().toString());
             return true;
         }
         
-        std::cout << "⚠️  Отзыв не найден для обновления в MongoDB: " << review.getId().toString() << std::endl;
+        LOG_DEBUG("MongoDBReviewRepository", "⚠️  Отзыв не найден для обновления в MongoDB: " << review.getId().toString());
         return false;
         
     } catch (const std::exception& e) {
@@ -342,11 +344,11 @@ bool MongoDBReviewRepository::remove(const UUID& id) {
         auto result = collection.delete_one(filter.view());
         
         if (result && result->deleted_count() > 0) {
-            std::cout << "✅ Отзыв успешно удален из MongoDB: " << id.toString() << std::endl;
+            LOG_DEBUG("MongoDBReviewRepository", "✅ Отзыв успешно удален из MongoDB: " << id.toString());
             return true;
         }
         
-        std::cout << "⚠️  Отзыв не найден для удаления в MongoDB: " << id.toString() << std::endl;
+        LOG_DEBUG("MongoDBReviewRepository", "⚠️  Отзыв не найден для удаления в MongoDB: " << id.toString());
         return false;
         
     } catch (const std::exception& e) {
@@ -371,6 +373,54 @@ bool MongoDBReviewRepository::exists(const UUID& id) {
     }
 }
 
+std::vector<Review> MongoDBReviewRepository::findByIds(const std::vector<UUID>& ids) {
+    std::vector<Review> reviews;
+    
+    if (ids.empty()) {
+        return reviews;
+    }
+    
+    try {
+        auto collection = getCollection();
+        auto filter = MongoDBRepositoryFactory::makeIdInFilter(ids);
+        auto cursor = collection.find(filter.view());
+        
+        for (auto&& doc : cursor) {
+            reviews.push_back(mapDocumentToReview(doc));
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "❌ MongoDB Error in findByIds: " << e.what() << std::endl;
+        throw DataAccessException(std::string("Failed to find reviews by IDs: ") + e.what());
+    }
+    
+    return reviews;
+}
+
+std::set<UUID> MongoDBReviewRepository::existsMany(const std::vector<UUID>& ids) {
+    std::set<UUID> existing;
+    
+    if (ids.empty()) {
+        return existing;
+    }
+    
+    try {
+        auto collection = getCollection();
+        auto filter = MongoDBRepositoryFactory::makeIdInFilter(ids);
+        
+        mongocxx::options::find options;
+        options.projection(MongoDBRepositoryFactory::makeIdProjection());
+        
+        for (auto&& doc : collection.find(filter.view(), options)) {
+            existing.insert(UUID::fromString(doc["id"].get_string().value.to_string()));
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "❌ MongoDB Error in existsMany: " << e.what() << std::endl;
+        throw DataAccessException(std::string("Failed to check review existence: ") + e.what());
+    }
+    
+    return existing;
+}
+
 Review MongoDBReviewRepository::mapDocumentToReview(const bsoncxx::document::view& doc) const {
     try {
         UUID id = UUID::fromString(doc["id"].get_string().value.to_string());
@@ -421,7 +471,7 @@ bsoncxx::document::value MongoDBReviewRepository::mapReviewToDocument(const Revi
         << "lessonId" << review.getLessonId().toString()
         << "rating" << review.getRating()
         << "comment" << review.getComment()
-        << "publicationDate" << DateTimeUtils::formatTimeForMongoDB(review.getPublicationDate())
+        << "publicationDate" << MongoDBTime::toDate(review.getPublicationDate())
         << "status" << reviewStatusToString(review.getStatus())
         << bsoncxx::builder::stream::finalize;
 }
@@ -1,6 +1,7 @@
 #include "MongoDBStudioRepository.hpp"
 #include "../../data/MongoDBRepositoryFactory.hpp"
 #include "../../data/DateTimeUtils.hpp"
+#include "../../core/Logger.hpp"
 #include <iostream>
 #include <bsoncxx/builder/basic/document.hpp>
 #include <bsoncxx/builder/basic/array.hpp>
@@ -11,8 +12,8 @@ using bsoncxx::builder::basic::sub_array;
 MongoDBStudioRepository::MongoDBStudioRepository(std::shared_ptr<MongoDBRepositoryFactory> factory)
     : factory_(std::move(factory)) {}
 
-mongocxx::collection MongoDBStudioRepository::getCollection() const {
-    return factory_->getDatabase().collection("studios");
+MongoDBPooledCollection MongoDBStudioRepository::getCollection() const {
+    return factory_->getCollection("studios");
 }
 
 std::optional<Studio> MongoDBStudioRepository::findById(const UUID& id) {
@@ -25,11 +26,11 @@ std::optional<Studio> MongoDBStudioRepository::findById(const UUID& id) {
         auto result = collection.find_one(filter.view());
         
         if (!result) {
-            std::cout << "❌ Студия не найдена в MongoDB: " << id.toString() << std::endl;
+            LOG_DEBUG("MongoDBStudioRepository", "❌ Студия не найдена в MongoDB: " << id.toString());
             return std::nullopt;
         }
         
-        std::cout << "✅ Студия найдена в MongoDB: " << id.toString() << std::endl;
+        LOG_DEBUG("MongoDBStudioRepository", "✅ Студия найдена в MongoDB: " << id.toString());
         return mapDocumentToStudio(result->view());
         
     } catch (const std::exception& e) {
@@ -40,7 +41,7 @@ std::optional<Studio> MongoDBStudioRepository::findById(const UUID& id) {
 
 std::optional<Studio> MongoDBStudioRepository::findMainStudio() {
     try {
-        std::cout << "🔍 Поиск основной студии в MongoDB" << std::endl;
+        LOG_DEBUG("MongoDBStudioRepository", "🔍 Поиск основной студии в MongoDB");
         
         auto collection = getCollection();
         
@@ -52,11 +53,11 @@ std::optional<Studio> MongoDBStudioRepository::findMainStudio() {
         auto cursor = collection.find({}, options);
         
         for (auto&& doc : cursor) {
-            std::cout << "✅ Основная студия найдена в MongoDB" << std::endl;
+            LOG_DEBUG("MongoDBStudioRepository", "✅ Основная студия найдена в MongoDB");
             return mapDocumentToStudio(doc);
         }
         
-        std::cout << "❌ Основная студия не найдена в MongoDB" << std::endl;
+        LOG_DEBUG("MongoDBStudioRepository", "❌ Основная студия не найдена в MongoDB");
         return std::nullopt;
         
     } catch (const std::exception& e) {
@@ -69,7 +70,7 @@ std::vector<Studio> MongoDBStudioRepository::findAll() {
     std::vector<Studio> studios;
     
     try {
-        std::cout << "🔍 Получение всех студий из MongoDB" << std::endl;
+        LOG_DEBUG("MongoDBStudioRepository", "🔍 Получение всех студий из MongoDB");
         
         auto collection = getCollection();
         auto cursor = collection.find({});
@@ -86,7 +87,7 @@ std::vector<Studio> MongoDBStudioRepository::findAll() {
             }
         }
         
-        std::cout << "✅ Успешно загружено студий из MongoDB: " << count << std::endl;
+        LOG_DEBUG("MongoDBStudioRepository", "✅ Успешно загружено студий из MongoDB: " << count);
         return studios;
         
     } catch (const std::exception& e) {
@@ -105,7 +106,7 @@ bool MongoDBStudioRepository::save(const Studio& studio) {
         auto result = collection.insert_one(document.view());
         
         if (result && result->result().inserted_count() > 0) {
-            std::cout << "✅ Студия успешно сохранена в MongoDB: " << studio.getId().toString() << std::endl;
+            LOG_DEBUG("MongoDBStudioRepository", "✅ Студия успешно сохранена в MongoDB: " << studio.getId().toString());
             return true;
         }
         
@@ -138,11 +139,11 @@ bool MongoDBStudioRepository::update(const Studio& studio) {
         auto result = collection.update_one(filter.view(), update_doc.view());
         
         if (result && result->modified_count() > 0) {
-            std::cout << "✅ Студия успешно обновлена в MongoDB: " << studio.getId().toString() << std::endl;
+            LOG_DEBUG("MongoDBStudioRepository", "✅ Студия успешно обновлена в MongoDB: " << studio.getId().toString());
             return true;
         }
         
-        std::cout << "⚠️  Студия не найдена для обновления в MongoDB: " << studio.getId().toString() << std::endl;
+        LOG_DEBUG("MongoDBStudioRepository", "⚠️  Студия не найдена для обновления в MongoDB: " << studio.getId().toString());
         return false;
         
     } catch (const std::exception& e) {
@@ -161,11 +162,11 @@ bool MongoDBStudioRepository::remove(const UUID& id) {
         auto result = collection.delete_one(filter.view());
         
         if (result && result->deleted_count() > 0) {
-            std::cout << "✅ Студия успешно удалена из MongoDB: " << id.toString() << std::endl;
+            LOG_DEBUG("MongoDBStudioRepository", "✅ Студия успешно удалена из MongoDB: " << id.toString());
             return true;
         }
         
-        std::cout << "⚠️  Студия не найдена для удаления в MongoDB: " << id.toString() << std::endl;
+        LOG_DEBUG("MongoDBStudioRepository", "⚠️  Студия не найдена для удаления в MongoDB: " << id.toString());
         return false;
         
     } catch (const std::exception& e) {
@@ -190,6 +191,54 @@ bool MongoDBStudioRepository::exists(const UUID& id) {
     }
 }
 
+std::vector<Studio> MongoDBStudioRepository::findByIds(const std::vector<UUID>& ids) {
+    std::vector<Studio> studios;
+    
+    if (ids.empty()) {
+        return studios;
+    }
+    
+    try {
+        auto collection = getCollection();
+        auto filter = MongoDBRepositoryFactory::makeIdInFilter(ids);
+        auto cursor = collection.find(filter.view());
+        
+        for (auto&& doc : cursor) {
+            studios.push_back(mapDocumentToStudio(doc));
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "❌ MongoDB Error in findByIds: " << e.what() << std::endl;
+        throw DataAccessException(std::string("Failed to find studios by IDs: ") + e.what());
+    }
+    
+    return studios;
+}
+
+std::set<UUID> MongoDBStudioRepository::existsMany(const std::vector<UUID>& ids) {
+    std::set<UUID> existing;
+    
+    if (ids.empty()) {
+        return existing;
+    }
+    
+    try {
+        auto collection = getCollection();
+        auto filter = MongoDBRepositoryFactory::makeIdInFilter(ids);
+        
+        mongocxx::options::find options;
+        options.projection(MongoDBRepositoryFactory::makeIdProjection());
+        
+        for (auto&& doc : collection.find(filter.view(), options)) {
+            existing.insert(UUID::fromString(doc["id"].get_string().value.to_string()));
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "❌ MongoDB Error in existsMany: " << e.what() << std::endl;
+        throw DataAccessException(std::string("Failed to check studio existence: ") + e.what());
+    }
+    
+    return existing;
+}
+
 bsoncxx::document::value MongoDBStudioRepository::mapStudioToDocument(const Studio& studio) const {
     bsoncxx::builder::basic::document builder;
     
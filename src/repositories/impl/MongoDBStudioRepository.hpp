@@ -5,6 +5,7 @@
 #include "../../data/exceptions/DataAccessException.hpp"
 #include <mongocxx/client.hpp>
 #include <mongocxx/collection.hpp>
+#include "../../data/MongoDBClientPool.hpp"
 #include <bsoncxx/builder/stream/document.hpp>
 #include <bsoncxx/json.hpp>
 #include <iostream>
@@ -15,7 +16,7 @@ class MongoDBRepositoryFactory;
 class MongoDBStudioRepository : public IStudioRepository {
 private:
     std::shared_ptr<MongoDBRepositoryFactory> factory_;
-    mongocxx::collection getCollection() const;
+    MongoDBPooledCollection getCollection() const;
 
 public:
     explicit MongoDBStudioRepository(std::shared_ptr<MongoDBRepositoryFactory> factory);
@@ -27,6 +28,8 @@ public:
     bool update(const Studio& studio) override;
     bool remove(const UUID& id) override;
     bool exists(const UUID& id) override;
+    std::vector<Studio> findByIds(const std::vector<UUID>& ids) override;
+    std::set<UUID> existsMany(const std::vector<UUID>& ids) override;
 
 private:
     Studio mapDocumentToStudio(const bsoncxx::document::view& doc) const;
@@ -1,6 +1,8 @@
 #include "MongoDBSubscriptionRepository.hpp"
 #include "../../data/MongoDBRepositoryFactory.hpp"
 #include "../../data/DateTimeUtils.hpp"
+#include "../../core/Logger.hpp"
+#include "../../data/MongoDBTime.hpp"
 #include <bsoncxx/builder/basic/document.hpp>
 #include <bsoncxx/builder/basic/array.hpp>
 #include <bsoncxx/builder/basic/kvp.hpp>
@@ -9,8 +11,8 @@
 MongoDBSubscriptionRepository::MongoDBSubscriptionRepository(std::shared_ptr<MongoDBRepositoryFactory> factory)
     : factory_(std::move(factory)) {}
 
-mongocxx::collection MongoDBSubscriptionRepository::getCollection() const {
-    return factory_->getDatabase().collection("subscriptions");
+MongoDBPooledCollection MongoDBSubscriptionRepository::getCollection() const {
+    return factory_->getCollection("subscriptions");
 }
 
 std::optional<Subscription> MongoDBSubscriptionRepository::findById(const UUID& id) {
@@ -23,11 +25,11 @@ std::optional<Subscription> MongoDBSubscriptionRepository::findById(const UUID&
         auto result = collection.find_one(filter.view());
         
         if (!result) {
-            std::cout << "❌ Подписка не найдена в MongoDB: " << id.toString() << std::endl;
+            LOG_DEBUG("MongoDBSubscriptionRepository", "❌ Подписка не найдена в MongoDB: " << id.toString());
             return std::nullopt;
         }
         
-        std::cout << "✅ Подписка найдена в MongoDB: " << id.toString() << std::endl;
+        LOG_DEBUG("MongoDBSubscriptionRepository", "✅ Подписка найдена в MongoDB: " << id.toString());
         return mapDocumentToSubscription(result->view());
         
     } catch (const std::exception& e) {
@@ -40,7 +42,7 @@ std::vector<Subscription> MongoDBSubscriptionRepository::findByClientId(const UU
     std::vector<Subscription> subscriptions;
     
     try {
-        std::cout << "🔍 Поиск подписок клиента в MongoDB: " << clientId.toString() << std::endl;
+        LOG_DEBUG("MongoDBSubscriptionRepository", "🔍 Поиск подписок клиента в MongoDB: " << clientId.toString());
         
         auto collection = getCollection();
         auto filter = bsoncxx::builder::stream::document{}
@@ -55,14 +57,14 @@ std::vector<Subscription> MongoDBSubscriptionRepository::findByClientId(const UU
                 auto subscription = mapDocumentToSubscription(doc);
                 subscriptions.push_back(subscription);
                 count++;
-                std::cout << "✅ Найдена подписка: " << subscription.getId().toString() << std::endl;
+                LOG_DEBUG("MongoDBSubscriptionRepository", "✅ Найдена подписка: " << subscription.getId().toString());
             } catch (const std::exception& e) {
                 std::cerr << "❌ Ошибка создания подписки из MongoDB документа: " << e.what() << std::endl;
                 continue;
             }
         }
         
-        std::cout << "📊 Найдено подписок в MongoDB: " << count << std::endl;
+        LOG_DEBUG("MongoDBSubscriptionRepository", "📊 Найдено подписок в MongoDB: " << count);
         return subscriptions;
         
     } catch (const std::exception& e) {
@@ -75,7 +77,7 @@ std::vector<Subscription> MongoDBSubscriptionRepository::findActiveSubscriptions
     std::vector<Subscription> subscriptions;
     
     try {
-        std::cout << "🔍 Поиск активных подписок в MongoDB" << std::endl;
+        LOG_DEBUG("MongoDBSubscriptionRepository", "🔍 Поиск активных подписок в MongoDB");
         
         auto collection = getCollection();
         
@@ -83,9 +85,8 @@ std::vector<Subscription> MongoDBSubscriptionRepository::findActiveSubscriptions
         auto now = std::chrono::system_clock::now();
         auto filter = bsoncxx::builder::stream::document{}
             << "status" << "ACTIVE"
-            << "endDate" << bsoncxx::builder::stream::open_document
-                << "$gte" << DateTimeUtils::formatTimeForMongoDB(now)
-            << bsoncxx::builder::stream::close_document
+            << "$and" << bsoncxx::builder::basic::make_array(
+                MongoDBTime::rangeCondition("endDate", {{"$gte", now}})).view()
             << bsoncxx::builder::stream::finalize;
         
         auto cursor = collection.find(filter.view());
@@ -102,7 +103,7 @@ std::vector<Subscription> MongoDBSubscriptionRepository::findActiveSubscriptions
             }
         }
         
-        std::cout << "✅ Успешно загружено активных подписок из MongoDB: " << count << std::endl;
+        LOG_DEBUG("MongoDBSubscriptionRepository", "✅ Успешно загружено активных подписок из MongoDB: " << count);
         return subscriptions;
         
     } catch (const std::exception& e) {
@@ -115,7 +116,7 @@ std::vector<Subscription> MongoDBSubscriptionRepository::findExpiringSubscriptio
     std::vector<Subscription> subscriptions;
     
     try {
-        std::cout << "🔍 Поиск истекающих подписок в MongoDB (дней: " << days << ")" << std::endl;
+        LOG_DEBUG("MongoDBSubscriptionRepository", "🔍 Поиск истекающих подписок в MongoDB (дней: " << days << ")");
         
         auto collection = getCollection();
         
@@ -125,10 +126,8 @@ std::vector<Subscription> MongoDBSubscriptionRepository::findExpiringSubscriptio
         // Подписки, которые истекают в течение указанного количества дней
         auto filter = bsoncxx::builder::stream::document{}
             << "status" << "ACTIVE"
-            << "endDate" << bsoncxx::builder::stream::open_document
-                << "$gte" << DateTimeUtils::formatTimeForMongoDB(now)
-                << "$lte" << DateTimeUtils::formatTimeForMongoDB(expirationThreshold)
-            << bsoncxx::builder::stream::close_document
+            << "$and" << bsoncxx::builder::basic::make_array(
+                MongoDBTime::rangeCondition("endDate", {{"$gte", now}, {"$lte", expirationThreshold}})).view()
             << bsoncxx::builder::stream::finalize;
         
         auto cursor = collection.find(filter.view());
@@ -145,7 +144,7 @@ std::vector<Subscription> MongoDBSubscriptionRepository::findExpiringSubscriptio
             }
         }
         
-        std::cout << "✅ Найдено истекающих подписок в MongoDB: " << count << std::endl;
+        LOG_DEBUG("MongoDBSubscriptionRepository", "✅ Найдено истекающих подписок в MongoDB: " << count);
         return subscriptions;
         
     } catch (const std::exception& e) {
@@ -158,7 +157,7 @@ std::vector<Subscription> MongoDBSubscriptionRepository::findAll() {
     std::vector<Subscription> subscriptions;
     
     try {
-        std::cout << "🔍 Получение всех подписок из MongoDB" << std::endl;
+        LOG_DEBUG("MongoDBSubscriptionRepository", "🔍 Получение всех подписок из MongoDB");
         
         auto collection = getCollection();
         auto cursor = collection.find({});
@@ -175,7 +174,7 @@ std::vector<Subscription> MongoDBSubscriptionRepository::findAll() {
             }
         }
         
-        std::cout << "✅ Успешно загружено подписок из MongoDB: " << count << std::endl;
+        LOG_DEBUG("MongoDBSubscriptionRepository", "✅ Успешно загружено подписок из MongoDB: " << count);
         return subscriptions;
         
     } catch (const std::exception& e) {
@@ -194,7 +193,7 @@ bool MongoDBSubscriptionRepository::save(const Subscription& subscription) {
         auto result = collection.insert_one(document.view());
         
         if (result && result->result().inserted_count() > 0) {
-            std::cout << "✅ Подписка успешно сохранена в MongoDB: " << subscription.getId().toString() << std::endl;
+            LOG_DEBUG("MongoDBSubscriptionRepository", "✅ Подписка успешно сохранена в MongoDB: " << subscription.getId().toString());
             return true;
         }
         
@@ -220,22 +219,22 @@ bool MongoDBSubscriptionRepository::update(const Subscription& subscription) {
             << "$set" << bsoncxx::builder::stream::open_document
                 << "clientId" << subscription.getClientId().toString()
                 << "subscriptionTypeId" << subscription.getSubscriptionTypeId().toString()
-                << "startDate" << DateTimeUtils::formatTimeForMongoDB(subscription.getStartDate())
-                << "endDate" << DateTimeUtils::formatTimeForMongoDB(subscription.getEndDate())
+                << "startDate" << MongoDBTime::toDate(subscription.getStartDate())
+                << "endDate" << MongoDBTime::toDate(subscription.getEndDate())
                 << "remainingVisits" << subscription.getRemainingVisits()
                 << "status" << subscriptionStatusToString(subscription.getStatus())
-                << "purchaseDate" << DateTimeUtils::formatTimeForMongoDB(subscription.getPurchaseDate())
+                << "purchaseDate" << MongoDBTime::toDate(subscription.getPurchaseDate())
             << bsoncxx::builder::stream::close_document
             << bsoncxx::builder::stream::finalize;
         
         auto result = collection.update_one(filter.view(), update_doc.view());
         
         if (result && result->modified_count() > 0) {
-            std::cout << "✅ Подписка успешно обновлена в MongoDB: " << subscription.getId().toString() << std::endl;
+            LOG_DEBUG("MongoDBSubscriptionRepository", "✅ Подписка успешно обновлена в MongoDB: " << subscription.getId().toString());
             return true;
         }
         
-        std::cout << "⚠️  Подписка не найдена для обновления в MongoDB: " << subscription.getId().toString() << std::endl;
+        LOG_DEBUG("MongoDBSubscriptionRepository", "⚠️  Подписка не найдена для обновления в MongoDB: " << subscription.getId().toString());
         return false;
         
     } catch (const std::exception& e) {
@@ -254,11 +253,11 @@ bool MongoDBSubscriptionRepository::remove(const UUID& id) {
         auto result = collection.delete_one(filter.view());
         
         if (result && result->deleted_count() > 0) {
-            std::cout << "✅ Подписка успешно удалена из MongoDB: " << id.toString() << std::endl;
+            LOG_DEBUG("MongoDBSubscriptionRepository", "✅ Подписка успешно удалена из MongoDB: " << id.toString());
             return true;
         }
         
-        std::cout << "⚠️  Подписка не найдена для удаления в MongoDB: " << id.toString() << std::endl;
+        LOG_DEBUG("MongoDBSubscriptionRepository", "⚠️  Подписка не найдена для удаления в MongoDB: " << id.toString());
         return false;
         
     } catch (const std::exception& e) {
@@ -283,14 +282,62 @@ bool MongoDBSubscriptionRepository::exists(const UUID& id) {
     }
 }
 
+std::vector<Subscription> MongoDBSubscriptionRepository::findByIds(const std::vector<UUID>& ids) {
+    std::vector<Subscription> subscriptions;
+    
+    if (ids.empty()) {
+        return subscriptions;
+    }
+    
+    try {
+        auto collection = getCollection();
+        auto filter = MongoDBRepositoryFactory::makeIdInFilter(ids);
+        auto cursor = collection.find(filter.view());
+        
+        for (auto&& doc : cursor) {
+            subscriptions.push_back(mapDocumentToSubscription(doc));
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "❌ MongoDB Error in findByIds: " << e.what() << std::endl;
+        throw DataAccessException(std::string("Failed to find subscriptions by IDs: ") + e.what());
+    }
+    
+    return subscriptions;
+}
+
+std::set<UUID> MongoDBSubscriptionRepository::existsMany(const std::vector<UUID>& ids) {
+    std::set<UUID> existing;
+    
+    if (ids.empty()) {
+        return existing;
+    }
+    
+    try {
+        auto collection = getCollection();
+        auto filter = MongoDBRepositoryFactory::makeIdInFilter(ids);
+        
+        mongocxx::options::find options;
+        options.projection(MongoDBRepositoryFactory::makeIdProjection());
+        
+        for (auto&& doc : collection.find(filter.view(), options)) {
+            existing.insert(UUID::fromString(doc["id"].get_string().value.to_string()));
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "❌ MongoDB Error in existsMany: " << e.what() << std::endl;
+        throw DataAccessException(std::string("Failed to check subscription existence: ") + e.what());
+    }
+    
+    return existing;
+}
+
 Subscription MongoDBSubscriptionRepository::mapDocumentToSubscription(const bsoncxx::document::view& doc) const {
     try {
         UUID id = UUID::fromString(doc["id"].get_string().value.to_string());
         UUID clientId = UUID::fromString(doc["clientId"].get_string().value.to_string());
         UUID subscriptionTypeId = UUID::fromString(doc["subscriptionTypeId"].get_string().value.to_string());
         
-        auto startDate = DateTimeUtils::parseTimeFromMongoDB(doc["startDate"].get_string().value.to_string());
-        auto endDate = DateTimeUtils::parseTimeFromMongoDB(doc["endDate"].get_string().value.to_string());
+        auto startDate = MongoDBTime::fromElement(doc["startDate"]);
+        auto endDate = MongoDBTime::fromElement(doc["endDate"]);
         int remainingVisits = doc["remainingVisits"].get_int32();
         
         // Создаем подписку
@@ -316,7 +363,7 @@ Subscription MongoDBSubscriptionRepository::mapDocumentToSubscription(const bson
         
         // Устанавливаем дату покупки если она есть
         if (doc["purchaseDate"]) {
-            auto purchaseDate = DateTimeUtils::parseTimeFromMongoDB(doc["purchaseDate"].get_string().value.to_string());
+            auto purchaseDate = MongoDBTime::fromElement(doc["purchaseDate"]);
             // В модели нет сеттера для purchaseDate, поэтому оставляем как есть
         }
         
@@ -344,11 +391,11 @@ bsoncxx::document::value MongoDBSubscriptionRepository::mapSubscriptionToDocumen
         << "id" << subscription.getId().toString()
         << "clientId" << subscription.getClientId().toString()
         << "subscriptionTypeId" << subscription.getSubscriptionTypeId().toString()
-        << "startDate" << DateTimeUtils::formatTimeForMongoDB(subscription.getStartDate())
-        << "endDate" << DateTimeUtils::formatTimeForMongoDB(subscription.getEndDate())
+        << "startDate" << MongoDBTime::toDate(subscription.getStartDate())
+        << "endDate" << MongoDBTime::toDate(subscription.getEndDate())
         << "remainingVisits" << subscription.getRemainingVisits()
         << "status" << subscriptionStatusToString(subscription.getStatus())
-        << "purchaseDate" << DateTimeUtils::formatTimeForMongoDB(subscription.getPurchaseDate())
+        << "purchaseDate" << MongoDBTime::toDate(subscription.getPurchaseDate())
         << bsoncxx::builder::stream::finalize;
 }
 
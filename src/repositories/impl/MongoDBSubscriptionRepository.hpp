@@ -5,6 +5,7 @@
 #include "../../data/exceptions/DataAccessException.hpp"
 #include <mongocxx/client.hpp>
 #include <mongocxx/collection.hpp>
+#include "../../data/MongoDBClientPool.hpp"
 #include <bsoncxx/builder/stream/document.hpp>
 #include <bsoncxx/json.hpp>
 #include <iostream>
@@ -15,7 +16,7 @@ class MongoDBRepositoryFactory;
 class MongoDBSubscriptionRepository : public ISubscriptionRepository {
 private:
     std::shared_ptr<MongoDBRepositoryFactory> factory_;
-    mongocxx::collection getCollection() const;
+    MongoDBPooledCollection getCollection() const;
 
 public:
     explicit MongoDBSubscriptionRepository(std::shared_ptr<MongoDBRepositoryFactory> factory);
@@ -29,6 +30,8 @@ public:
     bool update(const Subscription& subscription) override;
     bool remove(const UUID& id) override;
     bool exists(const UUID& id) override;
+    std::vector<Subscription> findByIds(const std::vector<UUID>& ids) override;
+    std::set<UUID> existsMany(const std::vector<UUID>& ids) override;
 
 private:
     Subscription mapDocumentToSubscription(const bsoncxx::document::view& doc) const;
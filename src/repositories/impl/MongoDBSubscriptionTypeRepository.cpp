@@ -1,6 +1,7 @@
 #include "MongoDBSubscriptionTypeRepository.hpp"
 #include "../../data/MongoDBRepositoryFactory.hpp"
 #include "../../data/DateTimeUtils.hpp"
+#include "../../core/Logger.hpp"
 #include <bsoncxx/builder/basic/document.hpp>
 #include <bsoncxx/builder/basic/array.hpp>
 #include <bsoncxx/builder/basic/kvp.hpp>
@@ -9,8 +10,8 @@
 MongoDBSubscriptionTypeRepository::MongoDBSubscriptionTypeRepository(std::shared_ptr<MongoDBRepositoryFactory> factory)
     : factory_(std::move(factory)) {}
 
-mongocxx::collection MongoDBSubscriptionTypeRepository::getCollection() const {
-    return factory_->getDatabase().collection("subscription_types");
+MongoDBPooledCollection MongoDBSubscriptionTypeRepository::getCollection() const {
+    return factory_->getCollection("subscription_types");
 }
 
 std::optional<SubscriptionType> MongoDBSubscriptionTypeRepository::findById(const UUID& id) {
@@ -23,11 +24,11 @@ std::optional<SubscriptionType> MongoDBSubscriptionTypeRepository::findById(cons
         auto result = collection.find_one(filter.view());
         
         if (!result) {
-            std::cout << "❌ Тип абонемента не найден в MongoDB: " << id.toString() << std::endl;
+            LOG_DEBUG("MongoDBSubscriptionTypeRepository", "❌ Тип абонемента не найден в MongoDB: " << id.toString());
             return std::nullopt;
         }
         
-        std::cout << "✅ Тип абонемента найден в MongoDB: " << id.toString() << std::endl;
+        LOG_DEBUG("MongoDBSubscriptionTypeRepository", "✅ Тип абонемента найден в MongoDB: " << id.toString());
         return mapDocumentToSubscriptionType(result->view());
         
     } catch (const std::exception& e) {
@@ -40,7 +41,7 @@ std::vector<SubscriptionType> MongoDBSubscriptionTypeRepository::findAllActive()
     std::vector<SubscriptionType> subscriptionTypes;
     
     try {
-        std::cout << "🔍 Поиск активных типов абонементов в MongoDB" << std::endl;
+        LOG_DEBUG("MongoDBSubscriptionTypeRepository", "🔍 Поиск активных типов абонементов в MongoDB");
         
         auto collection = getCollection();
         
@@ -66,14 +67,14 @@ std::vector<SubscriptionType> MongoDBSubscriptionTypeRepository::findAllActive()
                 auto subscriptionType = mapDocumentToSubscriptionType(doc);
                 subscriptionTypes.push_back(subscriptionType);
                 count++;
-                std::cout << "✅ Найден активный тип абонемента: " << subscriptionType.getName() << std::endl;
+                LOG_DEBUG("MongoDBSubscriptionTypeRepository", "✅ Найден активный тип абонемента: " << subscriptionType.getName());
             } catch (const std::exception& e) {
                 std::cerr << "❌ Ошибка создания типа абонемента из MongoDB документа: " << e.what() << std::endl;
                 continue;
             }
         }
         
-        std::cout << "📊 Найдено активных типов абонементов в MongoDB: " << count << std::endl;
+        LOG_DEBUG("MongoDBSubscriptionTypeRepository", "📊 Найдено активных типов абонементов в MongoDB: " << count);
         return subscriptionTypes;
         
     } catch (const std::exception& e) {
@@ -86,7 +87,7 @@ std::vector<SubscriptionType> MongoDBSubscriptionTypeRepository::findAll() {
     std::vector<SubscriptionType> subscriptionTypes;
     
     try {
-        std::cout << "🔍 Получение всех типов абонементов из MongoDB" << std::endl;
+        LOG_DEBUG("MongoDBSubscriptionTypeRepository", "🔍 Получение всех типов абонементов из MongoDB");
         
         auto collection = getCollection();
         auto cursor = collection.find({});
@@ -103,7 +104,7 @@ std::vector<SubscriptionType> MongoDBSubscriptionTypeRepository::findAll() {
             }
         }
         
-        std::cout << "✅ Успешно загружено типов абонементов из MongoDB: " << count << std::endl;
+        LOG_DEBUG("MongoDBSubscriptionTypeRepository", "✅ Успешно загружено типов абонементов из MongoDB: " << count);
         return subscriptionTypes;
         
     } catch (const std::exception& e) {
@@ -122,7 +123,7 @@ bool MongoDBSubscriptionTypeRepository::save(const SubscriptionType& subscriptio
         auto result = collection.insert_one(document.view());
         
         if (result && result->result().inserted_count() > 0) {
-            std::cout << "✅ Тип абонемента успешно сохранен в MongoDB: " << subscriptionType.getId().toString() << std::endl;
+            LOG_DEBUG("MongoDBSubscriptionTypeRepository", "✅ Тип абонемента успешно сохранен в MongoDB: " << subscriptionType.getId().toString());
             return true;
         }
         
@@ -158,11 +159,11 @@ bool MongoDBSubscriptionTypeRepository::update(const SubscriptionType& subscript
         auto result = collection.update_one(filter.view(), update_doc.view());
         
         if (result && result->modified_count() > 0) {
-            std::cout << "✅ Тип абонемента успешно обновлен в MongoDB: " << subscriptionType.getId().toString() << std::endl;
+            LOG_DEBUG("MongoDBSubscriptionTypeRepository", "✅ Тип абонемента успешно обновлен в MongoDB: " << subscriptionType.getId().toString());
             return true;
         }
         
-        std::cout << "⚠️  Тип абонемента не найден для обновления в MongoDB: " << subscriptionType.getId().toString() << std::endl;
+        LOG_DEBUG("MongoDBSubscriptionTypeRepository", "⚠️  Тип абонемента не найден для обновления в MongoDB: " << subscriptionType.getId().toString());
         return false;
         
     } catch (const std::exception& e) {
@@ -181,11 +182,11 @@ bool MongoDBSubscriptionTypeRepository::remove(const UUID& id) {
         auto result = collection.delete_one(filter.view());
         
         if (result && result->deleted_count() > 0) {
-            std::cout << "✅ Тип абонемента успешно удален из MongoDB: " << id.toString() << std::endl;
+            LOG_DEBUG("MongoDBSubscriptionTypeRepository", "✅ Тип абонемента успешно удален из MongoDB: " << id.toString());
             return true;
         }
         
-        std::cout << "⚠️  Тип абонемента не найден для удаления в MongoDB: " << id.toString() << std::endl;
+        LOG_DEBUG("MongoDBSubscriptionTypeRepository", "⚠️  Тип абонемента не найден для удаления в MongoDB: " << id.toString());
         return false;
         
     } catch (const std::exception& e) {
@@ -210,6 +211,54 @@ bool MongoDBSubscriptionTypeRepository::exists(const UUID& id) {
     }
 }
 
+std::vector<SubscriptionType> MongoDBSubscriptionTypeRepository::findByIds(const std::vector<UUID>& ids) {
+    std::vector<SubscriptionType> types;
+    
+    if (ids.empty()) {
+        return types;
+    }
+    
+    try {
+        auto collection = getCollection();
+        auto filter = MongoDBRepositoryFactory::makeIdInFilter(ids);
+        auto cursor = collection.find(filter.view());
+        
+        for (auto&& doc : cursor) {
+            types.push_back(mapDocumentToSubscriptionType(doc));
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "❌ MongoDB Error in findByIds: " << e.what() << std::endl;
+        throw DataAccessException(std::string("Failed to find subscription types by IDs: ") + e.what());
+    }
+    
+    return types;
+}
+
+std::set<UUID> MongoDBSubscriptionTypeRepository::existsMany(const std::vector<UUID>& ids) {
+    std::set<UUID> existing;
+    
+    if (ids.empty()) {
+        return existing;
+    }
+    
+    try {
+        auto collection = getCollection();
+        auto filter = MongoDBRepositoryFactory::makeIdInFilter(ids);
+        
+        mongocxx::options::find options;
+        options.projection(MongoDBRepositoryFactory::makeIdProjection());
+        
+        for (auto&& doc : collection.find(filter.view(), options)) {
+            existing.insert(UUID::fromString(doc["id"].get_string().value.to_string()));
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "❌ MongoDB Error in existsMany: " << e.what() << std::endl;
+        throw DataAccessException(std::string("Failed to check subscription type existence: ") + e.what());
+    }
+    
+    return existing;
+}
+
 SubscriptionType MongoDBSubscriptionTypeRepository::mapDocumentToSubscriptionType(const bsoncxx::document::view& doc) const {
     try {
         UUID id = UUID::fromString(doc["id"].get_string().value.to_string());
@@ -1,6 +1,7 @@
 #include "MongoDBTrainerRepository.hpp"
 #include "../../data/MongoDBRepositoryFactory.hpp"
 #include "../../data/DateTimeUtils.hpp"
+#include "../../core/Logger.hpp"
 #include <bsoncxx/builder/basic/document.hpp>
 #include <bsoncxx/builder/basic/array.hpp>
 #include <bsoncxx/builder/basic/kvp.hpp>
@@ -9,8 +10,8 @@
 MongoDBTrainerRepository::MongoDBTrainerRepository(std::shared_ptr<MongoDBRepositoryFactory> factory)
     : factory_(std::move(factory)) {}
 
-mongocxx::collection MongoDBTrainerRepository::getCollection() const {
-    return factory_->getDatabase().collection("trainers");
+MongoDBPooledCollection MongoDBTrainerRepository::getCollection() const {
+    return factory_->getCollection("trainers");
 }
 
 std::optional<Trainer> MongoDBTrainerRepository::findById(const UUID& id) {
@@ -23,11 +24,11 @@ std::optional<Trainer> MongoDBTrainerRepository::findById(const UUID& id) {
         auto result = collection.find_one(filter.view());
         
         if (!result) {
-            std::cout << "❌ Тренер не найден в MongoDB: " << id.toString() << std::endl;
+            LOG_DEBUG("MongoDBTrainerRepository", "❌ Тренер не найден в MongoDB: " << id.toString());
             return std::nullopt;
         }
         
-        std::cout << "✅ Тренер найден в MongoDB: " << id.toString() << std::endl;
+        LOG_DEBUG("MongoDBTrainerRepository", "✅ Тренер найден в MongoDB: " << id.toString());
         return mapDocumentToTrainer(result->view());
         
     } catch (const std::exception& e) {
@@ -40,7 +41,7 @@ std::vector<Trainer> MongoDBTrainerRepository::findBySpecialization(const std::s
     std::vector<Trainer> trainers;
     
     try {
-        std::cout << "🔍 Поиск тренеров по специализации в MongoDB: " << specialization << std::endl;
+        LOG_DEBUG("MongoDBTrainerRepository", "🔍 Поиск тренеров по специализации в MongoDB: " << specialization);
         
         auto collection = getCollection();
         
@@ -62,14 +63,14 @@ std::vector<Trainer> MongoDBTrainerRepository::findBySpecialization(const std::s
                 auto trainer = mapDocumentToTrainer(doc);
                 trainers.push_back(trainer);
                 count++;
-                std::cout << "✅ Найден тренер: " << trainer.getName() << std::endl;
+                LOG_DEBUG("MongoDBTrainerRepository", "✅ Найден тренер: " << trainer.getName());
             } catch (const std::exception& e) {
                 std::cerr << "❌ Ошибка создания тренера из MongoDB документа: " << e.what() << std::endl;
                 continue;
             }
         }
         
-        std::cout << "📊 Найдено тренеров в MongoDB: " << count << std::endl;
+        LOG_DEBUG("MongoDBTrainerRepository", "📊 Найдено тренеров в MongoDB: " << count);
         return trainers;
         
     } catch (const std::exception& e) {
@@ -82,7 +83,7 @@ std::vector<Trainer> MongoDBTrainerRepository::findActiveTrainers() {
     std::vector<Trainer> trainers;
     
     try {
-        std::cout << "🔍 Поиск активных тренеров в MongoDB" << std::endl;
+        LOG_DEBUG("MongoDBTrainerRepository", "🔍 Поиск активных тренеров в MongoDB");
         
         auto collection = getCollection();
         auto filter = bsoncxx::builder::stream::document{}
@@ -103,7 +104,7 @@ std::vector<Trainer> MongoDBTrainerRepository::findActiveTrainers() {
             }
         }
         
-        std::cout << "✅ Успешно загружено активных тренеров из MongoDB: " << count << std::endl;
+        LOG_DEBUG("MongoDBTrainerRepository", "✅ Успешно загружено активных тренеров из MongoDB: " << count);
         return trainers;
         
     } catch (const std::exception& e) {
@@ -116,7 +117,7 @@ std::vector<Trainer> MongoDBTrainerRepository::findAll() {
     std::vector<Trainer> trainers;
     
     try {
-        std::cout << "🔍 Получение всех тренеров из MongoDB" << std::endl;
+        LOG_DEBUG("MongoDBTrainerRepository", "🔍 Получение всех тренеров из MongoDB");
         
         auto collection = getCollection();
         auto cursor = collection.find({});
@@ -133,7 +134,7 @@ std::vector<Trainer> MongoDBTrainerRepository::findAll() {
             }
         }
         
-        std::cout << "✅ Успешно загружено тренеров из MongoDB: " << count << std::endl;
+        LOG_DEBUG("MongoDBTrainerRepository", "✅ Успешно загружено тренеров из MongoDB: " << count);
         return trainers;
         
     } catch (const std::exception& e) {
@@ -152,7 +153,7 @@ bool MongoDBTrainerRepository::save(const Trainer& trainer) {
         auto result = collection.insert_one(document.view());
         
         if (result && result->result().inserted_count() > 0) {
-            std::cout << "✅ Тренер успешно сохранен в MongoDB: " << trainer.getId().toString() << std::endl;
+            LOG_DEBUG("MongoDBTrainerRepository", "✅ Тренер успешно сохранен в MongoDB: " << trainer.getId().toString());
             return true;
         }
         
@@ -193,11 +194,11 @@ bool MongoDBTrainerRepository::update(const Trainer& trainer) {
         auto result = collection.update_one(filter.view(), update_doc.view());
         
         if (result && result->modified_count() > 0) {
-            std::cout << "✅ Тренер успешно обновлен в MongoDB: " << trainer.getId().toString() << std::endl;
+            LOG_DEBUG("MongoDBTrainerRepository", "✅ Тренер успешно обновлен в MongoDB: " << trainer.getId().toString());
             return true;
         }
         
-        std::cout << "⚠️  Тренер не найден для обновления в MongoDB: " << trainer.getId().toString() << std::endl;
+        LOG_DEBUG("MongoDBTrainerRepository", "⚠️  Тренер не найден для обновления в MongoDB: " << trainer.getId().toString());
         return false;
         
     } catch (const std::exception& e) {
@@ -216,11 +217,11 @@ bool MongoDBTrainerRepository::remove(const UUID& id) {
         auto result = collection.delete_one(filter.view());
         
         if (result && result->deleted_count() > 0) {
-            std::cout << "✅ Тренер успешно удален из MongoDB: " << id.toString() << std::endl;
+            LOG_DEBUG("MongoDBTrainerRepository", "✅ Тренер успешно удален из MongoDB: " << id.toString());
             return true;
         }
         
-        std::cout << "⚠️  Тренер не найден для удаления в MongoDB: " << id.toString() << std::endl;
+        LOG_DEBUG("MongoDBTrainerRepository", "⚠️  Тренер не найден для удаления в MongoDB: " << id.toString());
         return false;
         
     } catch (const std::exception& e) {
@@ -245,6 +246,54 @@ bool MongoDBTrainerRepository::exists(const UUID& id) {
     }
 }
 
+std::vector<Trainer> MongoDBTrainerRepository::findByIds(const std::vector<UUID>& ids) {
+    std::vector<Trainer> trainers;
+    
+    if (ids.empty()) {
+        return trainers;
+    }
+    
+    try {
+        auto collection = getCollection();
+        auto filter = MongoDBRepositoryFactory::makeIdInFilter(ids);
+        auto cursor = collection.find(filter.view());
+        
+        for (auto&& doc : cursor) {
+            trainers.push_back(mapDocumentToTrainer(doc));
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "❌ MongoDB Error in findByIds: " << e.what() << std::endl;
+        throw DataAccessException(std::string("Failed to find trainers by IDs: ") + e.what());
+    }
+    
+    return trainers;
+}
+
+std::set<UUID> MongoDBTrainerRepository::existsMany(const std::vector<UUID>& ids) {
+    std::set<UUID> existing;
+    
+    if (ids.empty()) {
+        return existing;
+    }
+    
+    try {
+        auto collection = getCollection();
+        auto filter = MongoDBRepositoryFactory::makeIdInFilter(ids);
+        
+        mongocxx::options::find options;
+        options.projection(MongoDBRepositoryFactory::makeIdProjection());
+        
+        for (auto&& doc : collection.find(filter.view(), options)) {
+            existing.insert(UUID::fromString(doc["id"].get_string().value.to_string()));
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "❌ MongoDB Error in existsMany: " << e.what() << std::endl;
+        throw DataAccessException(std::string("Failed to check trainer existence: ") + e.what());
+    }
+    
+    return existing;
+}
+
 Trainer MongoDBTrainerRepository::mapDocumentToTrainer(const bsoncxx::document::view& doc) const {
     try {
         UUID id = UUID::fromString(doc["id"].get_string().value.to_string());
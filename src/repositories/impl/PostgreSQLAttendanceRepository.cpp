@@ -3,24 +3,180 @@
 #include "../../data/DateTimeUtils.hpp"
 #include "../../data/QueryFactory.hpp"
 #include <iostream>
+#include "../../data/PreparedStatementRegistry.hpp"
+#include "../../data/SqlQueryBuilder.hpp"
+#include <mutex>
+
+// Именованные запросы репозитория, см. PreparedStatementRegistry
+static const char* const STMT_FIND_BY_ID = "attendance_find_by_id";
+static const char* const STMT_FIND_BY_CLIENT_ID = "attendance_find_by_client_id";
+static const char* const STMT_FIND_BY_ENTITY_ID = "attendance_find_by_entity_id";
+static const char* const STMT_FIND_BY_TYPE_AND_STATUS = "attendance_find_by_type_and_status";
+static const char* const STMT_FIND_ALL = "attendance_find_all";
+static const char* const STMT_EXISTS = "attendance_exists";
+static const char* const STMT_FIND_BY_IDS = "attendance_find_by_ids";
+static const char* const STMT_EXISTS_MANY = "attendance_exists_many";
+static const char* const STMT_COUNT_BY_CLIENT_AND_STATUS = "attendance_count_by_client_and_status";
+static const char* const STMT_COUNT_BY_TYPE_AND_STATUS = "attendance_count_by_type_and_status";
+static const char* const STMT_GET_TOP_CLIENTS_BY_VISITS = "attendance_get_top_clients_by_visits";
+static const char* const STMT_AGGREGATE_COUNTS = "attendance_aggregate_counts";
+static const char* const STMT_AGGREGATE_COUNTS_BY_CLIENT = "attendance_aggregate_counts_by_client";
+static const char* const STMT_AGGREGATE_CLIENT_COUNTS = "attendance_aggregate_client_counts";
+static const char* const STMT_CLIENT_SUMMARIES = "attendance_client_summaries";
+static const char* const STMT_CLIENT_SUMMARIES_PAGE = "attendance_client_summaries_page";
+
+// Сводка по клиентам: тип × статус разворачивается в столбцы через FILTER, одна строка на клиента
+static const char* const CLIENT_SUMMARY_SELECT = R"(
+            SELECT c.id AS client_id, c.name AS client_name,
+                   COUNT(a.id) FILTER (WHERE a.type = 'LESSON' AND a.status = 'VISITED') AS lesson_visited,
+                   COUNT(a.id) FILTER (WHERE a.type = 'LESSON' AND a.status = 'CANCELLED') AS lesson_cancelled,
+                   COUNT(a.id) FILTER (WHERE a.type = 'LESSON' AND a.status = 'NO_SHOW') AS lesson_no_show,
+                   COUNT(a.id) FILTER (WHERE a.type = 'BOOKING' AND a.status = 'VISITED') AS booking_visited,
+                   COUNT(a.id) FILTER (WHERE a.type = 'BOOKING' AND a.status = 'CANCELLED') AS booking_cancelled,
+                   COUNT(a.id) FILTER (WHERE a.type = 'BOOKING' AND a.status = 'NO_SHOW') AS booking_no_show
+            FROM clients c
+            LEFT JOIN attendance a ON a.client_id = c.id
+)";
+
+static const std::string ZERO_UUID = "00000000-0000-0000-0000-000000000000";
+
+static ClientAttendanceSummary mapRowToClientSummary(const pqxx::row& row) {
+    ClientAttendanceSummary summary;
+    summary.clientId = UUID::fromString(row["client_id"].c_str());
+    summary.clientName = row["client_name"].c_str();
+    summary.counts.add(AttendanceType::LESSON, AttendanceStatus::VISITED, row["lesson_visited"].as<int>());
+    summary.counts.add(AttendanceType::LESSON, AttendanceStatus::CANCELLED, row["lesson_cancelled"].as<int>());
+    summary.counts.add(AttendanceType::LESSON, AttendanceStatus::NO_SHOW, row["lesson_no_show"].as<int>());
+    summary.counts.add(AttendanceType::BOOKING, AttendanceStatus::VISITED, row["booking_visited"].as<int>());
+    summary.counts.add(AttendanceType::BOOKING, AttendanceStatus::CANCELLED, row["booking_cancelled"].as<int>());
+    summary.counts.add(AttendanceType::BOOKING, AttendanceStatus::NO_SHOW, row["booking_no_show"].as<int>());
+    return summary;
+}
 
 PostgreSQLAttendanceRepository::PostgreSQLAttendanceRepository(
     std::shared_ptr<DatabaseConnection> dbConnection)
-    : dbConnection_(std::move(dbConnection)) {}
+    : dbConnection_(std::move(dbConnection)) {
+    registerPreparedStatements();
+}
 
-std::optional<Attendance> PostgreSQLAttendanceRepository::findById(const UUID& id) {
-    try {
-        auto work = dbConnection_->beginTransaction();
-        
-        SqlQueryBuilder queryBuilder;
-        std::string query = queryBuilder
-            .select({"id", "client_id", "entity_id", "type", "status", 
+void PostgreSQLAttendanceRepository::registerPreparedStatements() {
+    static std::once_flag registered;
+    std::call_once(registered, []() {
+        QueryFactory::registerPreparedStatements();
+
+        auto& registry = PreparedStatementRegistry::getInstance();
+        registry.registerStatement(STMT_FIND_BY_ID, SqlQueryBuilder()
+            .select({"id", "client_id", "entity_id", "type", "status",
                     "scheduled_time", "actual_time", "notes"})
             .from("attendance")
             .where("id = $1")
-            .build();
+            .build());
+        registry.registerStatement(STMT_FIND_BY_CLIENT_ID, SqlQueryBuilder()
+            .select({"id", "client_id", "entity_id", "type", "status",
+                    "scheduled_time", "actual_time", "notes"})
+            .from("attendance")
+            .where("client_id = $1")
+            .orderBy("scheduled_time", false)
+            .build());
+        registry.registerStatement(STMT_FIND_BY_ENTITY_ID, SqlQueryBuilder()
+            .select({"id", "client_id", "entity_id", "type", "status",
+                    "scheduled_time", "actual_time", "notes"})
+            .from("attendance")
+            .where("entity_id = $1")
+            .orderBy("scheduled_time", false)
+            .build());
+        registry.registerStatement(STMT_FIND_BY_TYPE_AND_STATUS, SqlQueryBuilder()
+            .select({"id", "client_id", "entity_id", "type", "status",
+                    "scheduled_time", "actual_time", "notes"})
+            .from("attendance")
+            .where("type = $1 AND status = $2")
+            .orderBy("scheduled_time", false)
+            .build());
+        registry.registerStatement(STMT_FIND_ALL, SqlQueryBuilder()
+            .select({"id", "client_id", "entity_id", "type", "status",
+                    "scheduled_time", "actual_time", "notes"})
+            .from("attendance")
+            .orderBy("scheduled_time", false)
+            .build());
+        registry.registerStatement(STMT_EXISTS, SqlQueryBuilder()
+            .select({"1"})
+            .from("attendance")
+            .where("id = $1")
+            .build());
+        registry.registerStatement(STMT_FIND_BY_IDS, SqlQueryBuilder()
+            .select({"id", "client_id", "entity_id", "type", "status",
+                    "scheduled_time", "actual_time", "notes"})
+            .from("attendance")
+            .where("id = ANY($1::uuid[])")
+            .build());
+        registry.registerStatement(STMT_EXISTS_MANY, SqlQueryBuilder()
+            .select({"id"})
+            .from("attendance")
+            .where("id = ANY($1::uuid[])")
+            .build());
+        registry.registerStatement(STMT_COUNT_BY_CLIENT_AND_STATUS, SqlQueryBuilder()
+            .select({"COUNT(*)"})
+            .from("attendance")
+            .where("client_id = $1 AND status = $2")
+            .build());
+        registry.registerStatement(STMT_COUNT_BY_TYPE_AND_STATUS, SqlQueryBuilder()
+            .select({"COUNT(*)"})
+            .from("attendance")
+            .where("type = $1 AND status = $2")
+            .build());
+        registry.registerStatement(STMT_GET_TOP_CLIENTS_BY_VISITS, R"(
+            SELECT client_id, COUNT(*) as visit_count
+            FROM attendance 
+            WHERE status = 'VISITED'
+            GROUP BY client_id 
+            ORDER BY visit_count DESC 
+            LIMIT $1
+        )");
+        registry.registerStatement(STMT_AGGREGATE_COUNTS, SqlQueryBuilder()
+            .select({"type", "status", "COUNT(*) AS count"})
+            .from("attendance")
+            .groupBy("type")
+            .groupBy("status")
+            .build());
+        registry.registerStatement(STMT_AGGREGATE_COUNTS_BY_CLIENT, SqlQueryBuilder()
+            .select({"client_id", "type", "status", "COUNT(*) AS count"})
+            .from("attendance")
+            .groupBy("client_id")
+            .groupBy("type")
+            .groupBy("status")
+            .build());
+        registry.registerStatement(STMT_AGGREGATE_CLIENT_COUNTS, SqlQueryBuilder()
+            .select({"type", "status", "COUNT(*) AS count"})
+            .from("attendance")
+            .where("client_id = $1")
+            .groupBy("type")
+            .groupBy("status")
+            .build());
+        // Доля посещений считается в SQL, чтобы top-N отбирался на сервере
+        registry.registerStatement(STMT_CLIENT_SUMMARIES, std::string(CLIENT_SUMMARY_SELECT) + R"(
+            GROUP BY c.id, c.name
+            ORDER BY COALESCE(
+                         COUNT(a.id) FILTER (WHERE a.status = 'VISITED')::float8
+                         / NULLIF(COUNT(a.id) FILTER (WHERE a.status IN ('VISITED', 'CANCELLED', 'NO_SHOW')), 0),
+                         0) DESC,
+                     c.name
+            LIMIT NULLIF($1::int, 0)
+        )");
+        // Keyset-пагинация по первичному ключу clients: каждая пачка - отдельный короткий запрос
+        registry.registerStatement(STMT_CLIENT_SUMMARIES_PAGE, std::string(CLIENT_SUMMARY_SELECT) + R"(
+            WHERE c.id > $1::uuid
+            GROUP BY c.id, c.name
+            ORDER BY c.id
+            LIMIT $2
+        )");
+    });
+}
+
+std::optional<Attendance> PostgreSQLAttendanceRepository::findById(const UUID& id) {
+    try {
+        auto work = dbConnection_->beginReadTransaction();
         
-        auto result = work.exec_params(query, id.toString());
+        auto result = work.exec_prepared(STMT_FIND_BY_ID, id.toString());
         
         if (result.empty()) {
             return std::nullopt;
@@ -37,18 +193,9 @@ std::optional<Attendance> PostgreSQLAttendanceRepository::findById(const UUID& i
 
 std::vector<Attendance> PostgreSQLAttendanceRepository::findByClientId(const UUID& clientId) {
     try {
-        auto work = dbConnection_->beginTransaction();
-        
-        SqlQueryBuilder queryBuilder;
-        std::string query = queryBuilder
-            .select({"id", "client_id", "entity_id", "type", "status", 
-                    "scheduled_time", "actual_time", "notes"})
-            .from("attendance")
-            .where("client_id = $1")
-            .orderBy("scheduled_time", false)
-            .build();
+        auto work = dbConnection_->beginReadTransaction();
         
-        auto result = work.exec_params(query, clientId.toString());
+        auto result = work.exec_prepared(STMT_FIND_BY_CLIENT_ID, clientId.toString());
         
         std::vector<Attendance> attendances;
         for (const auto& row : result) {
@@ -65,18 +212,9 @@ std::vector<Attendance> PostgreSQLAttendanceRepository::findByClientId(const UUI
 
 std::vector<Attendance> PostgreSQLAttendanceRepository::findByEntityId(const UUID& entityId) {
     try {
-        auto work = dbConnection_->beginTransaction();
+        auto work = dbConnection_->beginReadTransaction();
         
-        SqlQueryBuilder queryBuilder;
-        std::string query = queryBuilder
-            .select({"id", "client_id", "entity_id", "type", "status", 
-                    "scheduled_time", "actual_time", "notes"})
-            .from("attendance")
-            .where("entity_id = $1")
-            .orderBy("scheduled_time", false)
-            .build();
-        
-        auto result = work.exec_params(query, entityId.toString());
+        auto result = work.exec_prepared(STMT_FIND_BY_ENTITY_ID, entityId.toString());
         
         std::vector<Attendance> attendances;
         for (const auto& row : result) {
@@ -97,15 +235,13 @@ std::vector<Attendance> PostgreSQLAttendanceRepository::findByClientAndPeriod(
     const std::chrono::system_clock::time_point& end) {
     
     try {
-        auto work = dbConnection_->beginTransaction();
+        auto work = dbConnection_->beginReadTransaction();
         
-        // Теперь этот вызов корректен, так как метод статический
-        std::string query = QueryFactory::createFindAttendanceByClientAndPeriodQuery();
         auto startStr = DateTimeUtils::formatTimeForPostgres(start);
         auto endStr = DateTimeUtils::formatTimeForPostgres(end);
         
-        auto result = work.exec_params(
-            query, 
+        auto result = work.exec_prepared(
+            QueryFactory::Statements::FIND_ATTENDANCE_BY_CLIENT_AND_PERIOD, 
             clientId.toString(),
             startStr,
             endStr
@@ -128,19 +264,10 @@ std::vector<Attendance> PostgreSQLAttendanceRepository::findByTypeAndStatus(
     AttendanceType type, AttendanceStatus status) {
     
     try {
-        auto work = dbConnection_->beginTransaction();
-        
-        SqlQueryBuilder queryBuilder;
-        std::string query = queryBuilder
-            .select({"id", "client_id", "entity_id", "type", "status", 
-                    "scheduled_time", "actual_time", "notes"})
-            .from("attendance")
-            .where("type = $1 AND status = $2")
-            .orderBy("scheduled_time", false)
-            .build();
+        auto work = dbConnection_->beginReadTransaction();
         
-        auto result = work.exec_params(
-            query, 
+        auto result = work.exec_prepared(
+            STMT_FIND_BY_TYPE_AND_STATUS, 
             attendanceTypeToString(type),
             attendanceStatusToString(status)
         );
@@ -160,17 +287,9 @@ std::vector<Attendance> PostgreSQLAttendanceRepository::findByTypeAndStatus(
 
 std::vector<Attendance> PostgreSQLAttendanceRepository::findAll() {
     try {
-        auto work = dbConnection_->beginTransaction();
-        
-        SqlQueryBuilder queryBuilder;
-        std::string query = queryBuilder
-            .select({"id", "client_id", "entity_id", "type", "status", 
-                    "scheduled_time", "actual_time", "notes"})
-            .from("attendance")
-            .orderBy("scheduled_time", false)
-            .build();
+        auto work = dbConnection_->beginReadTransaction();
         
-        auto result = work.exec(query);
+        auto result = work.exec_prepared(STMT_FIND_ALL);
         
         std::vector<Attendance> attendances;
         for (const auto& row : result) {
@@ -293,16 +412,9 @@ bool PostgreSQLAttendanceRepository::remove(const UUID& id) {
 
 bool PostgreSQLAttendanceRepository::exists(const UUID& id) {
     try {
-        auto work = dbConnection_->beginTransaction();
+        auto work = dbConnection_->beginReadTransaction();
         
-        SqlQueryBuilder queryBuilder;
-        std::string query = queryBuilder
-            .select({"1"})
-            .from("attendance")
-            .where("id = $1")
-            .build();
-            
-        auto result = work.exec_params(query, id.toString());
+        auto result = work.exec_prepared(STMT_EXISTS, id.toString());
         
         dbConnection_->commitTransaction(work);
         return !result.empty();
@@ -312,19 +424,59 @@ bool PostgreSQLAttendanceRepository::exists(const UUID& id) {
     }
 }
 
+std::vector<Attendance> PostgreSQLAttendanceRepository::findByIds(const std::vector<UUID>& ids) {
+    if (ids.empty()) {
+        return {};
+    }
+    
+    try {
+        auto work = dbConnection_->beginReadTransaction();
+        
+        auto result = work.exec_prepared(STMT_FIND_BY_IDS, SqlQueryBuilder::uuidArrayLiteral(ids));
+        
+        std::vector<Attendance> attendances;
+        attendances.reserve(result.size());
+        for (const auto& row : result) {
+            attendances.push_back(mapResultToAttendance(row));
+        }
+        
+        dbConnection_->commitTransaction(work);
+        return attendances;
+        
+    } catch (const std::exception& e) {
+        throw QueryException(std::string("Failed to find attendance records by IDs: ") + e.what());
+    }
+}
+
+std::set<UUID> PostgreSQLAttendanceRepository::existsMany(const std::vector<UUID>& ids) {
+    if (ids.empty()) {
+        return {};
+    }
+    
+    try {
+        auto work = dbConnection_->beginReadTransaction();
+        
+        auto result = work.exec_prepared(STMT_EXISTS_MANY, SqlQueryBuilder::uuidArrayLiteral(ids));
+        
+        std::set<UUID> existing;
+        for (const auto& row : result) {
+            existing.insert(UUID::fromString(row["id"].c_str()));
+        }
+        
+        dbConnection_->commitTransaction(work);
+        return existing;
+        
+    } catch (const std::exception& e) {
+        throw QueryException(std::string("Failed to check attendance existence: ") + e.what());
+    }
+}
+
 int PostgreSQLAttendanceRepository::countByClientAndStatus(const UUID& clientId, AttendanceStatus status) {
     try {
-        auto work = dbConnection_->beginTransaction();
+        auto work = dbConnection_->beginReadTransaction();
         
-        SqlQueryBuilder queryBuilder;
-        std::string query = queryBuilder
-            .select({"COUNT(*)"})
-            .from("attendance")
-            .where("client_id = $1 AND status = $2")
-            .build();
-            
-        auto result = work.exec_params(
-            query, 
+        auto result = work.exec_prepared(
+            STMT_COUNT_BY_CLIENT_AND_STATUS, 
             clientId.toString(),
             attendanceStatusToString(status)
         );
@@ -344,17 +496,10 @@ int PostgreSQLAttendanceRepository::countByClientAndStatus(const UUID& clientId,
 
 int PostgreSQLAttendanceRepository::countByTypeAndStatus(AttendanceType type, AttendanceStatus status) {
     try {
-        auto work = dbConnection_->beginTransaction();
+        auto work = dbConnection_->beginReadTransaction();
         
-        SqlQueryBuilder queryBuilder;
-        std::string query = queryBuilder
-            .select({"COUNT(*)"})
-            .from("attendance")
-            .where("type = $1 AND status = $2")
-            .build();
-            
-        auto result = work.exec_params(
-            query, 
+        auto result = work.exec_prepared(
+            STMT_COUNT_BY_TYPE_AND_STATUS, 
             attendanceTypeToString(type),
             attendanceStatusToString(status)
         );
@@ -372,20 +517,110 @@ int PostgreSQLAttendanceRepository::countByTypeAndStatus(AttendanceType type, At
     }
 }
 
-std::vector<std::pair<UUID, int>> PostgreSQLAttendanceRepository::getTopClientsByVisits(int limit) {
+AttendanceBreakdown PostgreSQLAttendanceRepository::aggregateCounts(bool includeClients) {
     try {
-        auto work = dbConnection_->beginTransaction();
+        auto work = dbConnection_->beginReadTransaction();
         
-        std::string query = R"(
-            SELECT client_id, COUNT(*) as visit_count
-            FROM attendance 
-            WHERE status = 'VISITED'
-            GROUP BY client_id 
-            ORDER BY visit_count DESC 
-            LIMIT $1
-        )";
+        auto result = work.exec_prepared(includeClients ? STMT_AGGREGATE_COUNTS_BY_CLIENT : STMT_AGGREGATE_COUNTS);
+        
+        AttendanceBreakdown breakdown;
+        for (const auto& row : result) {
+            AttendanceType type = stringToAttendanceType(row["type"].c_str());
+            AttendanceStatus status = stringToAttendanceStatus(row["status"].c_str());
+            int count = row["count"].as<int>();
+            
+            breakdown.totals.add(type, status, count);
+            if (includeClients) {
+                breakdown.byClient[UUID::fromString(row["client_id"].c_str())].add(type, status, count);
+            }
+        }
+        
+        dbConnection_->commitTransaction(work);
+        return breakdown;
+        
+    } catch (const std::exception& e) {
+        throw QueryException(std::string("Failed to aggregate attendance counts: ") + e.what());
+    }
+}
+
+AttendanceCounts PostgreSQLAttendanceRepository::aggregateClientCounts(const UUID& clientId) {
+    try {
+        auto work = dbConnection_->beginReadTransaction();
+        
+        auto result = work.exec_prepared(STMT_AGGREGATE_CLIENT_COUNTS, clientId.toString());
+        
+        AttendanceCounts counts;
+        for (const auto& row : result) {
+            counts.add(stringToAttendanceType(row["type"].c_str()),
+                       stringToAttendanceStatus(row["status"].c_str()),
+                       row["count"].as<int>());
+        }
+        
+        dbConnection_->commitTransaction(work);
+        return counts;
+        
+    } catch (const std::exception& e) {
+        throw QueryException(std::string("Failed to aggregate client attendance counts: ") + e.what());
+    }
+}
+
+std::vector<ClientAttendanceSummary> PostgreSQLAttendanceRepository::findClientSummaries(int limit) {
+    try {
+        auto work = dbConnection_->beginReadTransaction();
+        
+        auto result = work.exec_prepared(STMT_CLIENT_SUMMARIES, limit > 0 ? limit : 0);
+        
+        std::vector<ClientAttendanceSummary> summaries;
+        summaries.reserve(result.size());
+        for (const auto& row : result) {
+            summaries.push_back(mapRowToClientSummary(row));
+        }
+        
+        dbConnection_->commitTransaction(work);
+        return summaries;
+        
+    } catch (const std::exception& e) {
+        throw QueryException(std::string("Failed to find client attendance summaries: ") + e.what());
+    }
+}
+
+void PostgreSQLAttendanceRepository::streamClientSummaries(int batchSize, const ClientAttendanceSummaryConsumer& consumer) {
+    if (batchSize <= 0) {
+        throw std::invalid_argument("Batch size must be positive");
+    }
+    
+    std::string lastClientId = ZERO_UUID;
+    std::vector<ClientAttendanceSummary> batch;
+    
+    do {
+        batch.clear();
+        try {
+            auto work = dbConnection_->beginReadTransaction();
+            auto result = work.exec_prepared(STMT_CLIENT_SUMMARIES_PAGE, lastClientId, batchSize);
+            for (const auto& row : result) {
+                batch.push_back(mapRowToClientSummary(row));
+            }
+            dbConnection_->commitTransaction(work);
+        } catch (const std::exception& e) {
+            throw QueryException(std::string("Failed to stream client attendance summaries: ") + e.what());
+        }
+        
+        // Потребитель вызывается вне транзакции, чтобы медленный вывод не держал соединение
+        for (const auto& summary : batch) {
+            consumer(summary);
+        }
+        
+        if (!batch.empty()) {
+            lastClientId = batch.back().clientId.toString();
+        }
+    } while (batch.size() == static_cast<std::size_t>(batchSize));
+}
+
+std::vector<std::pair<UUID, int>> PostgreSQLAttendanceRepository::getTopClientsByVisits(int limit) {
+    try {
+        auto work = dbConnection_->beginReadTransaction();
         
-        auto result = work.exec_params(query, limit);
+        auto result = work.exec_prepared(STMT_GET_TOP_CLIENTS_BY_VISITS, limit);
         
         std::vector<std::pair<UUID, int>> topClients;
         for (const auto& row : result) {
@@ -23,12 +23,21 @@ public:
     bool update(const Attendance& attendance) override;
     bool remove(const UUID& id) override;
     bool exists(const UUID& id) override;
+    std::vector<Attendance> findByIds(const std::vector<UUID>& ids) override;
+    std::set<UUID> existsMany(const std::vector<UUID>& ids) override;
     
     int countByClientAndStatus(const UUID& clientId, AttendanceStatus status) override;
     int countByTypeAndStatus(AttendanceType type, AttendanceStatus status) override;
     std::vector<std::pair<UUID, int>> getTopClientsByVisits(int limit) override;
+    AttendanceBreakdown aggregateCounts(bool includeClients) override;
+    AttendanceCounts aggregateClientCounts(const UUID& clientId) override;
+    std::vector<ClientAttendanceSummary> findClientSummaries(int limit) override;
+    void streamClientSummaries(int batchSize, const ClientAttendanceSummaryConsumer& consumer) override;
 
 private:
+    // Регистрирует запросы-поисковики в PreparedStatementRegistry (однократно на процесс)
+    static void registerPreparedStatements();
+
     std::shared_ptr<DatabaseConnection> dbConnection_;
     
     Attendance mapResultToAttendance(const pqxx::row& row) const;
@@ -3,23 +3,97 @@
 #include "../../data/DateTimeUtils.hpp"
 #include "../../data/QueryFactory.hpp"
 #include <iostream>
+#include "../../data/PreparedStatementRegistry.hpp"
+#include "../../data/SqlQueryBuilder.hpp"
+#include <mutex>
+
+// Именованные запросы репозитория, см. PreparedStatementRegistry
+static const char* const STMT_FIND_BY_ID = "booking_find_by_id";
+static const char* const STMT_FIND_BY_CLIENT_ID = "booking_find_by_client_id";
+static const char* const STMT_FIND_BY_HALL_ID = "booking_find_by_hall_id";
+static const char* const STMT_FIND_ALL = "booking_find_all";
+static const char* const STMT_EXISTS = "booking_exists";
+static const char* const STMT_FIND_BY_IDS = "booking_find_by_ids";
+static const char* const STMT_EXISTS_MANY = "booking_exists_many";
+static const char* const STMT_FIND_BY_HALLS_AND_RANGE = "booking_find_by_halls_and_range";
+static const char* const STMT_FIND_BY_BRANCH_AND_RANGE = "booking_find_by_branch_and_range";
 
 PostgreSQLBookingRepository::PostgreSQLBookingRepository(
     std::shared_ptr<DatabaseConnection> dbConnection)
-    : dbConnection_(std::move(dbConnection)) {}
+    : dbConnection_(std::move(dbConnection)) {
+    registerPreparedStatements();
+}
 
-std::optional<Booking> PostgreSQLBookingRepository::findById(const UUID& id) {
-    try {
-        auto work = dbConnection_->beginTransaction();
-        
-        SqlQueryBuilder queryBuilder;
-        std::string query = queryBuilder
+void PostgreSQLBookingRepository::registerPreparedStatements() {
+    static std::once_flag registered;
+    std::call_once(registered, []() {
+        QueryFactory::registerPreparedStatements();
+
+        auto& registry = PreparedStatementRegistry::getInstance();
+        registry.registerStatement(STMT_FIND_BY_ID, SqlQueryBuilder()
             .select({"id", "client_id", "hall_id", "start_time", "duration_minutes", "purpose", "status", "created_at"})
             .from("bookings")
             .where("id = $1")
-            .build();
+            .build());
+        registry.registerStatement(STMT_FIND_BY_CLIENT_ID, SqlQueryBuilder()
+            .select({"id", "client_id", "hall_id", "start_time", "duration_minutes", "purpose", "status", "created_at"})
+            .from("bookings")
+            .where("client_id = $1")
+            .build());
+        registry.registerStatement(STMT_FIND_BY_HALL_ID, SqlQueryBuilder()
+            .select({"id", "client_id", "hall_id", "start_time", "duration_minutes", "purpose", "status", "created_at"})
+            .from("bookings")
+            .where("hall_id = $1")
+            .build());
+        registry.registerStatement(STMT_FIND_ALL, SqlQueryBuilder()
+            .select({"id", "client_id", "hall_id", "start_time", "duration_minutes", "purpose", "status", "created_at"})
+            .from("bookings")
+            .orderBy("created_at", false)
+            .build());
+        registry.registerStatement(STMT_EXISTS, SqlQueryBuilder()
+            .select({"1"})
+            .from("bookings")
+            .where("id = $1")
+            .build());
+        registry.registerStatement(STMT_FIND_BY_IDS, SqlQueryBuilder()
+            .select({"id", "client_id", "hall_id", "start_time", "duration_minutes", "purpose", "status", "created_at"})
+            .from("bookings")
+            .where("id = ANY($1::uuid[])")
+            .build());
+        registry.registerStatement(STMT_EXISTS_MANY, SqlQueryBuilder()
+            .select({"id"})
+            .from("bookings")
+            .where("id = ANY($1::uuid[])")
+            .build());
+        registry.registerStatement(STMT_FIND_BY_HALLS_AND_RANGE, SqlQueryBuilder()
+            .select({"id", "client_id", "hall_id", "start_time", "duration_minutes", "purpose", "status", "created_at"})
+            .from("bookings")
+            .where("hall_id = ANY($1::uuid[])")
+            .andWhere("start_time >= $2::timestamp")
+            .andWhere("start_time <= $3::timestamp")
+            .orderBy("start_time")
+            .build());
+        // Залы филиала - в соединении, без отдельного запроса к dance_halls
+        registry.registerStatement(STMT_FIND_BY_BRANCH_AND_RANGE, SqlQueryBuilder()
+            .select({
+                "b.id", "b.client_id", "b.hall_id", "b.start_time", "b.duration_minutes",
+                "b.purpose", "b.status", "b.created_at"
+            })
+            .from("bookings b")
+            .innerJoin("dance_halls h", "h.id = b.hall_id")
+            .where("h.branch_id = $1")
+            .andWhere("b.start_time >= $2::timestamp")
+            .andWhere("b.start_time <= $3::timestamp")
+            .orderBy("b.start_time")
+            .build());
+    });
+}
+
+std::optional<Booking> PostgreSQLBookingRepository::findById(const UUID& id) {
+    try {
+        auto work = dbConnection_->beginReadTransaction();
         
-        auto result = work.exec_params(query, id.toString());
+        auto result = work.exec_prepared(STMT_FIND_BY_ID, id.toString());
         
         if (result.empty()) {
             return std::nullopt;
@@ -36,16 +110,9 @@ std::optional<Booking> PostgreSQLBookingRepository::findById(const UUID& id) {
 
 std::vector<Booking> PostgreSQLBookingRepository::findByClientId(const UUID& clientId) {
     try {
-        auto work = dbConnection_->beginTransaction();
-        
-        SqlQueryBuilder queryBuilder;
-        std::string query = queryBuilder
-            .select({"id", "client_id", "hall_id", "start_time", "duration_minutes", "purpose", "status", "created_at"})
-            .from("bookings")
-            .where("client_id = $1")
-            .build();
+        auto work = dbConnection_->beginReadTransaction();
         
-        auto result = work.exec_params(query, clientId.toString());
+        auto result = work.exec_prepared(STMT_FIND_BY_CLIENT_ID, clientId.toString());
         
         std::vector<Booking> bookings;
         for (const auto& row : result) {
@@ -62,16 +129,9 @@ std::vector<Booking> PostgreSQLBookingRepository::findByClientId(const UUID& cli
 
 std::vector<Booking> PostgreSQLBookingRepository::findByHallId(const UUID& hallId) {
     try {
-        auto work = dbConnection_->beginTransaction();
-        
-        SqlQueryBuilder queryBuilder;
-        std::string query = queryBuilder
-            .select({"id", "client_id", "hall_id", "start_time", "duration_minutes", "purpose", "status", "created_at"})
-            .from("bookings")
-            .where("hall_id = $1")
-            .build();
+        auto work = dbConnection_->beginReadTransaction();
         
-        auto result = work.exec_params(query, hallId.toString());
+        auto result = work.exec_prepared(STMT_FIND_BY_HALL_ID, hallId.toString());
         
         std::vector<Booking> bookings;
         for (const auto& row : result) {
@@ -90,13 +150,12 @@ std::vector<Booking> PostgreSQLBookingRepository::findConflictingBookings(
     const UUID& hallId, const TimeSlot& timeSlot) {
     
     try {
-        auto work = dbConnection_->beginTransaction();
+        auto work = dbConnection_->beginReadTransaction();
         
-        std::string query = QueryFactory::createFindConflictingBookingsQuery();
         auto startTimeStr = DateTimeUtils::formatTimeForPostgres(timeSlot.getStartTime());
         
-        auto result = work.exec_params(
-            query, 
+        auto result = work.exec_prepared(
+            QueryFactory::Statements::FIND_CONFLICTING_BOOKINGS, 
             hallId.toString(),
             startTimeStr,
             timeSlot.getDurationMinutes()
@@ -115,18 +174,110 @@ std::vector<Booking> PostgreSQLBookingRepository::findConflictingBookings(
     }
 }
 
-std::vector<Booking> PostgreSQLBookingRepository::findAll() {
+std::vector<Booking> PostgreSQLBookingRepository::findConflictingBookingsInRange(
+    const std::vector<UUID>& hallIds,
+    const std::chrono::system_clock::time_point& from,
+    const std::chrono::system_clock::time_point& to) {
+    
+    if (hallIds.empty() || !(from < to)) {
+        return {};
+    }
+    
     try {
-        auto work = dbConnection_->beginTransaction();
+        auto work = dbConnection_->beginReadTransaction();
         
-        SqlQueryBuilder queryBuilder;
-        std::string query = queryBuilder
-            .select({"id", "client_id", "hall_id", "start_time", "duration_minutes", "purpose", "status", "created_at"})
-            .from("bookings")
-            .orderBy("created_at", false)
-            .build();
+        auto result = work.exec_prepared(
+            QueryFactory::Statements::FIND_CONFLICTING_BOOKINGS_IN_RANGE,
+            SqlQueryBuilder::uuidArrayLiteral(hallIds),
+            DateTimeUtils::formatTimeForPostgres(from),
+            DateTimeUtils::formatTimeForPostgres(to)
+        );
+        
+        std::vector<Booking> bookings;
+        bookings.reserve(result.size());
+        for (const auto& row : result) {
+            bookings.push_back(mapResultToBooking(row));
+        }
+        
+        dbConnection_->commitTransaction(work);
+        return bookings;
+        
+    } catch (const std::exception& e) {
+        throw QueryException(std::string("Failed to find conflicting bookings in range: ") + e.what());
+    }
+}
+
+std::vector<Booking> PostgreSQLBookingRepository::findByHallsAndRange(
+    const std::vector<UUID>& hallIds,
+    const std::chrono::system_clock::time_point& from,
+    const std::chrono::system_clock::time_point& to) {
+    
+    if (hallIds.empty() || to < from) {
+        return {};
+    }
+    
+    try {
+        auto work = dbConnection_->beginReadTransaction();
         
-        auto result = work.exec(query);
+        auto result = work.exec_prepared(
+            STMT_FIND_BY_HALLS_AND_RANGE,
+            SqlQueryBuilder::uuidArrayLiteral(hallIds),
+            DateTimeUtils::formatTimeForPostgres(from),
+            DateTimeUtils::formatTimeForPostgres(to)
+        );
+        
+        std::vector<Booking> bookings;
+        bookings.reserve(result.size());
+        for (const auto& row : result) {
+            bookings.push_back(mapResultToBooking(row));
+        }
+        
+        dbConnection_->commitTransaction(work);
+        return bookings;
+        
+    } catch (const std::exception& e) {
+        throw QueryException(std::string("Failed to find bookings by halls and range: ") + e.what());
+    }
+}
+
+std::vector<Booking> PostgreSQLBookingRepository::findByBranchAndRange(
+    const UUID& branchId,
+    const std::chrono::system_clock::time_point& from,
+    const std::chrono::system_clock::time_point& to) {
+    
+    if (to < from) {
+        return {};
+    }
+    
+    try {
+        auto work = dbConnection_->beginReadTransaction();
+        
+        auto result = work.exec_prepared(
+            STMT_FIND_BY_BRANCH_AND_RANGE,
+            branchId.toString(),
+            DateTimeUtils::formatTimeForPostgres(from),
+            DateTimeUtils::formatTimeForPostgres(to)
+        );
+        
+        std::vector<Booking> bookings;
+        bookings.reserve(result.size());
+        for (const auto& row : result) {
+            bookings.push_back(mapResultToBooking(row));
+        }
+        
+        dbConnection_->commitTransaction(work);
+        return bookings;
+        
+    } catch (const std::exception& e) {
+        throw QueryException(std::string("Failed to find bookings by branch and range: ") + e.what());
+    }
+}
+
+std::vector<Booking> PostgreSQLBookingRepository::findAll() {
+    try {
+        auto work = dbConnection_->beginReadTransaction();
+        
+        auto result = work.exec_prepared(STMT_FIND_ALL);
         
         std::vector<Booking> bookings;
         for (const auto& row : result) {
@@ -252,16 +403,9 @@ bool PostgreSQLBookingRepository::remove(const UUID& id) {
 
 bool PostgreSQLBookingRepository::exists(const UUID& id) {
     try {
-        auto work = dbConnection_->beginTransaction();
+        auto work = dbConnection_->beginReadTransaction();
         
-        SqlQueryBuilder queryBuilder;
-        std::string query = queryBuilder
-            .select({"1"})
-            .from("bookings")
-            .where("id = $1")
-            .build();
-            
-        auto result = work.exec_params(query, id.toString());
+        auto result = work.exec_prepared(STMT_EXISTS, id.toString());
         
         dbConnection_->commitTransaction(work);
         return !result.empty();
@@ -271,6 +415,53 @@ bool PostgreSQLBookingRepository::exists(const UUID& id) {
     }
 }
 
+std::vector<Booking> PostgreSQLBookingRepository::findByIds(const std::vector<UUID>& ids) {
+    if (ids.empty()) {
+        return {};
+    }
+    
+    try {
+        auto work = dbConnection_->beginReadTransaction();
+        
+        auto result = work.exec_prepared(STMT_FIND_BY_IDS, SqlQueryBuilder::uuidArrayLiteral(ids));
+        
+        std::vector<Booking> bookings;
+        bookings.reserve(result.size());
+        for (const auto& row : result) {
+            bookings.push_back(mapResultToBooking(row));
+        }
+        
+        dbConnection_->commitTransaction(work);
+        return bookings;
+        
+    } catch (const std::exception& e) {
+        throw QueryException(std::string("Failed to find bookings by IDs: ") + e.what());
+    }
+}
+
+std::set<UUID> PostgreSQLBookingRepository::existsMany(const std::vector<UUID>& ids) {
+    if (ids.empty()) {
+        return {};
+    }
+    
+    try {
+        auto work = dbConnection_->beginReadTransaction();
+        
+        auto result = work.exec_prepared(STMT_EXISTS_MANY, SqlQueryBuilder::uuidArrayLiteral(ids));
+        
+        std::set<UUID> existing;
+        for (const auto& row : result) {
+            existing.insert(UUID::fromString(row["id"].c_str()));
+        }
+        
+        dbConnection_->commitTransaction(work);
+        return existing;
+        
+    } catch (const std::exception& e) {
+        throw QueryException(std::string("Failed to check booking existence: ") + e.what());
+    }
+}
+
 
 Booking PostgreSQLBookingRepository::mapResultToBooking(const pqxx::row& row) const {
     try {
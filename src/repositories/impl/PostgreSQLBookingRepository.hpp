@@ -15,13 +15,27 @@ public:
     std::vector<Booking> findByClientId(const UUID& clientId) override;
     std::vector<Booking> findByHallId(const UUID& hallId) override;
     std::vector<Booking> findConflictingBookings(const UUID& hallId, const TimeSlot& timeSlot) override;
+    std::vector<Booking> findConflictingBookingsInRange(const std::vector<UUID>& hallIds,
+                                                        const std::chrono::system_clock::time_point& from,
+                                                        const std::chrono::system_clock::time_point& to) override;
+    std::vector<Booking> findByHallsAndRange(const std::vector<UUID>& hallIds,
+                                             const std::chrono::system_clock::time_point& from,
+                                             const std::chrono::system_clock::time_point& to) override;
+    std::vector<Booking> findByBranchAndRange(const UUID& branchId,
+                                              const std::chrono::system_clock::time_point& from,
+                                              const std::chrono::system_clock::time_point& to) override;
     std::vector<Booking> findAll() override;
     bool save(const Booking& booking) override;
     bool update(const Booking& booking) override;
     bool remove(const UUID& id) override;
     bool exists(const UUID& id) override;
+    std::vector<Booking> findByIds(const std::vector<UUID>& ids) override;
+    std::set<UUID> existsMany(const std::vector<UUID>& ids) override;
 
 private:
+    // Регистрирует запросы-поисковики в PreparedStatementRegistry (однократно на процесс)
+    static void registerPreparedStatements();
+
     std::shared_ptr<DatabaseConnection> dbConnection_;
     
     Booking mapResultToBooking(const pqxx::row& row) const;
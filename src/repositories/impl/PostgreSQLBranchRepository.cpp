@@ -1,24 +1,85 @@
 #include "PostgreSQLBranchRepository.hpp"
 #include "../../data/SqlQueryBuilder.hpp"
 #include "../../data/DateTimeUtils.hpp"
+#include "../../data/PreparedStatementRegistry.hpp"
+#include <map>
+#include <mutex>
+
+// Именованные запросы репозитория, см. PreparedStatementRegistry
+static const char* const STMT_FIND_BY_ID = "branch_find_by_id";
+static const char* const STMT_FIND_BY_STUDIO_ID = "branch_find_by_studio_id";
+static const char* const STMT_FIND_ALL = "branch_find_all";
+static const char* const STMT_EXISTS = "branch_exists";
+static const char* const STMT_FIND_ADDRESS_BY_ID = "branch_find_address_by_id";
+static const char* const STMT_ADDRESS_EXISTS = "branch_address_exists";
+static const char* const STMT_FIND_BY_IDS = "branch_find_by_ids";
+static const char* const STMT_EXISTS_MANY = "branch_exists_many";
+static const char* const STMT_FIND_ADDRESSES_BY_IDS = "branch_find_addresses_by_ids";
 
 PostgreSQLBranchRepository::PostgreSQLBranchRepository(
     std::shared_ptr<DatabaseConnection> dbConnection)
-    : dbConnection_(std::move(dbConnection)) {}
+    : dbConnection_(std::move(dbConnection)) {
+    registerPreparedStatements();
+}
 
-std::optional<Branch> PostgreSQLBranchRepository::findById(const UUID& id) {
-    try {
-        auto work = dbConnection_->beginTransaction();
-        
-        // Сначала получаем основные данные филиала
-        SqlQueryBuilder branchQueryBuilder;
-        std::string branchQuery = branchQueryBuilder
+void PostgreSQLBranchRepository::registerPreparedStatements() {
+    static std::once_flag registered;
+    std::call_once(registered, []() {
+
+        auto& registry = PreparedStatementRegistry::getInstance();
+        registry.registerStatement(STMT_FIND_BY_ID, SqlQueryBuilder()
             .select({"id", "name", "phone", "open_time", "close_time", "studio_id", "address_id"})
             .from("branches")
             .where("id = $1")
-            .build();
+            .build());
+        registry.registerStatement(STMT_FIND_BY_STUDIO_ID, SqlQueryBuilder()
+            .select({"id", "name", "phone", "open_time", "close_time", "studio_id", "address_id"})
+            .from("branches")
+            .where("studio_id = $1")
+            .build());
+        registry.registerStatement(STMT_FIND_ALL, SqlQueryBuilder()
+            .select({"id", "name", "phone", "open_time", "close_time", "studio_id", "address_id"})
+            .from("branches")
+            .build());
+        registry.registerStatement(STMT_EXISTS, SqlQueryBuilder()
+            .select({"1"})
+            .from("branches")
+            .where("id = $1")
+            .build());
+        registry.registerStatement(STMT_FIND_ADDRESS_BY_ID, SqlQueryBuilder()
+            .select({"id", "country", "city", "street", "building", "apartment", "postal_code", "timezone_offset"})
+            .from("addresses")
+            .where("id = $1")
+            .build());
+        registry.registerStatement(STMT_ADDRESS_EXISTS, SqlQueryBuilder()
+            .select({"1"})
+            .from("addresses")
+            .where("id = $1")
+            .build());
+        registry.registerStatement(STMT_FIND_BY_IDS, SqlQueryBuilder()
+            .select({"id", "name", "phone", "open_time", "close_time", "studio_id", "address_id"})
+            .from("branches")
+            .where("id = ANY($1::uuid[])")
+            .build());
+        registry.registerStatement(STMT_EXISTS_MANY, SqlQueryBuilder()
+            .select({"id"})
+            .from("branches")
+            .where("id = ANY($1::uuid[])")
+            .build());
+        registry.registerStatement(STMT_FIND_ADDRESSES_BY_IDS, SqlQueryBuilder()
+            .select({"id", "country", "city", "street", "building", "apartment", "postal_code", "timezone_offset"})
+            .from("addresses")
+            .where("id = ANY($1::uuid[])")
+            .build());
+    });
+}
+
+std::optional<Branch> PostgreSQLBranchRepository::findById(const UUID& id) {
+    try {
+        auto work = dbConnection_->beginReadTransaction();
         
-        auto branchResult = work.exec_params(branchQuery, id.toString());
+        // Сначала получаем основные данные филиала
+        auto branchResult = work.exec_prepared(STMT_FIND_BY_ID, id.toString());
         
         if (branchResult.empty()) {
             return std::nullopt;
@@ -42,16 +103,9 @@ std::optional<Branch> PostgreSQLBranchRepository::findById(const UUID& id) {
 
 std::vector<Branch> PostgreSQLBranchRepository::findByStudioId(const UUID& studioId) {
     try {
-        auto work = dbConnection_->beginTransaction();
+        auto work = dbConnection_->beginReadTransaction();
         
-        SqlQueryBuilder queryBuilder;
-        std::string query = queryBuilder
-            .select({"id", "name", "phone", "open_time", "close_time", "studio_id", "address_id"})
-            .from("branches")
-            .where("studio_id = $1")
-            .build();
-        
-        auto result = work.exec_params(query, studioId.toString());
+        auto result = work.exec_prepared(STMT_FIND_BY_STUDIO_ID, studioId.toString());
         
         std::vector<Branch> branches;
         for (const auto& row : result) {
@@ -70,16 +124,9 @@ std::vector<Branch> PostgreSQLBranchRepository::findByStudioId(const UUID& studi
     }
 }
 
-std::optional<BranchAddress> PostgreSQLBranchRepository::findAddressById(const UUID& addressId, pqxx::work& work) {
+std::optional<BranchAddress> PostgreSQLBranchRepository::findAddressById(const UUID& addressId, DatabaseTransaction& work) {
     try {
-        SqlQueryBuilder queryBuilder;
-        std::string query = queryBuilder
-            .select({"id", "country", "city", "street", "building", "apartment", "postal_code", "timezone_offset"})
-            .from("addresses")
-            .where("id = $1")
-            .build();
-        
-        auto result = work.exec_params(query, addressId.toString());
+        auto result = work.exec_prepared(STMT_FIND_ADDRESS_BY_ID, addressId.toString());
         
         if (result.empty()) {
             return std::nullopt;
@@ -94,15 +141,9 @@ std::optional<BranchAddress> PostgreSQLBranchRepository::findAddressById(const U
 
 std::vector<Branch> PostgreSQLBranchRepository::findAll() {
     try {
-        auto work = dbConnection_->beginTransaction();
+        auto work = dbConnection_->beginReadTransaction();
         
-        SqlQueryBuilder queryBuilder;
-        std::string query = queryBuilder
-            .select({"id", "name", "phone", "open_time", "close_time", "studio_id", "address_id"})
-            .from("branches")
-            .build();
-        
-        auto result = work.exec(query);
+        auto result = work.exec_prepared(STMT_FIND_ALL);
         
         std::vector<Branch> branches;
         for (const auto& row : result) {
@@ -121,19 +162,12 @@ std::vector<Branch> PostgreSQLBranchRepository::findAll() {
     }
 }
 
-bool PostgreSQLBranchRepository::addressExists(pqxx::work& work, const UUID& addressId) {
-    SqlQueryBuilder queryBuilder;
-    std::string query = queryBuilder
-        .select({"1"})
-        .from("addresses")
-        .where("id = $1")
-        .build();
-    
-    auto result = work.exec_params(query, addressId.toString());
+bool PostgreSQLBranchRepository::addressExists(DatabaseTransaction& work, const UUID& addressId) {
+    auto result = work.exec_prepared(STMT_ADDRESS_EXISTS, addressId.toString());
     return !result.empty();
 }
 
-void PostgreSQLBranchRepository::saveAddressWithUpsert(pqxx::work& work, const BranchAddress& address) {
+void PostgreSQLBranchRepository::saveAddressWithUpsert(DatabaseTransaction& work, const BranchAddress& address) {
     try {
         if (addressExists(work, address.getId())) {
             // Обновляем адрес
@@ -360,16 +394,9 @@ bool PostgreSQLBranchRepository::remove(const UUID& id) {
 
 bool PostgreSQLBranchRepository::exists(const UUID& id) {
     try {
-        auto work = dbConnection_->beginTransaction();
+        auto work = dbConnection_->beginReadTransaction();
         
-        SqlQueryBuilder queryBuilder;
-        std::string query = queryBuilder
-            .select({"1"})
-            .from("branches")
-            .where("id = $1")
-            .build();
-            
-        auto result = work.exec_params(query, id.toString());
+        auto result = work.exec_prepared(STMT_EXISTS, id.toString());
         
         dbConnection_->commitTransaction(work);
         return !result.empty();
@@ -379,6 +406,70 @@ bool PostgreSQLBranchRepository::exists(const UUID& id) {
     }
 }
 
+std::vector<Branch> PostgreSQLBranchRepository::findByIds(const std::vector<UUID>& ids) {
+    if (ids.empty()) {
+        return {};
+    }
+    
+    try {
+        auto work = dbConnection_->beginReadTransaction();
+        
+        auto branchResult = work.exec_prepared(STMT_FIND_BY_IDS, SqlQueryBuilder::uuidArrayLiteral(ids));
+        
+        // Адреса всех найденных филиалов получаем вторым запросом, а не по одному на филиал
+        std::vector<UUID> addressIds;
+        for (const auto& row : branchResult) {
+            addressIds.push_back(UUID::fromString(row["address_id"].c_str()));
+        }
+        
+        std::map<UUID, BranchAddress> addresses;
+        if (!addressIds.empty()) {
+            auto addressResult = work.exec_prepared(STMT_FIND_ADDRESSES_BY_IDS, SqlQueryBuilder::uuidArrayLiteral(addressIds));
+            for (const auto& row : addressResult) {
+                auto address = mapResultToAddress(row);
+                addresses.emplace(address.getId(), address);
+            }
+        }
+        
+        std::vector<Branch> branches;
+        for (const auto& row : branchResult) {
+            auto address = addresses.find(UUID::fromString(row["address_id"].c_str()));
+            if (address != addresses.end()) {
+                branches.push_back(mapResultToBranch(row, address->second));
+            }
+        }
+        
+        dbConnection_->commitTransaction(work);
+        return branches;
+        
+    } catch (const std::exception& e) {
+        throw QueryException(std::string("Failed to find branches by IDs: ") + e.what());
+    }
+}
+
+std::set<UUID> PostgreSQLBranchRepository::existsMany(const std::vector<UUID>& ids) {
+    if (ids.empty()) {
+        return {};
+    }
+    
+    try {
+        auto work = dbConnection_->beginReadTransaction();
+        
+        auto result = work.exec_prepared(STMT_EXISTS_MANY, SqlQueryBuilder::uuidArrayLiteral(ids));
+        
+        std::set<UUID> existing;
+        for (const auto& row : result) {
+            existing.insert(UUID::fromString(row["id"].c_str()));
+        }
+        
+        dbConnection_->commitTransaction(work);
+        return existing;
+        
+    } catch (const std::exception& e) {
+        throw QueryException(std::string("Failed to check branch existence: ") + e.what());
+    }
+}
+
 Branch PostgreSQLBranchRepository::mapResultToBranch(const pqxx::row& row, const BranchAddress& address) const {
     UUID id = UUID::fromString(row["id"].c_str());
     std::string name = row["name"].c_str();
@@ -420,7 +511,7 @@ void PostgreSQLBranchRepository::validateBranch(const Branch& branch) const {
     }
 }
 
-bool PostgreSQLBranchRepository::updateAddress(const BranchAddress& address, pqxx::work& work) {
+bool PostgreSQLBranchRepository::updateAddress(const BranchAddress& address, DatabaseTransaction& work) {
     try {
         std::map<std::string, std::string> values = {
             {"country", "$2"},
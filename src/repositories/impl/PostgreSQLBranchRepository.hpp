@@ -19,17 +19,22 @@ public:
     bool update(const Branch& branch) override;
     bool remove(const UUID& id) override;
     bool exists(const UUID& id) override;
+    std::vector<Branch> findByIds(const std::vector<UUID>& ids) override;
+    std::set<UUID> existsMany(const std::vector<UUID>& ids) override;
 
 private:
+    // Регистрирует запросы-поисковики в PreparedStatementRegistry (однократно на процесс)
+    static void registerPreparedStatements();
+
     std::shared_ptr<DatabaseConnection> dbConnection_;
     
     // Вспомогательные методы
-    std::optional<BranchAddress> findAddressById(const UUID& addressId, pqxx::work& work);
+    std::optional<BranchAddress> findAddressById(const UUID& addressId, DatabaseTransaction& work);
     Branch mapResultToBranch(const pqxx::row& row, const BranchAddress& address) const;
     BranchAddress mapResultToAddress(const pqxx::row& row) const;
-    void saveAddressWithUpsert(pqxx::work& work, const BranchAddress& address);
-    bool addressExists(pqxx::work& work, const UUID& addressId);
-    bool updateAddress(const BranchAddress& address, pqxx::work& work);
+    void saveAddressWithUpsert(DatabaseTransaction& work, const BranchAddress& address);
+    bool addressExists(DatabaseTransaction& work, const UUID& addressId);
+    bool updateAddress(const BranchAddress& address, DatabaseTransaction& work);
     void validateBranch(const Branch& branch) const;
 };
 
@@ -4,23 +4,72 @@
 #include "../../data/DateTimeUtils.hpp"
 #include "../../data/SqlQueryBuilder.hpp"
 #include "../../services/exceptions/ValidationException.hpp" 
+#include "../../data/PreparedStatementRegistry.hpp"
+#include "../../core/Logger.hpp"
+#include <mutex>
+
+// Именованные запросы репозитория, см. PreparedStatementRegistry
+static const char* const STMT_FIND_BY_ID = "client_find_by_id";
+static const char* const STMT_FIND_BY_EMAIL = "client_find_by_email";
+static const char* const STMT_FIND_ALL = "client_find_all";
+static const char* const STMT_COUNT = "client_count";
+static const char* const STMT_EXISTS = "client_exists";
+static const char* const STMT_FIND_BY_IDS = "client_find_by_ids";
+static const char* const STMT_EXISTS_MANY = "client_exists_many";
 
 PostgreSQLClientRepository::PostgreSQLClientRepository(
     std::shared_ptr<DatabaseConnection> dbConnection)
-    : dbConnection_(std::move(dbConnection)) {}
+    : dbConnection_(std::move(dbConnection)) {
+    registerPreparedStatements();
+}
 
-std::optional<Client> PostgreSQLClientRepository::findById(const UUID& id) {
-    try {
-        auto work = dbConnection_->beginTransaction();
-        
-        SqlQueryBuilder queryBuilder;
-        std::string query = queryBuilder
+void PostgreSQLClientRepository::registerPreparedStatements() {
+    static std::once_flag registered;
+    std::call_once(registered, []() {
+
+        auto& registry = PreparedStatementRegistry::getInstance();
+        registry.registerStatement(STMT_FIND_BY_ID, SqlQueryBuilder()
             .select({"id", "name", "email", "phone", "password_hash", "registration_date", "status"})
             .from("clients")
             .where("id = $1")
-            .build();
+            .build());
+        registry.registerStatement(STMT_FIND_BY_EMAIL, SqlQueryBuilder()
+            .select({"id", "name", "email", "phone", "password_hash", "registration_date", "status"})
+            .from("clients")
+            .where("LOWER(email) = LOWER($1)")
+            .build());
+        registry.registerStatement(STMT_FIND_ALL, SqlQueryBuilder()
+            .select({"id", "name", "email", "phone", "password_hash", "registration_date", "status"})
+            .from("clients")
+            .orderBy("registration_date", false)
+            .build());
+        registry.registerStatement(STMT_COUNT, SqlQueryBuilder()
+            .select({"COUNT(*)"})
+            .from("clients")
+            .build());
+        registry.registerStatement(STMT_EXISTS, SqlQueryBuilder()
+            .select({"1"})
+            .from("clients")
+            .where("id = $1")
+            .build());
+        registry.registerStatement(STMT_FIND_BY_IDS, SqlQueryBuilder()
+            .select({"id", "name", "email", "phone", "password_hash", "registration_date", "status"})
+            .from("clients")
+            .where("id = ANY($1::uuid[])")
+            .build());
+        registry.registerStatement(STMT_EXISTS_MANY, SqlQueryBuilder()
+            .select({"id"})
+            .from("clients")
+            .where("id = ANY($1::uuid[])")
+            .build());
+    });
+}
+
+std::optional<Client> PostgreSQLClientRepository::findById(const UUID& id) {
+    try {
+        auto work = dbConnection_->beginReadTransaction();
         
-        auto result = work.exec_params(query, id.toString());
+        auto result = work.exec_prepared(STMT_FIND_BY_ID, id.toString());
         
         if (result.empty()) {
             return std::nullopt;
@@ -36,40 +85,30 @@ std::optional<Client> PostgreSQLClientRepository::findById(const UUID& id) {
 }
 
 std::optional<Client> PostgreSQLClientRepository::findByEmail(const std::string& email) {
-    std::cout << "🔍 PostgreSQLClientRepository::findByEmail - Поиск по email: " << email << std::endl;
+    LOG_DEBUG("PostgreSQLClientRepository", "🔍 PostgreSQLClientRepository::findByEmail - Поиск по email: " << email);
     
     try {
-        auto work = dbConnection_->beginTransaction();
-        
-        SqlQueryBuilder queryBuilder;
-        std::string query = queryBuilder
-            .select({"id", "name", "email", "phone", "password_hash", "registration_date", "status"})
-            .from("clients")
-            .where("LOWER(email) = LOWER($1)")
-            .build();
+        auto work = dbConnection_->beginReadTransaction();
         
-        std::cout << "🔍 PostgreSQLClientRepository::findByEmail - SQL запрос: " << query << std::endl;
+        LOG_DEBUG("PostgreSQLClientRepository", "🔍 PostgreSQLClientRepository::findByEmail - подготовленный запрос: " << STMT_FIND_BY_EMAIL);
         
-        auto result = work.exec_params(query, email);
+        auto result = work.exec_prepared(STMT_FIND_BY_EMAIL, email);
         
         if (result.empty()) {
-            std::cout << "❌ PostgreSQLClientRepository::findByEmail - Клиент не найден в БД: " << email << std::endl;
+            LOG_DEBUG("PostgreSQLClientRepository", "❌ PostgreSQLClientRepository::findByEmail - Клиент не найден в БД: " << email);
             dbConnection_->commitTransaction(work);
             return std::nullopt;
         }
         
-        std::cout << "✅ PostgreSQLClientRepository::findByEmail - Найдена запись в БД" << std::endl;
-        std::cout << "🔍 PostgreSQLClientRepository::findByEmail - Данные из БД:" << std::endl;
-        std::cout << "   ID: " << result[0]["id"].c_str() << std::endl;
-        std::cout << "   Name: " << result[0]["name"].c_str() << std::endl;
-        std::cout << "   Email: " << result[0]["email"].c_str() << std::endl;
-        std::cout << "   Password Hash: " << result[0]["password_hash"].c_str() << std::endl;
-        std::cout << "   Status: " << result[0]["status"].c_str() << std::endl;
+        LOG_DEBUG("PostgreSQLClientRepository", "✅ PostgreSQLClientRepository::findByEmail - Найдена запись в БД");
+        // Хеш пароля в лог не выводим
+        LOG_DEBUG("PostgreSQLClientRepository", "🔍 PostgreSQLClientRepository::findByEmail - Данные из БД: ID "
+                  << result[0]["id"].c_str() << ", статус " << result[0]["status"].c_str());
         
         auto client = mapResultToClient(result[0]);
         dbConnection_->commitTransaction(work);
         
-        std::cout << "✅ PostgreSQLClientRepository::findByEmail - Успешно создан объект Client" << std::endl;
+        LOG_DEBUG("PostgreSQLClientRepository", "✅ PostgreSQLClientRepository::findByEmail - Успешно создан объект Client");
         return client;
         
     } catch (const pqxx::unique_violation& e) {
@@ -84,16 +123,9 @@ std::optional<Client> PostgreSQLClientRepository::findByEmail(const std::string&
 
 std::vector<Client> PostgreSQLClientRepository::findAll() {
     try {
-        auto work = dbConnection_->beginTransaction();
-        
-        SqlQueryBuilder queryBuilder;
-        std::string query = queryBuilder
-            .select({"id", "name", "email", "phone", "password_hash", "registration_date", "status"})
-            .from("clients")
-            .orderBy("registration_date", false)
-            .build();
+        auto work = dbConnection_->beginReadTransaction();
         
-        auto result = work.exec(query);
+        auto result = work.exec_prepared(STMT_FIND_ALL);
         
         std::vector<Client> clients;
         for (const auto& row : result) {
@@ -108,6 +140,25 @@ std::vector<Client> PostgreSQLClientRepository::findAll() {
     }
 }
 
+int PostgreSQLClientRepository::count() {
+    try {
+        auto work = dbConnection_->beginReadTransaction();
+        
+        auto result = work.exec_prepared(STMT_COUNT);
+        
+        int count = 0;
+        if (!result.empty()) {
+            count = result[0]["count"].as<int>();
+        }
+        
+        dbConnection_->commitTransaction(work);
+        return count;
+        
+    } catch (const std::exception& e) {
+        throw QueryException(std::string("Failed to count clients: ") + e.what());
+    }
+}
+
 bool PostgreSQLClientRepository::save(const Client& client) {
     validateClient(client);
     
@@ -210,16 +261,9 @@ bool PostgreSQLClientRepository::remove(const UUID& id) {
 
 bool PostgreSQLClientRepository::exists(const UUID& id) {
     try {
-        auto work = dbConnection_->beginTransaction();
+        auto work = dbConnection_->beginReadTransaction();
         
-        SqlQueryBuilder queryBuilder;
-        std::string query = queryBuilder
-            .select({"1"})
-            .from("clients")
-            .where("id = $1")
-            .build();
-            
-        auto result = work.exec_params(query, id.toString());
+        auto result = work.exec_prepared(STMT_EXISTS, id.toString());
         
         dbConnection_->commitTransaction(work);
         return !result.empty();
@@ -229,6 +273,53 @@ bool PostgreSQLClientRepository::exists(const UUID& id) {
     }
 }
 
+std::vector<Client> PostgreSQLClientRepository::findByIds(const std::vector<UUID>& ids) {
+    if (ids.empty()) {
+        return {};
+    }
+    
+    try {
+        auto work = dbConnection_->beginReadTransaction();
+        
+        auto result = work.exec_prepared(STMT_FIND_BY_IDS, SqlQueryBuilder::uuidArrayLiteral(ids));
+        
+        std::vector<Client> clients;
+        clients.reserve(result.size());
+        for (const auto& row : result) {
+            clients.push_back(mapResultToClient(row));
+        }
+        
+        dbConnection_->commitTransaction(work);
+        return clients;
+        
+    } catch (const std::exception& e) {
+        throw QueryException(std::string("Failed to find clients by IDs: ") + e.what());
+    }
+}
+
+std::set<UUID> PostgreSQLClientRepository::existsMany(const std::vector<UUID>& ids) {
+    if (ids.empty()) {
+        return {};
+    }
+    
+    try {
+        auto work = dbConnection_->beginReadTransaction();
+        
+        auto result = work.exec_prepared(STMT_EXISTS_MANY, SqlQueryBuilder::uuidArrayLiteral(ids));
+        
+        std::set<UUID> existing;
+        for (const auto& row : result) {
+            existing.insert(UUID::fromString(row["id"].c_str()));
+        }
+        
+        dbConnection_->commitTransaction(work);
+        return existing;
+        
+    } catch (const std::exception& e) {
+        throw QueryException(std::string("Failed to check client existence: ") + e.what());
+    }
+}
+
 bool PostgreSQLClientRepository::emailExists(const std::string& email) {
     try {
         auto work = dbConnection_->beginTransaction();
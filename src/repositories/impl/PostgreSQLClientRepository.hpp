@@ -14,13 +14,19 @@ public:
     std::optional<Client> findById(const UUID& id) override;
     std::optional<Client> findByEmail(const std::string& email) override;
     std::vector<Client> findAll() override;
+    int count() override;
     bool emailExists(const std::string& email);
     bool save(const Client& client) override;
     bool update(const Client& client) override;
     bool remove(const UUID& id) override;
     bool exists(const UUID& id) override;
+    std::vector<Client> findByIds(const std::vector<UUID>& ids) override;
+    std::set<UUID> existsMany(const std::vector<UUID>& ids) override;
 
 private:
+    // Регистрирует запросы-поисковики в PreparedStatementRegistry (однократно на процесс)
+    static void registerPreparedStatements();
+
     std::shared_ptr<DatabaseConnection> dbConnection_;
     
     Client mapResultToClient(const pqxx::row& row) const;
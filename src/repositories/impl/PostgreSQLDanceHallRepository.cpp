@@ -2,23 +2,66 @@
 #include <pqxx/pqxx>
 #include "../../data/SqlQueryBuilder.hpp"
 #include <iostream>
+#include "../../data/PreparedStatementRegistry.hpp"
+#include "../../core/Logger.hpp"
+#include <mutex>
+
+// Именованные запросы репозитория, см. PreparedStatementRegistry
+static const char* const STMT_FIND_BY_ID = "hall_find_by_id";
+static const char* const STMT_FIND_BY_BRANCH_ID = "hall_find_by_branch_id";
+static const char* const STMT_EXISTS = "hall_exists";
+static const char* const STMT_FIND_BY_IDS = "hall_find_by_ids";
+static const char* const STMT_EXISTS_MANY = "hall_exists_many";
+static const char* const STMT_FIND_ALL = "hall_find_all";
 
 PostgreSQLDanceHallRepository::PostgreSQLDanceHallRepository(
     std::shared_ptr<DatabaseConnection> dbConnection)
-    : dbConnection_(std::move(dbConnection)) {}
+    : dbConnection_(std::move(dbConnection)) {
+    registerPreparedStatements();
+}
 
-std::optional<DanceHall> PostgreSQLDanceHallRepository::findById(const UUID& id) {
-    try {
-        auto work = dbConnection_->beginTransaction();
-        
-        SqlQueryBuilder queryBuilder;
-        std::string query = queryBuilder
+void PostgreSQLDanceHallRepository::registerPreparedStatements() {
+    static std::once_flag registered;
+    std::call_once(registered, []() {
+
+        auto& registry = PreparedStatementRegistry::getInstance();
+        registry.registerStatement(STMT_FIND_BY_ID, SqlQueryBuilder()
             .select({"id", "name", "description", "capacity", "floor_type", "equipment", "branch_id"})
             .from("dance_halls")
             .where("id = $1")
-            .build();
+            .build());
+        registry.registerStatement(STMT_FIND_BY_BRANCH_ID, SqlQueryBuilder()
+            .select({"id", "name", "description", "capacity", "floor_type", "equipment", "branch_id"})
+            .from("dance_halls")
+            .where("branch_id = $1")
+            .build());
+        registry.registerStatement(STMT_EXISTS, SqlQueryBuilder()
+            .select({"1"})
+            .from("dance_halls")
+            .where("id = $1")
+            .build());
+        registry.registerStatement(STMT_FIND_BY_IDS, SqlQueryBuilder()
+            .select({"id", "name", "description", "capacity", "floor_type", "equipment", "branch_id"})
+            .from("dance_halls")
+            .where("id = ANY($1::uuid[])")
+            .build());
+        registry.registerStatement(STMT_EXISTS_MANY, SqlQueryBuilder()
+            .select({"id"})
+            .from("dance_halls")
+            .where("id = ANY($1::uuid[])")
+            .build());
+        registry.registerStatement(STMT_FIND_ALL, SqlQueryBuilder()
+            .select({"id", "name", "description", "capacity", "floor_type", "equipment", "branch_id"})
+            .from("dance_halls")
+            .build());
+    });
+}
+
+std::optional<DanceHall> PostgreSQLDanceHallRepository::findById(const UUID& id) {
+    try {
+        auto work = dbConnection_->beginReadTransaction();
         
-        auto result = work.exec_params(query, id.toString());
+        auto result = work.exec_prepared(STMT_FIND_BY_ID, id.toString());
         
         if (result.empty()) {
             return std::nullopt;
@@ -36,28 +79,21 @@ std::optional<DanceHall> PostgreSQLDanceHallRepository::findById(const UUID& id)
 
 std::vector<DanceHall> PostgreSQLDanceHallRepository::findByBranchId(const UUID& branchId) {
     try {
-        std::cout << "🔍 Поиск залов для филиала: " << branchId.toString() << std::endl;
+        LOG_DEBUG("PostgreSQLDanceHallRepository", "🔍 Поиск залов для филиала: " << branchId.toString());
         
-        auto work = dbConnection_->beginTransaction();
-        
-        SqlQueryBuilder queryBuilder;
-        std::string query = queryBuilder
-            .select({"id", "name", "description", "capacity", "floor_type", "equipment", "branch_id"})
-            .from("dance_halls")
-            .where("branch_id = $1")
-            .build();
+        auto work = dbConnection_->beginReadTransaction();
         
-        auto result = work.exec_params(query, branchId.toString());
+        auto result = work.exec_prepared(STMT_FIND_BY_BRANCH_ID, branchId.toString());
         
-        std::cout << "📊 Найдено записей в БД: " << result.size() << std::endl;
+        LOG_DEBUG("PostgreSQLDanceHallRepository", "📊 Найдено записей в БД: " << result.size());
         
         std::vector<DanceHall> halls;
         for (const auto& row : result) {
             try {
                 auto hall = mapResultToDanceHall(row);
                 halls.push_back(hall);
-                std::cout << "✅ Успешно создан зал: " << hall.getName() 
-                          << " (ID: " << hall.getId().toString() << ")" << std::endl;
+                LOG_DEBUG("PostgreSQLDanceHallRepository", "✅ Успешно создан зал: " << hall.getName() 
+                          << " (ID: " << hall.getId().toString() << ")");
             } catch (const std::exception& e) {
                 std::cerr << "❌ Ошибка создания зала из строки: " << e.what() << std::endl;
                 std::cerr << "   Данные строки: " << std::endl;
@@ -73,7 +109,7 @@ std::vector<DanceHall> PostgreSQLDanceHallRepository::findByBranchId(const UUID&
         }
         
         dbConnection_->commitTransaction(work);
-        std::cout << "✅ Успешно создано залов: " << halls.size() << std::endl;
+        LOG_DEBUG("PostgreSQLDanceHallRepository", "✅ Успешно создано залов: " << halls.size());
         return halls;
         
     } catch (const std::exception& e) {
@@ -84,16 +120,9 @@ std::vector<DanceHall> PostgreSQLDanceHallRepository::findByBranchId(const UUID&
 
 bool PostgreSQLDanceHallRepository::exists(const UUID& id) {
     try {
-        auto work = dbConnection_->beginTransaction();
+        auto work = dbConnection_->beginReadTransaction();
         
-        SqlQueryBuilder queryBuilder;
-        std::string query = queryBuilder
-            .select({"1"})
-            .from("dance_halls")
-            .where("id = $1")
-            .build();
-            
-        auto result = work.exec_params(query, id.toString());
+        auto result = work.exec_prepared(STMT_EXISTS, id.toString());
         
         dbConnection_->commitTransaction(work);
         return !result.empty();
@@ -103,17 +132,58 @@ bool PostgreSQLDanceHallRepository::exists(const UUID& id) {
     }
 }
 
-std::vector<DanceHall> PostgreSQLDanceHallRepository::findAll() {
+std::vector<DanceHall> PostgreSQLDanceHallRepository::findByIds(const std::vector<UUID>& ids) {
+    if (ids.empty()) {
+        return {};
+    }
+    
     try {
-        auto work = dbConnection_->beginTransaction();
+        auto work = dbConnection_->beginReadTransaction();
         
-        SqlQueryBuilder queryBuilder;
-        std::string query = queryBuilder
-            .select({"id", "name", "description", "capacity", "floor_type", "equipment", "branch_id"})
-            .from("dance_halls")
-            .build();
+        auto result = work.exec_prepared(STMT_FIND_BY_IDS, SqlQueryBuilder::uuidArrayLiteral(ids));
+        
+        std::vector<DanceHall> halls;
+        halls.reserve(result.size());
+        for (const auto& row : result) {
+            halls.push_back(mapResultToDanceHall(row));
+        }
+        
+        dbConnection_->commitTransaction(work);
+        return halls;
+        
+    } catch (const std::exception& e) {
+        throw QueryException(std::string("Failed to find dance halls by IDs: ") + e.what());
+    }
+}
+
+std::set<UUID> PostgreSQLDanceHallRepository::existsMany(const std::vector<UUID>& ids) {
+    if (ids.empty()) {
+        return {};
+    }
+    
+    try {
+        auto work = dbConnection_->beginReadTransaction();
+        
+        auto result = work.exec_prepared(STMT_EXISTS_MANY, SqlQueryBuilder::uuidArrayLiteral(ids));
+        
+        std::set<UUID> existing;
+        for (const auto& row : result) {
+            existing.insert(UUID::fromString(row["id"].c_str()));
+        }
+        
+        dbConnection_->commitTransaction(work);
+        return existing;
+        
+    } catch (const std::exception& e) {
+        throw QueryException(std::string("Failed to check hall existence: ") + e.what());
+    }
+}
+
+std::vector<DanceHall> PostgreSQLDanceHallRepository::findAll() {
+    try {
+        auto work = dbConnection_->beginReadTransaction();
         
-        auto result = work.exec(query);
+        auto result = work.exec_prepared(STMT_FIND_ALL);
         
         std::vector<DanceHall> halls;
         for (const auto& row : result) {
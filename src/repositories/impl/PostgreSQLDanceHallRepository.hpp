@@ -14,12 +14,17 @@ public:
     std::optional<DanceHall> findById(const UUID& id) override;
     std::vector<DanceHall> findByBranchId(const UUID& branchId) override;
     bool exists(const UUID& id) override;
+    std::vector<DanceHall> findByIds(const std::vector<UUID>& ids) override;
+    std::set<UUID> existsMany(const std::vector<UUID>& ids) override;
     std::vector<DanceHall> findAll() override;
     bool save(const DanceHall& hall) override;
     bool update(const DanceHall& hall) override;
     bool remove(const UUID& id) override;
 
 private:
+    // Регистрирует запросы-поисковики в PreparedStatementRegistry (однократно на процесс)
+    static void registerPreparedStatements();
+
     std::shared_ptr<DatabaseConnection> dbConnection_;
     
     DanceHall mapResultToDanceHall(const pqxx::row& row) const;
@@ -2,23 +2,78 @@
 #include "../../data/SqlQueryBuilder.hpp"
 #include "../../data/DateTimeUtils.hpp"
 #include "../../data/QueryFactory.hpp"
+#include "../../data/PreparedStatementRegistry.hpp"
+#include <mutex>
+
+// Именованные запросы репозитория, см. PreparedStatementRegistry
+static const char* const STMT_FIND_BY_ID = "enrollment_find_by_id";
+static const char* const STMT_FIND_BY_CLIENT_ID = "enrollment_find_by_client_id";
+static const char* const STMT_FIND_BY_LESSON_ID = "enrollment_find_by_lesson_id";
+static const char* const STMT_FIND_BY_CLIENT_AND_LESSON = "enrollment_find_by_client_and_lesson";
+static const char* const STMT_EXISTS = "enrollment_exists";
+static const char* const STMT_FIND_BY_IDS = "enrollment_find_by_ids";
+static const char* const STMT_EXISTS_MANY = "enrollment_exists_many";
+static const char* const STMT_FIND_ALL = "enrollment_find_all";
 
 PostgreSQLEnrollmentRepository::PostgreSQLEnrollmentRepository(
     std::shared_ptr<DatabaseConnection> dbConnection)
-    : dbConnection_(std::move(dbConnection)) {}
+    : dbConnection_(std::move(dbConnection)) {
+    registerPreparedStatements();
+}
 
-std::optional<Enrollment> PostgreSQLEnrollmentRepository::findById(const UUID& id) {
-    try {
-        auto work = dbConnection_->beginTransaction();
-        
-        SqlQueryBuilder queryBuilder;
-        std::string query = queryBuilder
+void PostgreSQLEnrollmentRepository::registerPreparedStatements() {
+    static std::once_flag registered;
+    std::call_once(registered, []() {
+        QueryFactory::registerPreparedStatements();
+
+        auto& registry = PreparedStatementRegistry::getInstance();
+        registry.registerStatement(STMT_FIND_BY_ID, SqlQueryBuilder()
             .select({"id", "client_id", "lesson_id", "status", "enrollment_date"})
             .from("enrollments")
             .where("id = $1")
-            .build();
+            .build());
+        registry.registerStatement(STMT_FIND_BY_CLIENT_ID, SqlQueryBuilder()
+            .select({"id", "client_id", "lesson_id", "status", "enrollment_date"})
+            .from("enrollments")
+            .where("client_id = $1")
+            .build());
+        registry.registerStatement(STMT_FIND_BY_LESSON_ID, SqlQueryBuilder()
+            .select({"id", "client_id", "lesson_id", "status", "enrollment_date"})
+            .from("enrollments")
+            .where("lesson_id = $1")
+            .build());
+        registry.registerStatement(STMT_FIND_BY_CLIENT_AND_LESSON, SqlQueryBuilder()
+            .select({"id", "client_id", "lesson_id", "status", "enrollment_date"})
+            .from("enrollments")
+            .where("client_id = $1 AND lesson_id = $2")
+            .build());
+        registry.registerStatement(STMT_EXISTS, SqlQueryBuilder()
+            .select({"1"})
+            .from("enrollments")
+            .where("id = $1")
+            .build());
+        registry.registerStatement(STMT_FIND_BY_IDS, SqlQueryBuilder()
+            .select({"id", "client_id", "lesson_id", "status", "enrollment_date"})
+            .from("enrollments")
+            .where("id = ANY($1::uuid[])")
+            .build());
+        registry.registerStatement(STMT_EXISTS_MANY, SqlQueryBuilder()
+            .select({"id"})
+            .from("enrollments")
+            .where("id = ANY($1::uuid[])")
+            .build());
+        registry.registerStatement(STMT_FIND_ALL, SqlQueryBuilder()
+            .select({"id", "client_id", "lesson_id", "status", "enrollment_date"})
+            .from("enrollments")
+            .build());
+    });
+}
+
+std::optional<Enrollment> PostgreSQLEnrollmentRepository::findById(const UUID& id) {
+    try {
+        auto work = dbConnection_->beginReadTransaction();
         
-        auto result = work.exec_params(query, id.toString());
+        auto result = work.exec_prepared(STMT_FIND_BY_ID, id.toString());
         
         if (result.empty()) {
             return std::nullopt;
@@ -35,16 +90,9 @@ std::optional<Enrollment> PostgreSQLEnrollmentRepository::findById(const UUID& i
 
 std::vector<Enrollment> PostgreSQLEnrollmentRepository::findByClientId(const UUID& clientId) {
     try {
-        auto work = dbConnection_->beginTransaction();
-        
-        SqlQueryBuilder queryBuilder;
-        std::string query = queryBuilder
-            .select({"id", "client_id", "lesson_id", "status", "enrollment_date"})
-            .from("enrollments")
-            .where("client_id = $1")
-            .build();
+        auto work = dbConnection_->beginReadTransaction();
         
-        auto result = work.exec_params(query, clientId.toString());
+        auto result = work.exec_prepared(STMT_FIND_BY_CLIENT_ID, clientId.toString());
         
         std::vector<Enrollment> enrollments;
         for (const auto& row : result) {
@@ -61,16 +109,9 @@ std::vector<Enrollment> PostgreSQLEnrollmentRepository::findByClientId(const UUI
 
 std::vector<Enrollment> PostgreSQLEnrollmentRepository::findByLessonId(const UUID& lessonId) {
     try {
-        auto work = dbConnection_->beginTransaction();
+        auto work = dbConnection_->beginReadTransaction();
         
-        SqlQueryBuilder queryBuilder;
-        std::string query = queryBuilder
-            .select({"id", "client_id", "lesson_id", "status", "enrollment_date"})
-            .from("enrollments")
-            .where("lesson_id = $1")
-            .build();
-        
-        auto result = work.exec_params(query, lessonId.toString());
+        auto result = work.exec_prepared(STMT_FIND_BY_LESSON_ID, lessonId.toString());
         
         std::vector<Enrollment> enrollments;
         for (const auto& row : result) {
@@ -89,16 +130,9 @@ std::optional<Enrollment> PostgreSQLEnrollmentRepository::findByClientAndLesson(
     const UUID& clientId, const UUID& lessonId) {
     
     try {
-        auto work = dbConnection_->beginTransaction();
+        auto work = dbConnection_->beginReadTransaction();
         
-        SqlQueryBuilder queryBuilder;
-        std::string query = queryBuilder
-            .select({"id", "client_id", "lesson_id", "status", "enrollment_date"})
-            .from("enrollments")
-            .where("client_id = $1 AND lesson_id = $2")
-            .build();
-        
-        auto result = work.exec_params(query, clientId.toString(), lessonId.toString());
+        auto result = work.exec_prepared(STMT_FIND_BY_CLIENT_AND_LESSON, clientId.toString(), lessonId.toString());
         
         if (result.empty()) {
             return std::nullopt;
@@ -115,10 +149,9 @@ std::optional<Enrollment> PostgreSQLEnrollmentRepository::findByClientAndLesson(
 
 int PostgreSQLEnrollmentRepository::countByLessonId(const UUID& lessonId) {
     try {
-        auto work = dbConnection_->beginTransaction();
+        auto work = dbConnection_->beginReadTransaction();
         
-        std::string query = QueryFactory::createCountEnrollmentsByLessonQuery();
-        auto result = work.exec_params(query, lessonId.toString());
+        auto result = work.exec_prepared(QueryFactory::Statements::COUNT_ENROLLMENTS_BY_LESSON, lessonId.toString());
         
         int count = 0;
         if (!result.empty()) {
@@ -227,16 +260,9 @@ bool PostgreSQLEnrollmentRepository::remove(const UUID& id) {
 
 bool PostgreSQLEnrollmentRepository::exists(const UUID& id) {
     try {
-        auto work = dbConnection_->beginTransaction();
+        auto work = dbConnection_->beginReadTransaction();
         
-        SqlQueryBuilder queryBuilder;
-        std::string query = queryBuilder
-            .select({"1"})
-            .from("enrollments")
-            .where("id = $1")
-            .build();
-            
-        auto result = work.exec_params(query, id.toString());
+        auto result = work.exec_prepared(STMT_EXISTS, id.toString());
         
         dbConnection_->commitTransaction(work);
         return !result.empty();
@@ -246,6 +272,53 @@ bool PostgreSQLEnrollmentRepository::exists(const UUID& id) {
     }
 }
 
+std::vector<Enrollment> PostgreSQLEnrollmentRepository::findByIds(const std::vector<UUID>& ids) {
+    if (ids.empty()) {
+        return {};
+    }
+    
+    try {
+        auto work = dbConnection_->beginReadTransaction();
+        
+        auto result = work.exec_prepared(STMT_FIND_BY_IDS, SqlQueryBuilder::uuidArrayLiteral(ids));
+        
+        std::vector<Enrollment> enrollments;
+        enrollments.reserve(result.size());
+        for (const auto& row : result) {
+            enrollments.push_back(mapResultToEnrollment(row));
+        }
+        
+        dbConnection_->commitTransaction(work);
+        return enrollments;
+        
+    } catch (const std::exception& e) {
+        throw QueryException(std::string("Failed to find enrollments by IDs: ") + e.what());
+    }
+}
+
+std::set<UUID> PostgreSQLEnrollmentRepository::existsMany(const std::vector<UUID>& ids) {
+    if (ids.empty()) {
+        return {};
+    }
+    
+    try {
+        auto work = dbConnection_->beginReadTransaction();
+        
+        auto result = work.exec_prepared(STMT_EXISTS_MANY, SqlQueryBuilder::uuidArrayLiteral(ids));
+        
+        std::set<UUID> existing;
+        for (const auto& row : result) {
+            existing.insert(UUID::fromString(row["id"].c_str()));
+        }
+        
+        dbConnection_->commitTransaction(work);
+        return existing;
+        
+    } catch (const std::exception& e) {
+        throw QueryException(std::string("Failed to check enrollment existence: ") + e.what());
+    }
+}
+
 Enrollment PostgreSQLEnrollmentRepository::mapResultToEnrollment(const pqxx::row& row) const {
     UUID id = UUID::fromString(row["id"].c_str());
     UUID clientId = UUID::fromString(row["client_id"].c_str());
@@ -297,15 +370,9 @@ EnrollmentStatus PostgreSQLEnrollmentRepository::stringToEnrollmentStatus(const
 
 std::vector<Enrollment> PostgreSQLEnrollmentRepository::findAll() {
     try {
-        auto work = dbConnection_->beginTransaction();
-        
-        SqlQueryBuilder queryBuilder;
-        std::string query = queryBuilder
-            .select({"id", "client_id", "lesson_id", "status", "enrollment_date"})
-            .from("enrollments")
-            .build();
+        auto work = dbConnection_->beginReadTransaction();
         
-        auto result = work.exec(query);
+        auto result = work.exec_prepared(STMT_FIND_ALL);
         
         std::vector<Enrollment> enrollments;
         for (const auto& row : result) {
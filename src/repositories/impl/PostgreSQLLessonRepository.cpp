@@ -2,17 +2,34 @@
 #include <pqxx/pqxx>
 #include "../../data/DateTimeUtils.hpp"
 #include "../../data/QueryFactory.hpp"
+#include "../../data/PreparedStatementRegistry.hpp"
+#include "../../data/SqlQueryBuilder.hpp"
+#include <mutex>
+
+// Именованные запросы репозитория, см. PreparedStatementRegistry
+static const char* const STMT_FIND_BY_ID = "lesson_find_by_id";
+static const char* const STMT_FIND_BY_TRAINER_ID = "lesson_find_by_trainer_id";
+static const char* const STMT_FIND_BY_HALL_ID = "lesson_find_by_hall_id";
+static const char* const STMT_FIND_ALL = "lesson_find_all";
+static const char* const STMT_EXISTS = "lesson_exists";
+static const char* const STMT_FIND_BY_IDS = "lesson_find_by_ids";
+static const char* const STMT_EXISTS_MANY = "lesson_exists_many";
+static const char* const STMT_FIND_BY_HALLS_AND_RANGE = "lesson_find_by_halls_and_range";
+static const char* const STMT_FIND_BY_BRANCH_AND_RANGE = "lesson_find_by_branch_and_range";
 
 PostgreSQLLessonRepository::PostgreSQLLessonRepository(
     std::shared_ptr<DatabaseConnection> dbConnection)
-    : dbConnection_(std::move(dbConnection)) {}
+    : dbConnection_(std::move(dbConnection)) {
+    registerPreparedStatements();
+}
 
-std::optional<Lesson> PostgreSQLLessonRepository::findById(const UUID& id) {
-    try {
-        auto work = dbConnection_->beginTransaction();
-        
-        SqlQueryBuilder queryBuilder;
-        std::string query = queryBuilder
+void PostgreSQLLessonRepository::registerPreparedStatements() {
+    static std::once_flag registered;
+    std::call_once(registered, []() {
+        QueryFactory::registerPreparedStatements();
+
+        auto& registry = PreparedStatementRegistry::getInstance();
+        registry.registerStatement(STMT_FIND_BY_ID, SqlQueryBuilder()
             .select({
                 "id", "type", "name", "description", "start_time", "duration_minutes",
                 "difficulty", "max_participants", "current_participants", "price", "status",
@@ -20,9 +37,87 @@ std::optional<Lesson> PostgreSQLLessonRepository::findById(const UUID& id) {
             })
             .from("lessons")
             .where("id = $1")
-            .build();
+            .build());
+        registry.registerStatement(STMT_FIND_BY_TRAINER_ID, SqlQueryBuilder()
+            .select({
+                "id", "type", "name", "description", "start_time", "duration_minutes",
+                "difficulty", "max_participants", "current_participants", "price", "status",
+                "trainer_id", "hall_id"
+            })
+            .from("lessons")
+            .where("trainer_id = $1")
+            .build());
+        registry.registerStatement(STMT_FIND_BY_HALL_ID, SqlQueryBuilder()
+            .select({
+                "id", "type", "name", "description", "start_time", "duration_minutes",
+                "difficulty", "max_participants", "current_participants", "price", "status",
+                "trainer_id", "hall_id"
+            })
+            .from("lessons")
+            .where("hall_id = $1")
+            .build());
+        registry.registerStatement(STMT_FIND_ALL, SqlQueryBuilder()
+            .select({
+                "id", "type", "name", "description", "start_time", "duration_minutes",
+                "difficulty", "max_participants", "current_participants", "price", "status",
+                "trainer_id", "hall_id"
+            })
+            .from("lessons")
+            .orderBy("start_time", false)
+            .build());
+        registry.registerStatement(STMT_EXISTS, SqlQueryBuilder()
+            .select({"1"})
+            .from("lessons")
+            .where("id = $1")
+            .build());
+        registry.registerStatement(STMT_FIND_BY_IDS, SqlQueryBuilder()
+            .select({
+                "id", "type", "name", "description", "start_time", "duration_minutes",
+                "difficulty", "max_participants", "current_participants", "price", "status",
+                "trainer_id", "hall_id"
+            })
+            .from("lessons")
+            .where("id = ANY($1::uuid[])")
+            .build());
+        registry.registerStatement(STMT_EXISTS_MANY, SqlQueryBuilder()
+            .select({"id"})
+            .from("lessons")
+            .where("id = ANY($1::uuid[])")
+            .build());
+        registry.registerStatement(STMT_FIND_BY_HALLS_AND_RANGE, SqlQueryBuilder()
+            .select({
+                "id", "type", "name", "description", "start_time", "duration_minutes",
+                "difficulty", "max_participants", "current_participants", "price", "status",
+                "trainer_id", "hall_id"
+            })
+            .from("lessons")
+            .where("hall_id = ANY($1::uuid[])")
+            .andWhere("start_time >= $2::timestamp")
+            .andWhere("start_time <= $3::timestamp")
+            .orderBy("start_time")
+            .build());
+        // Залы филиала - в соединении, без отдельного запроса к dance_halls
+        registry.registerStatement(STMT_FIND_BY_BRANCH_AND_RANGE, SqlQueryBuilder()
+            .select({
+                "l.id", "l.type", "l.name", "l.description", "l.start_time", "l.duration_minutes",
+                "l.difficulty", "l.max_participants", "l.current_participants", "l.price", "l.status",
+                "l.trainer_id", "l.hall_id"
+            })
+            .from("lessons l")
+            .innerJoin("dance_halls h", "h.id = l.hall_id")
+            .where("h.branch_id = $1")
+            .andWhere("l.start_time >= $2::timestamp")
+            .andWhere("l.start_time <= $3::timestamp")
+            .orderBy("l.start_time")
+            .build());
+    });
+}
+
+std::optional<Lesson> PostgreSQLLessonRepository::findById(const UUID& id) {
+    try {
+        auto work = dbConnection_->beginReadTransaction();
         
-        auto result = work.exec_params(query, id.toString());
+        auto result = work.exec_prepared(STMT_FIND_BY_ID, id.toString());
         
         if (result.empty()) {
             return std::nullopt;
@@ -39,20 +134,9 @@ std::optional<Lesson> PostgreSQLLessonRepository::findById(const UUID& id) {
 
 std::vector<Lesson> PostgreSQLLessonRepository::findByTrainerId(const UUID& trainerId) {
     try {
-        auto work = dbConnection_->beginTransaction();
-        
-        SqlQueryBuilder queryBuilder;
-        std::string query = queryBuilder
-            .select({
-                "id", "type", "name", "description", "start_time", "duration_minutes",
-                "difficulty", "max_participants", "current_participants", "price", "status",
-                "trainer_id", "hall_id"
-            })
-            .from("lessons")
-            .where("trainer_id = $1")
-            .build();
+        auto work = dbConnection_->beginReadTransaction();
         
-        auto result = work.exec_params(query, trainerId.toString());
+        auto result = work.exec_prepared(STMT_FIND_BY_TRAINER_ID, trainerId.toString());
         
         std::vector<Lesson> lessons;
         for (const auto& row : result) {
@@ -69,20 +153,9 @@ std::vector<Lesson> PostgreSQLLessonRepository::findByTrainerId(const UUID& trai
 
 std::vector<Lesson> PostgreSQLLessonRepository::findByHallId(const UUID& hallId) {
     try {
-        auto work = dbConnection_->beginTransaction();
-        
-        SqlQueryBuilder queryBuilder;
-        std::string query = queryBuilder
-            .select({
-                "id", "type", "name", "description", "start_time", "duration_minutes",
-                "difficulty", "max_participants", "current_participants", "price", "status",
-                "trainer_id", "hall_id"
-            })
-            .from("lessons")
-            .where("hall_id = $1")
-            .build();
+        auto work = dbConnection_->beginReadTransaction();
         
-        auto result = work.exec_params(query, hallId.toString());
+        auto result = work.exec_prepared(STMT_FIND_BY_HALL_ID, hallId.toString());
         
         std::vector<Lesson> lessons;
         for (const auto& row : result) {
@@ -101,12 +174,11 @@ std::vector<Lesson> PostgreSQLLessonRepository::findConflictingLessons(
     const UUID& hallId, const TimeSlot& timeSlot) {
     
     try {
-        auto work = dbConnection_->beginTransaction();
+        auto work = dbConnection_->beginReadTransaction();
         
-        std::string query = QueryFactory::createFindConflictingLessonsQuery();
         auto startTimeStr = DateTimeUtils::formatTimeForPostgres(timeSlot.getStartTime());
-        auto result = work.exec_params(
-            query, 
+        auto result = work.exec_prepared(
+            QueryFactory::Statements::FIND_CONFLICTING_LESSONS, 
             hallId.toString(),
             startTimeStr,
             timeSlot.getDurationMinutes()
@@ -125,12 +197,110 @@ std::vector<Lesson> PostgreSQLLessonRepository::findConflictingLessons(
     }
 }
 
+std::vector<Lesson> PostgreSQLLessonRepository::findConflictingLessonsInRange(
+    const std::vector<UUID>& hallIds,
+    const std::chrono::system_clock::time_point& from,
+    const std::chrono::system_clock::time_point& to) {
+    
+    if (hallIds.empty() || !(from < to)) {
+        return {};
+    }
+    
+    try {
+        auto work = dbConnection_->beginReadTransaction();
+        
+        auto result = work.exec_prepared(
+            QueryFactory::Statements::FIND_CONFLICTING_LESSONS_IN_RANGE,
+            SqlQueryBuilder::uuidArrayLiteral(hallIds),
+            DateTimeUtils::formatTimeForPostgres(from),
+            DateTimeUtils::formatTimeForPostgres(to)
+        );
+        
+        std::vector<Lesson> lessons;
+        lessons.reserve(result.size());
+        for (const auto& row : result) {
+            lessons.push_back(mapResultToLesson(row));
+        }
+
+        dbConnection_->commitTransaction(work);
+        return lessons;
+        
+    } catch (const std::exception& e) {
+        throw QueryException(std::string("Failed to find conflicting lessons in range: ") + e.what());
+    }
+}
+
+std::vector<Lesson> PostgreSQLLessonRepository::findByHallsAndRange(
+    const std::vector<UUID>& hallIds,
+    const std::chrono::system_clock::time_point& from,
+    const std::chrono::system_clock::time_point& to) {
+    
+    if (hallIds.empty() || to < from) {
+        return {};
+    }
+    
+    try {
+        auto work = dbConnection_->beginReadTransaction();
+        
+        auto result = work.exec_prepared(
+            STMT_FIND_BY_HALLS_AND_RANGE,
+            SqlQueryBuilder::uuidArrayLiteral(hallIds),
+            DateTimeUtils::formatTimeForPostgres(from),
+            DateTimeUtils::formatTimeForPostgres(to)
+        );
+        
+        std::vector<Lesson> lessons;
+        lessons.reserve(result.size());
+        for (const auto& row : result) {
+            lessons.push_back(mapResultToLesson(row));
+        }
+        
+        dbConnection_->commitTransaction(work);
+        return lessons;
+        
+    } catch (const std::exception& e) {
+        throw QueryException(std::string("Failed to find lessons by halls and range: ") + e.what());
+    }
+}
+
+std::vector<Lesson> PostgreSQLLessonRepository::findByBranchAndRange(
+    const UUID& branchId,
+    const std::chrono::system_clock::time_point& from,
+    const std::chrono::system_clock::time_point& to) {
+    
+    if (to < from) {
+        return {};
+    }
+    
+    try {
+        auto work = dbConnection_->beginReadTransaction();
+        
+        auto result = work.exec_prepared(
+            STMT_FIND_BY_BRANCH_AND_RANGE,
+            branchId.toString(),
+            DateTimeUtils::formatTimeForPostgres(from),
+            DateTimeUtils::formatTimeForPostgres(to)
+        );
+        
+        std::vector<Lesson> lessons;
+        lessons.reserve(result.size());
+        for (const auto& row : result) {
+            lessons.push_back(mapResultToLesson(row));
+        }
+        
+        dbConnection_->commitTransaction(work);
+        return lessons;
+        
+    } catch (const std::exception& e) {
+        throw QueryException(std::string("Failed to find lessons by branch and range: ") + e.what());
+    }
+}
+
 std::vector<Lesson> PostgreSQLLessonRepository::findUpcomingLessons(int days) {
     try {
-        auto work = dbConnection_->beginTransaction();
+        auto work = dbConnection_->beginReadTransaction();
         
-        std::string query = QueryFactory::createFindUpcomingLessonsQuery();
-        auto result = work.exec_params(query, days);
+        auto result = work.exec_prepared(QueryFactory::Statements::FIND_UPCOMING_LESSONS, days);
         
         std::vector<Lesson> lessons;
         for (const auto& row : result) {
@@ -147,20 +317,9 @@ std::vector<Lesson> PostgreSQLLessonRepository::findUpcomingLessons(int days) {
 
 std::vector<Lesson> PostgreSQLLessonRepository::findAll() {
     try {
-        auto work = dbConnection_->beginTransaction();
+        auto work = dbConnection_->beginReadTransaction();
         
-        SqlQueryBuilder queryBuilder;
-        std::string query = queryBuilder
-            .select({
-                "id", "type", "name", "description", "start_time", "duration_minutes",
-                "difficulty", "max_participants", "current_participants", "price", "status",
-                "trainer_id", "hall_id"
-            })
-            .from("lessons")
-            .orderBy("start_time", false)
-            .build();
-        
-        auto result = work.exec(query);
+        auto result = work.exec_prepared(STMT_FIND_ALL);
         
         std::vector<Lesson> lessons;
         for (const auto& row : result) {
@@ -303,16 +462,9 @@ bool PostgreSQLLessonRepository::remove(const UUID& id) {
 
 bool PostgreSQLLessonRepository::exists(const UUID& id) {
     try {
-        auto work = dbConnection_->beginTransaction();
+        auto work = dbConnection_->beginReadTransaction();
         
-        SqlQueryBuilder queryBuilder;
-        std::string query = queryBuilder
-            .select({"1"})
-            .from("lessons")
-            .where("id = $1")
-            .build();
-            
-        auto result = work.exec_params(query, id.toString());
+        auto result = work.exec_prepared(STMT_EXISTS, id.toString());
         
         dbConnection_->commitTransaction(work);
         return !result.empty();
@@ -322,6 +474,53 @@ bool PostgreSQLLessonRepository::exists(const UUID& id) {
     }
 }
 
+std::vector<Lesson> PostgreSQLLessonRepository::findByIds(const std::vector<UUID>& ids) {
+    if (ids.empty()) {
+        return {};
+    }
+    
+    try {
+        auto work = dbConnection_->beginReadTransaction();
+        
+        auto result = work.exec_prepared(STMT_FIND_BY_IDS, SqlQueryBuilder::uuidArrayLiteral(ids));
+        
+        std::vector<Lesson> lessons;
+        lessons.reserve(result.size());
+        for (const auto& row : result) {
+            lessons.push_back(mapResultToLesson(row));
+        }
+        
+        dbConnection_->commitTransaction(work);
+        return lessons;
+        
+    } catch (const std::exception& e) {
+        throw QueryException(std::string("Failed to find lessons by IDs: ") + e.what());
+    }
+}
+
+std::set<UUID> PostgreSQLLessonRepository::existsMany(const std::vector<UUID>& ids) {
+    if (ids.empty()) {
+        return {};
+    }
+    
+    try {
+        auto work = dbConnection_->beginReadTransaction();
+        
+        auto result = work.exec_prepared(STMT_EXISTS_MANY, SqlQueryBuilder::uuidArrayLiteral(ids));
+        
+        std::set<UUID> existing;
+        for (const auto& row : result) {
+            existing.insert(UUID::fromString(row["id"].c_str()));
+        }
+        
+        dbConnection_->commitTransaction(work);
+        return existing;
+        
+    } catch (const std::exception& e) {
+        throw QueryException(std::string("Failed to check lesson existence: ") + e.what());
+    }
+}
+
 Lesson PostgreSQLLessonRepository::mapResultToLesson(const pqxx::row& row) const {
     UUID id = UUID::fromString(row["id"].c_str());
     
@@ -15,14 +15,28 @@ public:
     std::vector<Lesson> findByTrainerId(const UUID& trainerId) override;
     std::vector<Lesson> findByHallId(const UUID& hallId) override;
     std::vector<Lesson> findConflictingLessons(const UUID& hallId, const TimeSlot& timeSlot) override;
+    std::vector<Lesson> findConflictingLessonsInRange(const std::vector<UUID>& hallIds,
+                                                      const std::chrono::system_clock::time_point& from,
+                                                      const std::chrono::system_clock::time_point& to) override;
+    std::vector<Lesson> findByHallsAndRange(const std::vector<UUID>& hallIds,
+                                            const std::chrono::system_clock::time_point& from,
+                                            const std::chrono::system_clock::time_point& to) override;
+    std::vector<Lesson> findByBranchAndRange(const UUID& branchId,
+                                             const std::chrono::system_clock::time_point& from,
+                                             const std::chrono::system_clock::time_point& to) override;
     std::vector<Lesson> findUpcomingLessons(int days = 7) override;
     std::vector<Lesson> findAll() override;
     bool save(const Lesson& lesson) override;
     bool update(const Lesson& lesson) override;
     bool remove(const UUID& id) override;
     bool exists(const UUID& id) override;
+    std::vector<Lesson> findByIds(const std::vector<UUID>& ids) override;
+    std::set<UUID> existsMany(const std::vector<UUID>& ids) override;
 
 private:
+    // Регистрирует запросы-поисковики в PreparedStatementRegistry (однократно на процесс)
+    static void registerPreparedStatements();
+
     std::shared_ptr<DatabaseConnection> dbConnection_;
     
     Lesson mapResultToLesson(const pqxx::row& row) const;
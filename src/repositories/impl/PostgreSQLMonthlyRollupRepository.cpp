@@ -0,0 +1,189 @@
+#include "PostgreSQLMonthlyRollupRepository.hpp"
+#include <pqxx/pqxx>
+#include "../../data/PreparedStatementRegistry.hpp"
+#include <cstdio>
+#include <mutex>
+
+// Именованные запросы репозитория, см. PreparedStatementRegistry
+static const char* const STMT_INCREMENT = "monthly_rollups_increment";
+static const char* const STMT_FIND_BY_MONTH_RANGE = "monthly_rollups_find_by_month_range";
+static const char* const STMT_DELETE_MONTH = "monthly_rollups_delete_month";
+static const char* const STMT_REBUILD_MONTH = "monthly_rollups_rebuild_month";
+static const char* const STMT_GET_CURSOR = "rollup_jobs_get_cursor";
+static const char* const STMT_SAVE_CURSOR = "rollup_jobs_save_cursor";
+
+// Пересчет месяца одним запросом: $1 - первое число месяца, $2 - нулевой UUID для метрик без филиала.
+// Филиал занятия и бронирования определяется через зал; посещаемость относится к месяцу scheduled_time
+static const char* const REBUILD_MONTH_SQL = R"(
+            INSERT INTO monthly_rollups (month, branch_id, metric, value)
+            SELECT $1::date, computed.branch_id, computed.metric, computed.value
+            FROM (
+                SELECT h.branch_id,
+                       CASE WHEN l.status = 'COMPLETED' THEN 'lessons_held' ELSE 'lessons_cancelled' END AS metric,
+                       COUNT(*)::numeric AS value
+                FROM lessons l
+                JOIN dance_halls h ON h.id = l.hall_id
+                WHERE l.start_time >= $1::date AND l.start_time < $1::date + INTERVAL '1 month'
+                  AND l.status IN ('COMPLETED', 'CANCELLED')
+                GROUP BY 1, 2
+
+                UNION ALL
+
+                SELECT h.branch_id, m.metric, COUNT(*)::numeric
+                FROM attendance a
+                LEFT JOIN lessons l ON a.type = 'LESSON' AND l.id = a.entity_id
+                LEFT JOIN bookings b ON a.type = 'BOOKING' AND b.id = a.entity_id
+                JOIN dance_halls h ON h.id = COALESCE(l.hall_id, b.hall_id)
+                CROSS JOIN LATERAL (VALUES
+                    (CASE WHEN a.type = 'BOOKING' AND a.status = 'VISITED' THEN 'bookings_used' END),
+                    (CASE WHEN a.type = 'BOOKING' AND a.status = 'CANCELLED' THEN 'bookings_cancelled' END),
+                    (CASE WHEN a.status = 'VISITED' THEN 'attendance_visited' END),
+                    (CASE WHEN a.status IN ('VISITED', 'CANCELLED', 'NO_SHOW') THEN 'attendance_resolved' END)
+                ) AS m(metric)
+                WHERE m.metric IS NOT NULL
+                  AND a.scheduled_time >= $1::date AND a.scheduled_time < $1::date + INTERVAL '1 month'
+                GROUP BY 1, 2
+
+                UNION ALL
+
+                SELECT $2::uuid, 'new_clients', COUNT(*)::numeric
+                FROM clients
+                WHERE registration_date >= $1::date AND registration_date < $1::date + INTERVAL '1 month'
+                HAVING COUNT(*) > 0
+
+                UNION ALL
+
+                SELECT $2::uuid, 'subscription_revenue', SUM(t.price)
+                FROM subscriptions s
+                JOIN subscription_types t ON t.id = s.subscription_type_id
+                WHERE s.purchase_date >= $1::date AND s.purchase_date < $1::date + INTERVAL '1 month'
+                HAVING COUNT(*) > 0
+            ) AS computed
+)";
+
+static const std::string ZERO_UUID = "00000000-0000-0000-0000-000000000000";
+
+// Первое число месяца в виде, пригодном для ::date
+static std::string monthToDate(const YearMonth& month) {
+    return month.toString() + "-01";
+}
+
+// Разбирает дату YYYY-MM-DD, возвращенную PostgreSQL
+static YearMonth dateToMonth(const char* date) {
+    YearMonth month;
+    if (std::sscanf(date, "%d-%d", &month.year, &month.month) != 2) {
+        throw QueryException(std::string("Unexpected month value: ") + date);
+    }
+    return month;
+}
+
+PostgreSQLMonthlyRollupRepository::PostgreSQLMonthlyRollupRepository(
+    std::shared_ptr<DatabaseConnection> dbConnection)
+    : dbConnection_(std::move(dbConnection)) {
+    registerPreparedStatements();
+}
+
+void PostgreSQLMonthlyRollupRepository::registerPreparedStatements() {
+    static std::once_flag registered;
+    std::call_once(registered, []() {
+        auto& registry = PreparedStatementRegistry::getInstance();
+        // Конкурентные инкременты одной строки сериализуются блокировкой строки, а не чтением-записью в приложении
+        registry.registerStatement(STMT_INCREMENT, R"(
+            INSERT INTO monthly_rollups (month, branch_id, metric, value)
+            VALUES ($1::date, $2::uuid, $3, $4::numeric)
+            ON CONFLICT (month, branch_id, metric)
+            DO UPDATE SET value = monthly_rollups.value + EXCLUDED.value
+        )");
+        registry.registerStatement(STMT_FIND_BY_MONTH_RANGE, R"(
+            SELECT month::text AS month, branch_id, metric, value::float8 AS value
+            FROM monthly_rollups
+            WHERE month BETWEEN $1::date AND $2::date
+            ORDER BY month, branch_id, metric
+        )");
+        registry.registerStatement(STMT_DELETE_MONTH, "DELETE FROM monthly_rollups WHERE month = $1::date");
+        registry.registerStatement(STMT_REBUILD_MONTH, REBUILD_MONTH_SQL);
+        registry.registerStatement(STMT_GET_CURSOR,
+            "SELECT last_month::text AS last_month FROM rollup_jobs WHERE job_name = $1");
+        registry.registerStatement(STMT_SAVE_CURSOR, R"(
+            INSERT INTO rollup_jobs (job_name, last_month, updated_at)
+            VALUES ($1, $2::date, CURRENT_TIMESTAMP)
+            ON CONFLICT (job_name)
+            DO UPDATE SET last_month = EXCLUDED.last_month, updated_at = EXCLUDED.updated_at
+        )");
+    });
+}
+
+void PostgreSQLMonthlyRollupRepository::increment(const YearMonth& month, const UUID& branchId,
+                                                  const std::string& metric, double delta) {
+    try {
+        auto work = dbConnection_->beginTransaction();
+        work.exec_prepared(STMT_INCREMENT, monthToDate(month), branchId.toString(), metric, delta);
+        dbConnection_->commitTransaction(work);
+    } catch (const std::exception& e) {
+        throw QueryException(std::string("Failed to increment monthly rollup: ") + e.what());
+    }
+}
+
+std::vector<MonthlyRollupEntry> PostgreSQLMonthlyRollupRepository::findByMonthRange(
+    const YearMonth& from, const YearMonth& to) {
+    try {
+        auto work = dbConnection_->beginReadTransaction();
+        auto result = work.exec_prepared(STMT_FIND_BY_MONTH_RANGE, monthToDate(from), monthToDate(to));
+
+        std::vector<MonthlyRollupEntry> entries;
+        entries.reserve(result.size());
+        for (const auto& row : result) {
+            MonthlyRollupEntry entry;
+            entry.month = dateToMonth(row["month"].c_str());
+            entry.branchId = UUID::fromString(row["branch_id"].c_str());
+            entry.metric = row["metric"].c_str();
+            entry.value = row["value"].as<double>();
+            entries.push_back(std::move(entry));
+        }
+
+        dbConnection_->commitTransaction(work);
+        return entries;
+    } catch (const std::exception& e) {
+        throw QueryException(std::string("Failed to find monthly rollups: ") + e.what());
+    }
+}
+
+void PostgreSQLMonthlyRollupRepository::rebuildMonth(const YearMonth& month) {
+    try {
+        // Удаление и вставка в одной транзакции: читатели видят либо старые, либо новые значения
+        auto work = dbConnection_->beginTransaction();
+        auto monthDate = monthToDate(month);
+        work.exec_prepared(STMT_DELETE_MONTH, monthDate);
+        work.exec_prepared(STMT_REBUILD_MONTH, monthDate, ZERO_UUID);
+        dbConnection_->commitTransaction(work);
+    } catch (const std::exception& e) {
+        throw QueryException(std::string("Failed to rebuild monthly rollups for ") + month.toString() + ": " + e.what());
+    }
+}
+
+std::optional<YearMonth> PostgreSQLMonthlyRollupRepository::getBackfillCursor(const std::string& jobName) {
+    try {
+        auto work = dbConnection_->beginReadTransaction();
+        auto result = work.exec_prepared(STMT_GET_CURSOR, jobName);
+
+        std::optional<YearMonth> cursor;
+        if (!result.empty()) {
+            cursor = dateToMonth(result[0]["last_month"].c_str());
+        }
+
+        dbConnection_->commitTransaction(work);
+        return cursor;
+    } catch (const std::exception& e) {
+        throw QueryException(std::string("Failed to read rollup job cursor: ") + e.what());
+    }
+}
+
+void PostgreSQLMonthlyRollupRepository::saveBackfillCursor(const std::string& jobName, const YearMonth& month) {
+    try {
+        auto work = dbConnection_->beginTransaction();
+        work.exec_prepared(STMT_SAVE_CURSOR, jobName, monthToDate(month));
+        dbConnection_->commitTransaction(work);
+    } catch (const std::exception& e) {
+        throw QueryException(std::string("Failed to save rollup job cursor: ") + e.what());
+    }
+}
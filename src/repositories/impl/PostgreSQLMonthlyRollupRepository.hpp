@@ -0,0 +1,27 @@
+#ifndef POSTGRESQL_MONTHLY_ROLLUP_REPOSITORY_HPP
+#define POSTGRESQL_MONTHLY_ROLLUP_REPOSITORY_HPP
+
+#include "../IMonthlyRollupRepository.hpp"
+#include "../../data/DatabaseConnection.hpp"
+#include "../../data/exceptions/DataAccessException.hpp"
+#include <memory>
+
+class PostgreSQLMonthlyRollupRepository : public IMonthlyRollupRepository {
+public:
+    explicit PostgreSQLMonthlyRollupRepository(std::shared_ptr<DatabaseConnection> dbConnection);
+
+    void increment(const YearMonth& month, const UUID& branchId,
+                   const std::string& metric, double delta) override;
+    std::vector<MonthlyRollupEntry> findByMonthRange(const YearMonth& from, const YearMonth& to) override;
+    void rebuildMonth(const YearMonth& month) override;
+    std::optional<YearMonth> getBackfillCursor(const std::string& jobName) override;
+    void saveBackfillCursor(const std::string& jobName, const YearMonth& month) override;
+
+private:
+    // Регистрирует запросы в PreparedStatementRegistry (однократно на процесс)
+    static void registerPreparedStatements();
+
+    std::shared_ptr<DatabaseConnection> dbConnection_;
+};
+
+#endif // POSTGRESQL_MONTHLY_ROLLUP_REPOSITORY_HPP
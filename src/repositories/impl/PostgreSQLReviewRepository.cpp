@@ -2,23 +2,85 @@
 #include "../../data/SqlQueryBuilder.hpp"
 #include "../../data/DateTimeUtils.hpp"
 #include "../../data/QueryFactory.hpp"
+#include "../../data/PreparedStatementRegistry.hpp"
+#include <mutex>
+
+// Именованные запросы репозитория, см. PreparedStatementRegistry
+static const char* const STMT_FIND_BY_ID = "review_find_by_id";
+static const char* const STMT_FIND_BY_CLIENT_ID = "review_find_by_client_id";
+static const char* const STMT_FIND_BY_LESSON_ID = "review_find_by_lesson_id";
+static const char* const STMT_FIND_BY_CLIENT_AND_LESSON = "review_find_by_client_and_lesson";
+static const char* const STMT_FIND_PENDING_MODERATION = "review_find_pending_moderation";
+static const char* const STMT_FIND_ALL = "review_find_all";
+static const char* const STMT_EXISTS = "review_exists";
+static const char* const STMT_FIND_BY_IDS = "review_find_by_ids";
+static const char* const STMT_EXISTS_MANY = "review_exists_many";
 
 PostgreSQLReviewRepository::PostgreSQLReviewRepository(
     std::shared_ptr<DatabaseConnection> dbConnection)
-    : dbConnection_(std::move(dbConnection)) {}
+    : dbConnection_(std::move(dbConnection)) {
+    registerPreparedStatements();
+}
 
-std::optional<Review> PostgreSQLReviewRepository::findById(const UUID& id) {
-    try {
-        auto work = dbConnection_->beginTransaction();
-        
-        SqlQueryBuilder queryBuilder;
-        std::string query = queryBuilder
+void PostgreSQLReviewRepository::registerPreparedStatements() {
+    static std::once_flag registered;
+    std::call_once(registered, []() {
+        QueryFactory::registerPreparedStatements();
+
+        auto& registry = PreparedStatementRegistry::getInstance();
+        registry.registerStatement(STMT_FIND_BY_ID, SqlQueryBuilder()
             .select({"id", "client_id", "lesson_id", "rating", "comment", "publication_date", "status"})
             .from("reviews")
             .where("id = $1")
-            .build();
+            .build());
+        registry.registerStatement(STMT_FIND_BY_CLIENT_ID, SqlQueryBuilder()
+            .select({"id", "client_id", "lesson_id", "rating", "comment", "publication_date", "status"})
+            .from("reviews")
+            .where("client_id = $1")
+            .build());
+        registry.registerStatement(STMT_FIND_BY_LESSON_ID, SqlQueryBuilder()
+            .select({"id", "client_id", "lesson_id", "rating", "comment", "publication_date", "status"})
+            .from("reviews")
+            .where("lesson_id = $1")
+            .build());
+        registry.registerStatement(STMT_FIND_BY_CLIENT_AND_LESSON, SqlQueryBuilder()
+            .select({"id", "client_id", "lesson_id", "rating", "comment", "publication_date", "status"})
+            .from("reviews")
+            .where("client_id = $1 AND lesson_id = $2")
+            .build());
+        registry.registerStatement(STMT_FIND_PENDING_MODERATION, SqlQueryBuilder()
+            .select({"id", "client_id", "lesson_id", "rating", "comment", "publication_date", "status"})
+            .from("reviews")
+            .where("status = 'PENDING_MODERATION'")
+            .build());
+        registry.registerStatement(STMT_FIND_ALL, SqlQueryBuilder()
+            .select({"id", "client_id", "lesson_id", "rating", "comment", "publication_date", "status"})
+            .from("reviews")
+            .orderBy("publication_date", false)
+            .build());
+        registry.registerStatement(STMT_EXISTS, SqlQueryBuilder()
+            .select({"1"})
+            .from("reviews")
+            .where("id = $1")
+            .build());
+        registry.registerStatement(STMT_FIND_BY_IDS, SqlQueryBuilder()
+            .select({"id", "client_id", "lesson_id", "rating", "comment", "publication_date", "status"})
+            .from("reviews")
+            .where("id = ANY($1::uuid[])")
+            .build());
+        registry.registerStatement(STMT_EXISTS_MANY, SqlQueryBuilder()
+            .select({"id"})
+            .from("reviews")
+            .where("id = ANY($1::uuid[])")
+            .build());
+    });
+}
+
+std::optional<Review> PostgreSQLReviewRepository::findById(const UUID& id) {
+    try {
+        auto work = dbConnection_->beginReadTransaction();
         
-        auto result = work.exec_params(query, id.toString());
+        auto result = work.exec_prepared(STMT_FIND_BY_ID, id.toString());
         
         if (result.empty()) {
             return std::nullopt;
@@ -35,16 +97,9 @@ std::optional<Review> PostgreSQLReviewRepository::findById(const UUID& id) {
 
 std::vector<Review> PostgreSQLReviewRepository::findByClientId(const UUID& clientId) {
     try {
-        auto work = dbConnection_->beginTransaction();
+        auto work = dbConnection_->beginReadTransaction();
         
-        SqlQueryBuilder queryBuilder;
-        std::string query = queryBuilder
-            .select({"id", "client_id", "lesson_id", "rating", "comment", "publication_date", "status"})
-            .from("reviews")
-            .where("client_id = $1")
-            .build();
-        
-        auto result = work.exec_params(query, clientId.toString());
+        auto result = work.exec_prepared(STMT_FIND_BY_CLIENT_ID, clientId.toString());
         
         std::vector<Review> reviews;
         for (const auto& row : result) {
@@ -61,16 +116,9 @@ std::vector<Review> PostgreSQLReviewRepository::findByClientId(const UUID& clien
 
 std::vector<Review> PostgreSQLReviewRepository::findByLessonId(const UUID& lessonId) {
     try {
-        auto work = dbConnection_->beginTransaction();
+        auto work = dbConnection_->beginReadTransaction();
         
-        SqlQueryBuilder queryBuilder;
-        std::string query = queryBuilder
-            .select({"id", "client_id", "lesson_id", "rating", "comment", "publication_date", "status"})
-            .from("reviews")
-            .where("lesson_id = $1")
-            .build();
-        
-        auto result = work.exec_params(query, lessonId.toString());
+        auto result = work.exec_prepared(STMT_FIND_BY_LESSON_ID, lessonId.toString());
         
         std::vector<Review> reviews;
         for (const auto& row : result) {
@@ -89,16 +137,9 @@ std::optional<Review> PostgreSQLReviewRepository::findByClientAndLesson(
     const UUID& clientId, const UUID& lessonId) {
     
     try {
-        auto work = dbConnection_->beginTransaction();
-        
-        SqlQueryBuilder queryBuilder;
-        std::string query = queryBuilder
-            .select({"id", "client_id", "lesson_id", "rating", "comment", "publication_date", "status"})
-            .from("reviews")
-            .where("client_id = $1 AND lesson_id = $2")
-            .build();
+        auto work = dbConnection_->beginReadTransaction();
         
-        auto result = work.exec_params(query, clientId.toString(), lessonId.toString());
+        auto result = work.exec_prepared(STMT_FIND_BY_CLIENT_AND_LESSON, clientId.toString(), lessonId.toString());
         
         if (result.empty()) {
             return std::nullopt;
@@ -115,15 +156,8 @@ std::optional<Review> PostgreSQLReviewRepository::findByClientAndLesson(
 
 std::vector<Review> PostgreSQLReviewRepository::findPendingModeration() {
     try {
-        auto work = dbConnection_->beginTransaction();
-        SqlQueryBuilder queryBuilder;
-        std::string query = queryBuilder
-            .select({"id", "client_id", "lesson_id", "rating", "comment", "publication_date", "status"})
-            .from("reviews")
-            .where("status = 'PENDING_MODERATION'")
-            .build();
-        
-        auto result = work.exec(query);
+        auto work = dbConnection_->beginReadTransaction();
+        auto result = work.exec_prepared(STMT_FIND_PENDING_MODERATION);
         
         std::vector<Review> reviews;
         for (const auto& row : result) {
@@ -140,16 +174,9 @@ std::vector<Review> PostgreSQLReviewRepository::findPendingModeration() {
 
 std::vector<Review> PostgreSQLReviewRepository::findAll() {
     try {
-        auto work = dbConnection_->beginTransaction();
-        
-        SqlQueryBuilder queryBuilder;
-        std::string query = queryBuilder
-            .select({"id", "client_id", "lesson_id", "rating", "comment", "publication_date", "status"})
-            .from("reviews")
-            .orderBy("publication_date", false)
-            .build();
+        auto work = dbConnection_->beginReadTransaction();
         
-        auto result = work.exec(query);
+        auto result = work.exec_prepared(STMT_FIND_ALL);
         
         std::vector<Review> reviews;
         for (const auto& row : result) {
@@ -166,10 +193,9 @@ std::vector<Review> PostgreSQLReviewRepository::findAll() {
 
 double PostgreSQLReviewRepository::getAverageRatingForTrainer(const UUID& trainerId) {
     try {
-        auto work = dbConnection_->beginTransaction();
+        auto work = dbConnection_->beginReadTransaction();
         
-        std::string query = QueryFactory::createGetAverageRatingForTrainerQuery();
-        auto result = work.exec_params(query, trainerId.toString());
+        auto result = work.exec_prepared(QueryFactory::Statements::GET_AVERAGE_RATING_FOR_TRAINER, trainerId.toString());
         
         if (result.empty() || result[0]["avg_rating"].is_null()) {
             return 0.0;
@@ -286,16 +312,9 @@ bool PostgreSQLReviewRepository::remove(const UUID& id) {
 
 bool PostgreSQLReviewRepository::exists(const UUID& id) {
     try {
-        auto work = dbConnection_->beginTransaction();
+        auto work = dbConnection_->beginReadTransaction();
         
-        SqlQueryBuilder queryBuilder;
-        std::string query = queryBuilder
-            .select({"1"})
-            .from("reviews")
-            .where("id = $1")
-            .build();
-            
-        auto result = work.exec_params(query, id.toString());
+        auto result = work.exec_prepared(STMT_EXISTS, id.toString());
         
         dbConnection_->commitTransaction(work);
         return !result.empty();
@@ -305,6 +324,53 @@ bool PostgreSQLReviewRepository::exists(const UUID& id) {
     }
 }
 
+std::vector<Review> PostgreSQLReviewRepository::findByIds(const std::vector<UUID>& ids) {
+    if (ids.empty()) {
+        return {};
+    }
+    
+    try {
+        auto work = dbConnection_->beginReadTransaction();
+        
+        auto result = work.exec_prepared(STMT_FIND_BY_IDS, SqlQueryBuilder::uuidArrayLiteral(ids));
+        
+        std::vector<Review> reviews;
+        reviews.reserve(result.size());
+        for (const auto& row : result) {
+            reviews.push_back(mapResultToReview(row));
+        }
+        
+        dbConnection_->commitTransaction(work);
+        return reviews;
+        
+    } catch (const std::exception& e) {
+        throw QueryException(std::string("Failed to find reviews by IDs: ") + e.what());
+    }
+}
+
+std::set<UUID> PostgreSQLReviewRepository::existsMany(const std::vector<UUID>& ids) {
+    if (ids.empty()) {
+        return {};
+    }
+    
+    try {
+        auto work = dbConnection_->beginReadTransaction();
+        
+        auto result = work.exec_prepared(STMT_EXISTS_MANY, SqlQueryBuilder::uuidArrayLiteral(ids));
+        
+        std::set<UUID> existing;
+        for (const auto& row : result) {
+            existing.insert(UUID::fromString(row["id"].c_str()));
+        }
+        
+        dbConnection_->commitTransaction(work);
+        return existing;
+        
+    } catch (const std::exception& e) {
+        throw QueryException(std::string("Failed to check review existence: ") + e.what());
+    }
+}
+
 Review PostgreSQLReviewRepository::mapResultToReview(const pqxx::row& row) const {
     UUID id = UUID::fromString(row["id"].c_str());
     UUID clientId = UUID::fromString(row["client_id"].c_str());
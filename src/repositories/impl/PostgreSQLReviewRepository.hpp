@@ -21,8 +21,13 @@ public:
     bool update(const Review& review) override;
     bool remove(const UUID& id) override;
     bool exists(const UUID& id) override;
+    std::vector<Review> findByIds(const std::vector<UUID>& ids) override;
+    std::set<UUID> existsMany(const std::vector<UUID>& ids) override;
 
 private:
+    // Регистрирует запросы-поисковики в PreparedStatementRegistry (однократно на процесс)
+    static void registerPreparedStatements();
+
     std::shared_ptr<DatabaseConnection> dbConnection_;
     
     Review mapResultToReview(const pqxx::row& row) const;
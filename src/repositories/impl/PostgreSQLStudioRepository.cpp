@@ -1,23 +1,66 @@
 #include "PostgreSQLStudioRepository.hpp"
 #include "../../data/SqlQueryBuilder.hpp"
 #include "../../data/DateTimeUtils.hpp"
+#include "../../data/PreparedStatementRegistry.hpp"
+#include <mutex>
+
+// Именованные запросы репозитория, см. PreparedStatementRegistry
+static const char* const STMT_FIND_BY_ID = "studio_find_by_id";
+static const char* const STMT_FIND_MAIN_STUDIO = "studio_find_main_studio";
+static const char* const STMT_FIND_ALL = "studio_find_all";
+static const char* const STMT_EXISTS = "studio_exists";
+static const char* const STMT_FIND_BY_IDS = "studio_find_by_ids";
+static const char* const STMT_EXISTS_MANY = "studio_exists_many";
 
 PostgreSQLStudioRepository::PostgreSQLStudioRepository(
     std::shared_ptr<DatabaseConnection> dbConnection)
-    : dbConnection_(std::move(dbConnection)) {}
+    : dbConnection_(std::move(dbConnection)) {
+    registerPreparedStatements();
+}
 
-std::optional<Studio> PostgreSQLStudioRepository::findById(const UUID& id) {
-    try {
-        auto work = dbConnection_->beginTransaction();
-        
-        SqlQueryBuilder queryBuilder;
-        std::string query = queryBuilder
+void PostgreSQLStudioRepository::registerPreparedStatements() {
+    static std::once_flag registered;
+    std::call_once(registered, []() {
+
+        auto& registry = PreparedStatementRegistry::getInstance();
+        registry.registerStatement(STMT_FIND_BY_ID, SqlQueryBuilder()
             .select({"id", "name", "description", "contact_email"})
             .from("studios")
             .where("id = $1")
-            .build();
+            .build());
+        registry.registerStatement(STMT_FIND_MAIN_STUDIO, SqlQueryBuilder()
+            .select({"id", "name", "description", "contact_email"})
+            .from("studios")
+            .orderBy("id", true)
+            .limit(1)
+            .build());
+        registry.registerStatement(STMT_FIND_ALL, SqlQueryBuilder()
+            .select({"id", "name", "description", "contact_email"})
+            .from("studios")
+            .build());
+        registry.registerStatement(STMT_EXISTS, SqlQueryBuilder()
+            .select({"1"})
+            .from("studios")
+            .where("id = $1")
+            .build());
+        registry.registerStatement(STMT_FIND_BY_IDS, SqlQueryBuilder()
+            .select({"id", "name", "description", "contact_email"})
+            .from("studios")
+            .where("id = ANY($1::uuid[])")
+            .build());
+        registry.registerStatement(STMT_EXISTS_MANY, SqlQueryBuilder()
+            .select({"id"})
+            .from("studios")
+            .where("id = ANY($1::uuid[])")
+            .build());
+    });
+}
+
+std::optional<Studio> PostgreSQLStudioRepository::findById(const UUID& id) {
+    try {
+        auto work = dbConnection_->beginReadTransaction();
         
-        auto result = work.exec_params(query, id.toString());
+        auto result = work.exec_prepared(STMT_FIND_BY_ID, id.toString());
         
         if (result.empty()) {
             return std::nullopt;
@@ -34,17 +77,9 @@ std::optional<Studio> PostgreSQLStudioRepository::findById(const UUID& id) {
 
 std::optional<Studio> PostgreSQLStudioRepository::findMainStudio() {
     try {
-        auto work = dbConnection_->beginTransaction();
+        auto work = dbConnection_->beginReadTransaction();
         
-        SqlQueryBuilder queryBuilder;
-        std::string query = queryBuilder
-            .select({"id", "name", "description", "contact_email"})
-            .from("studios")
-            .orderBy("id", true)
-            .limit(1)
-            .build();
-        
-        auto result = work.exec(query);
+        auto result = work.exec_prepared(STMT_FIND_MAIN_STUDIO);
         
         if (result.empty()) {
             return std::nullopt;
@@ -61,15 +96,9 @@ std::optional<Studio> PostgreSQLStudioRepository::findMainStudio() {
 
 std::vector<Studio> PostgreSQLStudioRepository::findAll() {
     try {
-        auto work = dbConnection_->beginTransaction();
-        
-        SqlQueryBuilder queryBuilder;
-        std::string query = queryBuilder
-            .select({"id", "name", "description", "contact_email"})
-            .from("studios")
-            .build();
+        auto work = dbConnection_->beginReadTransaction();
         
-        auto result = work.exec(query);
+        auto result = work.exec_prepared(STMT_FIND_ALL);
         
         std::vector<Studio> studios;
         for (const auto& row : result) {
@@ -203,16 +232,9 @@ bool PostgreSQLStudioRepository::remove(const UUID& id) {
 
 bool PostgreSQLStudioRepository::exists(const UUID& id) {
     try {
-        auto work = dbConnection_->beginTransaction();
+        auto work = dbConnection_->beginReadTransaction();
         
-        SqlQueryBuilder queryBuilder;
-        std::string query = queryBuilder
-            .select({"1"})
-            .from("studios")
-            .where("id = $1")
-            .build();
-            
-        auto result = work.exec_params(query, id.toString());
+        auto result = work.exec_prepared(STMT_EXISTS, id.toString());
         
         dbConnection_->commitTransaction(work);
         return !result.empty();
@@ -222,6 +244,53 @@ bool PostgreSQLStudioRepository::exists(const UUID& id) {
     }
 }
 
+std::vector<Studio> PostgreSQLStudioRepository::findByIds(const std::vector<UUID>& ids) {
+    if (ids.empty()) {
+        return {};
+    }
+    
+    try {
+        auto work = dbConnection_->beginReadTransaction();
+        
+        auto result = work.exec_prepared(STMT_FIND_BY_IDS, SqlQueryBuilder::uuidArrayLiteral(ids));
+        
+        std::vector<Studio> studios;
+        studios.reserve(result.size());
+        for (const auto& row : result) {
+            studios.push_back(mapResultToStudio(row));
+        }
+        
+        dbConnection_->commitTransaction(work);
+        return studios;
+        
+    } catch (const std::exception& e) {
+        throw QueryException(std::string("Failed to find studios by IDs: ") + e.what());
+    }
+}
+
+std::set<UUID> PostgreSQLStudioRepository::existsMany(const std::vector<UUID>& ids) {
+    if (ids.empty()) {
+        return {};
+    }
+    
+    try {
+        auto work = dbConnection_->beginReadTransaction();
+        
+        auto result = work.exec_prepared(STMT_EXISTS_MANY, SqlQueryBuilder::uuidArrayLiteral(ids));
+        
+        std::set<UUID> existing;
+        for (const auto& row : result) {
+            existing.insert(UUID::fromString(row["id"].c_str()));
+        }
+        
+        dbConnection_->commitTransaction(work);
+        return existing;
+        
+    } catch (const std::exception& e) {
+        throw QueryException(std::string("Failed to check studio existence: ") + e.what());
+    }
+}
+
 Studio PostgreSQLStudioRepository::mapResultToStudio(const pqxx::row& row) const {
     UUID id = UUID::fromString(row["id"].c_str());
     std::string name = row["name"].c_str();
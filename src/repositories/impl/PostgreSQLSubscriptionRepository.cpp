@@ -2,24 +2,80 @@
 #include "../../data/SqlQueryBuilder.hpp"
 #include "../../data/DateTimeUtils.hpp"
 #include "../../data/QueryFactory.hpp"
+#include "../../data/PreparedStatementRegistry.hpp"
+#include <mutex>
+
+// Именованные запросы репозитория, см. PreparedStatementRegistry
+static const char* const STMT_FIND_BY_ID = "subscription_find_by_id";
+static const char* const STMT_FIND_BY_CLIENT_ID = "subscription_find_by_client_id";
+static const char* const STMT_FIND_ACTIVE_SUBSCRIPTIONS = "subscription_find_active_subscriptions";
+static const char* const STMT_FIND_ALL = "subscription_find_all";
+static const char* const STMT_EXISTS = "subscription_exists";
+static const char* const STMT_FIND_BY_IDS = "subscription_find_by_ids";
+static const char* const STMT_EXISTS_MANY = "subscription_exists_many";
 
 PostgreSQLSubscriptionRepository::PostgreSQLSubscriptionRepository(
     std::shared_ptr<DatabaseConnection> dbConnection)
-    : dbConnection_(std::move(dbConnection)) {}
+    : dbConnection_(std::move(dbConnection)) {
+    registerPreparedStatements();
+}
 
-std::optional<Subscription> PostgreSQLSubscriptionRepository::findById(const UUID& id) {
-    try {
-        auto work = dbConnection_->beginTransaction();
-        
-        SqlQueryBuilder queryBuilder;
-        std::string query = queryBuilder
-            .select({"id", "client_id", "subscription_type_id", "start_date", "end_date", 
-                     "remaining_visits", "status", "purchase_date"})
+void PostgreSQLSubscriptionRepository::registerPreparedStatements() {
+    static std::once_flag registered;
+    std::call_once(registered, []() {
+        QueryFactory::registerPreparedStatements();
+
+        auto& registry = PreparedStatementRegistry::getInstance();
+        registry.registerStatement(STMT_FIND_BY_ID, SqlQueryBuilder()
+            .select({"id", "client_id", "subscription_type_id", "start_date", "end_date",
+                    "remaining_visits", "status", "purchase_date"})
             .from("subscriptions")
             .where("id = $1")
-            .build();
+            .build());
+        registry.registerStatement(STMT_FIND_BY_CLIENT_ID, SqlQueryBuilder()
+            .select({"id", "client_id", "subscription_type_id", "start_date", "end_date",
+                    "remaining_visits", "status", "purchase_date"})
+            .from("subscriptions")
+            .where("client_id = $1")
+            .build());
+        registry.registerStatement(STMT_FIND_ACTIVE_SUBSCRIPTIONS, SqlQueryBuilder()
+            .select({"id", "client_id", "subscription_type_id", "start_date", "end_date",
+                    "remaining_visits", "status", "purchase_date"})
+            .from("subscriptions")
+            .where("status = 'ACTIVE'")
+            .build());
+        registry.registerStatement(STMT_FIND_ALL, SqlQueryBuilder()
+            .select({
+                "id", "client_id", "subscription_type_id", "start_date",
+                "end_date", "remaining_visits", "status", "purchase_date"
+            })
+            .from("subscriptions")
+            .orderBy("purchase_date", false)
+            .build());
+        registry.registerStatement(STMT_EXISTS, SqlQueryBuilder()
+            .select({"1"})
+            .from("subscriptions")
+            .where("id = $1")
+            .build());
+        registry.registerStatement(STMT_FIND_BY_IDS, SqlQueryBuilder()
+            .select({"id", "client_id", "subscription_type_id", "start_date", "end_date",
+                    "remaining_visits", "status", "purchase_date"})
+            .from("subscriptions")
+            .where("id = ANY($1::uuid[])")
+            .build());
+        registry.registerStatement(STMT_EXISTS_MANY, SqlQueryBuilder()
+            .select({"id"})
+            .from("subscriptions")
+            .where("id = ANY($1::uuid[])")
+            .build());
+    });
+}
+
+std::optional<Subscription> PostgreSQLSubscriptionRepository::findById(const UUID& id) {
+    try {
+        auto work = dbConnection_->beginReadTransaction();
         
-        auto result = work.exec_params(query, id.toString());
+        auto result = work.exec_prepared(STMT_FIND_BY_ID, id.toString());
         
         if (result.empty()) {
             return std::nullopt;
@@ -36,17 +92,9 @@ std::optional<Subscription> PostgreSQLSubscriptionRepository::findById(const UUI
 
 std::vector<Subscription> PostgreSQLSubscriptionRepository::findByClientId(const UUID& clientId) {
     try {
-        auto work = dbConnection_->beginTransaction();
-        
-        SqlQueryBuilder queryBuilder;
-        std::string query = queryBuilder
-            .select({"id", "client_id", "subscription_type_id", "start_date", "end_date", 
-                     "remaining_visits", "status", "purchase_date"})
-            .from("subscriptions")
-            .where("client_id = $1")
-            .build();
+        auto work = dbConnection_->beginReadTransaction();
         
-        auto result = work.exec_params(query, clientId.toString());
+        auto result = work.exec_prepared(STMT_FIND_BY_CLIENT_ID, clientId.toString());
         
         std::vector<Subscription> subscriptions;
         for (const auto& row : result) {
@@ -63,17 +111,9 @@ std::vector<Subscription> PostgreSQLSubscriptionRepository::findByClientId(const
 
 std::vector<Subscription> PostgreSQLSubscriptionRepository::findActiveSubscriptions() {
     try {
-        auto work = dbConnection_->beginTransaction();
-        
-        SqlQueryBuilder queryBuilder;
-        std::string query = queryBuilder
-            .select({"id", "client_id", "subscription_type_id", "start_date", "end_date", 
-                     "remaining_visits", "status", "purchase_date"})
-            .from("subscriptions")
-            .where("status = 'ACTIVE'")
-            .build();
+        auto work = dbConnection_->beginReadTransaction();
         
-        auto result = work.exec(query);
+        auto result = work.exec_prepared(STMT_FIND_ACTIVE_SUBSCRIPTIONS);
         
         std::vector<Subscription> subscriptions;
         for (const auto& row : result) {
@@ -90,10 +130,9 @@ std::vector<Subscription> PostgreSQLSubscriptionRepository::findActiveSubscripti
 
 std::vector<Subscription> PostgreSQLSubscriptionRepository::findExpiringSubscriptions(int days) {
     try {
-        auto work = dbConnection_->beginTransaction();
+        auto work = dbConnection_->beginReadTransaction();
         
-        std::string query = QueryFactory::createFindExpiringSubscriptionsQuery();
-        auto result = work.exec_params(query, days);
+        auto result = work.exec_prepared(QueryFactory::Statements::FIND_EXPIRING_SUBSCRIPTIONS, days);
         
         std::vector<Subscription> subscriptions;
         for (const auto& row : result) {
@@ -110,19 +149,9 @@ std::vector<Subscription> PostgreSQLSubscriptionRepository::findExpiringSubscrip
 
 std::vector<Subscription> PostgreSQLSubscriptionRepository::findAll() {
     try {
-        auto work = dbConnection_->beginTransaction();
+        auto work = dbConnection_->beginReadTransaction();
         
-        SqlQueryBuilder queryBuilder;
-        std::string query = queryBuilder
-            .select({
-                "id", "client_id", "subscription_type_id", "start_date", 
-                "end_date", "remaining_visits", "status", "purchase_date"
-            })
-            .from("subscriptions")
-            .orderBy("purchase_date", false)
-            .build();
-        
-        auto result = work.exec(query);
+        auto result = work.exec_prepared(STMT_FIND_ALL);
         
         std::vector<Subscription> subscriptions;
         for (const auto& row : result) {
@@ -243,16 +272,9 @@ bool PostgreSQLSubscriptionRepository::remove(const UUID& id) {
 
 bool PostgreSQLSubscriptionRepository::exists(const UUID& id) {
     try {
-        auto work = dbConnection_->beginTransaction();
+        auto work = dbConnection_->beginReadTransaction();
         
-        SqlQueryBuilder queryBuilder;
-        std::string query = queryBuilder
-            .select({"1"})
-            .from("subscriptions")
-            .where("id = $1")
-            .build();
-            
-        auto result = work.exec_params(query, id.toString());
+        auto result = work.exec_prepared(STMT_EXISTS, id.toString());
         
         dbConnection_->commitTransaction(work);
         return !result.empty();
@@ -262,6 +284,53 @@ bool PostgreSQLSubscriptionRepository::exists(const UUID& id) {
     }
 }
 
+std::vector<Subscription> PostgreSQLSubscriptionRepository::findByIds(const std::vector<UUID>& ids) {
+    if (ids.empty()) {
+        return {};
+    }
+    
+    try {
+        auto work = dbConnection_->beginReadTransaction();
+        
+        auto result = work.exec_prepared(STMT_FIND_BY_IDS, SqlQueryBuilder::uuidArrayLiteral(ids));
+        
+        std::vector<Subscription> subscriptions;
+        subscriptions.reserve(result.size());
+        for (const auto& row : result) {
+            subscriptions.push_back(mapResultToSubscription(row));
+        }
+        
+        dbConnection_->commitTransaction(work);
+        return subscriptions;
+        
+    } catch (const std::exception& e) {
+        throw QueryException(std::string("Failed to find subscriptions by IDs: ") + e.what());
+    }
+}
+
+std::set<UUID> PostgreSQLSubscriptionRepository::existsMany(const std::vector<UUID>& ids) {
+    if (ids.empty()) {
+        return {};
+    }
+    
+    try {
+        auto work = dbConnection_->beginReadTransaction();
+        
+        auto result = work.exec_prepared(STMT_EXISTS_MANY, SqlQueryBuilder::uuidArrayLiteral(ids));
+        
+        std::set<UUID> existing;
+        for (const auto& row : result) {
+            existing.insert(UUID::fromString(row["id"].c_str()));
+        }
+        
+        dbConnection_->commitTransaction(work);
+        return existing;
+        
+    } catch (const std::exception& e) {
+        throw QueryException(std::string("Failed to check subscription existence: ") + e.what());
+    }
+}
+
 Subscription PostgreSQLSubscriptionRepository::mapResultToSubscription(const pqxx::row& row) const {
     UUID id = UUID::fromString(row["id"].c_str());
     UUID clientId = UUID::fromString(row["client_id"].c_str());
@@ -1,22 +1,64 @@
 #include "PostgreSQLSubscriptionTypeRepository.hpp"
 #include "../../data/SqlQueryBuilder.hpp"
+#include "../../data/PreparedStatementRegistry.hpp"
+#include <mutex>
+
+// Именованные запросы репозитория, см. PreparedStatementRegistry
+static const char* const STMT_FIND_BY_ID = "subscription_type_find_by_id";
+static const char* const STMT_FIND_ALL_ACTIVE = "subscription_type_find_all_active";
+static const char* const STMT_FIND_ALL = "subscription_type_find_all";
+static const char* const STMT_EXISTS = "subscription_type_exists";
+static const char* const STMT_FIND_BY_IDS = "subscription_type_find_by_ids";
+static const char* const STMT_EXISTS_MANY = "subscription_type_exists_many";
 
 PostgreSQLSubscriptionTypeRepository::PostgreSQLSubscriptionTypeRepository(
     std::shared_ptr<DatabaseConnection> dbConnection)
-    : dbConnection_(std::move(dbConnection)) {}
+    : dbConnection_(std::move(dbConnection)) {
+    registerPreparedStatements();
+}
 
-std::optional<SubscriptionType> PostgreSQLSubscriptionTypeRepository::findById(const UUID& id) {
-    try {
-        auto work = dbConnection_->beginTransaction();
-        
-        SqlQueryBuilder queryBuilder;
-        std::string query = queryBuilder
+void PostgreSQLSubscriptionTypeRepository::registerPreparedStatements() {
+    static std::once_flag registered;
+    std::call_once(registered, []() {
+
+        auto& registry = PreparedStatementRegistry::getInstance();
+        registry.registerStatement(STMT_FIND_BY_ID, SqlQueryBuilder()
             .select({"id", "name", "description", "validity_days", "visit_count", "unlimited", "price"})
             .from("subscription_types")
             .where("id = $1")
-            .build();
+            .build());
+        registry.registerStatement(STMT_FIND_ALL_ACTIVE, SqlQueryBuilder()
+            .select({"id", "name", "description", "validity_days", "visit_count", "unlimited", "price"})
+            .from("subscription_types")
+            .where("unlimited = true OR visit_count > 0")
+            .build());
+        registry.registerStatement(STMT_FIND_ALL, SqlQueryBuilder()
+            .select({"id", "name", "description", "validity_days", "visit_count", "unlimited", "price"})
+            .from("subscription_types")
+            .build());
+        registry.registerStatement(STMT_EXISTS, SqlQueryBuilder()
+            .select({"1"})
+            .from("subscription_types")
+            .where("id = $1")
+            .build());
+        registry.registerStatement(STMT_FIND_BY_IDS, SqlQueryBuilder()
+            .select({"id", "name", "description", "validity_days", "visit_count", "unlimited", "price"})
+            .from("subscription_types")
+            .where("id = ANY($1::uuid[])")
+            .build());
+        registry.registerStatement(STMT_EXISTS_MANY, SqlQueryBuilder()
+            .select({"id"})
+            .from("subscription_types")
+            .where("id = ANY($1::uuid[])")
+            .build());
+    });
+}
+
+std::optional<SubscriptionType> PostgreSQLSubscriptionTypeRepository::findById(const UUID& id) {
+    try {
+        auto work = dbConnection_->beginReadTransaction();
         
-        auto result = work.exec_params(query, id.toString());
+        auto result = work.exec_prepared(STMT_FIND_BY_ID, id.toString());
         
         if (result.empty()) {
             return std::nullopt;
@@ -33,16 +75,9 @@ std::optional<SubscriptionType> PostgreSQLSubscriptionTypeRepository::findById(c
 
 std::vector<SubscriptionType> PostgreSQLSubscriptionTypeRepository::findAllActive() {
     try {
-        auto work = dbConnection_->beginTransaction();
-        
-        SqlQueryBuilder queryBuilder;
-        std::string query = queryBuilder
-            .select({"id", "name", "description", "validity_days", "visit_count", "unlimited", "price"})
-            .from("subscription_types")
-            .where("unlimited = true OR visit_count > 0")
-            .build();
+        auto work = dbConnection_->beginReadTransaction();
         
-        auto result = work.exec(query);
+        auto result = work.exec_prepared(STMT_FIND_ALL_ACTIVE);
         
         std::vector<SubscriptionType> subscriptionTypes;
         for (const auto& row : result) {
@@ -59,15 +94,9 @@ std::vector<SubscriptionType> PostgreSQLSubscriptionTypeRepository::findAllActiv
 
 std::vector<SubscriptionType> PostgreSQLSubscriptionTypeRepository::findAll() {
     try {
-        auto work = dbConnection_->beginTransaction();
+        auto work = dbConnection_->beginReadTransaction();
         
-        SqlQueryBuilder queryBuilder;
-        std::string query = queryBuilder
-            .select({"id", "name", "description", "validity_days", "visit_count", "unlimited", "price"})
-            .from("subscription_types")
-            .build();
-        
-        auto result = work.exec(query);
+        auto result = work.exec_prepared(STMT_FIND_ALL);
         
         std::vector<SubscriptionType> subscriptionTypes;
         for (const auto& row : result) {
@@ -186,16 +215,9 @@ bool PostgreSQLSubscriptionTypeRepository::remove(const UUID& id) {
 
 bool PostgreSQLSubscriptionTypeRepository::exists(const UUID& id) {
     try {
-        auto work = dbConnection_->beginTransaction();
+        auto work = dbConnection_->beginReadTransaction();
         
-        SqlQueryBuilder queryBuilder;
-        std::string query = queryBuilder
-            .select({"1"})
-            .from("subscription_types")
-            .where("id = $1")
-            .build();
-            
-        auto result = work.exec_params(query, id.toString());
+        auto result = work.exec_prepared(STMT_EXISTS, id.toString());
         
         dbConnection_->commitTransaction(work);
         return !result.empty();
@@ -205,6 +227,53 @@ bool PostgreSQLSubscriptionTypeRepository::exists(const UUID& id) {
     }
 }
 
+std::vector<SubscriptionType> PostgreSQLSubscriptionTypeRepository::findByIds(const std::vector<UUID>& ids) {
+    if (ids.empty()) {
+        return {};
+    }
+    
+    try {
+        auto work = dbConnection_->beginReadTransaction();
+        
+        auto result = work.exec_prepared(STMT_FIND_BY_IDS, SqlQueryBuilder::uuidArrayLiteral(ids));
+        
+        std::vector<SubscriptionType> types;
+        types.reserve(result.size());
+        for (const auto& row : result) {
+            types.push_back(mapResultToSubscriptionType(row));
+        }
+        
+        dbConnection_->commitTransaction(work);
+        return types;
+        
+    } catch (const std::exception& e) {
+        throw QueryException(std::string("Failed to find subscription types by IDs: ") + e.what());
+    }
+}
+
+std::set<UUID> PostgreSQLSubscriptionTypeRepository::existsMany(const std::vector<UUID>& ids) {
+    if (ids.empty()) {
+        return {};
+    }
+    
+    try {
+        auto work = dbConnection_->beginReadTransaction();
+        
+        auto result = work.exec_prepared(STMT_EXISTS_MANY, SqlQueryBuilder::uuidArrayLiteral(ids));
+        
+        std::set<UUID> existing;
+        for (const auto& row : result) {
+            existing.insert(UUID::fromString(row["id"].c_str()));
+        }
+        
+        dbConnection_->commitTransaction(work);
+        return existing;
+        
+    } catch (const std::exception& e) {
+        throw QueryException(std::string("Failed to check subscription type existence: ") + e.what());
+    }
+}
+
 SubscriptionType PostgreSQLSubscriptionTypeRepository::mapResultToSubscriptionType(const pqxx::row& row) const {
     UUID id = UUID::fromString(row["id"].c_str());
     std::string name = row["name"].c_str();
@@ -1,24 +1,77 @@
 #include "PostgreSQLTrainerRepository.hpp"
 #include <pqxx/pqxx>
 #include "../../data/QueryFactory.hpp"
+#include "../../data/PreparedStatementRegistry.hpp"
+#include "../../data/SqlQueryBuilder.hpp"
+#include <mutex>
+
+// Именованные запросы репозитория, см. PreparedStatementRegistry
+static const char* const STMT_FIND_BY_ID = "trainer_find_by_id";
+static const char* const STMT_FIND_BY_SPECIALIZATION = "trainer_find_by_specialization";
+static const char* const STMT_FIND_ACTIVE_TRAINERS = "trainer_find_active_trainers";
+static const char* const STMT_FIND_ALL = "trainer_find_all";
+static const char* const STMT_EXISTS = "trainer_exists";
+static const char* const STMT_FIND_BY_IDS = "trainer_find_by_ids";
+static const char* const STMT_EXISTS_MANY = "trainer_exists_many";
 
 PostgreSQLTrainerRepository::PostgreSQLTrainerRepository(
     std::shared_ptr<DatabaseConnection> dbConnection)
-    : dbConnection_(std::move(dbConnection)) {}
+    : dbConnection_(std::move(dbConnection)) {
+    registerPreparedStatements();
+}
 
-std::optional<Trainer> PostgreSQLTrainerRepository::findById(const UUID& id) {
-    try {
-        auto work = dbConnection_->beginTransaction();
-        
-        SqlQueryBuilder queryBuilder;
-        std::string query = queryBuilder
+void PostgreSQLTrainerRepository::registerPreparedStatements() {
+    static std::once_flag registered;
+    std::call_once(registered, []() {
+
+        auto& registry = PreparedStatementRegistry::getInstance();
+        registry.registerStatement(STMT_FIND_BY_ID, SqlQueryBuilder()
             .select({"t.id", "t.name", "t.biography", "t.qualification_level", "t.is_active", "ts.specialization"})
             .from("trainers t")
             .leftJoin("trainer_specializations ts", "t.id = ts.trainer_id")
             .where("t.id = $1")
-            .build();
+            .build());
+        registry.registerStatement(STMT_FIND_BY_SPECIALIZATION, SqlQueryBuilder()
+            .select({"t.id", "t.name", "t.biography", "t.qualification_level", "t.is_active", "ts.specialization"})
+            .from("trainers t")
+            .innerJoin("trainer_specializations ts", "t.id = ts.trainer_id")
+            .where("ts.specialization = $1 AND t.is_active = true")
+            .build());
+        registry.registerStatement(STMT_FIND_ACTIVE_TRAINERS, SqlQueryBuilder()
+            .select({"t.id", "t.name", "t.biography", "t.qualification_level", "t.is_active", "ts.specialization"})
+            .from("trainers t")
+            .leftJoin("trainer_specializations ts", "t.id = ts.trainer_id")
+            .where("t.is_active = true")
+            .build());
+        registry.registerStatement(STMT_FIND_ALL, SqlQueryBuilder()
+            .select({"t.id", "t.name", "t.biography", "t.qualification_level", "t.is_active", "ts.specialization"})
+            .from("trainers t")
+            .leftJoin("trainer_specializations ts", "t.id = ts.trainer_id")
+            .build());
+        registry.registerStatement(STMT_EXISTS, SqlQueryBuilder()
+            .select({"1"})
+            .from("trainers")
+            .where("id = $1")
+            .build());
+        registry.registerStatement(STMT_FIND_BY_IDS, SqlQueryBuilder()
+            .select({"t.id", "t.name", "t.biography", "t.qualification_level", "t.is_active", "ts.specialization"})
+            .from("trainers t")
+            .leftJoin("trainer_specializations ts", "t.id = ts.trainer_id")
+            .where("t.id = ANY($1::uuid[])")
+            .build());
+        registry.registerStatement(STMT_EXISTS_MANY, SqlQueryBuilder()
+            .select({"id"})
+            .from("trainers")
+            .where("id = ANY($1::uuid[])")
+            .build());
+    });
+}
+
+std::optional<Trainer> PostgreSQLTrainerRepository::findById(const UUID& id) {
+    try {
+        auto work = dbConnection_->beginReadTransaction();
         
-        auto result = work.exec_params(query, id.toString());
+        auto result = work.exec_prepared(STMT_FIND_BY_ID, id.toString());
         
         if (result.empty()) {
             dbConnection_->commitTransaction(work);
@@ -45,17 +98,9 @@ std::optional<Trainer> PostgreSQLTrainerRepository::findById(const UUID& id) {
 
 std::vector<Trainer> PostgreSQLTrainerRepository::findBySpecialization(const std::string& specialization) {
     try {
-        auto work = dbConnection_->beginTransaction();
+        auto work = dbConnection_->beginReadTransaction();
         
-        SqlQueryBuilder queryBuilder;
-        std::string query = queryBuilder
-            .select({"t.id", "t.name", "t.biography", "t.qualification_level", "t.is_active", "ts.specialization"})
-            .from("trainers t")
-            .innerJoin("trainer_specializations ts", "t.id = ts.trainer_id")
-            .where("ts.specialization = $1 AND t.is_active = true")
-            .build();
-        
-        auto result = work.exec_params(query, specialization);
+        auto result = work.exec_prepared(STMT_FIND_BY_SPECIALIZATION, specialization);
         
         std::vector<Trainer> trainers;
         std::map<UUID, Trainer> trainerMap;
@@ -88,17 +133,9 @@ std::vector<Trainer> PostgreSQLTrainerRepository::findBySpecialization(const std
 
 std::vector<Trainer> PostgreSQLTrainerRepository::findActiveTrainers() {
     try {
-        auto work = dbConnection_->beginTransaction();
+        auto work = dbConnection_->beginReadTransaction();
         
-        SqlQueryBuilder queryBuilder;
-        std::string query = queryBuilder
-            .select({"t.id", "t.name", "t.biography", "t.qualification_level", "t.is_active", "ts.specialization"})
-            .from("trainers t")
-            .leftJoin("trainer_specializations ts", "t.id = ts.trainer_id")
-            .where("t.is_active = true")
-            .build();
-        
-        auto result = work.exec(query);
+        auto result = work.exec_prepared(STMT_FIND_ACTIVE_TRAINERS);
         
         std::vector<Trainer> trainers;
         std::map<UUID, Trainer> trainerMap;
@@ -131,16 +168,9 @@ std::vector<Trainer> PostgreSQLTrainerRepository::findActiveTrainers() {
 
 std::vector<Trainer> PostgreSQLTrainerRepository::findAll() {
     try {
-        auto work = dbConnection_->beginTransaction();
-        
-        SqlQueryBuilder queryBuilder;
-        std::string query = queryBuilder
-            .select({"t.id", "t.name", "t.biography", "t.qualification_level", "t.is_active", "ts.specialization"})
-            .from("trainers t")
-            .leftJoin("trainer_specializations ts", "t.id = ts.trainer_id")
-            .build();
+        auto work = dbConnection_->beginReadTransaction();
         
-        auto result = work.exec(query);
+        auto result = work.exec_prepared(STMT_FIND_ALL);
         
         std::vector<Trainer> trainers;
         std::map<UUID, Trainer> trainerMap;
@@ -309,16 +339,9 @@ bool PostgreSQLTrainerRepository::remove(const UUID& id) {
 
 bool PostgreSQLTrainerRepository::exists(const UUID& id) {
     try {
-        auto work = dbConnection_->beginTransaction();
+        auto work = dbConnection_->beginReadTransaction();
         
-        SqlQueryBuilder queryBuilder;
-        std::string query = queryBuilder
-            .select({"1"})
-            .from("trainers")
-            .where("id = $1")
-            .build();
-            
-        auto result = work.exec_params(query, id.toString());
+        auto result = work.exec_prepared(STMT_EXISTS, id.toString());
         
         dbConnection_->commitTransaction(work);
         return !result.empty();
@@ -328,6 +351,68 @@ bool PostgreSQLTrainerRepository::exists(const UUID& id) {
     }
 }
 
+std::vector<Trainer> PostgreSQLTrainerRepository::findByIds(const std::vector<UUID>& ids) {
+    if (ids.empty()) {
+        return {};
+    }
+    
+    try {
+        auto work = dbConnection_->beginReadTransaction();
+        
+        auto result = work.exec_prepared(STMT_FIND_BY_IDS, SqlQueryBuilder::uuidArrayLiteral(ids));
+        
+        std::vector<Trainer> trainers;
+        std::map<UUID, Trainer> trainerMap;
+        
+        for (const auto& row : result) {
+            UUID id = UUID::fromString(row["id"].c_str());
+            
+            if (trainerMap.find(id) == trainerMap.end()) {
+                auto trainer = mapResultToTrainer(row);
+                trainerMap[id] = trainer;
+            }
+            
+            if (!row["specialization"].is_null()) {
+                std::string specialization = row["specialization"].c_str();
+                trainerMap[id].addSpecialization(specialization);
+            }
+        }
+        
+        for (auto& pair : trainerMap) {
+            trainers.push_back(pair.second);
+        }
+        
+        dbConnection_->commitTransaction(work);
+        return trainers;
+        
+    } catch (const std::exception& e) {
+        throw QueryException(std::string("Failed to find trainers by IDs: ") + e.what());
+    }
+}
+
+std::set<UUID> PostgreSQLTrainerRepository::existsMany(const std::vector<UUID>& ids) {
+    if (ids.empty()) {
+        return {};
+    }
+    
+    try {
+        auto work = dbConnection_->beginReadTransaction();
+        
+        auto result = work.exec_prepared(STMT_EXISTS_MANY, SqlQueryBuilder::uuidArrayLiteral(ids));
+        
+        std::set<UUID> existing;
+        for (const auto& row : result) {
+            existing.insert(UUID::fromString(row["id"].c_str()));
+        }
+        
+        dbConnection_->commitTransaction(work);
+        return existing;
+        
+    } catch (const std::exception& e) {
+        throw QueryException(std::string("Failed to check trainer existence: ") + e.what());
+    }
+}
+
 Trainer PostgreSQLTrainerRepository::mapResultToTrainer(const pqxx::row& row) const {
     UUID id = UUID::fromString(row["id"].c_str());
     std::string name = row["name"].c_str();
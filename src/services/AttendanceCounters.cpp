@@ -0,0 +1,240 @@
+#include "AttendanceCounters.hpp"
+#include "../core/Logger.hpp"
+#include <functional>
+#include <iostream>
+
+AttendanceCounters::AttendanceCounters(std::shared_ptr<IAttendanceRepository> attendanceRepo,
+                                       std::chrono::seconds reconcileInterval)
+    : attendanceRepo_(std::move(attendanceRepo)), reconcileInterval_(reconcileInterval) {
+    for (auto& shard : shards_) {
+        for (auto& cell : shard.cells) {
+            cell.store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+AttendanceCounters::~AttendanceCounters() {
+    stop();
+}
+
+std::size_t AttendanceCounters::cellIndex(AttendanceType type, AttendanceStatus status) {
+    return static_cast<std::size_t>(type) * STATUS_COUNT + static_cast<std::size_t>(status);
+}
+
+AttendanceCounters::Shard& AttendanceCounters::localShard() {
+    // Поток закрепляется за шардом при первом обращении
+    thread_local const std::size_t index = std::hash<std::thread::id>{}(std::this_thread::get_id()) % SHARD_COUNT;
+    return shards_[index];
+}
+
+AttendanceCounters::ClientSegment& AttendanceCounters::segmentFor(const UUID& clientId) {
+    return clients_[std::hash<UUID>{}(clientId) % CLIENT_SEGMENT_COUNT];
+}
+
+const AttendanceCounters::ClientSegment& AttendanceCounters::segmentFor(const UUID& clientId) const {
+    return clients_[std::hash<UUID>{}(clientId) % CLIENT_SEGMENT_COUNT];
+}
+
+void AttendanceCounters::loadBaseline() {
+    std::lock_guard<std::mutex> reloadLock(reloadMutex_);
+    auto started = std::chrono::steady_clock::now();
+
+    synchronize();
+    loaded_.store(true, std::memory_order_release);
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - started);
+    std::size_t clients = 0;
+    for (const auto& segment : clients_) {
+        std::lock_guard<std::mutex> lock(segment.mutex);
+        clients += segment.counts.size();
+    }
+    LOG_INFO("AttendanceCounters", "📊 Счетчики посещаемости загружены: клиентов " << clients
+             << ", " << elapsed.count() << " мс");
+}
+
+void AttendanceCounters::recordAttendance(const Attendance& attendance) {
+    record(attendance.getClientId(), attendance.getType(), attendance.getStatus());
+}
+
+void AttendanceCounters::record(const UUID& clientId, AttendanceType type, AttendanceStatus status, int delta) {
+    if (!recording_.load(std::memory_order_acquire)) {
+        return;
+    }
+
+    localShard().cells[cellIndex(type, status)].fetch_add(delta, std::memory_order_relaxed);
+
+    auto& segment = segmentFor(clientId);
+    std::lock_guard<std::mutex> lock(segment.mutex);
+    segment.counts[clientId].add(type, status, delta);
+}
+
+AttendanceCounts AttendanceCounters::snapshot() const {
+    AttendanceCounts counts;
+    for (std::size_t type = 0; type < TYPE_COUNT; ++type) {
+        for (std::size_t status = 0; status < STATUS_COUNT; ++status) {
+            std::int64_t total = 0;
+            for (const auto& shard : shards_) {
+                total += shard.cells[type * STATUS_COUNT + status].load(std::memory_order_relaxed);
+            }
+            counts.values[type][status] = static_cast<int>(total);
+        }
+    }
+    return counts;
+}
+
+std::optional<AttendanceCounts> AttendanceCounters::clientSnapshot(const UUID& clientId) const {
+    if (!isLoaded()) {
+        return std::nullopt;
+    }
+
+    const auto& segment = segmentFor(clientId);
+    std::lock_guard<std::mutex> lock(segment.mutex);
+    auto it = segment.counts.find(clientId);
+    return it != segment.counts.end() ? it->second : AttendanceCounts{};
+}
+
+int AttendanceCounters::reconcile() {
+    std::lock_guard<std::mutex> reloadLock(reloadMutex_);
+    if (!isLoaded()) {
+        return 0;
+    }
+
+    int corrected = synchronize();
+
+    if (corrected > 0) {
+        LOG_WARNING("AttendanceCounters", "⚠️ Сверка счетчиков посещаемости: исправлено ячеек " << corrected);
+    } else {
+        LOG_DEBUG("AttendanceCounters", "✅ Счетчики посещаемости совпадают с БД");
+    }
+    return corrected;
+}
+
+AttendanceCounters::ClientMaps AttendanceCounters::copyClients() const {
+    ClientMaps copy;
+    for (std::size_t i = 0; i < CLIENT_SEGMENT_COUNT; ++i) {
+        std::lock_guard<std::mutex> lock(clients_[i].mutex);
+        copy[i] = clients_[i].counts;
+    }
+    return copy;
+}
+
+int AttendanceCounters::synchronize() {
+    // Дельты, записанные после снимка, остаются в счетчиках и переживают поправку.
+    // При первой загрузке запись включается до снимка, чтобы не пропустить ни одной дельты
+    recording_.store(true, std::memory_order_release);
+    auto totalsBefore = snapshot();
+    auto clientsBefore = copyClients();
+
+    auto breakdown = attendanceRepo_->aggregateCounts(true);
+    int corrected = applyTotals(breakdown.totals, totalsBefore);
+    applyClients(breakdown.byClient, clientsBefore);
+    return corrected;
+}
+
+int AttendanceCounters::applyTotals(const AttendanceCounts& totals, const AttendanceCounts& before) {
+    auto& shard = localShard();
+    int corrected = 0;
+
+    for (std::size_t type = 0; type < TYPE_COUNT; ++type) {
+        for (std::size_t status = 0; status < STATUS_COUNT; ++status) {
+            std::int64_t drift = static_cast<std::int64_t>(totals.values[type][status]) - before.values[type][status];
+            if (drift != 0) {
+                shard.cells[type * STATUS_COUNT + status].fetch_add(drift, std::memory_order_relaxed);
+                ++corrected;
+            }
+        }
+    }
+    return corrected;
+}
+
+static bool isEmpty(const AttendanceCounts& counts) {
+    for (const auto& byStatus : counts.values) {
+        for (int value : byStatus) {
+            if (value != 0) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+void AttendanceCounters::applyClients(const std::map<UUID, AttendanceCounts>& byClient, const ClientMaps& before) {
+    ClientMaps fresh;
+    for (const auto& [clientId, counts] : byClient) {
+        fresh[std::hash<UUID>{}(clientId) % CLIENT_SEGMENT_COUNT].emplace(clientId, counts);
+    }
+
+    // Сегменты исправляются по одному: запись блокирует только свой сегмент
+    for (std::size_t i = 0; i < CLIENT_SEGMENT_COUNT; ++i) {
+        std::lock_guard<std::mutex> lock(clients_[i].mutex);
+        auto& counts = clients_[i].counts;
+        for (const auto& [clientId, old] : before[i]) {
+            auto& current = counts[clientId];
+            for (std::size_t type = 0; type < TYPE_COUNT; ++type) {
+                for (std::size_t status = 0; status < STATUS_COUNT; ++status) {
+                    current.values[type][status] -= old.values[type][status];
+                }
+            }
+        }
+        for (const auto& [clientId, loaded] : fresh[i]) {
+            auto& current = counts[clientId];
+            for (std::size_t type = 0; type < TYPE_COUNT; ++type) {
+                for (std::size_t status = 0; status < STATUS_COUNT; ++status) {
+                    current.values[type][status] += loaded.values[type][status];
+                }
+            }
+        }
+        for (auto it = counts.begin(); it != counts.end();) {
+            it = isEmpty(it->second) ? counts.erase(it) : std::next(it);
+        }
+    }
+}
+
+void AttendanceCounters::start() {
+    try {
+        loadBaseline();
+    } catch (const std::exception& e) {
+        std::cerr << "⚠️ Счетчики посещаемости не загружены, статистика будет считаться запросами к БД: "
+                  << e.what() << std::endl;
+    }
+
+    if (reconcileInterval_.count() <= 0 || running_.exchange(true)) {
+        return;
+    }
+    reconcileThread_ = std::thread(&AttendanceCounters::reconcileLoop, this);
+}
+
+void AttendanceCounters::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!running_.exchange(false)) {
+            return;
+        }
+    }
+    wakeUp_.notify_all();
+    if (reconcileThread_.joinable()) {
+        reconcileThread_.join();
+    }
+}
+
+void AttendanceCounters::reconcileLoop() {
+    while (running_) {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            wakeUp_.wait_for(lock, reconcileInterval_, [this]() { return !running_; });
+        }
+        if (!running_) {
+            break;
+        }
+
+        try {
+            if (isLoaded()) {
+                reconcile();
+            } else {
+                loadBaseline();
+            }
+        } catch (const std::exception& e) {
+            std::cerr << "❌ Ошибка сверки счетчиков посещаемости: " << e.what() << std::endl;
+        }
+    }
+}
@@ -0,0 +1,95 @@
+#pragma once
+#include "../repositories/IAttendanceRepository.hpp"
+#include "../types/uuid.hpp"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <unordered_map>
+
+// Счетчики посещаемости в памяти. Базовые значения загружаются из БД один раз,
+// дальше AttendanceService применяет дельты при каждой записи посещаемости.
+// Итоги тип × статус хранятся в шардированных атомиках (запись без блокировок,
+// снимок - сумма фиксированного числа шардов), счетчики клиентов - в хеш-таблице,
+// разбитой на независимо блокируемые сегменты.
+class AttendanceCounters {
+public:
+    explicit AttendanceCounters(std::shared_ptr<IAttendanceRepository> attendanceRepo,
+                                std::chrono::seconds reconcileInterval = std::chrono::seconds(300));
+    ~AttendanceCounters();
+
+    AttendanceCounters(const AttendanceCounters&) = delete;
+    AttendanceCounters& operator=(const AttendanceCounters&) = delete;
+
+    void loadBaseline();
+    bool isLoaded() const { return loaded_.load(std::memory_order_acquire); }
+
+    // До первой загрузки базовых значений дельты не применяются: их учтет сама загрузка
+    void recordAttendance(const Attendance& attendance);
+    void record(const UUID& clientId, AttendanceType type, AttendanceStatus status, int delta = 1);
+
+    AttendanceCounts snapshot() const;
+    // nullopt, если базовые значения еще не загружены
+    std::optional<AttendanceCounts> clientSnapshot(const UUID& clientId) const;
+
+    // Сверка с БД. Поправка считается относительно снимка счетчиков, снятого до запроса,
+    // и применяется как дельта: записи, сделанные во время запроса, сохраняются.
+    // Запись, закоммиченная в окне между снимком и запросом, может быть учтена дважды
+    // до следующей сверки. Возвращает число исправленных ячеек тип × статус.
+    int reconcile();
+
+    // Загружает базовые значения (при ошибке - повторит фоновая сверка) и запускает сверку раз в reconcileInterval
+    void start();
+    void stop();
+
+private:
+    static constexpr std::size_t TYPE_COUNT = 2;
+    static constexpr std::size_t STATUS_COUNT = 4;
+    static constexpr std::size_t CELL_COUNT = TYPE_COUNT * STATUS_COUNT;
+    static constexpr std::size_t SHARD_COUNT = 16;
+    static constexpr std::size_t CLIENT_SEGMENT_COUNT = 64;
+
+    // Отдельная строка кеша на шард, чтобы потоки не делили линию при инкременте
+    struct alignas(64) Shard {
+        std::array<std::atomic<std::int64_t>, CELL_COUNT> cells;
+    };
+
+    struct ClientSegment {
+        mutable std::mutex mutex;
+        std::unordered_map<UUID, AttendanceCounts> counts;
+    };
+
+    std::shared_ptr<IAttendanceRepository> attendanceRepo_;
+    std::chrono::seconds reconcileInterval_;
+
+    std::array<Shard, SHARD_COUNT> shards_;
+    std::array<ClientSegment, CLIENT_SEGMENT_COUNT> clients_;
+    std::atomic<bool> loaded_{false};
+    std::atomic<bool> recording_{false};  // дельты применяются с начала первой загрузки
+    std::mutex reloadMutex_;  // loadBaseline и reconcile не выполняются одновременно
+
+    std::atomic<bool> running_{false};
+    std::thread reconcileThread_;
+    std::mutex mutex_;
+    std::condition_variable wakeUp_;
+
+    static std::size_t cellIndex(AttendanceType type, AttendanceStatus status);
+    Shard& localShard();
+    ClientSegment& segmentFor(const UUID& clientId);
+    const ClientSegment& segmentFor(const UUID& clientId) const;
+
+    using ClientMaps = std::array<std::unordered_map<UUID, AttendanceCounts>, CLIENT_SEGMENT_COUNT>;
+
+    ClientMaps copyClients() const;
+    // Загрузка и сверка: снимок, запрос к БД, поправка (БД - снимок); вызывается под reloadMutex_
+    int synchronize();
+    // Прибавляет (totals - before) к итогам; возвращает число измененных ячеек
+    int applyTotals(const AttendanceCounts& totals, const AttendanceCounts& before);
+    void applyClients(const std::map<UUID, AttendanceCounts>& byClient, const ClientMaps& before);
+    void reconcileLoop();
+};
@@ -1,15 +1,20 @@
 #include "AttendanceService.hpp"
+#include "../core/Logger.hpp"
 #include <iostream>
 
 AttendanceService::AttendanceService(
     std::shared_ptr<IAttendanceRepository> attendanceRepo,
     std::shared_ptr<IBookingRepository> bookingRepo,
     std::shared_ptr<IEnrollmentRepository> enrollmentRepo,
-    std::shared_ptr<ILessonRepository> lessonRepo
+    std::shared_ptr<ILessonRepository> lessonRepo,
+    std::shared_ptr<AttendanceCounters> counters,
+    std::shared_ptr<MonthlyRollupService> rollups
 ) : attendanceRepo_(std::move(attendanceRepo)),
     bookingRepo_(std::move(bookingRepo)),
     enrollmentRepo_(std::move(enrollmentRepo)),
-    lessonRepo_(std::move(lessonRepo)) {}
+    lessonRepo_(std::move(lessonRepo)),
+    counters_(std::move(counters)),
+    rollups_(std::move(rollups)) {}
 
 bool AttendanceService::createAttendanceForBooking(const UUID& bookingId, BookingStatus newStatus, const std::string& notes) {
     try {
@@ -41,7 +46,7 @@ bool AttendanceService::createAttendanceForBooking(const UUID& bookingId, Bookin
                 return false;
         }
         
-        return attendanceRepo_->save(attendance);
+        return saveAttendance(attendance, booking->getHallId());
         
     } catch (const std::exception& e) {
         std::cerr << "❌ Ошибка создания посещаемости для бронирования: " << e.what() << std::endl;
@@ -88,7 +93,7 @@ bool AttendanceService::createAttendanceForEnrollment(const UUID& enrollmentId,
                 return false;
         }
         
-        return attendanceRepo_->save(attendance);
+        return saveAttendance(attendance, lesson->getHallId());
         
     } catch (const std::exception& e) {
         std::cerr << "❌ Ошибка создания посещаемости для записи на занятие: " << e.what() << std::endl;
@@ -127,8 +132,8 @@ bool AttendanceService::shouldCreateAttendance(BookingStatus oldStatus, BookingS
                        (newStatus == BookingStatus::COMPLETED || newStatus == BookingStatus::CANCELLED);
     
     if (shouldCreate) {
-        std::cout << "📝 Создание посещаемости для бронирования: " 
-                  << static_cast<int>(oldStatus) << " -> " << static_cast<int>(newStatus) << std::endl;
+        LOG_DEBUG("AttendanceService", "📝 Создание посещаемости для бронирования: " 
+                  << static_cast<int>(oldStatus) << " -> " << static_cast<int>(newStatus));
     }
     
     return shouldCreate;
@@ -142,13 +147,26 @@ bool AttendanceService::shouldCreateAttendance(EnrollmentStatus oldStatus, Enrol
                         newStatus == EnrollmentStatus::MISSED);
     
     if (shouldCreate) {
-        std::cout << "📝 Создание посещаемости для записи: " 
-                  << static_cast<int>(oldStatus) << " -> " << static_cast<int>(newStatus) << std::endl;
+        LOG_DEBUG("AttendanceService", "📝 Создание посещаемости для записи: " 
+                  << static_cast<int>(oldStatus) << " -> " << static_cast<int>(newStatus));
     }
     
     return shouldCreate;
 }
 
+bool AttendanceService::saveAttendance(const Attendance& attendance, const UUID& hallId) {
+    if (!attendanceRepo_->save(attendance)) {
+        return false;
+    }
+    if (counters_) {
+        counters_->recordAttendance(attendance);
+    }
+    if (rollups_) {
+        rollups_->recordAttendance(attendance, hallId);
+    }
+    return true;
+}
+
 std::optional<Attendance> AttendanceService::findExistingAttendance(const UUID& entityId, AttendanceType type) {
     try {
         auto attendances = attendanceRepo_->findByEntityId(entityId);
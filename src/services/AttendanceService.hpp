@@ -2,6 +2,8 @@
 #define ATTENDANCE_SERVICE_HPP
 
 #include "IAttendanceService.hpp"  
+#include "AttendanceCounters.hpp"
+#include "MonthlyRollupService.hpp"
 #include "../repositories/IAttendanceRepository.hpp"
 #include "../repositories/IBookingRepository.hpp"
 #include "../repositories/IEnrollmentRepository.hpp"
@@ -17,13 +19,18 @@ private:
     std::shared_ptr<IBookingRepository> bookingRepo_;
     std::shared_ptr<IEnrollmentRepository> enrollmentRepo_;
     std::shared_ptr<ILessonRepository> lessonRepo_;
+    std::shared_ptr<AttendanceCounters> counters_;
+    std::shared_ptr<MonthlyRollupService> rollups_;
 
 public:
+    // counters и rollups (необязательно) получают дельту после каждой сохраненной записи посещаемости
     AttendanceService(
         std::shared_ptr<IAttendanceRepository> attendanceRepo,
         std::shared_ptr<IBookingRepository> bookingRepo,
         std::shared_ptr<IEnrollmentRepository> enrollmentRepo,
-        std::shared_ptr<ILessonRepository> lessonRepo
+        std::shared_ptr<ILessonRepository> lessonRepo,
+        std::shared_ptr<AttendanceCounters> counters = nullptr,
+        std::shared_ptr<MonthlyRollupService> rollups = nullptr
     );
 
     // Создание записей посещаемости при изменении статусов
@@ -51,6 +58,8 @@ private:
     bool shouldCreateAttendance(BookingStatus oldStatus, BookingStatus newStatus);
     bool shouldCreateAttendance(EnrollmentStatus oldStatus, EnrollmentStatus newStatus);
     std::optional<Attendance> findExistingAttendance(const UUID& entityId, AttendanceType type);
+    // hallId - зал бронирования или занятия, по нему запись относится к филиалу в помесячной статистике
+    bool saveAttendance(const Attendance& attendance, const UUID& hallId);
 };
 
 #endif // ATTENDANCE_SERVICE_HPP
\ No newline at end of file
@@ -4,9 +4,11 @@
 #include <random>
 #include <iostream>
 
-AuthService::AuthService(std::shared_ptr<IClientRepository> clientRepo)
+AuthService::AuthService(std::shared_ptr<IClientRepository> clientRepo,
+                         std::shared_ptr<MonthlyRollupService> rollups)
     : clientRepository_(std::move(clientRepo)), 
-      passwordHasher_(std::make_unique<PasswordHasher>()) {}
+      passwordHasher_(std::make_unique<PasswordHasher>()),
+      rollups_(std::move(rollups)) {}
 
 AuthResponseDTO AuthService::registerClient(const AuthRequestDTO& request) {
     std::cout << "🔧 AuthService::registerClient - Начало регистрации: " << request.email << std::endl;
@@ -34,6 +36,9 @@ AuthResponseDTO AuthService::registerClient(const AuthRequestDTO& request) {
     if (!clientRepository_->save(client)) {
         throw std::runtime_error("Failed to save client to database");
     }
+    if (rollups_) {
+        rollups_->recordNewClient(client);
+    }
     
     std::cout << "✅ AuthService::registerClient - Регистрация успешна: " << request.email << std::endl;
     return AuthResponseDTO(newId, client.getName(), client.getEmail(), "ACTIVE");
@@ -6,6 +6,7 @@
 #include "../types/uuid.hpp"
 #include "../services/exceptions/AuthException.hpp"
 #include "../core/PasswordHasher.hpp"
+#include "MonthlyRollupService.hpp"
 #include <memory>
 #include <string>
 
@@ -13,9 +14,12 @@ class AuthService {
 private:
     std::shared_ptr<IClientRepository> clientRepository_;
     std::unique_ptr<PasswordHasher> passwordHasher_;
+    std::shared_ptr<MonthlyRollupService> rollups_;
 
 public:
-    explicit AuthService(std::shared_ptr<IClientRepository> clientRepo);
+    // rollups (необязательно) учитывает регистрации в помесячной статистике
+    explicit AuthService(std::shared_ptr<IClientRepository> clientRepo,
+                         std::shared_ptr<MonthlyRollupService> rollups = nullptr);
     
     // Основные методы аутентификации
     AuthResponseDTO registerClient(const AuthRequestDTO& request);
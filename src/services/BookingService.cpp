@@ -1,5 +1,7 @@
 #include "BookingService.hpp"
+#include "../core/Logger.hpp"
 #include <algorithm>
+#include <set>
 
 // Constructor
 BookingService::BookingService(
@@ -19,13 +21,13 @@ BookingService::BookingService(
     attendanceService_(std::move(attendanceService)) {} 
 
 // Validation methods
-void BookingService::validateBookingRequest(const BookingRequestDTO& request) const {
+void BookingService::validateBookingRequest(const BookingRequestDTO& request, RequestContext& context) const {
     if (!request.validate()) {
         throw ValidationException("Invalid booking request data");
     }
     
-    validateClient(request.clientId);
-    validateDanceHall(request.hallId);
+    validateClient(request.clientId, context);
+    validateDanceHall(request.hallId, context);
     validateTimeSlot(request.timeSlot);
 
     validateWorkingHours(request.hallId, request.timeSlot);
@@ -35,8 +37,7 @@ void BookingService::validateBookingRequest(const BookingRequestDTO& request) co
     }
 }
 
-void BookingService::validateClient(const UUID& clientId) const {
-    auto client = clientRepository_->findById(clientId);
+static void checkClient(const std::optional<Client>& client) {
     if (!client) {
         throw ValidationException("Client not found");
     }
@@ -46,12 +47,26 @@ void BookingService::validateClient(const UUID& clientId) const {
     }
 }
 
+void BookingService::validateClient(const UUID& clientId) const {
+    checkClient(clientRepository_->findById(clientId));
+}
+
+void BookingService::validateClient(const UUID& clientId, RequestContext& context) const {
+    checkClient(context.findById(*clientRepository_, clientId));
+}
+
 void BookingService::validateDanceHall(const UUID& hallId) const {
     if (!hallRepository_->exists(hallId)) {
         throw ValidationException("Dance hall not found");
     }
 }
 
+void BookingService::validateDanceHall(const UUID& hallId, RequestContext& context) const {
+    if (!context.exists(*hallRepository_, hallId)) {
+        throw ValidationException("Dance hall not found");
+    }
+}
+
 void BookingService::validateTimeSlot(const TimeSlot& timeSlot) const {
     if (!timeSlot.isValid()) {
         throw ValidationException("Invalid time slot");
@@ -115,7 +130,8 @@ void BookingService::checkBookingConflicts(const UUID& hallId, const TimeSlot& t
 }
 
 BookingResponseDTO BookingService::createBooking(const BookingRequestDTO& request) {
-    validateBookingRequest(request);
+    RequestContext context;
+    validateBookingRequest(request, context);
     
     if (!canClientBook(request.clientId)) {
         throw BusinessRuleException("Client cannot create new booking");
@@ -128,7 +144,7 @@ BookingResponseDTO BookingService::createBooking(const BookingRequestDTO& reques
     Booking booking(newId, request.clientId, request.hallId, request.timeSlot, request.purpose);
     booking.confirm();
     
-    if (!bookingRepository_->save(booking)) {
+    if (!context.save(*bookingRepository_, booking)) {
         throw BookingException("Failed to save booking");
     }
     
@@ -220,7 +236,7 @@ std::vector<BookingResponseDTO> BookingService::getClientBookings(const UUID& cl
 }
 
 std::vector<BookingResponseDTO> BookingService::getDanceHallBookings(const UUID& hallId) {  
-    validateDanceHall(hallId);  
+    validateDanceHall(hallId);
     
     auto bookings = bookingRepository_->findByHallId(hallId);
     std::vector<BookingResponseDTO> result;
@@ -301,65 +317,43 @@ std::optional<DanceHall> BookingService::getHallById(const UUID& hallId) const {
     }
 }
 
+// Залы по списку ID одним запросом
+std::vector<DanceHall> BookingService::getHallsByIds(const std::vector<UUID>& hallIds) const {
+    try {
+        return hallRepository_->findByIds(hallIds);
+    } catch (const std::exception& e) {
+        std::cerr << "Ошибка получения залов: " << e.what() << std::endl;
+        return {};
+    }
+}
+
 // Новый метод для получения максимальной доступной продолжительности
 std::vector<int> BookingService::getAvailableDurations(const UUID& hallId, 
                                                       const std::chrono::system_clock::time_point& startTime) const {
     try {
-        std::cout << "⏱️ Расчет доступных продолжительностей для зала " << hallId.toString() 
-                  << " в " << DateTimeUtils::formatTime(startTime) << std::endl; // Используем DateTimeUtils
+        LOG_DEBUG("BookingService", "⏱️ Расчет доступных продолжительностей для зала " << hallId.toString() 
+                  << " в " << DateTimeUtils::formatTime(startTime)); // Используем DateTimeUtils
         
         validateDanceHall(hallId);
         
-        // Получаем все бронирования для зала
-        auto bookings = bookingRepository_->findByHallId(hallId);
-        
-        // Фильтруем бронирования на выбранный день с помощью DateTimeUtils
-        auto dayBookings = filterBookingsByDate(bookings, startTime);
+        std::optional<WorkingHours> workingHours;
+        auto branch = getBranchForHall(hallId);
+        if (branch) {
+            workingHours = branch->getWorkingHours();
+        }
         
-        // Возможные продолжительности в минутах
-        std::vector<int> possibleDurations = {60, 120, 180, 240}; // 1, 2, 3, 4 часа
-        std::vector<int> availableDurations;
+        // Занятость зала загружаем одним запросом на весь диапазон возможных продолжительностей
+        auto availability = loadHallAvailability(
+            hallId, startTime, startTime + std::chrono::minutes(HallAvailability::maxCandidateDuration()), workingHours);
+        auto availableDurations = availability.availableDurations(startTime);
         
-        // Проверяем каждую продолжительность
-        for (int duration : possibleDurations) {
-            TimeSlot proposedSlot(startTime, duration);
-            
-            // Проверяем, что слот не конфликтует с существующими бронированиями
-            bool isAvailable = true;
-            for (const auto& booking : dayBookings) {
-                if (booking.getTimeSlot().overlapsWith(proposedSlot) && 
-                    !booking.isCancelled() && !booking.isCompleted()) {
-                    isAvailable = false;
-                    break;
-                }
-            }
-            
-            // Дополнительная проверка через isTimeSlotAvailable
-            if (isAvailable && !isTimeSlotAvailable(hallId, proposedSlot)) {
-                isAvailable = false;
-            }
-            
-            // Проверяем рабочие часы с помощью DateTimeUtils
-            if (isAvailable) {
-                auto branch = getBranchForHall(hallId);
-                if (branch) {
-                    auto workingHours = branch->getWorkingHours();
-                    if (!DateTimeUtils::isTimeInRange(proposedSlot.getEndTime(), workingHours.openTime, workingHours.closeTime)) {
-                        isAvailable = false;
-                    }
-                }
+        if (Logger::getInstance().isEnabled(LogLevel::DEBUG)) {
+            std::string durations;
+            for (int dur : availableDurations) {
+                durations += std::to_string(dur / 60) + "ч ";
             }
-            
-            if (isAvailable) {
-                availableDurations.push_back(duration);
-            }
-        }
-        
-        std::cout << "✅ Доступные продолжительности: ";
-        for (int dur : availableDurations) {
-            std::cout << dur/60 << "ч ";
+            LOG_DEBUG("BookingService", "✅ Доступные продолжительности: " << durations);
         }
-        std::cout << std::endl;
         
         return availableDurations;
         
@@ -379,14 +373,8 @@ std::vector<TimeSlot> BookingService::getAvailableTimeSlots(const UUID& hallId,
             throw ValidationException("Не удалось определить филиал зала");
         }
         
-        // Получаем все бронирования для зала
-        auto bookings = bookingRepository_->findByHallId(hallId);
-        
-        // Фильтруем бронирования по дате
-        auto dayBookings = filterBookingsByDate(bookings, date);
-        
         // Генерируем доступные слоты с учетом часового пояса филиала
-        return generateAvailableSlotsWithTimezone(date, branch->getWorkingHours(), dayBookings, hallId, branch->getTimezoneOffset());
+        return generateAvailableSlotsWithTimezone(date, branch->getWorkingHours(), hallId, branch->getTimezoneOffset());
         
     } catch (const std::exception& e) {
         std::cerr << "Ошибка получения доступных слотов: " << e.what() << std::endl;
@@ -394,6 +382,169 @@ std::vector<TimeSlot> BookingService::getAvailableTimeSlots(const UUID& hallId,
     }
 }
 
+HallAvailability BookingService::loadHallAvailability(const UUID& hallId,
+                                                       const std::chrono::system_clock::time_point& from,
+                                                       const std::chrono::system_clock::time_point& to,
+                                                       const std::optional<WorkingHours>& workingHours) const {
+    std::vector<TimeSlot> busySlots;
+    
+    // TimeSlot ограничен сутками, поэтому длинный диапазон запрашиваем частями
+    const auto maxChunk = std::chrono::hours(24);
+    const auto minChunk = std::chrono::minutes(15);
+    
+    for (auto chunkStart = from; chunkStart < to; chunkStart += maxChunk) {
+        auto chunkLength = std::min<std::chrono::system_clock::duration>(to - chunkStart, maxChunk);
+        auto chunkMinutes = std::max(std::chrono::duration_cast<std::chrono::minutes>(chunkLength), minChunk);
+        TimeSlot window(chunkStart, static_cast<int>(chunkMinutes.count()));
+        
+        // Репозиторий возвращает только активные бронирования (PENDING/CONFIRMED)
+        for (const auto& booking : bookingRepository_->findConflictingBookings(hallId, window)) {
+            busySlots.push_back(booking.getTimeSlot());
+        }
+        for (const auto& lesson : lessonRepository_->findConflictingLessons(hallId, window)) {
+            busySlots.push_back(lesson.getTimeSlot());
+        }
+    }
+    
+    return HallAvailability(busySlots, workingHours);
+}
+
+std::vector<HallDayAvailabilityDTO> BookingService::getBranchAvailability(
+    const UUID& branchId,
+    const std::chrono::system_clock::time_point& fromDate,
+    int days) const {
+    try {
+        if (days < 1 || days > MAX_AVAILABILITY_DAYS) {
+            throw ValidationException("Количество дней должно быть от 1 до " + std::to_string(MAX_AVAILABILITY_DAYS));
+        }
+        
+        auto branch = branchService_->getBranchById(branchId);
+        if (!branch) {
+            throw ValidationException("Филиал не найден");
+        }
+        
+        auto halls = hallRepository_->findByBranchId(branchId);
+        if (halls.empty()) {
+            return {};
+        }
+        
+        auto workingHours = branch->getWorkingHours();
+        auto timezoneOffset = branch->getTimezoneOffset();
+        
+        // Начало первых местных суток филиала в UTC
+        auto local_time_t = std::chrono::system_clock::to_time_t(fromDate + timezoneOffset);
+        std::tm local_tm = *std::gmtime(&local_time_t);
+        local_tm.tm_hour = 0;
+        local_tm.tm_min = 0;
+        local_tm.tm_sec = 0;
+        auto firstDayStart = std::chrono::system_clock::from_time_t(DateTimeUtils::timegm(&local_tm)) - timezoneOffset;
+        
+        std::vector<std::chrono::system_clock::time_point> dayStarts;
+        for (int day = 0; day < days; ++day) {
+            dayStarts.push_back(firstDayStart + std::chrono::hours(24 * day));
+        }
+        
+        std::vector<UUID> hallIds;
+        for (const auto& hall : halls) {
+            hallIds.push_back(hall.getId());
+        }
+        
+        // Два запроса на весь филиал и весь период вместо запросов на каждый зал, день и слот
+        auto from = dayStarts.front() + workingHours.openTime;
+        auto to = dayStarts.back() + workingHours.closeTime + std::chrono::minutes(HallAvailability::MAX_DURATION_MINUTES);
+        auto bookings = bookingRepository_->findConflictingBookingsInRange(hallIds, from, to);
+        auto lessons = lessonRepository_->findConflictingLessonsInRange(hallIds, from, to);
+        
+        HallOccupancyGrid grid(hallIds, dayStarts);
+        for (const auto& booking : bookings) {
+            auto slot = booking.getTimeSlot();
+            grid.markBusy(booking.getHallId(), slot.getStartTime(), slot.getEndTime());
+        }
+        for (const auto& lesson : lessons) {
+            grid.markBusy(lesson.getHallId(), lesson.getStartTime(),
+                         lesson.getStartTime() + std::chrono::minutes(lesson.getDurationMinutes()));
+        }
+        
+        std::vector<HallDayAvailabilityDTO> availability;
+        availability.reserve(hallIds.size() * dayStarts.size());
+        
+        for (const auto& hallId : hallIds) {
+            for (size_t day = 0; day < grid.dayCount(); ++day) {
+                HallDayAvailabilityDTO hallDay{hallId, grid.dayStart(day), {}};
+                
+                for (auto hour = workingHours.openTime; hour < workingHours.closeTime; ++hour) {
+                    auto slotStart = grid.dayStart(day) + hour;
+                    
+                    // Те же правила, что и в getAvailableTimeSlots: минимальная доступная продолжительность
+                    for (int duration : HallAvailability::candidateDurations()) {
+                        if (!grid.isFree(hallId, day, slotStart, duration)) {
+                            break;
+                        }
+                        auto slotEnd = slotStart + std::chrono::minutes(duration);
+                        if (DateTimeUtils::isTimeInRange(slotEnd, workingHours.openTime, workingHours.closeTime)) {
+                            hallDay.availableSlots.emplace_back(slotStart, duration);
+                            break;
+                        }
+                    }
+                }
+                
+                availability.push_back(std::move(hallDay));
+            }
+        }
+        
+        LOG_DEBUG("BookingService", "✅ Сетка доступности филиала: залов " << hallIds.size() << ", дней " << days);
+        return availability;
+        
+    } catch (const std::exception& e) {
+        std::cerr << "❌ Ошибка получения доступности филиала: " << e.what() << std::endl;
+        return {};
+    }
+}
+
+std::optional<DanceHall> BookingService::findAnyFreeHall(const UUID& branchId, const TimeSlot& timeSlot) const {
+    try {
+        auto branch = branchService_->getBranchById(branchId);
+        if (!branch) {
+            throw ValidationException("Филиал не найден");
+        }
+        
+        if (!TimeZoneService::isWithinLocalWorkingHours(timeSlot, branch->getWorkingHours(), branch->getTimezoneOffset())) {
+            return std::nullopt;
+        }
+        
+        auto halls = hallRepository_->findByBranchId(branchId);
+        if (halls.empty()) {
+            return std::nullopt;
+        }
+        
+        std::vector<UUID> hallIds;
+        for (const auto& hall : halls) {
+            hallIds.push_back(hall.getId());
+        }
+        
+        std::set<UUID> busyHalls;
+        for (const auto& booking : bookingRepository_->findConflictingBookingsInRange(
+                 hallIds, timeSlot.getStartTime(), timeSlot.getEndTime())) {
+            busyHalls.insert(booking.getHallId());
+        }
+        for (const auto& lesson : lessonRepository_->findConflictingLessonsInRange(
+                 hallIds, timeSlot.getStartTime(), timeSlot.getEndTime())) {
+            busyHalls.insert(lesson.getHallId());
+        }
+        
+        for (const auto& hall : halls) {
+            if (busyHalls.count(hall.getId()) == 0) {
+                return hall;
+            }
+        }
+        return std::nullopt;
+        
+    } catch (const std::exception& e) {
+        std::cerr << "❌ Ошибка поиска свободного зала: " << e.what() << std::endl;
+        return std::nullopt;
+    }
+}
+
 // Вспомогательный метод для фильтрации бронирований по дате
 std::vector<Booking> BookingService::filterBookingsByDate(const std::vector<Booking>& bookings, 
                                                          const std::chrono::system_clock::time_point& date) const {
@@ -468,7 +619,6 @@ std::vector<DanceHall> BookingService::getHallsByBranch(const UUID& branchId) co
 std::vector<TimeSlot> BookingService::generateAvailableSlotsWithTimezone(
     const std::chrono::system_clock::time_point& date,
     const WorkingHours& workingHours,
-    const std::vector<Booking>& existingBookings,
     const UUID& hallId,
     const std::chrono::minutes& timezoneOffset) const {
     
@@ -482,8 +632,9 @@ std::vector<TimeSlot> BookingService::generateAvailableSlotsWithTimezone(
     int startHour = workingHours.openTime.count();
     int endHour = workingHours.closeTime.count();
     
-    std::cout << "🕐 Генерация слотов с " << startHour << ":00 до " << endHour << ":00 (локальное время филиала)" << std::endl;
+    LOG_DEBUG("BookingService", "🕐 Генерация слотов с " << startHour << ":00 до " << endHour << ":00 (локальное время филиала)");
     
+    std::vector<std::chrono::system_clock::time_point> slotStarts;
     for (int hour = startHour; hour < endHour; hour++) {
         for (int minute = 0; minute < 60; minute += 60) {
             local_tm.tm_hour = hour;
@@ -494,20 +645,31 @@ std::vector<TimeSlot> BookingService::generateAvailableSlotsWithTimezone(
             auto localSlotStart = std::chrono::system_clock::from_time_t(DateTimeUtils::timegm(&local_tm));
             
             // Преобразуем обратно в UTC для хранения
-            auto utcSlotStart = localSlotStart - timezoneOffset;
-            
-            // Проверяем доступные продолжительности
-            auto availableDurations = getAvailableDurations(hallId, utcSlotStart);
-            
-            if (!availableDurations.empty()) {
-                int minDuration = *std::min_element(availableDurations.begin(), availableDurations.end());
-                TimeSlot slot(utcSlotStart, minDuration);
-                availableSlots.push_back(slot);
-            }
+            slotStarts.push_back(localSlotStart - timezoneOffset);
+        }
+    }
+    
+    if (slotStarts.empty()) {
+        LOG_DEBUG("BookingService", "✅ Сгенерировано слотов: 0");
+        return availableSlots;
+    }
+    
+    // Один проход: занятость на весь день загружается один раз, слоты проверяются в памяти
+    auto availability = loadHallAvailability(
+        hallId, slotStarts.front(),
+        slotStarts.back() + std::chrono::minutes(HallAvailability::maxCandidateDuration()), workingHours);
+    
+    for (const auto& utcSlotStart : slotStarts) {
+        auto availableDurations = availability.availableDurations(utcSlotStart);
+        
+        if (!availableDurations.empty()) {
+            int minDuration = *std::min_element(availableDurations.begin(), availableDurations.end());
+            TimeSlot slot(utcSlotStart, minDuration);
+            availableSlots.push_back(slot);
         }
     }
     
-    std::cout << "✅ Сгенерировано слотов: " << availableSlots.size() << std::endl;
+    LOG_DEBUG("BookingService", "✅ Сгенерировано слотов: " << availableSlots.size());
     return availableSlots;
 }
 
@@ -6,6 +6,7 @@
 #include "../repositories/IAttendanceRepository.hpp"
 #include "../repositories/ILessonRepository.hpp"
 #include "AttendanceService.hpp"
+#include "RequestContext.hpp"
 #include "IBranchService.hpp" 
 #include "../dtos/BookingDTO.hpp"
 #include "../types/uuid.hpp"
@@ -13,6 +14,8 @@
 #include "exceptions/ValidationException.hpp"
 #include "../data/DateTimeUtils.hpp"
 #include "TimeZoneService.hpp"
+#include "HallAvailability.hpp"
+#include "HallOccupancyGrid.hpp"
 #include <memory>
 #include <vector>
 #include <iostream>
@@ -28,9 +31,13 @@ private:
     std::shared_ptr<AttendanceService> attendanceService_;
 
     // Validation methods
-    void validateBookingRequest(const BookingRequestDTO& request) const;
+    // Загруженные при проверке сущности запоминаются в context и переиспользуются операцией
+    void validateBookingRequest(const BookingRequestDTO& request, RequestContext& context) const;
+    void validateClient(const UUID& clientId, RequestContext& context) const;
+    void validateDanceHall(const UUID& hallId, RequestContext& context) const;
+    // Для операций с единственным обращением к сущности контекст не нужен
     void validateClient(const UUID& clientId) const;
-    void validateDanceHall(const UUID& hallId) const; 
+    void validateDanceHall(const UUID& hallId) const;
     void validateTimeSlot(const TimeSlot& timeSlot) const;
     void validateWorkingHours(const UUID& hallId, const TimeSlot& timeSlot) const;
     void checkBookingConflicts(const UUID& hallId, const TimeSlot& timeSlot, 
@@ -57,9 +64,15 @@ private:
     std::vector<TimeSlot> generateAvailableSlotsWithTimezone(
         const std::chrono::system_clock::time_point& date,
         const WorkingHours& workingHours,
-        const std::vector<Booking>& existingBookings,
         const UUID& hallId,
         const std::chrono::minutes& timezoneOffset) const;
+    // Загружает бронирования и занятия зала на интервале [from, to) для проверки слотов в памяти
+    HallAvailability loadHallAvailability(const UUID& hallId,
+                                          const std::chrono::system_clock::time_point& from,
+                                          const std::chrono::system_clock::time_point& to,
+                                          const std::optional<WorkingHours>& workingHours) const;
+
+    static constexpr int MAX_AVAILABILITY_DAYS = 31;
 
 public:
     // Constructor with dependency injection
@@ -82,10 +95,17 @@ public:
     bool isTimeSlotAvailable(const UUID& hallId, const TimeSlot& timeSlot) const;
     std::vector<DanceHall> getAllHalls() const;
     std::optional<DanceHall> getHallById(const UUID& hallId) const;
+    std::vector<DanceHall> getHallsByIds(const std::vector<UUID>& hallIds) const;
     std::vector<TimeSlot> getAvailableTimeSlots(const UUID& hallId, 
                                                const std::chrono::system_clock::time_point& date) const;
     std::vector<int> getAvailableDurations(const UUID& hallId, 
                                           const std::chrono::system_clock::time_point& startTime) const;
+    // Свободные слоты всех залов филиала на days суток, начиная с суток fromDate
+    std::vector<HallDayAvailabilityDTO> getBranchAvailability(const UUID& branchId,
+                                                             const std::chrono::system_clock::time_point& fromDate,
+                                                             int days) const;
+    // Любой зал филиала, свободный на весь слот
+    std::optional<DanceHall> findAnyFreeHall(const UUID& branchId, const TimeSlot& timeSlot) const;
 
     std::vector<Branch> getAllBranches() const;
     std::vector<DanceHall> getHallsByBranch(const UUID& branchId) const;
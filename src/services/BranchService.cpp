@@ -3,9 +3,11 @@
 
 BranchService::BranchService(
     std::shared_ptr<IBranchRepository> branchRepo,
-    std::shared_ptr<IDanceHallRepository> hallRepo
+    std::shared_ptr<IDanceHallRepository> hallRepo,
+    std::shared_ptr<ReferenceDataCache> referenceData
 ) : branchRepository_(std::move(branchRepo)),
-    hallRepository_(std::move(hallRepo)) {}
+    hallRepository_(std::move(hallRepo)),
+    referenceData_(std::move(referenceData)) {}
 
 std::vector<Branch> BranchService::getAllBranches() {
     try {
@@ -45,6 +47,10 @@ std::string BranchService::getBranchName(const UUID& branchId) {
 
 std::optional<Branch> BranchService::getBranchForHall(const UUID& hallId) {
     try {
+        if (referenceData_) {
+            return referenceData_->getBranchForHall(hallId);
+        }
+        
         // Получаем зал
         auto hall = hallRepository_->findById(hallId);
         if (!hall) {
@@ -3,6 +3,7 @@
 #include "IBranchService.hpp"  
 #include "../repositories/IBranchRepository.hpp"
 #include "../repositories/IDanceHallRepository.hpp"
+#include "ReferenceDataCache.hpp"
 #include "../models/Branch.hpp"
 #include "../models/DanceHall.hpp"
 #include "../types/uuid.hpp"
@@ -13,11 +14,14 @@ class BranchService : public IBranchService {  // НАСЛЕДОВАНИЕ ОТ
 private:
     std::shared_ptr<IBranchRepository> branchRepository_;
     std::shared_ptr<IDanceHallRepository> hallRepository_;
+    // Необязательный кеш справочных данных: зал → филиал одним поиском в памяти
+    std::shared_ptr<ReferenceDataCache> referenceData_;
 
 public:
     BranchService(
         std::shared_ptr<IBranchRepository> branchRepo,
-        std::shared_ptr<IDanceHallRepository> hallRepo
+        std::shared_ptr<IDanceHallRepository> hallRepo,
+        std::shared_ptr<ReferenceDataCache> referenceData = nullptr
     );
 
     std::vector<Branch> getAllBranches() override;
@@ -2,32 +2,49 @@
 #include <memory>
 #include <atomic>
 #include <chrono>
+#include <cstdint>
 #include <mutex>
 #include <thread>
 #include <condition_variable>
 
+// Глобальное состояние доступности БД.
+// Запросные потоки только читают состояние (без блокировок и проверочных запросов),
+// проверку выполняет фоновый поток.
 class DatabaseHealthService {
 private:
     static std::atomic<bool> isDatabaseHealthy_;
+    static std::atomic<std::int64_t> lastSuccessTicks_;
+    static std::atomic<std::int64_t> nextRetryTicks_;
+    static std::atomic<int> consecutiveFailures_;
     static std::chrono::system_clock::time_point lastUnhealthyTime_;
     static std::mutex checkMutex_;
     static std::atomic<bool> monitoringActive_;
+    static std::atomic<bool> probeRequested_;
     static std::thread monitoringThread_;
     static std::condition_variable monitoringCondition_;
     static std::mutex monitoringMutex_;
-    
+
     static const std::chrono::seconds RETRY_INTERVAL_;
     static const std::chrono::seconds MONITORING_INTERVAL_;
 
     static void monitoringLoop();
+    static std::chrono::milliseconds computeBackoff(int failures, std::chrono::milliseconds baseDelay);
 
 public:
     static void startMonitoring();
     static void stopMonitoring();
     static bool isDatabaseHealthy();
     static void markDatabaseHealthy();
-    static void markDatabaseUnhealthy();
+    // baseDelay - начальная задержка экспоненциального backoff со случайным разбросом
+    static void markDatabaseUnhealthy(std::chrono::milliseconds baseDelay = std::chrono::milliseconds(1000));
+    // Не блокирует: true, если БД здорова или истекло окно backoff (пропускаем пробный запрос)
     static bool shouldRetryConnection();
     static void waitForRetry();
     static bool testConnection();
-};
\ No newline at end of file
+
+    // Успешный запрос подтверждает доступность БД без отдельной проверки
+    static void recordSuccess();
+    // Ошибка соединения в рабочем запросе: фоновый поток проверит БД немедленно
+    static void reportConnectionFailure();
+    static std::chrono::steady_clock::duration timeSinceLastSuccess();
+};
@@ -2,15 +2,32 @@
 #include <thread>
 #include <atomic>
 #include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
 #include "DatabaseHealthService.hpp"
 
+class DatabaseConnection;
+
+// Фоновая проверка пула: SELECT 1 выполняется только если за интервал
+// не было ни одного успешного рабочего запроса; заодно закрываются простаивающие соединения
 class DatabaseMonitorService {
 private:
+    std::shared_ptr<DatabaseConnection> connection_;
+    std::chrono::seconds interval_;
     std::atomic<bool> running_{false};
     std::thread monitorThread_;
-    
+    std::mutex mutex_;
+    std::condition_variable wakeUp_;
+
+    bool probe();
+
 public:
+    explicit DatabaseMonitorService(std::shared_ptr<DatabaseConnection> connection,
+                                    std::chrono::seconds interval = std::chrono::seconds(30));
+    ~DatabaseMonitorService();
+
     void start();
     void stop();
     void monitorLoop();
-};
\ No newline at end of file
+};
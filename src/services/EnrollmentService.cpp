@@ -11,13 +11,13 @@ EnrollmentService::EnrollmentService(
     lessonRepository_(std::move(lessonRepo)),
     attendanceService_(std::move(attendanceService)) {}
 
-void EnrollmentService::validateEnrollmentRequest(const EnrollmentRequestDTO& request) const {
+void EnrollmentService::validateEnrollmentRequest(const EnrollmentRequestDTO& request, RequestContext& context) const {
     if (!request.validate()) {
         throw ValidationException("Invalid enrollment request data");
     }
     
-    validateClient(request.clientId);
-    validateLesson(request.lessonId);
+    validateClient(request.clientId, context);
+    validateLesson(request.lessonId, context);
     
     // Проверяем, что клиент еще не записан на это занятие
     if (isClientEnrolled(request.clientId, request.lessonId)) {
@@ -25,8 +25,7 @@ void EnrollmentService::validateEnrollmentRequest(const EnrollmentRequestDTO& re
     }
 }
 
-void EnrollmentService::validateClient(const UUID& clientId) const {
-    auto client = clientRepository_->findById(clientId);
+static void checkClient(const std::optional<Client>& client) {
     if (!client) {
         throw ValidationException("Client not found");
     }
@@ -36,8 +35,7 @@ void EnrollmentService::validateClient(const UUID& clientId) const {
     }
 }
 
-void EnrollmentService::validateLesson(const UUID& lessonId) const {
-    auto lesson = lessonRepository_->findById(lessonId);
+static void checkLesson(const std::optional<Lesson>& lesson) {
     if (!lesson) {
         throw ValidationException("Lesson not found");
     }
@@ -47,11 +45,28 @@ void EnrollmentService::validateLesson(const UUID& lessonId) const {
     }
 }
 
+void EnrollmentService::validateClient(const UUID& clientId) const {
+    checkClient(clientRepository_->findById(clientId));
+}
+
+void EnrollmentService::validateClient(const UUID& clientId, RequestContext& context) const {
+    checkClient(context.findById(*clientRepository_, clientId));
+}
+
+void EnrollmentService::validateLesson(const UUID& lessonId) const {
+    checkLesson(lessonRepository_->findById(lessonId));
+}
+
+void EnrollmentService::validateLesson(const UUID& lessonId, RequestContext& context) const {
+    checkLesson(context.findById(*lessonRepository_, lessonId));
+}
+
 EnrollmentResponseDTO EnrollmentService::enrollClient(const EnrollmentRequestDTO& request) {
-    validateEnrollmentRequest(request);
+    RequestContext context;
+    validateEnrollmentRequest(request, context);
     
-    // Проверяем бизнес-правила через LessonService
-    auto lesson = lessonRepository_->findById(request.lessonId);
+    // Занятие уже загружено в validateLesson
+    auto lesson = context.findById(*lessonRepository_, request.lessonId);
     if (!lesson) {
         throw EnrollmentException("Lesson not found");
     }
@@ -70,7 +85,7 @@ EnrollmentResponseDTO EnrollmentService::enrollClient(const EnrollmentRequestDTO
     
     // Обновляем количество участников в занятии
     lesson->addParticipant();
-    if (!lessonRepository_->update(*lesson)) {
+    if (!context.update(*lessonRepository_, *lesson)) {
         // Откатываем запись если не удалось обновить занятие
         enrollmentRepository_->remove(newId);
         throw EnrollmentException("Failed to update lesson participants count");
@@ -4,6 +4,7 @@
 #include "../repositories/ILessonRepository.hpp"
 #include "../repositories/IAttendanceRepository.hpp"
 #include "AttendanceService.hpp"
+#include "RequestContext.hpp"
 #include "../dtos/EnrollmentDTO.hpp"
 #include "../types/uuid.hpp"
 #include "exceptions/ValidationException.hpp"
@@ -20,7 +21,11 @@ private:
     std::shared_ptr<AttendanceService> attendanceService_;  
     
 
-    void validateEnrollmentRequest(const EnrollmentRequestDTO& request) const;
+    // Загруженные при проверке сущности запоминаются в context и переиспользуются операцией
+    void validateEnrollmentRequest(const EnrollmentRequestDTO& request, RequestContext& context) const;
+    void validateClient(const UUID& clientId, RequestContext& context) const;
+    void validateLesson(const UUID& lessonId, RequestContext& context) const;
+    // Для операций с единственным обращением к сущности контекст не нужен
     void validateClient(const UUID& clientId) const;
     void validateLesson(const UUID& lessonId) const;
 
@@ -0,0 +1,69 @@
+#include "HallAvailability.hpp"
+#include "../data/DateTimeUtils.hpp"
+#include <algorithm>
+
+const std::vector<int>& HallAvailability::candidateDurations() {
+    static const std::vector<int> durations = {60, 120, 180, MAX_DURATION_MINUTES}; // 1, 2, 3, 4 часа
+    return durations;
+}
+
+int HallAvailability::maxCandidateDuration() {
+    return candidateDurations().back();
+}
+
+HallAvailability::HallAvailability(const std::vector<TimeSlot>& busySlots,
+                                   std::optional<WorkingHours> workingHours)
+    : workingHours_(std::move(workingHours)) {
+    std::vector<Interval> intervals;
+    intervals.reserve(busySlots.size());
+    for (const auto& slot : busySlots) {
+        intervals.push_back({slot.getStartTime(), slot.getEndTime()});
+    }
+
+    std::sort(intervals.begin(), intervals.end(), [](const Interval& a, const Interval& b) {
+        return a.start < b.start;
+    });
+
+    // Сливаем пересекающиеся интервалы. Касающиеся интервалы не сливаем:
+    // слот между ними нулевой длины все равно невозможен, а overlapsWith их не считает пересечением
+    for (const auto& interval : intervals) {
+        if (!busy_.empty() && interval.start < busy_.back().end) {
+            busy_.back().end = std::max(busy_.back().end, interval.end);
+        } else {
+            busy_.push_back(interval);
+        }
+    }
+}
+
+bool HallAvailability::isFree(TimePoint start, int durationMinutes) const {
+    auto end = start + std::chrono::minutes(durationMinutes);
+
+    // Первый занятый интервал, который заканчивается позже начала слота
+    auto it = std::upper_bound(busy_.begin(), busy_.end(), start, [](TimePoint time, const Interval& interval) {
+        return time < interval.end;
+    });
+
+    return it == busy_.end() || !(it->start < end);
+}
+
+std::vector<int> HallAvailability::availableDurations(TimePoint start) const {
+    std::vector<int> available;
+
+    for (int duration : candidateDurations()) {
+        if (!isFree(start, duration)) {
+            // Более длинный слот пересечется с тем же интервалом
+            break;
+        }
+
+        if (workingHours_) {
+            auto end = start + std::chrono::minutes(duration);
+            if (!DateTimeUtils::isTimeInRange(end, workingHours_->openTime, workingHours_->closeTime)) {
+                continue;
+            }
+        }
+
+        available.push_back(duration);
+    }
+
+    return available;
+}
@@ -0,0 +1,40 @@
+#pragma once
+#include "../models/TimeSlot.hpp"
+#include "../models/Branch.hpp"
+#include <chrono>
+#include <optional>
+#include <vector>
+
+// Занятость одного зала на интервале времени.
+// Строится один раз по загруженным бронированиям и занятиям, после чего
+// любое число слотов проверяется в памяти без обращений к БД.
+class HallAvailability {
+public:
+    using TimePoint = std::chrono::system_clock::time_point;
+
+    // Самая длинная из предлагаемых продолжительностей (в минутах)
+    static constexpr int MAX_DURATION_MINUTES = 240;
+
+    // Продолжительности, которые предлагаются клиенту (в минутах)
+    static const std::vector<int>& candidateDurations();
+    static int maxCandidateDuration();
+
+    HallAvailability(const std::vector<TimeSlot>& busySlots,
+                     std::optional<WorkingHours> workingHours);
+
+    // Слот не пересекается ни с одним занятым интервалом
+    bool isFree(TimePoint start, int durationMinutes) const;
+
+    // Те же правила, что и у BookingService::getAvailableDurations
+    std::vector<int> availableDurations(TimePoint start) const;
+
+private:
+    struct Interval {
+        TimePoint start;
+        TimePoint end;
+    };
+
+    // Отсортированы по началу и объединены, поэтому концы тоже возрастают
+    std::vector<Interval> busy_;
+    std::optional<WorkingHours> workingHours_;
+};
@@ -0,0 +1,65 @@
+#include "HallOccupancyGrid.hpp"
+#include <algorithm>
+
+HallOccupancyGrid::HallOccupancyGrid(const std::vector<UUID>& hallIds, std::vector<TimePoint> dayStarts)
+    : dayStarts_(std::move(dayStarts)) {
+    for (const auto& hallId : hallIds) {
+        hallIndex_.emplace(hallId, hallIndex_.size());
+    }
+    masks_.resize(hallIndex_.size() * dayStarts_.size());
+}
+
+HallOccupancyGrid::DayMask HallOccupancyGrid::cellRange(int firstCell, int lastCell) {
+    DayMask mask;
+    if (firstCell >= lastCell) {
+        return mask;
+    }
+    mask.set();
+    mask >>= CELLS_PER_DAY - (lastCell - firstCell);
+    mask <<= firstCell;
+    return mask;
+}
+
+void HallOccupancyGrid::markBusy(const UUID& hallId, TimePoint start, TimePoint end) {
+    auto hall = hallIndex_.find(hallId);
+    if (hall == hallIndex_.end() || !(start < end)) {
+        return;
+    }
+
+    const auto cell = std::chrono::minutes(CELL_MINUTES);
+    const auto span = cell * CELLS_PER_DAY;
+
+    for (std::size_t day = 0; day < dayStarts_.size(); ++day) {
+        auto dayStart = dayStarts_[day];
+        if (!(start < dayStart + span) || !(dayStart < end)) {
+            continue;
+        }
+
+        // Округляем наружу: частично занятая ячейка занята целиком
+        auto fromOffset = std::max(start - dayStart, TimePoint::duration::zero());
+        auto toOffset = std::min<TimePoint::duration>(end - dayStart, span);
+        int firstCell = static_cast<int>(fromOffset / cell);
+        int lastCell = static_cast<int>((toOffset + cell - TimePoint::duration(1)) / cell);
+
+        masks_[hall->second * dayStarts_.size() + day] |= cellRange(firstCell, lastCell);
+    }
+}
+
+bool HallOccupancyGrid::isFree(const UUID& hallId, std::size_t dayIndex, TimePoint start, int durationMinutes) const {
+    auto hall = hallIndex_.find(hallId);
+    if (hall == hallIndex_.end() || dayIndex >= dayStarts_.size()) {
+        return false;
+    }
+
+    const auto cell = std::chrono::minutes(CELL_MINUTES);
+    auto fromOffset = start - dayStarts_[dayIndex];
+    auto toOffset = fromOffset + std::chrono::minutes(durationMinutes);
+    if (fromOffset < TimePoint::duration::zero() || toOffset > cell * CELLS_PER_DAY) {
+        return false;
+    }
+
+    int firstCell = static_cast<int>(fromOffset / cell);
+    int lastCell = static_cast<int>((toOffset + cell - TimePoint::duration(1)) / cell);
+
+    return (masks_[hall->second * dayStarts_.size() + dayIndex] & cellRange(firstCell, lastCell)).none();
+}
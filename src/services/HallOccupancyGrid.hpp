@@ -0,0 +1,39 @@
+#pragma once
+#include "HallAvailability.hpp"
+#include "../types/uuid.hpp"
+#include <bitset>
+#include <chrono>
+#include <cstddef>
+#include <map>
+#include <vector>
+
+// Занятость нескольких залов по дням в виде битовых масок с шагом 15 минут.
+// Маска суток покрывает местные сутки филиала и еще MAX_DURATION_MINUTES,
+// чтобы слоты в конце дня проверялись без обращения к маске следующих суток.
+class HallOccupancyGrid {
+public:
+    using TimePoint = std::chrono::system_clock::time_point;
+
+    static constexpr int CELL_MINUTES = 15;
+    static constexpr int CELLS_PER_DAY = (24 * 60 + HallAvailability::MAX_DURATION_MINUTES) / CELL_MINUTES;
+    using DayMask = std::bitset<CELLS_PER_DAY>;
+
+    // dayStarts - начала местных суток филиала в UTC
+    HallOccupancyGrid(const std::vector<UUID>& hallIds, std::vector<TimePoint> dayStarts);
+
+    // Отмечает интервал [start, end) занятым; ячейки, задетые частично, считаются занятыми
+    void markBusy(const UUID& hallId, TimePoint start, TimePoint end);
+
+    // Слот должен начинаться и заканчиваться в пределах маски суток dayIndex
+    bool isFree(const UUID& hallId, std::size_t dayIndex, TimePoint start, int durationMinutes) const;
+
+    std::size_t dayCount() const { return dayStarts_.size(); }
+    TimePoint dayStart(std::size_t dayIndex) const { return dayStarts_[dayIndex]; }
+
+private:
+    std::vector<TimePoint> dayStarts_;
+    std::map<UUID, std::size_t> hallIndex_;
+    std::vector<DayMask> masks_; // masks_[hallIndex * dayCount() + dayIndex]
+
+    static DayMask cellRange(int firstCell, int lastCell);
+};
@@ -5,11 +5,13 @@ LessonService::LessonService(
     std::shared_ptr<ILessonRepository> lessonRepo,
     std::shared_ptr<IEnrollmentRepository> enrollmentRepo,
     std::shared_ptr<ITrainerRepository> trainerRepo,
-    std::shared_ptr<IDanceHallRepository> hallRepo
+    std::shared_ptr<IDanceHallRepository> hallRepo,
+    std::shared_ptr<MonthlyRollupService> rollups
 ) : lessonRepository_(std::move(lessonRepo)),
     enrollmentRepository_(std::move(enrollmentRepo)),
     trainerRepository_(std::move(trainerRepo)),
-    hallRepository_(std::move(hallRepo)) {}
+    hallRepository_(std::move(hallRepo)),
+    rollups_(std::move(rollups)) {}
 
 void LessonService::validateLessonRequest(const LessonRequestDTO& request) const {
     if (!request.validate()) {
@@ -81,6 +83,9 @@ LessonResponseDTO LessonService::createLesson(const LessonRequestDTO& request) {
     if (!lessonRepository_->save(lesson)) {
         throw std::runtime_error("Failed to save lesson");
     }
+    if (rollups_) {
+        rollups_->recordLessonCreated(lesson);
+    }
     
     return LessonResponseDTO(lesson);
 }
@@ -106,6 +111,9 @@ LessonResponseDTO LessonService::updateLesson(const UUID& lessonId, const Lesson
     if (!lessonRepository_->update(updatedLesson)) {
         throw std::runtime_error("Failed to update lesson");
     }
+    if (rollups_) {
+        rollups_->recordLessonChanged(*existingLesson, updatedLesson);
+    }
     
     return LessonResponseDTO(updatedLesson);
 }
@@ -121,11 +129,39 @@ LessonResponseDTO LessonService::cancelLesson(const UUID& lessonId) {
         throw BusinessRuleException("Only scheduled lessons can be cancelled");
     }
     
+    Lesson scheduledLesson = *lesson;
     lesson->setStatus(LessonStatus::CANCELLED);
     
     if (!lessonRepository_->update(*lesson)) {
         throw std::runtime_error("Failed to cancel lesson");
     }
+    if (rollups_) {
+        rollups_->recordLessonChanged(scheduledLesson, *lesson);
+    }
+    
+    return LessonResponseDTO(*lesson);
+}
+
+LessonResponseDTO LessonService::completeLesson(const UUID& lessonId) {
+    auto lesson = lessonRepository_->findById(lessonId);
+    if (!lesson) {
+        throw std::runtime_error("Lesson not found");
+    }
+    
+    // Завершить можно только состоявшееся занятие
+    if (lesson->getStatus() != LessonStatus::SCHEDULED && lesson->getStatus() != LessonStatus::ONGOING) {
+        throw BusinessRuleException("Only scheduled or ongoing lessons can be completed");
+    }
+    
+    Lesson previousLesson = *lesson;
+    lesson->setStatus(LessonStatus::COMPLETED);
+    
+    if (!lessonRepository_->update(*lesson)) {
+        throw std::runtime_error("Failed to complete lesson");
+    }
+    if (rollups_) {
+        rollups_->recordLessonChanged(previousLesson, *lesson);
+    }
     
     return LessonResponseDTO(*lesson);
 }
@@ -139,6 +175,17 @@ LessonResponseDTO LessonService::getLesson(const UUID& lessonId) {
     return LessonResponseDTO(*lesson);
 }
 
+std::vector<LessonResponseDTO> LessonService::getLessonsByIds(const std::vector<UUID>& lessonIds) {
+    auto lessons = lessonRepository_->findByIds(lessonIds);
+    std::vector<LessonResponseDTO> result;
+    
+    for (const auto& lesson : lessons) {
+        result.push_back(LessonResponseDTO(lesson));
+    }
+    
+    return result;
+}
+
 std::vector<LessonResponseDTO> LessonService::getLessonsByTrainer(const UUID& trainerId) {
     validateTrainer(trainerId);
     
@@ -165,6 +212,25 @@ std::vector<LessonResponseDTO> LessonService::getLessonsByHall(const UUID& hallI
     return result;
 }
 
+std::vector<LessonResponseDTO> LessonService::getLessonsByBranchAndRange(
+    const UUID& branchId,
+    const std::chrono::system_clock::time_point& from,
+    const std::chrono::system_clock::time_point& to) {
+    if (to < from) {
+        throw ValidationException("Start date must be before end date");
+    }
+    
+    auto lessons = lessonRepository_->findByBranchAndRange(branchId, from, to);
+    std::vector<LessonResponseDTO> result;
+    result.reserve(lessons.size());
+    
+    for (const auto& lesson : lessons) {
+        result.push_back(LessonResponseDTO(lesson));
+    }
+    
+    return result;
+}
+
 std::vector<LessonResponseDTO> LessonService::getUpcomingLessons(int days) {
     auto lessons = lessonRepository_->findUpcomingLessons(days);
     std::vector<LessonResponseDTO> result;
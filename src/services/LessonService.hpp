@@ -5,6 +5,7 @@
 #include "../repositories/IDanceHallRepository.hpp"
 #include "../dtos/LessonDTO.hpp"
 #include "../types/uuid.hpp"
+#include "MonthlyRollupService.hpp"
 #include "exceptions/ValidationException.hpp"
 #include <memory>
 #include <vector>
@@ -15,6 +16,7 @@ private:
     std::shared_ptr<IEnrollmentRepository> enrollmentRepository_;
     std::shared_ptr<ITrainerRepository> trainerRepository_;
     std::shared_ptr<IDanceHallRepository> hallRepository_;
+    std::shared_ptr<MonthlyRollupService> rollups_;
 
     void validateLessonRequest(const LessonRequestDTO& request) const;
     void validateTrainer(const UUID& trainerId) const;
@@ -22,19 +24,27 @@ private:
     void checkTimeConflicts(const UUID& hallId, const TimeSlot& timeSlot, const UUID& excludeLessonId = UUID()) const;
 
 public:
+    // rollups (необязательно) учитывает создание, перенос и отмену занятий в помесячной статистике
     LessonService(
         std::shared_ptr<ILessonRepository> lessonRepo,
         std::shared_ptr<IEnrollmentRepository> enrollmentRepo,
         std::shared_ptr<ITrainerRepository> trainerRepo,
-        std::shared_ptr<IDanceHallRepository> hallRepo
+        std::shared_ptr<IDanceHallRepository> hallRepo,
+        std::shared_ptr<MonthlyRollupService> rollups = nullptr
     );
 
     LessonResponseDTO createLesson(const LessonRequestDTO& request);
     LessonResponseDTO updateLesson(const UUID& lessonId, const LessonRequestDTO& request);
     LessonResponseDTO cancelLesson(const UUID& lessonId);
+    LessonResponseDTO completeLesson(const UUID& lessonId);
     LessonResponseDTO getLesson(const UUID& lessonId);
+    std::vector<LessonResponseDTO> getLessonsByIds(const std::vector<UUID>& lessonIds);
     std::vector<LessonResponseDTO> getLessonsByTrainer(const UUID& trainerId);
     std::vector<LessonResponseDTO> getLessonsByHall(const UUID& hallId);
+    // Занятия всех залов филиала, начинающиеся в [from, to], одним запросом
+    std::vector<LessonResponseDTO> getLessonsByBranchAndRange(const UUID& branchId,
+                                                              const std::chrono::system_clock::time_point& from,
+                                                              const std::chrono::system_clock::time_point& to);
     std::vector<LessonResponseDTO> getUpcomingLessons(int days = 7);
     bool canClientEnroll(const UUID& clientId, const UUID& lessonId) const;
     int getAvailableSpots(const UUID& lessonId) const;
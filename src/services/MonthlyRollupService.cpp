@@ -0,0 +1,237 @@
+#include "MonthlyRollupService.hpp"
+#include "../core/Logger.hpp"
+#include "exceptions/ValidationException.hpp"
+#include <cmath>
+#include <iostream>
+#include <map>
+
+static const UUID NO_BRANCH;
+
+MonthlyRollupService::MonthlyRollupService(std::shared_ptr<IMonthlyRollupRepository> rollupRepo,
+                                           std::shared_ptr<IDanceHallRepository> hallRepo)
+    : rollupRepo_(std::move(rollupRepo)),
+      hallRepo_(std::move(hallRepo)) {}
+
+std::optional<UUID> MonthlyRollupService::branchOfHall(const UUID& hallId) {
+    {
+        std::lock_guard<std::mutex> lock(hallBranchesMutex_);
+        auto it = hallBranches_.find(hallId);
+        if (it != hallBranches_.end()) {
+            return it->second;
+        }
+    }
+
+    // Запрос к БД - вне блокировки; повторная вставка того же зала безвредна
+    auto hall = hallRepo_->findById(hallId);
+    if (!hall) {
+        return std::nullopt;
+    }
+    std::lock_guard<std::mutex> lock(hallBranchesMutex_);
+    hallBranches_[hallId] = hall->getBranchId();
+    return hall->getBranchId();
+}
+
+std::optional<std::pair<UUID, const char*>> MonthlyRollupService::lessonMetric(const Lesson& lesson) {
+    // Запланированные и идущие занятия не учитываются: метрика появляется при завершении или отмене
+    const char* metric = nullptr;
+    if (lesson.getStatus() == LessonStatus::COMPLETED) {
+        metric = RollupMetric::LESSONS_HELD;
+    } else if (lesson.getStatus() == LessonStatus::CANCELLED) {
+        metric = RollupMetric::LESSONS_CANCELLED;
+    } else {
+        return std::nullopt;
+    }
+
+    auto branchId = branchOfHall(lesson.getHallId());
+    if (!branchId) {
+        return std::nullopt;
+    }
+    return std::make_pair(*branchId, metric);
+}
+
+void MonthlyRollupService::apply(const YearMonth& month, const UUID& branchId, const char* metric, double delta) {
+    rollupRepo_->increment(month, branchId, metric, delta);
+}
+
+void MonthlyRollupService::recordLessonCreated(const Lesson& lesson) {
+    try {
+        if (auto key = lessonMetric(lesson)) {
+            apply(YearMonth::of(lesson.getStartTime()), key->first, key->second, 1);
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "❌ Ошибка обновления помесячной статистики (занятие): " << e.what() << std::endl;
+    }
+}
+
+void MonthlyRollupService::recordLessonChanged(const Lesson& before, const Lesson& after) {
+    try {
+        auto oldKey = lessonMetric(before);
+        auto newKey = lessonMetric(after);
+        YearMonth oldMonth = YearMonth::of(before.getStartTime());
+        YearMonth newMonth = YearMonth::of(after.getStartTime());
+
+        if (oldKey && newKey && oldMonth == newMonth && oldKey->first == newKey->first &&
+            std::string(oldKey->second) == newKey->second) {
+            return;
+        }
+        if (oldKey) {
+            apply(oldMonth, oldKey->first, oldKey->second, -1);
+        }
+        if (newKey) {
+            apply(newMonth, newKey->first, newKey->second, 1);
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "❌ Ошибка обновления помесячной статистики (изменение занятия): " << e.what() << std::endl;
+    }
+}
+
+void MonthlyRollupService::recordAttendance(const Attendance& attendance, const UUID& hallId) {
+    try {
+        auto branchId = branchOfHall(hallId);
+        if (!branchId) {
+            return;
+        }
+
+        YearMonth month = YearMonth::of(attendance.getScheduledTime());
+        AttendanceStatus status = attendance.getStatus();
+        if (attendance.getType() == AttendanceType::BOOKING) {
+            if (status == AttendanceStatus::VISITED) {
+                apply(month, *branchId, RollupMetric::BOOKINGS_USED, 1);
+            } else if (status == AttendanceStatus::CANCELLED) {
+                apply(month, *branchId, RollupMetric::BOOKINGS_CANCELLED, 1);
+            }
+        }
+        if (status == AttendanceStatus::VISITED) {
+            apply(month, *branchId, RollupMetric::ATTENDANCE_VISITED, 1);
+        }
+        if (status != AttendanceStatus::SCHEDULED) {
+            apply(month, *branchId, RollupMetric::ATTENDANCE_RESOLVED, 1);
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "❌ Ошибка обновления помесячной статистики (посещаемость): " << e.what() << std::endl;
+    }
+}
+
+void MonthlyRollupService::recordNewClient(const Client& client) {
+    try {
+        apply(YearMonth::of(client.getRegistrationDate()), NO_BRANCH, RollupMetric::NEW_CLIENTS, 1);
+    } catch (const std::exception& e) {
+        std::cerr << "❌ Ошибка обновления помесячной статистики (клиент): " << e.what() << std::endl;
+    }
+}
+
+void MonthlyRollupService::recordSubscriptionPurchase(const Subscription& subscription, double price) {
+    try {
+        apply(YearMonth::of(subscription.getPurchaseDate()), NO_BRANCH, RollupMetric::SUBSCRIPTION_REVENUE, price);
+    } catch (const std::exception& e) {
+        std::cerr << "❌ Ошибка обновления помесячной статистики (абонемент): " << e.what() << std::endl;
+    }
+}
+
+// Слагаемые доли посещений: сама доля не суммируется между филиалами
+struct AttendanceRateParts {
+    double visited = 0.0;
+    double resolved = 0.0;
+};
+
+static void addEntry(MonthlyStatsDTO& stats, AttendanceRateParts& rateParts, const MonthlyRollupEntry& entry) {
+    int count = static_cast<int>(std::lround(entry.value));
+    if (entry.metric == RollupMetric::LESSONS_HELD) {
+        stats.lessonsHeld += count;
+    } else if (entry.metric == RollupMetric::LESSONS_CANCELLED) {
+        stats.lessonsCancelled += count;
+    } else if (entry.metric == RollupMetric::BOOKINGS_USED) {
+        stats.bookingsUsed += count;
+    } else if (entry.metric == RollupMetric::BOOKINGS_CANCELLED) {
+        stats.bookingsCancelled += count;
+    } else if (entry.metric == RollupMetric::NEW_CLIENTS) {
+        stats.newClients += count;
+    } else if (entry.metric == RollupMetric::SUBSCRIPTION_REVENUE) {
+        stats.subscriptionRevenue += entry.value;
+    } else if (entry.metric == RollupMetric::ATTENDANCE_VISITED) {
+        rateParts.visited += entry.value;
+    } else if (entry.metric == RollupMetric::ATTENDANCE_RESOLVED) {
+        rateParts.resolved += entry.value;
+    }
+}
+
+std::vector<MonthlyStatsDTO> MonthlyRollupService::getTrend(const YearMonth& from, const YearMonth& to,
+                                                            const std::optional<UUID>& branchId) {
+    if (from.month < 1 || from.month > 12 || to.month < 1 || to.month > 12) {
+        throw ValidationException("Month must be between 1 and 12");
+    }
+    if (to < from) {
+        throw ValidationException("Invalid month range: " + from.toString() + " .. " + to.toString());
+    }
+
+    std::map<int, MonthlyStatsDTO> byMonth;
+    std::map<int, AttendanceRateParts> rateParts;
+    for (YearMonth month = from; month <= to; month = month.next()) {
+        auto& stats = byMonth[month.toInt()];
+        stats.year = month.year;
+        stats.month = month.month;
+    }
+
+    for (const auto& entry : rollupRepo_->findByMonthRange(from, to)) {
+        if (branchId && entry.branchId != *branchId) {
+            continue;
+        }
+        auto it = byMonth.find(entry.month.toInt());
+        if (it != byMonth.end()) {
+            addEntry(it->second, rateParts[entry.month.toInt()], entry);
+        }
+    }
+
+    std::vector<MonthlyStatsDTO> trend;
+    trend.reserve(byMonth.size());
+    for (auto& [key, stats] : byMonth) {
+        const auto& parts = rateParts[key];
+        stats.attendanceRate = parts.resolved > 0 ? parts.visited / parts.resolved * 100.0 : 0.0;
+        trend.push_back(stats);
+    }
+    return trend;
+}
+
+MonthlyStatsDTO MonthlyRollupService::getMonth(int year, int month, const std::optional<UUID>& branchId) {
+    YearMonth target{year, month};
+    return getTrend(target, target, branchId).front();
+}
+
+std::string MonthlyRollupService::backfillJobName(const YearMonth& from, const YearMonth& to) {
+    return "monthly_rollups:" + from.toString() + ".." + to.toString();
+}
+
+int MonthlyRollupService::backfill(const YearMonth& from, const YearMonth& to, bool restart) {
+    if (from.month < 1 || from.month > 12 || to.month < 1 || to.month > 12 || to < from) {
+        throw ValidationException("Invalid month range: " + from.toString() + " .. " + to.toString());
+    }
+
+    std::string jobName = backfillJobName(from, to);
+
+    YearMonth start = from;
+    if (!restart) {
+        if (auto cursor = rollupRepo_->getBackfillCursor(jobName)) {
+            start = cursor->next();
+        }
+    }
+
+    if (to < start) {
+        LOG_INFO("MonthlyRollupService", "✅ Пересчет " << jobName << " уже завершен");
+        return 0;
+    }
+
+    LOG_INFO("MonthlyRollupService", "🔄 Пересчет помесячной статистики " << start.toString()
+             << " .. " << to.toString() << (start == from ? "" : " (продолжение)"));
+
+    // Ошибка прерывает задание: позиция остается на последнем успешно пересчитанном месяце
+    int processed = 0;
+    for (YearMonth month = start; month <= to; month = month.next()) {
+        rollupRepo_->rebuildMonth(month);
+        rollupRepo_->saveBackfillCursor(jobName, month);
+        ++processed;
+        LOG_DEBUG("MonthlyRollupService", "   ✅ " << month.toString());
+    }
+
+    LOG_INFO("MonthlyRollupService", "✅ Пересчитано месяцев: " << processed);
+    return processed;
+}
@@ -0,0 +1,69 @@
+#pragma once
+#include "../repositories/IMonthlyRollupRepository.hpp"
+#include "../repositories/IDanceHallRepository.hpp"
+#include "../models/Attendance.hpp"
+#include "../models/Client.hpp"
+#include "../models/Lesson.hpp"
+#include "../models/Subscription.hpp"
+#include "../types/uuid.hpp"
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+struct MonthlyStatsDTO {
+    int year = 0;
+    int month = 0;
+    int lessonsHeld = 0;
+    int lessonsCancelled = 0;
+    int bookingsUsed = 0;
+    int bookingsCancelled = 0;
+    int newClients = 0;
+    double subscriptionRevenue = 0.0;
+    double attendanceRate = 0.0;  // доля VISITED среди записей с итоговым статусом, %
+};
+
+// Помесячные агрегаты статистики (monthly_rollups). Сервисы сообщают о записях через record*,
+// отчеты читают готовые значения вместо сканирования исходных таблиц. backfill пересчитывает
+// месяцы по исходным данным и продолжает с места остановки при повторном запуске.
+class MonthlyRollupService {
+public:
+    MonthlyRollupService(std::shared_ptr<IMonthlyRollupRepository> rollupRepo,
+                         std::shared_ptr<IDanceHallRepository> hallRepo);
+
+    // Хуки записи вызываются после успешного сохранения и не выбрасывают исключений:
+    // операция уже выполнена, а расхождение в агрегатах исправляется повторным backfill
+    void recordLessonCreated(const Lesson& lesson);
+    // Перенос занятия в другой месяц или зал, завершение и отмена: дельта между старым и новым состоянием
+    void recordLessonChanged(const Lesson& before, const Lesson& after);
+    void recordAttendance(const Attendance& attendance, const UUID& hallId);
+    void recordNewClient(const Client& client);
+    void recordSubscriptionPurchase(const Subscription& subscription, double price);
+
+    // Без branchId - по всей студии; с филиалом - только метрики филиала
+    // (новые клиенты и выручка от абонементов к филиалу не относятся и остаются нулевыми)
+    MonthlyStatsDTO getMonth(int year, int month, const std::optional<UUID>& branchId = std::nullopt);
+    // По одной записи на каждый месяц from..to, включая месяцы без данных
+    std::vector<MonthlyStatsDTO> getTrend(const YearMonth& from, const YearMonth& to,
+                                          const std::optional<UUID>& branchId = std::nullopt);
+
+    // Пересчет месяцев from..to. Позиция сохраняется после каждого месяца, поэтому прерванный
+    // запуск продолжается со следующего месяца; restart начинает диапазон заново.
+    // Возвращает число пересчитанных месяцев
+    int backfill(const YearMonth& from, const YearMonth& to, bool restart = false);
+
+private:
+    std::shared_ptr<IMonthlyRollupRepository> rollupRepo_;
+    std::shared_ptr<IDanceHallRepository> hallRepo_;
+
+    mutable std::mutex hallBranchesMutex_;
+    std::unordered_map<UUID, UUID> hallBranches_;
+
+    std::optional<UUID> branchOfHall(const UUID& hallId);
+    std::optional<std::pair<UUID, const char*>> lessonMetric(const Lesson& lesson);
+    void apply(const YearMonth& month, const UUID& branchId, const char* metric, double delta);
+
+    static std::string backfillJobName(const YearMonth& from, const YearMonth& to);
+};
@@ -0,0 +1,249 @@
+#include "ReferenceDataCache.hpp"
+#include "../core/Logger.hpp"
+#include <iostream>
+
+ReferenceDataCache::ReferenceDataCache(std::shared_ptr<IBranchRepository> branchRepo,
+                                       std::shared_ptr<IDanceHallRepository> hallRepo,
+                                       std::shared_ptr<ISubscriptionTypeRepository> subscriptionTypeRepo,
+                                       std::chrono::seconds refreshInterval)
+    : branchRepo_(std::move(branchRepo)),
+      hallRepo_(std::move(hallRepo)),
+      subscriptionTypeRepo_(std::move(subscriptionTypeRepo)),
+      refreshInterval_(refreshInterval) {}
+
+ReferenceDataCache::~ReferenceDataCache() {
+    stop();
+}
+
+std::shared_ptr<const ReferenceDataCache::Snapshot> ReferenceDataCache::loadSnapshot() const {
+    auto started = std::chrono::steady_clock::now();
+    auto snapshot = std::make_shared<Snapshot>();
+
+    snapshot->branches = branchRepo_->findAll();
+    for (std::size_t i = 0; i < snapshot->branches.size(); ++i) {
+        snapshot->branchIndex[snapshot->branches[i].getId()] = i;
+    }
+
+    snapshot->halls = hallRepo_->findAll();
+    for (std::size_t i = 0; i < snapshot->halls.size(); ++i) {
+        snapshot->hallIndex[snapshot->halls[i].getId()] = i;
+        snapshot->hallsByBranch[snapshot->halls[i].getBranchId()].push_back(i);
+    }
+
+    // Признак активности есть только в БД, поэтому активные типы - отдельным запросом
+    snapshot->subscriptionTypes = subscriptionTypeRepo_->findAll();
+    for (std::size_t i = 0; i < snapshot->subscriptionTypes.size(); ++i) {
+        snapshot->subscriptionTypeIndex[snapshot->subscriptionTypes[i].getId()] = i;
+    }
+    for (const auto& type : subscriptionTypeRepo_->findAllActive()) {
+        auto it = snapshot->subscriptionTypeIndex.find(type.getId());
+        if (it != snapshot->subscriptionTypeIndex.end()) {
+            snapshot->activeSubscriptionTypes.push_back(it->second);
+        }
+    }
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - started);
+    LOG_INFO("ReferenceDataCache", "📚 Справочные данные загружены: филиалов " << snapshot->branches.size()
+             << ", залов " << snapshot->halls.size()
+             << ", типов абонементов " << snapshot->subscriptionTypes.size()
+             << ", " << elapsed.count() << " мс");
+    return snapshot;
+}
+
+bool ReferenceDataCache::isExpired(std::chrono::steady_clock::time_point now) const {
+    // Пока работает фоновый поток, снимок обновляет он, читатели БД не ждут
+    return refreshInterval_.count() > 0 && !running_ && now - loadedAt_ >= refreshInterval_;
+}
+
+void ReferenceDataCache::publish(std::shared_ptr<const Snapshot> snapshot, std::uint64_t generation,
+                                 std::chrono::steady_clock::time_point startedAt) {
+    if (generation == generation_) {
+        snapshot_ = std::move(snapshot);
+        loadedAt_ = startedAt;
+    }
+}
+
+std::shared_ptr<const ReferenceDataCache::Snapshot> ReferenceDataCache::current() {
+    std::uint64_t generation;
+    std::shared_ptr<const Snapshot> stale;
+    auto now = std::chrono::steady_clock::now();
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (snapshot_ && !isExpired(now)) {
+            return snapshot_;
+        }
+        stale = snapshot_;
+        generation = generation_;
+    }
+
+    // Параллельные промахи могут загрузить снимок одновременно - результат одинаков
+    std::shared_ptr<const Snapshot> snapshot;
+    try {
+        snapshot = loadSnapshot();
+    } catch (const std::exception& e) {
+        if (!stale) {
+            throw;
+        }
+        // Устаревший снимок лучше отказа; следующая попытка - после очередного refreshInterval
+        std::cerr << "⚠️ Справочные данные не обновлены, используется прежний снимок: " << e.what() << std::endl;
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (snapshot_ == stale) {
+            loadedAt_ = now;
+        }
+        return stale;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    publish(snapshot, generation, now);
+    return snapshot;
+}
+
+void ReferenceDataCache::refresh() {
+    std::uint64_t generation;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        generation = generation_;
+    }
+    auto startedAt = std::chrono::steady_clock::now();
+    auto snapshot = loadSnapshot();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    publish(std::move(snapshot), generation, startedAt);
+}
+
+void ReferenceDataCache::start() {
+    if (refreshInterval_.count() <= 0 || running_.exchange(true)) {
+        return;
+    }
+    refreshThread_ = std::thread(&ReferenceDataCache::refreshLoop, this);
+}
+
+void ReferenceDataCache::stop() {
+    {
+        std::lock_guard<std::mutex> lock(refreshMutex_);
+        if (!running_.exchange(false)) {
+            return;
+        }
+    }
+    wakeUp_.notify_all();
+    if (refreshThread_.joinable()) {
+        refreshThread_.join();
+    }
+}
+
+void ReferenceDataCache::refreshLoop() {
+    while (running_) {
+        {
+            std::unique_lock<std::mutex> lock(refreshMutex_);
+            wakeUp_.wait_for(lock, refreshInterval_, [this]() { return !running_; });
+        }
+        if (!running_) {
+            break;
+        }
+
+        try {
+            refresh();
+        } catch (const std::exception& e) {
+            std::cerr << "❌ Ошибка обновления справочных данных: " << e.what() << std::endl;
+        }
+    }
+}
+
+void ReferenceDataCache::load() {
+    invalidate();
+    current();
+}
+
+void ReferenceDataCache::invalidate() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    snapshot_.reset();
+    ++generation_;
+}
+
+bool ReferenceDataCache::isLoaded() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return snapshot_ != nullptr;
+}
+
+std::vector<Branch> ReferenceDataCache::getAllBranches() {
+    return current()->branches;
+}
+
+std::optional<Branch> ReferenceDataCache::getBranch(const UUID& branchId) {
+    auto snapshot = current();
+    auto it = snapshot->branchIndex.find(branchId);
+    if (it == snapshot->branchIndex.end()) {
+        return std::nullopt;
+    }
+    return snapshot->branches[it->second];
+}
+
+std::vector<DanceHall> ReferenceDataCache::getAllHalls() {
+    return current()->halls;
+}
+
+std::optional<DanceHall> ReferenceDataCache::getHall(const UUID& hallId) {
+    auto snapshot = current();
+    auto it = snapshot->hallIndex.find(hallId);
+    if (it == snapshot->hallIndex.end()) {
+        return std::nullopt;
+    }
+    return snapshot->halls[it->second];
+}
+
+std::vector<DanceHall> ReferenceDataCache::getHallsByBranch(const UUID& branchId) {
+    auto snapshot = current();
+    std::vector<DanceHall> halls;
+    auto it = snapshot->hallsByBranch.find(branchId);
+    if (it != snapshot->hallsByBranch.end()) {
+        halls.reserve(it->second.size());
+        for (std::size_t index : it->second) {
+            halls.push_back(snapshot->halls[index]);
+        }
+    }
+    return halls;
+}
+
+std::optional<Branch> ReferenceDataCache::getBranchForHall(const UUID& hallId) {
+    auto snapshot = current();
+    auto hall = snapshot->hallIndex.find(hallId);
+    if (hall == snapshot->hallIndex.end()) {
+        return std::nullopt;
+    }
+    auto branch = snapshot->branchIndex.find(snapshot->halls[hall->second].getBranchId());
+    if (branch == snapshot->branchIndex.end()) {
+        return std::nullopt;
+    }
+    return snapshot->branches[branch->second];
+}
+
+std::optional<std::chrono::minutes> ReferenceDataCache::getTimezoneOffsetForHall(const UUID& hallId) {
+    auto branch = getBranchForHall(hallId);
+    if (!branch) {
+        return std::nullopt;
+    }
+    return branch->getTimezoneOffset();
+}
+
+std::vector<SubscriptionType> ReferenceDataCache::getAllSubscriptionTypes() {
+    return current()->subscriptionTypes;
+}
+
+std::vector<SubscriptionType> ReferenceDataCache::getActiveSubscriptionTypes() {
+    auto snapshot = current();
+    std::vector<SubscriptionType> types;
+    types.reserve(snapshot->activeSubscriptionTypes.size());
+    for (std::size_t index : snapshot->activeSubscriptionTypes) {
+        types.push_back(snapshot->subscriptionTypes[index]);
+    }
+    return types;
+}
+
+std::optional<SubscriptionType> ReferenceDataCache::getSubscriptionType(const UUID& typeId) {
+    auto snapshot = current();
+    auto it = snapshot->subscriptionTypeIndex.find(typeId);
+    if (it == snapshot->subscriptionTypeIndex.end()) {
+        return std::nullopt;
+    }
+    return snapshot->subscriptionTypes[it->second];
+}
@@ -0,0 +1,102 @@
+#pragma once
+#include "../repositories/IBranchRepository.hpp"
+#include "../repositories/IDanceHallRepository.hpp"
+#include "../repositories/ISubscriptionTypeRepository.hpp"
+#include "../models/Branch.hpp"
+#include "../models/DanceHall.hpp"
+#include "../models/SubscriptionType.hpp"
+#include "../types/uuid.hpp"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+// Справочные данные студии в памяти: филиалы (с адресами), залы и типы абонементов.
+// Меняются несколько раз в год, а читаются почти в каждом бронировании, поэтому загружаются
+// целиком и отдаются из индексов зал → филиал → часовой пояс без обращения к БД.
+// Запись через репозитории CachedBranchRepository / CachedDanceHallRepository /
+// CachedSubscriptionTypeRepository сбрасывает снимок, следующее чтение загружает его заново.
+// Записи другого процесса (например, TechUI) этот сброс не видит: они попадают в снимок
+// при перезагрузке раз в refreshInterval - фоновым потоком после start(), а без него -
+// при первом чтении после истечения срока снимка. До этого, не дольше refreshInterval,
+// отдаются прежние залы, часы работы и часовые пояса. refreshInterval = 0 - без перезагрузки.
+class ReferenceDataCache {
+public:
+    ReferenceDataCache(std::shared_ptr<IBranchRepository> branchRepo,
+                       std::shared_ptr<IDanceHallRepository> hallRepo,
+                       std::shared_ptr<ISubscriptionTypeRepository> subscriptionTypeRepo,
+                       std::chrono::seconds refreshInterval = std::chrono::seconds(0));
+    ~ReferenceDataCache();
+
+    ReferenceDataCache(const ReferenceDataCache&) = delete;
+    ReferenceDataCache& operator=(const ReferenceDataCache&) = delete;
+
+    // Загрузка при старте; ошибки репозиториев пробрасываются
+    void load();
+    void invalidate();
+    bool isLoaded() const;
+
+    // Загружает новый снимок и подменяет текущий; до подмены читатели получают прежний
+    void refresh();
+
+    // Запускает перезагрузку раз в refreshInterval (при refreshInterval = 0 ничего не делает)
+    void start();
+    void stop();
+
+    // Порядок списков - как у findAll / findAllActive исходных репозиториев
+    std::vector<Branch> getAllBranches();
+    std::optional<Branch> getBranch(const UUID& branchId);
+    std::vector<DanceHall> getAllHalls();
+    std::optional<DanceHall> getHall(const UUID& hallId);
+    std::vector<DanceHall> getHallsByBranch(const UUID& branchId);
+    std::optional<Branch> getBranchForHall(const UUID& hallId);
+    // nullopt, если зал или его филиал не найдены
+    std::optional<std::chrono::minutes> getTimezoneOffsetForHall(const UUID& hallId);
+
+    std::vector<SubscriptionType> getAllSubscriptionTypes();
+    std::vector<SubscriptionType> getActiveSubscriptionTypes();
+    std::optional<SubscriptionType> getSubscriptionType(const UUID& typeId);
+
+private:
+    struct Snapshot {
+        std::vector<Branch> branches;
+        std::unordered_map<UUID, std::size_t> branchIndex;
+        std::vector<DanceHall> halls;
+        std::unordered_map<UUID, std::size_t> hallIndex;
+        std::unordered_map<UUID, std::vector<std::size_t>> hallsByBranch;
+        std::vector<SubscriptionType> subscriptionTypes;
+        std::unordered_map<UUID, std::size_t> subscriptionTypeIndex;
+        std::vector<std::size_t> activeSubscriptionTypes;
+    };
+
+    std::shared_ptr<IBranchRepository> branchRepo_;
+    std::shared_ptr<IDanceHallRepository> hallRepo_;
+    std::shared_ptr<ISubscriptionTypeRepository> subscriptionTypeRepo_;
+    std::chrono::seconds refreshInterval_;
+
+    mutable std::mutex mutex_;
+    std::shared_ptr<const Snapshot> snapshot_;
+    std::chrono::steady_clock::time_point loadedAt_;
+    // Увеличивается при каждом сбросе: снимок, загрузка которого началась до сброса, не сохраняется
+    std::uint64_t generation_ = 0;
+
+    std::atomic<bool> running_{false};
+    std::thread refreshThread_;
+    std::mutex refreshMutex_;
+    std::condition_variable wakeUp_;
+
+    // Текущий снимок; при отсутствии или истечении срока загружает новый (запросы к БД - вне блокировки)
+    std::shared_ptr<const Snapshot> current();
+    std::shared_ptr<const Snapshot> loadSnapshot() const;
+    bool isExpired(std::chrono::steady_clock::time_point now) const;
+    // Сохраняет снимок, если с начала его загрузки не было сброса; вызывается под mutex_
+    void publish(std::shared_ptr<const Snapshot> snapshot, std::uint64_t generation,
+                 std::chrono::steady_clock::time_point startedAt);
+    void refreshLoop();
+};
@@ -0,0 +1,95 @@
+#pragma once
+#include "../types/uuid.hpp"
+#include <any>
+#include <map>
+#include <optional>
+#include <utility>
+
+// Карта идентичности на время одной операции сервиса.
+// Создается на стеке в начале публичного метода и передается во вспомогательные
+// методы по ссылке: повторный findById того же ключа в том же репозитории
+// возвращает уже загруженную сущность без обращения к БД. Записи через контекст
+// сбрасывают ключ, поэтому после записи сущность перечитывается.
+// Живет не дольше операции и не разделяется между потоками.
+class RequestContext {
+public:
+    RequestContext() = default;
+    RequestContext(const RequestContext&) = delete;
+    RequestContext& operator=(const RequestContext&) = delete;
+
+    template <typename Repository>
+    auto findById(Repository& repository, const UUID& id) -> decltype(repository.findById(id)) {
+        using Result = decltype(repository.findById(id));
+
+        Key key{&repository, id};
+        auto it = entities_.find(key);
+        if (it != entities_.end()) {
+            return std::any_cast<const Result&>(it->second);
+        }
+
+        auto entity = repository.findById(id);
+        entities_[key] = entity;
+        existence_[key] = entity.has_value();
+        return entity;
+    }
+
+    template <typename Repository>
+    bool exists(Repository& repository, const UUID& id) {
+        Key key{&repository, id};
+        auto it = existence_.find(key);
+        if (it != existence_.end()) {
+            return it->second;
+        }
+
+        bool found = repository.exists(id);
+        existence_[key] = found;
+        return found;
+    }
+
+    template <typename Repository, typename Entity>
+    bool save(Repository& repository, const Entity& entity) {
+        return writeThrough(repository, entity.getId(), [&] { return repository.save(entity); });
+    }
+
+    template <typename Repository, typename Entity>
+    bool update(Repository& repository, const Entity& entity) {
+        return writeThrough(repository, entity.getId(), [&] { return repository.update(entity); });
+    }
+
+    template <typename Repository>
+    bool remove(Repository& repository, const UUID& id) {
+        return writeThrough(repository, id, [&] { return repository.remove(id); });
+    }
+
+    template <typename Repository>
+    void forget(Repository& repository, const UUID& id) {
+        Key key{&repository, id};
+        entities_.erase(key);
+        existence_.erase(key);
+    }
+
+    void clear() {
+        entities_.clear();
+        existence_.clear();
+    }
+
+private:
+    // Ключ включает репозиторий: один UUID в разных репозиториях - разные сущности
+    using Key = std::pair<const void*, UUID>;
+
+    std::map<Key, std::any> entities_;
+    std::map<Key, bool> existence_;
+
+    // Ключ сбрасывается и при исключении: запись могла примениться до ошибки
+    template <typename Repository, typename Write>
+    bool writeThrough(Repository& repository, const UUID& id, Write write) {
+        try {
+            bool result = write();
+            forget(repository, id);
+            return result;
+        } catch (...) {
+            forget(repository, id);
+            throw;
+        }
+    }
+};
@@ -29,37 +29,22 @@ ScheduleResponseDTO ScheduleService::getBranchSchedule(const UUID& branchId,
     
     ScheduleResponseDTO response(branchId, startDate, endDate);
     
-    // Получаем занятия для филиала в указанном диапазоне дат
-    // Для упрощения предположим, что у нас есть метод для получения занятий по филиалу и дате
-    // Здесь мы будем использовать существующие методы репозитория и фильтровать по залам филиала
-    
-    // Получаем все залы филиала
-    auto halls = hallRepository_->findByBranchId(branchId);
-    
-    for (const auto& hall : halls) {
-        // Получаем занятия для зала
-        auto lessons = lessonRepository_->findByHallId(hall.getId());
-        for (const auto& lesson : lessons) {
-            auto lessonTime = lesson.getStartTime();
-            if (lessonTime >= startDate && lessonTime <= endDate) {
-                ScheduleSlotDTO slot(lesson.getTimeSlot(), lesson.getId(), "lesson", 
-                                    lesson.getName(), lesson.getDescription(), 
-                                    EnumUtils::lessonStatusToString(lesson.getStatus()));
-                response.addSlot(slot);
-            }
-        }
-        
-        // Получаем бронирования для зала
-        auto bookings = bookingRepository_->findByHallId(hall.getId());
-        for (const auto& booking : bookings) {
-            auto bookingTime = booking.getTimeSlot().getStartTime();
-            if (bookingTime >= startDate && bookingTime <= endDate) {
-                ScheduleSlotDTO slot(booking.getTimeSlot(), booking.getId(), "booking", 
-                                    "Бронирование", booking.getPurpose(), 
-                                    EnumUtils::bookingStatusToString(booking.getStatus()));
-                response.addSlot(slot);
-            }
-        }
+    // Два запроса на филиал вместо пары запросов на каждый зал: залы филиала
+    // и диапазон дат отбираются в БД, репозитории возвращают записи по времени начала
+    auto lessons = lessonRepository_->findByBranchAndRange(branchId, startDate, endDate);
+    for (const auto& lesson : lessons) {
+        ScheduleSlotDTO slot(lesson.getTimeSlot(), lesson.getId(), "lesson", 
+                            lesson.getName(), lesson.getDescription(), 
+                            EnumUtils::lessonStatusToString(lesson.getStatus()));
+        response.addSlot(slot);
+    }
+    
+    auto bookings = bookingRepository_->findByBranchAndRange(branchId, startDate, endDate);
+    for (const auto& booking : bookings) {
+        ScheduleSlotDTO slot(booking.getTimeSlot(), booking.getId(), "booking", 
+                            "Бронирование", booking.getPurpose(), 
+                            EnumUtils::bookingStatusToString(booking.getStatus()));
+        response.addSlot(slot);
     }
     
     return response;
@@ -76,28 +61,22 @@ ScheduleResponseDTO ScheduleService::getHallSchedule(const UUID& hallId,
     
     ScheduleResponseDTO response(hallId, startDate, endDate);
     
-    // Получаем занятия для зала
-    auto lessons = lessonRepository_->findByHallId(hallId);
+    // Получаем занятия для зала за период
+    auto lessons = lessonRepository_->findByHallsAndRange({hallId}, startDate, endDate);
     for (const auto& lesson : lessons) {
-        auto lessonTime = lesson.getStartTime();
-        if (lessonTime >= startDate && lessonTime <= endDate) {
-            ScheduleSlotDTO slot(lesson.getTimeSlot(), lesson.getId(), "lesson", 
-                                lesson.getName(), lesson.getDescription(), 
-                                EnumUtils::lessonStatusToString(lesson.getStatus()));
-            response.addSlot(slot);
-        }
+        ScheduleSlotDTO slot(lesson.getTimeSlot(), lesson.getId(), "lesson", 
+                            lesson.getName(), lesson.getDescription(), 
+                            EnumUtils::lessonStatusToString(lesson.getStatus()));
+        response.addSlot(slot);
     }
     
-    // Получаем бронирования для зала
-    auto bookings = bookingRepository_->findByHallId(hallId);
+    // Получаем бронирования для зала за период
+    auto bookings = bookingRepository_->findByHallsAndRange({hallId}, startDate, endDate);
     for (const auto& booking : bookings) {
-        auto bookingTime = booking.getTimeSlot().getStartTime();
-        if (bookingTime >= startDate && bookingTime <= endDate) {
-            ScheduleSlotDTO slot(booking.getTimeSlot(), booking.getId(), "booking", 
-                                "Бронирование", booking.getPurpose(), 
-                                EnumUtils::bookingStatusToString(booking.getStatus()));
-            response.addSlot(slot);
-        }
+        ScheduleSlotDTO slot(booking.getTimeSlot(), booking.getId(), "booking", 
+                            "Бронирование", booking.getPurpose(), 
+                            EnumUtils::bookingStatusToString(booking.getStatus()));
+        response.addSlot(slot);
     }
     
     return response;
@@ -115,8 +94,8 @@ std::vector<TimeSlot> ScheduleService::getAvailableTimeSlots(const UUID& hallId,
     
     std::vector<TimeSlot> busySlots;
     
-    // Занятия
-    auto lessons = lessonRepository_->findByHallId(hallId);
+    // Занятия (диапазон в БД включает правую границу, она отсекается ниже)
+    auto lessons = lessonRepository_->findByHallsAndRange({hallId}, startOfDay, endOfDay);
     for (const auto& lesson : lessons) {
         auto lessonTime = lesson.getStartTime();
         if (lessonTime >= startOfDay && lessonTime < endOfDay) {
@@ -125,7 +104,7 @@ std::vector<TimeSlot> ScheduleService::getAvailableTimeSlots(const UUID& hallId,
     }
     
     // Бронирования
-    auto bookings = bookingRepository_->findByHallId(hallId);
+    auto bookings = bookingRepository_->findByHallsAndRange({hallId}, startOfDay, endOfDay);
     for (const auto& booking : bookings) {
         auto bookingTime = booking.getTimeSlot().getStartTime();
         if (bookingTime >= startOfDay && bookingTime < endOfDay) {
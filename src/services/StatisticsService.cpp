@@ -1,5 +1,7 @@
 #include "StatisticsService.hpp"
+#include "../core/Logger.hpp"
 #include <algorithm>
+#include <cmath>
 #include <iomanip>
 #include <sstream>
 
@@ -10,31 +12,38 @@ StatisticsService::StatisticsService(
     std::shared_ptr<ILessonRepository> lessonRepo,
     std::shared_ptr<IBookingRepository> bookingRepo,
     std::shared_ptr<IEnrollmentRepository> enrollmentRepo,
-    std::shared_ptr<AttendanceService> attendanceService  
+    std::shared_ptr<AttendanceService> attendanceService,
+    std::shared_ptr<AttendanceCounters> counters,
+    std::shared_ptr<MonthlyRollupService> rollups
 ) : attendanceRepo_(std::move(attendanceRepo)),
     clientRepo_(std::move(clientRepo)),
     lessonRepo_(std::move(lessonRepo)),
     bookingRepo_(std::move(bookingRepo)),
     enrollmentRepo_(std::move(enrollmentRepo)),
-    attendanceService_(std::move(attendanceService)) {} 
+    attendanceService_(std::move(attendanceService)),
+    counters_(std::move(counters)),
+    rollups_(std::move(rollups)) {} 
 
 StudioStatsDTO StatisticsService::getStudioStats() {
     StudioStatsDTO stats{};
     
     try {
-        auto clients = clientRepo_->findAll();
-        stats.totalClients = clients.size();
+        stats.totalClients = clientRepo_->count();
+        
+        // Счетчики в памяти, если загружены; иначе все тип × статус одним агрегирующим запросом
+        auto counts = counters_ && counters_->isLoaded() ? counters_->snapshot()
+                                                         : attendanceRepo_->aggregateCounts(false).totals;
         
         // Статистика по занятиям
-        stats.visitedLessons = attendanceRepo_->countByTypeAndStatus(AttendanceType::LESSON, AttendanceStatus::VISITED);
-        stats.cancelledLessons = attendanceRepo_->countByTypeAndStatus(AttendanceType::LESSON, AttendanceStatus::CANCELLED);
-        stats.noShowLessons = attendanceRepo_->countByTypeAndStatus(AttendanceType::LESSON, AttendanceStatus::NO_SHOW);
+        stats.visitedLessons = counts.get(AttendanceType::LESSON, AttendanceStatus::VISITED);
+        stats.cancelledLessons = counts.get(AttendanceType::LESSON, AttendanceStatus::CANCELLED);
+        stats.noShowLessons = counts.get(AttendanceType::LESSON, AttendanceStatus::NO_SHOW);
         stats.totalLessons = stats.visitedLessons + stats.cancelledLessons + stats.noShowLessons;
         
         // Статистика по бронированиям
-        stats.visitedBookings = attendanceRepo_->countByTypeAndStatus(AttendanceType::BOOKING, AttendanceStatus::VISITED);
-        stats.cancelledBookings = attendanceRepo_->countByTypeAndStatus(AttendanceType::BOOKING, AttendanceStatus::CANCELLED);
-        stats.noShowBookings = attendanceRepo_->countByTypeAndStatus(AttendanceType::BOOKING, AttendanceStatus::NO_SHOW);
+        stats.visitedBookings = counts.get(AttendanceType::BOOKING, AttendanceStatus::VISITED);
+        stats.cancelledBookings = counts.get(AttendanceType::BOOKING, AttendanceStatus::CANCELLED);
+        stats.noShowBookings = counts.get(AttendanceType::BOOKING, AttendanceStatus::NO_SHOW);
         stats.totalBookings = stats.visitedBookings + stats.cancelledBookings + stats.noShowBookings;
         
         // Общий рейтинг посещаемости
@@ -61,22 +70,8 @@ ClientStatsDTO StatisticsService::getClientStats(const UUID& clientId) {
         }
         stats.clientName = client->getName();
         
-        // Статистика по занятиям
-        stats.visitedLessons = attendanceRepo_->countByClientAndStatus(clientId, AttendanceStatus::VISITED);
-        stats.cancelledLessons = attendanceRepo_->countByClientAndStatus(clientId, AttendanceStatus::CANCELLED);
-        stats.noShowLessons = attendanceRepo_->countByClientAndStatus(clientId, AttendanceStatus::NO_SHOW);
-        stats.totalLessons = stats.visitedLessons + stats.cancelledLessons + stats.noShowLessons;
-        
-        // Статистика по бронированиям
-        auto clientAttendances = attendanceRepo_->findByClientId(clientId);
-        for (const auto& attendance : clientAttendances) {
-            if (attendance.getType() == AttendanceType::BOOKING) {
-                stats.totalBookings++;
-                if (attendance.isVisited()) stats.visitedBookings++;
-                if (attendance.isCancelled()) stats.cancelledBookings++;
-                if (attendance.isNoShow()) stats.noShowBookings++;
-            }
-        }
+        auto counts = counters_ ? counters_->clientSnapshot(clientId) : std::nullopt;
+        fillClientCounts(stats, counts ? *counts : attendanceRepo_->aggregateClientCounts(clientId));
         
     } catch (const std::exception& e) {
         std::cerr << "Ошибка при получении статистики клиента: " << e.what() << std::endl;
@@ -86,21 +81,20 @@ ClientStatsDTO StatisticsService::getClientStats(const UUID& clientId) {
 }
 
 std::vector<ClientStatsDTO> StatisticsService::getAllClientsStats() {
+    return getTopClientsStats(0);
+}
+
+std::vector<ClientStatsDTO> StatisticsService::getTopClientsStats(int limit) {
     std::vector<ClientStatsDTO> result;
     
     try {
-        auto clients = clientRepo_->findAll();
-        for (const auto& client : clients) {
-            auto stats = getClientStats(client.getId());
-            result.push_back(stats);
+        // Один агрегирующий запрос; сортировка по рейтингу посещаемости и top-N - на стороне БД
+        auto summaries = attendanceRepo_->findClientSummaries(limit);
+        result.reserve(summaries.size());
+        for (const auto& summary : summaries) {
+            result.push_back(toClientStats(summary));
         }
         
-        // Сортируем по рейтингу посещаемости (по убыванию)
-        std::sort(result.begin(), result.end(), 
-                 [](const ClientStatsDTO& a, const ClientStatsDTO& b) {
-                     return a.attendanceRate > b.attendanceRate;
-                 });
-        
     } catch (const std::exception& e) {
         std::cerr << "Ошибка при получении статистики всех клиентов: " << e.what() << std::endl;
     }
@@ -108,27 +102,67 @@ std::vector<ClientStatsDTO> StatisticsService::getAllClientsStats() {
     return result;
 }
 
+void StatisticsService::streamAllClientsStats(const std::function<void(const ClientStatsDTO&)>& consumer) {
+    attendanceRepo_->streamClientSummaries(CLIENT_STATS_BATCH_SIZE, [this, &consumer](const ClientAttendanceSummary& summary) {
+        consumer(toClientStats(summary));
+    });
+}
+
 std::map<std::string, int> StatisticsService::getMonthlyStats(int year, int month) {
     std::map<std::string, int> monthlyStats;
     
-    monthlyStats["Занятий проведено"] = 0;
-    monthlyStats["Бронирований использовано"] = 0;
-    monthlyStats["Новых клиентов"] = 0;
-    monthlyStats["Отменено занятий"] = 0;
+    MonthlyStatsDTO stats{};
+    try {
+        stats = getMonthlyReport(year, month);
+    } catch (const std::exception& e) {
+        std::cerr << "❌ Ошибка получения статистики за месяц: " << e.what() << std::endl;
+    }
+    
+    monthlyStats["Занятий проведено"] = stats.lessonsHeld;
+    monthlyStats["Бронирований использовано"] = stats.bookingsUsed;
+    monthlyStats["Новых клиентов"] = stats.newClients;
+    monthlyStats["Отменено занятий"] = stats.lessonsCancelled;
+    monthlyStats["Выручка от абонементов"] = static_cast<int>(std::lround(stats.subscriptionRevenue));
+    monthlyStats["Посещаемость, %"] = static_cast<int>(std::lround(stats.attendanceRate));
     
     return monthlyStats;
 }
 
+MonthlyStatsDTO StatisticsService::getMonthlyReport(int year, int month, const std::optional<UUID>& branchId) {
+    if (!rollups_) {
+        MonthlyStatsDTO empty;
+        empty.year = year;
+        empty.month = month;
+        return empty;
+    }
+    return rollups_->getMonth(year, month, branchId);
+}
+
+std::vector<MonthlyStatsDTO> StatisticsService::getMonthlyTrend(const YearMonth& from, const YearMonth& to,
+                                                                const std::optional<UUID>& branchId) {
+    if (!rollups_) {
+        return {};
+    }
+    return rollups_->getTrend(from, to, branchId);
+}
+
+int StatisticsService::backfillMonthlyStats(const YearMonth& from, const YearMonth& to, bool restart) {
+    if (!rollups_) {
+        throw std::runtime_error("Monthly rollups are not configured");
+    }
+    return rollups_->backfill(from, to, restart);
+}
+
 bool StatisticsService::migrateExistingData() {
     try {
-        std::cout << "🔄 Начало миграции существующих данных..." << std::endl;
+        LOG_DEBUG("StatisticsService", "🔄 Начало миграции существующих данных...");
         
         bool success = true;
         success &= migrateBookingsToAttendance();
         success &= migrateEnrollmentsToAttendance();
         
         if (success) {
-            std::cout << "✅ Миграция данных завершена успешно" << std::endl;
+            LOG_INFO("StatisticsService", "✅ Миграция данных завершена успешно");
         } else {
             std::cerr << "❌ Ошибка при миграции данных" << std::endl;
         }
@@ -147,7 +181,7 @@ bool StatisticsService::migrateBookingsToAttendance() {
         int migrated = 0;
         int skipped = 0;
         
-        std::cout << "🔍 Найдено бронирований для миграции: " << allBookings.size() << std::endl;
+        LOG_DEBUG("StatisticsService", "🔍 Найдено бронирований для миграции: " << allBookings.size());
         
         for (const auto& booking : allBookings) {
             try {
@@ -174,9 +208,8 @@ bool StatisticsService::migrateBookingsToAttendance() {
                     
                     if (attendanceRepo_->save(attendance)) {
                         migrated++;
-                        std::cout << "✅ Мигрировано бронирование: " << booking.getId().toString() 
-                                  << " -> " << (attendanceStatus == AttendanceStatus::VISITED ? "VISITED" : "CANCELLED") 
-                                  << std::endl;
+                        LOG_DEBUG("StatisticsService", "✅ Мигрировано бронирование: " << booking.getId().toString() 
+                                  << " -> " << (attendanceStatus == AttendanceStatus::VISITED ? "VISITED" : "CANCELLED"));
                     } else {
                         std::cerr << "❌ Не удалось сохранить посещаемость для бронирования: " 
                                   << booking.getId().toString() << std::endl;
@@ -190,8 +223,8 @@ bool StatisticsService::migrateBookingsToAttendance() {
             }
         }
         
-        std::cout << "📊 Мигрировано бронирований в посещаемость: " << migrated 
-                  << ", пропущено: " << skipped << std::endl;
+        LOG_INFO("StatisticsService", "📊 Мигрировано бронирований в посещаемость: " << migrated 
+                  << ", пропущено: " << skipped);
         return migrated > 0;
         
     } catch (const std::exception& e) {
@@ -206,7 +239,7 @@ bool StatisticsService::migrateEnrollmentsToAttendance() {
         int migrated = 0;
         int skipped = 0;
         
-        std::cout << "🔍 Найдено записей на занятия для миграции: " << allEnrollments.size() << std::endl;
+        LOG_DEBUG("StatisticsService", "🔍 Найдено записей на занятия для миграции: " << allEnrollments.size());
         
         for (const auto& enrollment : allEnrollments) {
             try {
@@ -260,8 +293,8 @@ bool StatisticsService::migrateEnrollmentsToAttendance() {
                     
                     if (attendanceRepo_->save(attendance)) {
                         migrated++;
-                        std::cout << "✅ Мигрирована запись на занятие: " << enrollment.getId().toString() 
-                                  << " -> " << attendanceStatusToString(attendanceStatus) << std::endl;
+                        LOG_DEBUG("StatisticsService", "✅ Мигрирована запись на занятие: " << enrollment.getId().toString() 
+                                  << " -> " << attendanceStatusToString(attendanceStatus));
                     } else {
                         std::cerr << "❌ Не удалось сохранить посещаемость для записи: " 
                                   << enrollment.getId().toString() << std::endl;
@@ -275,8 +308,8 @@ bool StatisticsService::migrateEnrollmentsToAttendance() {
             }
         }
         
-        std::cout << "📊 Мигрировано записей на занятия: " << migrated 
-                  << ", пропущено: " << skipped << std::endl;
+        LOG_INFO("StatisticsService", "📊 Мигрировано записей на занятия: " << migrated 
+                  << ", пропущено: " << skipped);
         return migrated > 0;
         
     } catch (const std::exception& e) {
@@ -294,6 +327,29 @@ std::string StatisticsService::attendanceStatusToString(AttendanceStatus status)
     }
 }
 
+ClientStatsDTO StatisticsService::toClientStats(const ClientAttendanceSummary& summary) const {
+    ClientStatsDTO stats{};
+    stats.clientId = summary.clientId;
+    stats.clientName = summary.clientName;
+    fillClientCounts(stats, summary.counts);
+    return stats;
+}
+
+void StatisticsService::fillClientCounts(ClientStatsDTO& stats, const AttendanceCounts& counts) const {
+    stats.visitedLessons = counts.get(AttendanceType::LESSON, AttendanceStatus::VISITED);
+    stats.cancelledLessons = counts.get(AttendanceType::LESSON, AttendanceStatus::CANCELLED);
+    stats.noShowLessons = counts.get(AttendanceType::LESSON, AttendanceStatus::NO_SHOW);
+    stats.totalLessons = stats.visitedLessons + stats.cancelledLessons + stats.noShowLessons;
+    
+    stats.visitedBookings = counts.get(AttendanceType::BOOKING, AttendanceStatus::VISITED);
+    stats.cancelledBookings = counts.get(AttendanceType::BOOKING, AttendanceStatus::CANCELLED);
+    stats.noShowBookings = counts.get(AttendanceType::BOOKING, AttendanceStatus::NO_SHOW);
+    stats.totalBookings = stats.visitedBookings + stats.cancelledBookings + stats.noShowBookings;
+    
+    stats.attendanceRate = calculateAttendanceRate(stats.visitedLessons + stats.visitedBookings,
+                                                   stats.totalLessons + stats.totalBookings);
+}
+
 double StatisticsService::calculateAttendanceRate(int visited, int total) const {
     if (total == 0) return 0.0;
     return (static_cast<double>(visited) / total) * 100.0;
@@ -5,8 +5,11 @@
 #include "../repositories/IBookingRepository.hpp"
 #include "../repositories/IEnrollmentRepository.hpp"
 #include "AttendanceService.hpp"
+#include "AttendanceCounters.hpp"
+#include "MonthlyRollupService.hpp"
 #include "../types/uuid.hpp"
 #include "../models/Enrollment.hpp" 
+#include <functional>
 #include <memory>
 #include <vector>
 #include <map>
@@ -48,6 +51,10 @@ private:
     std::shared_ptr<IBookingRepository> bookingRepo_;
     std::shared_ptr<IEnrollmentRepository> enrollmentRepo_;
     std::shared_ptr<AttendanceService> attendanceService_;
+    std::shared_ptr<AttendanceCounters> counters_;
+    std::shared_ptr<MonthlyRollupService> rollups_;
+
+    static constexpr int CLIENT_STATS_BATCH_SIZE = 500;
 
 public:
     StatisticsService(
@@ -56,17 +63,31 @@ public:
         std::shared_ptr<ILessonRepository> lessonRepo,
         std::shared_ptr<IBookingRepository> bookingRepo,
         std::shared_ptr<IEnrollmentRepository> enrollmentRepo,
-        std::shared_ptr<AttendanceService> attendanceService
+        std::shared_ptr<AttendanceService> attendanceService,
+        std::shared_ptr<AttendanceCounters> counters = nullptr,
+        std::shared_ptr<MonthlyRollupService> rollups = nullptr
     );
 
     StudioStatsDTO getStudioStats();
     ClientStatsDTO getClientStats(const UUID& clientId);
+    // Отсортированы по убыванию рейтинга посещаемости
     std::vector<ClientStatsDTO> getAllClientsStats();
+    std::vector<ClientStatsDTO> getTopClientsStats(int limit);
+    // Потоковая выдача в порядке ID клиента, без загрузки всех клиентов в память
+    void streamAllClientsStats(const std::function<void(const ClientStatsDTO&)>& consumer);
+    // Из помесячных агрегатов; без MonthlyRollupService все значения нулевые
     std::map<std::string, int> getMonthlyStats(int year, int month);
+    MonthlyStatsDTO getMonthlyReport(int year, int month, const std::optional<UUID>& branchId = std::nullopt);
+    std::vector<MonthlyStatsDTO> getMonthlyTrend(const YearMonth& from, const YearMonth& to,
+                                                 const std::optional<UUID>& branchId = std::nullopt);
+    // Возобновляемый пересчет помесячных агрегатов, см. MonthlyRollupService::backfill
+    int backfillMonthlyStats(const YearMonth& from, const YearMonth& to, bool restart = false);
     bool migrateExistingData();
     
 private:
     double calculateAttendanceRate(int visited, int total) const;
+    ClientStatsDTO toClientStats(const ClientAttendanceSummary& summary) const;
+    void fillClientCounts(ClientStatsDTO& stats, const AttendanceCounts& counts) const;
     bool migrateBookingsToAttendance();
     bool migrateEnrollmentsToAttendance();
     std::string attendanceStatusToString(AttendanceStatus status);
@@ -4,10 +4,12 @@
 SubscriptionService::SubscriptionService(
     std::shared_ptr<ISubscriptionRepository> subscriptionRepo,
     std::shared_ptr<ISubscriptionTypeRepository> subscriptionTypeRepo,
-    std::shared_ptr<IClientRepository> clientRepo
+    std::shared_ptr<IClientRepository> clientRepo,
+    std::shared_ptr<MonthlyRollupService> rollups
 ) : subscriptionRepository_(std::move(subscriptionRepo)),
     subscriptionTypeRepository_(std::move(subscriptionTypeRepo)),
-    clientRepository_(std::move(clientRepo)) {}
+    clientRepository_(std::move(clientRepo)),
+    rollups_(std::move(rollups)) {}
 
 void SubscriptionService::validateSubscriptionRequest(const SubscriptionRequestDTO& request) const {
     if (!request.validate()) {
@@ -77,6 +79,9 @@ SubscriptionResponseDTO SubscriptionService::purchaseSubscription(const Subscrip
     if (!subscriptionRepository_->save(subscription)) {
         throw std::runtime_error("Failed to save subscription");
     }
+    if (rollups_) {
+        rollups_->recordSubscriptionPurchase(subscription, subscriptionType->getPrice());
+    }
     
     return SubscriptionResponseDTO(subscription);
 }
@@ -109,6 +114,10 @@ SubscriptionResponseDTO SubscriptionService::renewSubscription(const UUID& subsc
     if (!subscriptionRepository_->update(renewedSubscription)) {
         throw std::runtime_error("Failed to renew subscription");
     }
+    // Продление перезаписывает purchase_date, поэтому выручка относится к месяцу продления
+    if (rollups_) {
+        rollups_->recordSubscriptionPurchase(renewedSubscription, subscriptionType->getPrice());
+    }
     
     return SubscriptionResponseDTO(renewedSubscription);
 }
@@ -4,6 +4,7 @@
 #include "../repositories/IClientRepository.hpp"
 #include "../dtos/SubscriptionDTO.hpp"
 #include "../types/uuid.hpp"
+#include "MonthlyRollupService.hpp"
 #include "exceptions/ValidationException.hpp"
 #include <memory>
 #include <vector>
@@ -13,16 +14,19 @@ private:
     std::shared_ptr<ISubscriptionRepository> subscriptionRepository_;
     std::shared_ptr<ISubscriptionTypeRepository> subscriptionTypeRepository_;
     std::shared_ptr<IClientRepository> clientRepository_;
+    std::shared_ptr<MonthlyRollupService> rollups_;
 
     void validateSubscriptionRequest(const SubscriptionRequestDTO& request) const;
     void validateClient(const UUID& clientId) const;
     bool hasActiveSubscription(const UUID& clientId) const;
 
 public:
+    // rollups (необязательно) учитывает выручку от покупок и продлений в помесячной статистике
     SubscriptionService(
         std::shared_ptr<ISubscriptionRepository> subscriptionRepo,
         std::shared_ptr<ISubscriptionTypeRepository> subscriptionTypeRepo,
-        std::shared_ptr<IClientRepository> clientRepo
+        std::shared_ptr<IClientRepository> clientRepo,
+        std::shared_ptr<MonthlyRollupService> rollups = nullptr
     );
 
     SubscriptionResponseDTO purchaseSubscription(const SubscriptionRequestDTO& request);
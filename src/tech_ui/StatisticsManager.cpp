@@ -8,9 +8,11 @@ void StatisticsManager::showMenu() {
         std::cout << "1. Общая статистика студии" << std::endl;
         std::cout << "2. Статистика по клиенту" << std::endl;
         std::cout << "3. Статистика всех клиентов" << std::endl;
+        std::cout << "5. Статистика по месяцам" << std::endl;
+        std::cout << "6. Пересчет помесячной статистики" << std::endl;
         std::cout << "0. Назад" << std::endl;
         
-        int choice = InputHandlers::readInt("Выберите опцию: ", 0, 4);
+        int choice = InputHandlers::readInt("Выберите опцию: ", 0, 6);
         
         switch (choice) {
             case 1:
@@ -25,6 +27,12 @@ void StatisticsManager::showMenu() {
             case 4:
                 migrateHistoricalData();
                 break;
+            case 5:
+                showMonthlyStats();
+                break;
+            case 6:
+                backfillMonthlyStats();
+                break;
             case 0:
                 return;
             default:
@@ -88,17 +96,12 @@ void StatisticsManager::showAllClientsStats() {
     try {
         std::cout << "\n--- СТАТИСТИКА ВСЕХ КЛИЕНТОВ ---" << std::endl;
         
-        auto allStats = statisticsService_->getAllClientsStats(); 
-        
-        if (allStats.empty()) {
-            std::cout << "Нет данных для отображения." << std::endl;
-            return;
-        }
-        
         std::cout << "📊 СТАТИСТИКА ПОСЕЩАЕМОСТИ КЛИЕНТОВ:" << std::endl;
         std::cout << "=============================================" << std::endl;
         
-        for (const auto& stats : allStats) {
+        // Клиенты выводятся по мере получения пачек из БД
+        std::size_t shown = 0;
+        statisticsService_->streamAllClientsStats([&shown](const ClientStatsDTO& stats) {
             std::cout << "👤 " << stats.clientName << " (ID: " << stats.clientId.toString() << ")" << std::endl;
             std::cout << "   🎓 Занятия: " << stats.visitedLessons << "/" << stats.totalLessons 
                       << " (" << std::fixed << std::setprecision(1) 
@@ -109,6 +112,13 @@ void StatisticsManager::showAllClientsStats() {
                       << (stats.totalBookings > 0 ? (static_cast<double>(stats.visitedBookings) / stats.totalBookings * 100) : 0)
                       << "%)" << std::endl;
             std::cout << "---------------------------------------------" << std::endl;
+            ++shown;
+        });
+        
+        if (shown == 0) {
+            std::cout << "Нет данных для отображения." << std::endl;
+        } else {
+            std::cout << "Всего клиентов: " << shown << std::endl;
         }
         
     } catch (const std::exception& e) {
@@ -116,6 +126,59 @@ void StatisticsManager::showAllClientsStats() {
     }
 }
 
+void StatisticsManager::showMonthlyStats() {
+    try {
+        std::cout << "\n--- СТАТИСТИКА ПО МЕСЯЦАМ ---" << std::endl;
+        
+        int fromYear = InputHandlers::readInt("Год начала: ", 2000, 2100);
+        int fromMonth = InputHandlers::readInt("Месяц начала (1-12): ", 1, 12);
+        int toYear = InputHandlers::readInt("Год окончания: ", 2000, 2100);
+        int toMonth = InputHandlers::readInt("Месяц окончания (1-12): ", 1, 12);
+        
+        auto trend = statisticsService_->getMonthlyTrend({fromYear, fromMonth}, {toYear, toMonth});
+        if (trend.empty()) {
+            std::cout << "Нет данных для отображения." << std::endl;
+            return;
+        }
+        
+        for (const auto& stats : trend) {
+            std::cout << "📅 " << YearMonth{stats.year, stats.month}.toString() << std::endl;
+            std::cout << "   🎓 Занятий проведено: " << stats.lessonsHeld
+                      << ", отменено: " << stats.lessonsCancelled << std::endl;
+            std::cout << "   🏟️ Бронирований использовано: " << stats.bookingsUsed
+                      << ", отменено: " << stats.bookingsCancelled << std::endl;
+            std::cout << "   👥 Новых клиентов: " << stats.newClients << std::endl;
+            std::cout << "   💳 Выручка от абонементов: " << std::fixed << std::setprecision(2)
+                      << stats.subscriptionRevenue << std::endl;
+            std::cout << "   📈 Посещаемость: " << std::fixed << std::setprecision(1)
+                      << stats.attendanceRate << "%" << std::endl;
+            std::cout << "---------------------------------------------" << std::endl;
+        }
+        
+    } catch (const std::exception& e) {
+        std::cerr << "❌ Ошибка при получении статистики по месяцам: " << e.what() << std::endl;
+    }
+}
+
+void StatisticsManager::backfillMonthlyStats() {
+    std::cout << "\n--- ПЕРЕСЧЕТ ПОМЕСЯЧНОЙ СТАТИСТИКИ ---" << std::endl;
+    std::cout << "ℹ️  Прерванный пересчет того же диапазона продолжится с последнего обработанного месяца." << std::endl;
+    
+    try {
+        int fromYear = InputHandlers::readInt("Год начала: ", 2000, 2100);
+        int fromMonth = InputHandlers::readInt("Месяц начала (1-12): ", 1, 12);
+        int toYear = InputHandlers::readInt("Год окончания: ", 2000, 2100);
+        int toMonth = InputHandlers::readInt("Месяц окончания (1-12): ", 1, 12);
+        bool restart = InputHandlers::readYesNo("Начать диапазон заново?");
+        
+        int processed = statisticsService_->backfillMonthlyStats({fromYear, fromMonth}, {toYear, toMonth}, restart);
+        std::cout << "✅ Пересчитано месяцев: " << processed << std::endl;
+        
+    } catch (const std::exception& e) {
+        std::cerr << "❌ Ошибка пересчета помесячной статистики: " << e.what() << std::endl;
+    }
+}
+
 bool StatisticsManager::migrateHistoricalData() {
     std::cout << "\n--- МИГРАЦИЯ ИСТОРИЧЕСКИХ ДАННЫХ ---" << std::endl;
     std::cout << "⚠️  Эта операция перенесет существующие бронирования и записи в систему посещаемости." << std::endl;
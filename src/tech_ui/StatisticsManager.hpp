@@ -15,5 +15,7 @@ public:
     void showStudioStats();
     void showClientStats(); 
     void showAllClientsStats();
+    void showMonthlyStats();
+    void backfillMonthlyStats();
     bool migrateHistoricalData();
 };
\ No newline at end of file
@@ -1,5 +1,6 @@
 #include "TechUIManagers.hpp"
 #include "../services/BranchService.hpp"
+#include "../repositories/impl/CachedReferenceRepositories.hpp"
 
 TechUIManagers::TechUIManagers(const Config& config) {
     try {
@@ -19,22 +20,47 @@ TechUIManagers::TechUIManagers(const Config& config) {
         branchRepo_ = repositoryFactory_->createBranchRepository();
         studioRepo_ = repositoryFactory_->createStudioRepository();
         attendanceRepo_ = repositoryFactory_->createAttendanceRepository(); 
+        monthlyRollupRepo_ = repositoryFactory_->createMonthlyRollupRepository();
 
         // Тестируем соединение
         if (!repositoryFactory_->testConnection()) {
             throw std::runtime_error("Database connection test failed");
         }
         
+        // Филиалы, залы и типы абонементов читаются из памяти; запись через обертки сбрасывает кеш.
+        // Без фонового потока: изменения веб-приложения видны после истечения срока снимка
+        referenceData_ = std::make_shared<ReferenceDataCache>(
+            branchRepo_, hallRepo_, subscriptionTypeRepo_,
+            std::chrono::seconds(config.getReferenceDataRefreshIntervalSeconds()));
+        try {
+            referenceData_->load();
+        } catch (const std::exception& e) {
+            std::cerr << "⚠️ Справочные данные не загружены (загрузятся при первом обращении): " << e.what() << std::endl;
+        }
+        branchRepo_ = std::make_shared<CachedBranchRepository>(branchRepo_, referenceData_);
+        hallRepo_ = std::make_shared<CachedDanceHallRepository>(hallRepo_, referenceData_);
+        subscriptionTypeRepo_ = std::make_shared<CachedSubscriptionTypeRepository>(subscriptionTypeRepo_, referenceData_);
+        
+        attendanceCounters_ = std::make_shared<AttendanceCounters>(
+            attendanceRepo_,
+            std::chrono::seconds(config.getStatisticsReconcileIntervalSeconds())
+        );
+        attendanceCounters_->start();
+        
+        monthlyRollups_ = std::make_shared<MonthlyRollupService>(monthlyRollupRepo_, hallRepo_);
+        
         auto attendanceService = std::make_shared<AttendanceService>(
             attendanceRepo_,
             bookingRepo_,
             enrollmentRepo_,
-            lessonRepo_
+            lessonRepo_,
+            attendanceCounters_,
+            monthlyRollups_
         );
 
-        auto branchService = std::make_shared<BranchService>(branchRepo_, hallRepo_);
+        auto branchService = std::make_shared<BranchService>(branchRepo_, hallRepo_, referenceData_);
         
-        authService_ = std::make_unique<AuthService>(clientRepo_);
+        authService_ = std::make_unique<AuthService>(clientRepo_, monthlyRollups_);
         
         bookingService_ = std::make_unique<BookingService>(
             bookingRepo_,
@@ -50,7 +76,8 @@ TechUIManagers::TechUIManagers(const Config& config) {
             lessonRepo_,
             enrollmentRepo_,
             trainerRepo_,
-            hallRepo_
+            hallRepo_,
+            monthlyRollups_
         );
     
         enrollmentService_ = std::make_unique<EnrollmentService>(
@@ -63,7 +90,8 @@ TechUIManagers::TechUIManagers(const Config& config) {
         subscriptionService_ = std::make_unique<SubscriptionService>(
             subscriptionRepo_,
             subscriptionTypeRepo_,
-            clientRepo_
+            clientRepo_,
+            monthlyRollups_
         );
         
         reviewService_ = std::make_unique<ReviewService>(
@@ -85,7 +113,9 @@ TechUIManagers::TechUIManagers(const Config& config) {
             lessonRepo_,
             bookingRepo_,
             enrollmentRepo_,
-            attendanceService
+            attendanceService,
+            attendanceCounters_,
+            monthlyRollups_
         );
         
         statisticsManager_ = std::make_unique<StatisticsManager>(statisticsService_.get());
@@ -10,6 +10,7 @@
 #include "../services/ScheduleService.hpp"
 #include "../services/StatisticsService.hpp"
 #include "../services/AttendanceService.hpp"
+#include "../services/ReferenceDataCache.hpp"
 #include "StatisticsManager.hpp" 
 #include "../data/IRepositoryFactory.hpp"
 #include "../data/RepositoryFactoryCreator.hpp"
@@ -33,6 +34,14 @@ private:
     std::shared_ptr<IBranchRepository> branchRepo_;
     std::shared_ptr<IStudioRepository> studioRepo_;
     std::shared_ptr<IAttendanceRepository> attendanceRepo_;
+    std::shared_ptr<IMonthlyRollupRepository> monthlyRollupRepo_;
+
+    // Счетчики посещаемости для StatisticsManager
+    std::shared_ptr<AttendanceCounters> attendanceCounters_;
+    // Помесячные агрегаты: обновляются сервисами, читаются и пересчитываются StatisticsManager
+    std::shared_ptr<MonthlyRollupService> monthlyRollups_;
+    // Справочные данные; hallRepo_, branchRepo_ и subscriptionTypeRepo_ читают из него
+    std::shared_ptr<ReferenceDataCache> referenceData_;
 
     // Сервисы
     std::unique_ptr<AuthService> authService_;
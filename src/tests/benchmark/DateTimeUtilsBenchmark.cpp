@@ -0,0 +1,128 @@
+// Микробенчмарк разбора и форматирования временных меток DateTimeUtils
+// в сравнении с прежней реализацией на std::istringstream/std::get_time и std::put_time.
+//
+// Запуск: ./DateTimeUtilsBenchmark [количество строк]
+#include "../../data/DateTimeUtils.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <ctime>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using Clock = std::chrono::steady_clock;
+using TimePoint = std::chrono::system_clock::time_point;
+
+// Прежняя реализация разбора (для сравнения)
+static TimePoint legacyParseTimeFromPostgres(const std::string& timeStr) {
+    std::tm tm = {};
+    std::istringstream ss(timeStr);
+    ss >> std::get_time(&tm, "%Y-%m-%d %H:%M:%S");
+    if (ss.fail()) {
+        throw std::runtime_error("Failed to parse time from PostgreSQL: " + timeStr);
+    }
+    tm.tm_isdst = -1;
+    return std::chrono::system_clock::from_time_t(::timegm(&tm));
+}
+
+// Прежняя реализация форматирования (для сравнения)
+static std::string legacyFormatTimeForPostgres(const TimePoint& timePoint) {
+    auto time_t = std::chrono::system_clock::to_time_t(timePoint);
+    std::tm tm = *std::gmtime(&time_t);
+    std::ostringstream oss;
+    oss << std::put_time(&tm, "%Y-%m-%d %H:%M:%S");
+    return oss.str();
+}
+
+template <typename Operation>
+static double measureNanosPerItem(std::size_t count, Operation&& operation) {
+    auto start = Clock::now();
+    operation();
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start);
+    return static_cast<double>(elapsed.count()) / static_cast<double>(count);
+}
+
+static void report(const std::string& name, double legacyNs, double currentNs) {
+    std::cout << std::left << std::setw(28) << name
+              << std::right << std::setw(10) << std::fixed << std::setprecision(1) << legacyNs << " ns"
+              << std::setw(10) << currentNs << " ns"
+              << std::setw(8) << std::setprecision(1) << legacyNs / currentNs << "x" << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    std::size_t count = argc > 1 ? static_cast<std::size_t>(std::atol(argv[1])) : 1000000;
+
+    // Столбец временных меток, как в результате findAll
+    std::vector<TimePoint> timePoints;
+    std::vector<std::string> column;
+    std::vector<std::string> mongoColumn;
+    timePoints.reserve(count);
+    column.reserve(count);
+    mongoColumn.reserve(count);
+    auto base = std::chrono::system_clock::from_time_t(1700000000);
+    for (std::size_t i = 0; i < count; ++i) {
+        timePoints.push_back(base + std::chrono::seconds(static_cast<long long>(i) * 997));
+        column.push_back(DateTimeUtils::formatTimeForPostgres(timePoints.back()));
+        mongoColumn.push_back(DateTimeUtils::formatTimeForMongoDB(timePoints.back()));
+    }
+
+    std::int64_t checksum = 0;
+
+    std::cout << "📊 DateTimeUtils benchmark, " << count << " timestamps" << std::endl;
+    std::cout << std::left << std::setw(28) << "operation"
+              << std::right << std::setw(13) << "legacy" << std::setw(13) << "current"
+              << std::setw(9) << "gain" << std::endl;
+
+    double legacyParse = measureNanosPerItem(count, [&]() {
+        for (const auto& value : column) {
+            checksum += legacyParseTimeFromPostgres(value).time_since_epoch().count();
+        }
+    });
+    double currentParse = measureNanosPerItem(count, [&]() {
+        for (const auto& value : column) {
+            checksum -= DateTimeUtils::parseTimeFromPostgres(value).time_since_epoch().count();
+        }
+    });
+    report("parseTimeFromPostgres", legacyParse, currentParse);
+
+    double legacyMongoParse = measureNanosPerItem(count, [&]() {
+        for (const auto& value : mongoColumn) {
+            std::tm tm = {};
+            std::istringstream ss(value);
+            ss >> std::get_time(&tm, "%Y-%m-%dT%H:%M:%SZ");
+            checksum += static_cast<std::int64_t>(std::mktime(&tm));
+        }
+    });
+    double batchMongoParse = measureNanosPerItem(count, [&]() {
+        auto values = DateTimeUtils::parseTimesFromMongoDB(mongoColumn);
+        checksum -= static_cast<std::int64_t>(values.size());
+    });
+    report("parseTimesFromMongoDB", legacyMongoParse, batchMongoParse);
+
+    double legacyFormat = measureNanosPerItem(count, [&]() {
+        for (const auto& timePoint : timePoints) {
+            checksum += static_cast<std::int64_t>(legacyFormatTimeForPostgres(timePoint).size());
+        }
+    });
+    double currentFormat = measureNanosPerItem(count, [&]() {
+        for (const auto& timePoint : timePoints) {
+            checksum -= static_cast<std::int64_t>(DateTimeUtils::formatTimeForPostgres(timePoint).size());
+        }
+    });
+    report("formatTimeForPostgres", legacyFormat, currentFormat);
+
+    double bufferFormat = measureNanosPerItem(count, [&]() {
+        char buffer[DateTimeUtils::POSTGRES_TIMESTAMP_LENGTH];
+        for (const auto& timePoint : timePoints) {
+            checksum -= static_cast<std::int64_t>(DateTimeUtils::formatTimeForPostgres(timePoint, buffer));
+        }
+    });
+    report("formatTimeForPostgres (buf)", legacyFormat, bufferFormat);
+
+    // Контрольная сумма не дает компилятору выбросить измеряемые вызовы
+    std::cout << "checksum: " << checksum << std::endl;
+    return 0;
+}
@@ -0,0 +1,150 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include "../../services/AttendanceCounters.hpp"
+#include "mocks/MockAttendanceRepository.hpp"
+
+using ::testing::Invoke;
+using ::testing::Return;
+using ::testing::StrictMock;
+
+class AttendanceCountersTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        mockAttendanceRepo_ = std::make_shared<StrictMock<MockAttendanceRepository>>();
+        // Без фоновой сверки: тесты вызывают reconcile сами
+        counters_ = std::make_unique<AttendanceCounters>(mockAttendanceRepo_, std::chrono::seconds(0));
+        clientId_ = UUID::generate();
+        otherClientId_ = UUID::generate();
+    }
+
+    // Итоги по всем клиентам складываются из per-client значений, как в БД
+    static AttendanceBreakdown createBreakdown(const std::map<UUID, AttendanceCounts>& byClient) {
+        AttendanceBreakdown breakdown;
+        breakdown.byClient = byClient;
+        for (const auto& [clientId, counts] : byClient) {
+            for (std::size_t type = 0; type < counts.values.size(); ++type) {
+                for (std::size_t status = 0; status < counts.values[type].size(); ++status) {
+                    breakdown.totals.values[type][status] += counts.values[type][status];
+                }
+            }
+        }
+        return breakdown;
+    }
+
+    static AttendanceCounts createCounts(int visitedLessons, int cancelledBookings = 0) {
+        AttendanceCounts counts;
+        counts.add(AttendanceType::LESSON, AttendanceStatus::VISITED, visitedLessons);
+        counts.add(AttendanceType::BOOKING, AttendanceStatus::CANCELLED, cancelledBookings);
+        return counts;
+    }
+
+    std::shared_ptr<StrictMock<MockAttendanceRepository>> mockAttendanceRepo_;
+    std::unique_ptr<AttendanceCounters> counters_;
+    UUID clientId_;
+    UUID otherClientId_;
+};
+
+TEST_F(AttendanceCountersTest, BeforeLoad_RecordIgnored) {
+    EXPECT_FALSE(counters_->isLoaded());
+
+    counters_->record(clientId_, AttendanceType::LESSON, AttendanceStatus::VISITED);
+
+    EXPECT_EQ(counters_->snapshot().get(AttendanceType::LESSON, AttendanceStatus::VISITED), 0);
+    EXPECT_FALSE(counters_->clientSnapshot(clientId_).has_value());
+}
+
+TEST_F(AttendanceCountersTest, LoadBaseline_LoadsTotalsAndClients) {
+    EXPECT_CALL(*mockAttendanceRepo_, aggregateCounts(true))
+        .WillOnce(Return(createBreakdown({{clientId_, createCounts(3, 1)}, {otherClientId_, createCounts(2)}})));
+
+    counters_->loadBaseline();
+
+    ASSERT_TRUE(counters_->isLoaded());
+    auto totals = counters_->snapshot();
+    EXPECT_EQ(totals.get(AttendanceType::LESSON, AttendanceStatus::VISITED), 5);
+    EXPECT_EQ(totals.get(AttendanceType::BOOKING, AttendanceStatus::CANCELLED), 1);
+
+    auto client = counters_->clientSnapshot(clientId_);
+    ASSERT_TRUE(client.has_value());
+    EXPECT_EQ(client->get(AttendanceType::LESSON, AttendanceStatus::VISITED), 3);
+    EXPECT_EQ(counters_->clientSnapshot(UUID::generate())->visited(), 0);
+}
+
+TEST_F(AttendanceCountersTest, Record_AppliesDeltaToTotalsAndClient) {
+    EXPECT_CALL(*mockAttendanceRepo_, aggregateCounts(true))
+        .WillOnce(Return(createBreakdown({{clientId_, createCounts(1)}})));
+    counters_->loadBaseline();
+
+    counters_->record(clientId_, AttendanceType::LESSON, AttendanceStatus::VISITED);
+    counters_->record(otherClientId_, AttendanceType::BOOKING, AttendanceStatus::NO_SHOW);
+    counters_->record(clientId_, AttendanceType::LESSON, AttendanceStatus::SCHEDULED, -1);
+
+    auto totals = counters_->snapshot();
+    EXPECT_EQ(totals.get(AttendanceType::LESSON, AttendanceStatus::VISITED), 2);
+    EXPECT_EQ(totals.get(AttendanceType::BOOKING, AttendanceStatus::NO_SHOW), 1);
+    EXPECT_EQ(totals.get(AttendanceType::LESSON, AttendanceStatus::SCHEDULED), -1);
+    EXPECT_EQ(counters_->clientSnapshot(clientId_)->get(AttendanceType::LESSON, AttendanceStatus::VISITED), 2);
+    EXPECT_EQ(counters_->clientSnapshot(otherClientId_)->get(AttendanceType::BOOKING, AttendanceStatus::NO_SHOW), 1);
+}
+
+TEST_F(AttendanceCountersTest, Reconcile_CorrectsDrift) {
+    EXPECT_CALL(*mockAttendanceRepo_, aggregateCounts(true))
+        .WillOnce(Return(createBreakdown({{clientId_, createCounts(2)}})))
+        .WillOnce(Return(createBreakdown({{clientId_, createCounts(4)}, {otherClientId_, createCounts(0, 1)}})));
+    counters_->loadBaseline();
+
+    int corrected = counters_->reconcile();
+
+    EXPECT_EQ(corrected, 2);
+    auto totals = counters_->snapshot();
+    EXPECT_EQ(totals.get(AttendanceType::LESSON, AttendanceStatus::VISITED), 4);
+    EXPECT_EQ(totals.get(AttendanceType::BOOKING, AttendanceStatus::CANCELLED), 1);
+    EXPECT_EQ(counters_->clientSnapshot(clientId_)->get(AttendanceType::LESSON, AttendanceStatus::VISITED), 4);
+    EXPECT_EQ(counters_->clientSnapshot(otherClientId_)->get(AttendanceType::BOOKING, AttendanceStatus::CANCELLED), 1);
+}
+
+TEST_F(AttendanceCountersTest, Reconcile_NoDrift_NothingCorrected) {
+    auto breakdown = createBreakdown({{clientId_, createCounts(2)}});
+    EXPECT_CALL(*mockAttendanceRepo_, aggregateCounts(true))
+        .WillOnce(Return(breakdown))
+        .WillOnce(Return(breakdown));
+    counters_->loadBaseline();
+
+    EXPECT_EQ(counters_->reconcile(), 0);
+    EXPECT_EQ(counters_->snapshot().get(AttendanceType::LESSON, AttendanceStatus::VISITED), 2);
+}
+
+TEST_F(AttendanceCountersTest, Reconcile_KeepsDeltaRecordedDuringQuery) {
+    EXPECT_CALL(*mockAttendanceRepo_, aggregateCounts(true))
+        .WillOnce(Return(createBreakdown({{clientId_, createCounts(2)}})))
+        .WillOnce(Invoke([&](bool) {
+            // Запись закоммичена после того, как запрос прочитал данные: в результат не попала
+            counters_->record(clientId_, AttendanceType::LESSON, AttendanceStatus::VISITED);
+            return createBreakdown({{clientId_, createCounts(2)}});
+        }));
+    counters_->loadBaseline();
+
+    counters_->reconcile();
+
+    EXPECT_EQ(counters_->snapshot().get(AttendanceType::LESSON, AttendanceStatus::VISITED), 3);
+    EXPECT_EQ(counters_->clientSnapshot(clientId_)->get(AttendanceType::LESSON, AttendanceStatus::VISITED), 3);
+}
+
+TEST_F(AttendanceCountersTest, LoadBaseline_KeepsDeltaRecordedDuringQuery) {
+    EXPECT_CALL(*mockAttendanceRepo_, aggregateCounts(true))
+        .WillOnce(Invoke([&](bool) {
+            counters_->record(otherClientId_, AttendanceType::BOOKING, AttendanceStatus::VISITED);
+            return createBreakdown({{clientId_, createCounts(1)}});
+        }));
+
+    counters_->loadBaseline();
+
+    auto totals = counters_->snapshot();
+    EXPECT_EQ(totals.get(AttendanceType::LESSON, AttendanceStatus::VISITED), 1);
+    EXPECT_EQ(totals.get(AttendanceType::BOOKING, AttendanceStatus::VISITED), 1);
+    EXPECT_EQ(counters_->clientSnapshot(otherClientId_)->get(AttendanceType::BOOKING, AttendanceStatus::VISITED), 1);
+}
+
+TEST_F(AttendanceCountersTest, Reconcile_BeforeLoad_DoesNotQuery) {
+    EXPECT_EQ(counters_->reconcile(), 0);
+}
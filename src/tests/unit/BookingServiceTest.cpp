@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
+#include <algorithm>
 #include "../../services/BookingService.hpp"
 #include "mocks/MockBookingRepository.hpp"
 #include "mocks/MockClientRepository.hpp"
@@ -193,6 +194,96 @@ TEST_F(BookingServiceTest, IsTimeSlotAvailable_NoConflicts_ReturnsTrue) {
     EXPECT_TRUE(isAvailable);
 }
 
+// Тест получения свободных слотов: занятость зала загружается одним запросом на день
+TEST_F(BookingServiceTest, GetAvailableTimeSlots_BookedHour_ExcludedWithSingleQuery) {
+    // Arrange
+    UUID hallId = createTestHallId();
+    auto branch = createTestBranch(createTestBranchId());
+    auto date = std::chrono::system_clock::now() + std::chrono::hours(48);
+    
+    // Начало занятого часа: 12:00 по местному времени филиала (UTC+3)
+    auto offset = branch.getTimezoneOffset();
+    auto local_time_t = std::chrono::system_clock::to_time_t(date + offset);
+    std::tm local_tm = *std::gmtime(&local_time_t);
+    local_tm.tm_hour = 12;
+    local_tm.tm_min = 0;
+    local_tm.tm_sec = 0;
+    auto bookedStart = std::chrono::system_clock::from_time_t(DateTimeUtils::timegm(&local_tm)) - offset;
+    
+    auto booking = createTestBooking(createTestBookingId(), createTestClientId(), hallId, TimeSlot(bookedStart, 60));
+    
+    EXPECT_CALL(*mockHallRepo_, exists(hallId))
+        .WillOnce(Return(true));
+    EXPECT_CALL(*mockBranchService_, getBranchForHall(hallId))
+        .WillOnce(Return(branch));
+    EXPECT_CALL(*mockBookingRepo_, findConflictingBookings(hallId, _))
+        .WillOnce(Return(std::vector<Booking>{booking}));
+    EXPECT_CALL(*mockLessonRepo_, findConflictingLessons(hallId, _))
+        .WillOnce(Return(std::vector<Lesson>{}));
+    EXPECT_CALL(*mockBookingRepo_, findByHallId(_))
+        .Times(0);
+    
+    // Act
+    auto slots = bookingService_->getAvailableTimeSlots(hallId, date);
+    
+    // Assert
+    ASSERT_FALSE(slots.empty());
+    for (const auto& slot : slots) {
+        EXPECT_NE(slot.getStartTime(), bookedStart);
+        EXPECT_FALSE(slot.overlapsWith(booking.getTimeSlot()));
+    }
+    
+    // Соседний свободный час (13:00 по местному времени) предлагается
+    auto nextHour = bookedStart + std::chrono::hours(1);
+    EXPECT_TRUE(std::any_of(slots.begin(), slots.end(), [&](const TimeSlot& slot) {
+        return slot.getStartTime() == nextHour;
+    }));
+}
+
+// Тест сетки доступности филиала: два запроса на все залы и дни
+TEST_F(BookingServiceTest, GetBranchAvailability_TwoHalls_SingleRangeQueries) {
+    // Arrange
+    UUID branchId = createTestBranchId();
+    auto branch = createTestBranch(branchId);
+    auto busyHall = createTestHall(createTestHallId(), branchId);
+    auto freeHall = createTestHall(createTestHallId(), branchId);
+    auto date = std::chrono::system_clock::now() + std::chrono::hours(48);
+    
+    // Занятый час: 12:00 первых суток по местному времени филиала
+    auto offset = branch.getTimezoneOffset();
+    auto local_time_t = std::chrono::system_clock::to_time_t(date + offset);
+    std::tm local_tm = *std::gmtime(&local_time_t);
+    local_tm.tm_hour = 12;
+    local_tm.tm_min = 0;
+    local_tm.tm_sec = 0;
+    auto bookedStart = std::chrono::system_clock::from_time_t(DateTimeUtils::timegm(&local_tm)) - offset;
+    auto booking = createTestBooking(createTestBookingId(), createTestClientId(), busyHall.getId(), TimeSlot(bookedStart, 60));
+    
+    EXPECT_CALL(*mockBranchService_, getBranchById(branchId))
+        .WillOnce(Return(branch));
+    EXPECT_CALL(*mockHallRepo_, findByBranchId(branchId))
+        .WillOnce(Return(std::vector<DanceHall>{busyHall, freeHall}));
+    EXPECT_CALL(*mockBookingRepo_, findConflictingBookingsInRange(_, _, _))
+        .WillOnce(Return(std::vector<Booking>{booking}));
+    EXPECT_CALL(*mockLessonRepo_, findConflictingLessonsInRange(_, _, _))
+        .WillOnce(Return(std::vector<Lesson>{}));
+    
+    // Act
+    auto availability = bookingService_->getBranchAvailability(branchId, date, 2);
+    
+    // Assert
+    ASSERT_EQ(availability.size(), 4u);
+    const auto& busyDay = availability[0];
+    const auto& freeDay = availability[2];
+    EXPECT_EQ(busyDay.hallId, busyHall.getId());
+    EXPECT_EQ(freeDay.hallId, freeHall.getId());
+    EXPECT_EQ(busyDay.availableSlots.size() + 1, freeDay.availableSlots.size());
+    for (const auto& slot : busyDay.availableSlots) {
+        EXPECT_FALSE(slot.overlapsWith(booking.getTimeSlot()));
+    }
+    EXPECT_EQ(availability[1].availableSlots.size(), availability[3].availableSlots.size());
+}
+
 // Тест получения бронирований клиента
 TEST_F(BookingServiceTest, GetClientBookings_ClientExists_ReturnsBookings) {
     // Arrange
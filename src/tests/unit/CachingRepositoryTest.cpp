@@ -0,0 +1,168 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include "../../repositories/impl/CachingRepositories.hpp"
+#include "mocks/MockClientRepository.hpp"
+#include <thread>
+
+using ::testing::_;
+using ::testing::ElementsAre;
+using ::testing::Invoke;
+using ::testing::Return;
+using ::testing::StrictMock;
+
+class CachingRepositoryTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        mockClientRepo_ = std::make_shared<StrictMock<MockClientRepository>>();
+        clientId_ = UUID::generate();
+    }
+
+    std::unique_ptr<CachingClientRepository> createRepository(const CachePolicy& policy = CachePolicy()) {
+        return std::make_unique<CachingClientRepository>(mockClientRepo_, policy);
+    }
+
+    Client createTestClient(const UUID& id) {
+        return Client(id, "Test Client", "client@example.com", "+79255052590");
+    }
+
+    std::shared_ptr<StrictMock<MockClientRepository>> mockClientRepo_;
+    UUID clientId_;
+};
+
+TEST_F(CachingRepositoryTest, FindById_SecondCall_ServedFromCache) {
+    auto repository = createRepository();
+    EXPECT_CALL(*mockClientRepo_, findById(clientId_))
+        .WillOnce(Return(createTestClient(clientId_)));
+
+    auto first = repository->findById(clientId_);
+    auto second = repository->findById(clientId_);
+
+    ASSERT_TRUE(first.has_value());
+    ASSERT_TRUE(second.has_value());
+    EXPECT_EQ(second->getId(), clientId_);
+    EXPECT_TRUE(repository->exists(clientId_));
+
+    auto stats = repository->getCacheStats();
+    EXPECT_EQ(stats.misses, 1u);
+    EXPECT_EQ(stats.hits, 2u);
+}
+
+TEST_F(CachingRepositoryTest, Writes_InvalidateKey) {
+    auto repository = createRepository();
+    auto client = createTestClient(clientId_);
+    EXPECT_CALL(*mockClientRepo_, findById(clientId_))
+        .Times(4)
+        .WillRepeatedly(Return(client));
+    EXPECT_CALL(*mockClientRepo_, save(_)).WillOnce(Return(true));
+    EXPECT_CALL(*mockClientRepo_, update(_)).WillOnce(Return(true));
+    EXPECT_CALL(*mockClientRepo_, remove(clientId_)).WillOnce(Return(true));
+
+    // Каждая запись сбрасывает ключ, поэтому следующее чтение снова идет в исходный репозиторий
+    repository->findById(clientId_);
+    repository->save(client);
+    repository->findById(clientId_);
+    repository->update(client);
+    repository->findById(clientId_);
+    repository->remove(clientId_);
+    repository->findById(clientId_);
+
+    EXPECT_EQ(repository->getCacheStats().invalidations, 3u);
+}
+
+TEST_F(CachingRepositoryTest, FailedWrite_StillInvalidatesKey) {
+    auto repository = createRepository();
+    auto client = createTestClient(clientId_);
+    EXPECT_CALL(*mockClientRepo_, findById(clientId_))
+        .Times(2)
+        .WillRepeatedly(Return(client));
+    EXPECT_CALL(*mockClientRepo_, update(_))
+        .WillOnce(Invoke([](const Client&) -> bool { throw std::runtime_error("connection lost"); }));
+
+    repository->findById(clientId_);
+    EXPECT_THROW(repository->update(client), std::runtime_error);
+    repository->findById(clientId_);
+}
+
+TEST_F(CachingRepositoryTest, LoadRacingWithInvalidate_NotStored) {
+    auto repository = createRepository();
+    auto client = createTestClient(clientId_);
+
+    // Пока загрузка "в полете", другой вызов обновляет клиента и сбрасывает ключ
+    EXPECT_CALL(*mockClientRepo_, update(_)).WillOnce(Return(true));
+    EXPECT_CALL(*mockClientRepo_, findById(clientId_))
+        .WillOnce(Invoke([&](const UUID&) {
+            repository->update(client);
+            return std::optional<Client>(client);
+        }))
+        .WillOnce(Return(client));
+
+    repository->findById(clientId_);
+    repository->findById(clientId_);
+
+    EXPECT_EQ(repository->getCacheStats().size, 1u);
+}
+
+TEST_F(CachingRepositoryTest, NegativeEntry_ExpiresAfterNegativeTtl) {
+    CachePolicy policy;
+    policy.negativeTtl = std::chrono::seconds(1);
+    auto repository = createRepository(policy);
+    EXPECT_CALL(*mockClientRepo_, findById(clientId_))
+        .WillOnce(Return(std::nullopt))
+        .WillOnce(Return(createTestClient(clientId_)));
+
+    EXPECT_FALSE(repository->findById(clientId_).has_value());
+    EXPECT_FALSE(repository->exists(clientId_));
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(1100));
+
+    EXPECT_TRUE(repository->findById(clientId_).has_value());
+
+    auto stats = repository->getCacheStats();
+    EXPECT_EQ(stats.negativeHits, 1u);
+    EXPECT_EQ(stats.expirations, 1u);
+}
+
+TEST_F(CachingRepositoryTest, FindByIds_LoadsOnlyMissingIdsInOneCall) {
+    auto repository = createRepository();
+    UUID missingId = UUID::generate();
+    UUID unknownId = UUID::generate();
+    EXPECT_CALL(*mockClientRepo_, findById(clientId_))
+        .WillOnce(Return(createTestClient(clientId_)));
+    EXPECT_CALL(*mockClientRepo_, findByIds(ElementsAre(missingId, unknownId)))
+        .WillOnce(Return(std::vector<Client>{createTestClient(missingId)}));
+
+    repository->findById(clientId_);
+    auto clients = repository->findByIds({clientId_, missingId, clientId_, unknownId});
+
+    ASSERT_EQ(clients.size(), 2u);
+    EXPECT_EQ(clients[0].getId(), clientId_);
+    EXPECT_EQ(clients[1].getId(), missingId);
+
+    // Найденный и ненайденный ключи закешированы: повторный вызов не обращается к репозиторию
+    EXPECT_EQ(repository->findByIds({missingId, unknownId}).size(), 1u);
+}
+
+TEST_F(CachingRepositoryTest, FullShard_EvictsLeastRecentlyUsed) {
+    CachePolicy policy;
+    policy.capacity = 2;
+    policy.shards = 1;
+    auto repository = createRepository(policy);
+    UUID secondId = UUID::generate();
+    UUID thirdId = UUID::generate();
+    EXPECT_CALL(*mockClientRepo_, findById(clientId_))
+        .WillOnce(Return(createTestClient(clientId_)));
+    EXPECT_CALL(*mockClientRepo_, findById(secondId))
+        .Times(2)
+        .WillRepeatedly(Return(createTestClient(secondId)));
+    EXPECT_CALL(*mockClientRepo_, findById(thirdId))
+        .WillOnce(Return(createTestClient(thirdId)));
+
+    repository->findById(clientId_);
+    repository->findById(secondId);
+    repository->findById(clientId_);  // clientId_ становится недавно использованным
+    repository->findById(thirdId);    // вытесняет secondId
+    repository->findById(clientId_);
+    repository->findById(secondId);
+
+    EXPECT_GE(repository->getCacheStats().evictions, 1u);
+}
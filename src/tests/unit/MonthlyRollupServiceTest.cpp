@@ -0,0 +1,114 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include "../../services/MonthlyRollupService.hpp"
+#include "mocks/MockMonthlyRollupRepository.hpp"
+#include "mocks/MockDanceHallRepository.hpp"
+#include <ctime>
+
+using ::testing::_;
+using ::testing::NiceMock;
+using ::testing::Return;
+using ::testing::StrictMock;
+
+class MonthlyRollupServiceTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        mockRollupRepo_ = std::make_shared<StrictMock<MockMonthlyRollupRepository>>();
+        mockHallRepo_ = std::make_shared<NiceMock<MockDanceHallRepository>>();
+        hallId_ = UUID::fromString("22222222-2222-2222-2222-222222222222");
+        branchId_ = UUID::fromString("44444444-4444-4444-4444-444444444444");
+        trainerId_ = UUID::fromString("11111111-1111-1111-1111-111111111111");
+
+        ON_CALL(*mockHallRepo_, findById(hallId_))
+            .WillByDefault(Return(DanceHall(hallId_, "Main Hall", 50, branchId_)));
+
+        service_ = std::make_unique<MonthlyRollupService>(mockRollupRepo_, mockHallRepo_);
+    }
+
+    // Полдень 15-го числа месяца (UTC)
+    static std::chrono::system_clock::time_point midMonth(int year, int month) {
+        std::tm tm{};
+        tm.tm_year = year - 1900;
+        tm.tm_mon = month - 1;
+        tm.tm_mday = 15;
+        tm.tm_hour = 12;
+        return std::chrono::system_clock::from_time_t(timegm(&tm));
+    }
+
+    Lesson createLesson(const std::chrono::system_clock::time_point& start,
+                        LessonStatus status = LessonStatus::SCHEDULED) {
+        Lesson lesson(lessonId_, LessonType::OPEN_CLASS, "Ballet Class", start, 60,
+                      DifficultyLevel::BEGINNER, 10, 25.0, trainerId_, hallId_);
+        lesson.setStatus(status);
+        return lesson;
+    }
+
+    std::shared_ptr<StrictMock<MockMonthlyRollupRepository>> mockRollupRepo_;
+    std::shared_ptr<NiceMock<MockDanceHallRepository>> mockHallRepo_;
+    std::unique_ptr<MonthlyRollupService> service_;
+
+    UUID lessonId_ = UUID::generate();
+    UUID hallId_;
+    UUID branchId_;
+    UUID trainerId_;
+};
+
+TEST_F(MonthlyRollupServiceTest, CreateScheduledLesson_NoIncrement) {
+    // StrictMock: любой вызов increment провалит тест
+    service_->recordLessonCreated(createLesson(midMonth(2026, 3)));
+}
+
+TEST_F(MonthlyRollupServiceTest, CreateCompletedLesson_IncrementsHeld) {
+    EXPECT_CALL(*mockRollupRepo_, increment(YearMonth{2026, 3}, branchId_,
+                                            std::string(RollupMetric::LESSONS_HELD), 1.0));
+
+    service_->recordLessonCreated(createLesson(midMonth(2026, 3), LessonStatus::COMPLETED));
+}
+
+TEST_F(MonthlyRollupServiceTest, CompleteLesson_IncrementsHeld) {
+    EXPECT_CALL(*mockRollupRepo_, increment(YearMonth{2026, 3}, branchId_,
+                                            std::string(RollupMetric::LESSONS_HELD), 1.0));
+
+    service_->recordLessonChanged(createLesson(midMonth(2026, 3)),
+                                  createLesson(midMonth(2026, 3), LessonStatus::COMPLETED));
+}
+
+TEST_F(MonthlyRollupServiceTest, RescheduleScheduledLessonAcrossMonths_NoIncrement) {
+    service_->recordLessonChanged(createLesson(midMonth(2026, 3)), createLesson(midMonth(2026, 4)));
+}
+
+TEST_F(MonthlyRollupServiceTest, RescheduleCompletedLessonAcrossMonths_MovesHeld) {
+    EXPECT_CALL(*mockRollupRepo_, increment(YearMonth{2026, 3}, branchId_,
+                                            std::string(RollupMetric::LESSONS_HELD), -1.0));
+    EXPECT_CALL(*mockRollupRepo_, increment(YearMonth{2026, 4}, branchId_,
+                                            std::string(RollupMetric::LESSONS_HELD), 1.0));
+
+    service_->recordLessonChanged(createLesson(midMonth(2026, 3), LessonStatus::COMPLETED),
+                                  createLesson(midMonth(2026, 4), LessonStatus::COMPLETED));
+}
+
+TEST_F(MonthlyRollupServiceTest, RescheduleWithinMonth_NoIncrement) {
+    service_->recordLessonChanged(createLesson(midMonth(2026, 3), LessonStatus::COMPLETED),
+                                  createLesson(midMonth(2026, 3) + std::chrono::hours(48), LessonStatus::COMPLETED));
+}
+
+TEST_F(MonthlyRollupServiceTest, CancelScheduledLesson_IncrementsCancelled) {
+    EXPECT_CALL(*mockRollupRepo_, increment(YearMonth{2026, 3}, branchId_,
+                                            std::string(RollupMetric::LESSONS_CANCELLED), 1.0));
+
+    service_->recordLessonChanged(createLesson(midMonth(2026, 3)),
+                                  createLesson(midMonth(2026, 3), LessonStatus::CANCELLED));
+}
+
+TEST_F(MonthlyRollupServiceTest, UnknownHall_NoIncrement) {
+    EXPECT_CALL(*mockHallRepo_, findById(hallId_)).WillOnce(Return(std::nullopt));
+
+    service_->recordLessonCreated(createLesson(midMonth(2026, 3), LessonStatus::COMPLETED));
+}
+
+TEST_F(MonthlyRollupServiceTest, RepositoryError_Swallowed) {
+    EXPECT_CALL(*mockRollupRepo_, increment(_, _, _, _))
+        .WillOnce(::testing::Throw(std::runtime_error("connection lost")));
+
+    EXPECT_NO_THROW(service_->recordLessonCreated(createLesson(midMonth(2026, 3), LessonStatus::COMPLETED)));
+}
@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include "../../services/RequestContext.hpp"
+#include "mocks/MockClientRepository.hpp"
+#include "mocks/MockLessonRepository.hpp"
+
+using ::testing::_;
+using ::testing::Invoke;
+using ::testing::Return;
+using ::testing::StrictMock;
+
+class RequestContextTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        clientId_ = UUID::generate();
+    }
+
+    Client createTestClient(const UUID& id) {
+        return Client(id, "Test Client", "client@example.com", "+79255052590");
+    }
+
+    StrictMock<MockClientRepository> clientRepo_;
+    UUID clientId_;
+};
+
+TEST_F(RequestContextTest, FindById_RepeatedLookup_HitsRepositoryOnce) {
+    EXPECT_CALL(clientRepo_, findById(clientId_))
+        .WillOnce(Return(createTestClient(clientId_)));
+
+    RequestContext context;
+    auto first = context.findById(clientRepo_, clientId_);
+    auto second = context.findById(clientRepo_, clientId_);
+
+    ASSERT_TRUE(first.has_value());
+    ASSERT_TRUE(second.has_value());
+    EXPECT_EQ(second->getId(), clientId_);
+    // Результат поиска отвечает и на exists без отдельного запроса
+    EXPECT_TRUE(context.exists(clientRepo_, clientId_));
+}
+
+TEST_F(RequestContextTest, FindById_MissingEntity_Remembered) {
+    EXPECT_CALL(clientRepo_, findById(clientId_)).WillOnce(Return(std::nullopt));
+
+    RequestContext context;
+    EXPECT_FALSE(context.findById(clientRepo_, clientId_).has_value());
+    EXPECT_FALSE(context.findById(clientRepo_, clientId_).has_value());
+    EXPECT_FALSE(context.exists(clientRepo_, clientId_));
+}
+
+TEST_F(RequestContextTest, Exists_RepeatedCheck_HitsRepositoryOnce) {
+    EXPECT_CALL(clientRepo_, exists(clientId_)).WillOnce(Return(true));
+
+    RequestContext context;
+    EXPECT_TRUE(context.exists(clientRepo_, clientId_));
+    EXPECT_TRUE(context.exists(clientRepo_, clientId_));
+}
+
+TEST_F(RequestContextTest, SaveAndUpdate_InvalidateCachedEntity) {
+    auto client = createTestClient(clientId_);
+    EXPECT_CALL(clientRepo_, findById(clientId_))
+        .Times(3)
+        .WillRepeatedly(Return(client));
+    EXPECT_CALL(clientRepo_, save(_)).WillOnce(Return(true));
+    EXPECT_CALL(clientRepo_, update(_)).WillOnce(Return(true));
+
+    RequestContext context;
+    context.findById(clientRepo_, clientId_);
+    EXPECT_TRUE(context.save(clientRepo_, client));
+    context.findById(clientRepo_, clientId_);
+    EXPECT_TRUE(context.update(clientRepo_, client));
+    context.findById(clientRepo_, clientId_);
+}
+
+TEST_F(RequestContextTest, RemoveAndForget_InvalidateCachedEntity) {
+    EXPECT_CALL(clientRepo_, findById(clientId_))
+        .Times(3)
+        .WillRepeatedly(Return(createTestClient(clientId_)));
+    EXPECT_CALL(clientRepo_, remove(clientId_)).WillOnce(Return(true));
+
+    RequestContext context;
+    context.findById(clientRepo_, clientId_);
+    context.forget(clientRepo_, clientId_);
+    context.findById(clientRepo_, clientId_);
+    EXPECT_TRUE(context.remove(clientRepo_, clientId_));
+    context.findById(clientRepo_, clientId_);
+}
+
+TEST_F(RequestContextTest, FailedWrite_StillInvalidatesCachedEntity) {
+    auto client = createTestClient(clientId_);
+    EXPECT_CALL(clientRepo_, findById(clientId_))
+        .Times(2)
+        .WillRepeatedly(Return(client));
+    EXPECT_CALL(clientRepo_, update(_))
+        .WillOnce(Invoke([](const Client&) -> bool { throw std::runtime_error("connection lost"); }));
+
+    RequestContext context;
+    context.findById(clientRepo_, clientId_);
+    EXPECT_THROW(context.update(clientRepo_, client), std::runtime_error);
+    context.findById(clientRepo_, clientId_);
+}
+
+TEST_F(RequestContextTest, SameIdInDifferentRepositories_CachedSeparately) {
+    StrictMock<MockLessonRepository> lessonRepo;
+    EXPECT_CALL(clientRepo_, findById(clientId_))
+        .WillOnce(Return(createTestClient(clientId_)));
+    EXPECT_CALL(lessonRepo, findById(clientId_)).WillOnce(Return(std::nullopt));
+
+    RequestContext context;
+    EXPECT_TRUE(context.findById(clientRepo_, clientId_).has_value());
+    EXPECT_FALSE(context.findById(lessonRepo, clientId_).has_value());
+    EXPECT_TRUE(context.findById(clientRepo_, clientId_).has_value());
+}
+
+TEST_F(RequestContextTest, Clear_DropsAllEntries) {
+    EXPECT_CALL(clientRepo_, findById(clientId_))
+        .Times(2)
+        .WillRepeatedly(Return(createTestClient(clientId_)));
+
+    RequestContext context;
+    context.findById(clientRepo_, clientId_);
+    context.clear();
+    context.findById(clientRepo_, clientId_);
+}
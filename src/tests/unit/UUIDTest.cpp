@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+#include "../../types/uuid.hpp"
+#include <unordered_map>
+
+TEST(UUIDTest, ParseAndFormat_RoundTrip) {
+    const std::string text = "0123abcd-4567-89ef-0123-456789abcdef";
+    UUID uuid = UUID::fromString(text);
+
+    EXPECT_EQ(uuid.toString(), text);
+    auto chars = uuid.toChars();
+    EXPECT_EQ(std::string(chars.data(), chars.size()), text);
+    EXPECT_EQ(UUID::fromString(uuid.toString()), uuid);
+}
+
+TEST(UUIDTest, Parse_StoresBytesInOrder) {
+    UUID uuid = UUID::fromString("00112233-4455-6677-8899-aabbccddeeff");
+
+    UUID::Bytes expected = {0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77,
+                            0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff};
+    EXPECT_EQ(uuid.bytes(), expected);
+    EXPECT_EQ(UUID::fromBytes(expected), uuid);
+}
+
+TEST(UUIDTest, UppercaseInput_FormattedInLowercase) {
+    UUID upper = UUID::fromString("0123ABCD-4567-89EF-0123-456789ABCDEF");
+    UUID lower = UUID::fromString("0123abcd-4567-89ef-0123-456789abcdef");
+
+    EXPECT_EQ(upper, lower);
+    EXPECT_EQ(upper.toString(), "0123abcd-4567-89ef-0123-456789abcdef");
+}
+
+TEST(UUIDTest, InvalidLength_Rejected) {
+    EXPECT_FALSE(UUID::isValidUUIDFormat(""));
+    EXPECT_FALSE(UUID::isValidUUIDFormat("0123abcd-4567-89ef-0123-456789abcde"));
+    EXPECT_FALSE(UUID::isValidUUIDFormat("0123abcd-4567-89ef-0123-456789abcdef0"));
+    EXPECT_FALSE(UUID::isValidUUIDFormat("0123abcd456789ef0123456789abcdef"));
+    EXPECT_THROW(UUID::fromString("0123abcd-4567"), std::invalid_argument);
+}
+
+TEST(UUIDTest, MisplacedDashes_Rejected) {
+    EXPECT_FALSE(UUID::isValidUUIDFormat("0123abc-d4567-89ef-0123-456789abcdef"));
+    EXPECT_FALSE(UUID::isValidUUIDFormat("0123abcd-456-789ef-0123-456789abcdef"));
+    EXPECT_FALSE(UUID::isValidUUIDFormat("0123abcd-4567-89ef0-123-456789abcdef"));
+    EXPECT_FALSE(UUID::isValidUUIDFormat("0123abcd-4567-89ef-0123456789abcdef-"));
+    EXPECT_THROW(UUID::fromString("0123abcd_4567_89ef_0123_456789abcdef"), std::invalid_argument);
+}
+
+TEST(UUIDTest, NonHexCharacters_Rejected) {
+    EXPECT_FALSE(UUID::isValidUUIDFormat("g123abcd-4567-89ef-0123-456789abcdef"));
+    EXPECT_FALSE(UUID::isValidUUIDFormat("0123abcd-4567-89ef-0123-456789abcdez"));
+    EXPECT_FALSE(UUID::isValidUUIDFormat("0123abcd-4567-89ef-0123-4567 9abcdef"));
+    EXPECT_FALSE(UUID::isValidUUIDFormat("0123abcd-4567-89ef-0123-4567\xff" "9abcdef"));
+    EXPECT_THROW(UUID::fromString("0123abcd-4567-89ef-01-3-456789abcdef"), std::invalid_argument);
+}
+
+TEST(UUIDTest, Comparison_MatchesLowercaseStringOrder) {
+    UUID low = UUID::fromString("00000000-0000-0000-0000-0000000000ff");
+    UUID high = UUID::fromString("00000000-0000-0000-0000-000000000100");
+
+    EXPECT_TRUE(low < high);
+    EXPECT_FALSE(high < low);
+    EXPECT_FALSE(low < low);
+    EXPECT_EQ(low < high, low.toString() < high.toString());
+    EXPECT_TRUE(low == UUID::fromString("00000000-0000-0000-0000-0000000000FF"));
+    EXPECT_TRUE(low != high);
+}
+
+TEST(UUIDTest, NullUUID) {
+    EXPECT_TRUE(UUID().isNull());
+    EXPECT_EQ(UUID().toString(), "00000000-0000-0000-0000-000000000000");
+    EXPECT_FALSE(UUID::generate().isNull());
+}
+
+TEST(UUIDTest, UnorderedMap_FindsByEqualValue) {
+    std::unordered_map<UUID, int> values;
+    UUID first = UUID::fromString("11111111-1111-1111-1111-111111111111");
+    UUID second = UUID::fromString("11111111-1111-1111-1111-111111111112");
+    values[first] = 1;
+    values[second] = 2;
+
+    EXPECT_EQ(values.size(), 2u);
+    EXPECT_EQ(values.at(UUID::fromString("11111111-1111-1111-1111-111111111111")), 1);
+    EXPECT_EQ(values.at(UUID::fromString("11111111-1111-1111-1111-111111111112")), 2);
+    EXPECT_EQ(std::hash<UUID>{}(first), UUID::Hash{}(first));
+    EXPECT_NE(UUID::Hash{}(first), UUID::Hash{}(second));
+}
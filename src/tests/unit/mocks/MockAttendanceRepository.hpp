@@ -16,9 +16,15 @@ public:
     MOCK_METHOD(bool, update, (const Attendance&), (override));
     MOCK_METHOD(bool, remove, (const UUID&), (override));
     MOCK_METHOD(bool, exists, (const UUID&), (override));
+    MOCK_METHOD(std::vector<Attendance>, findByIds, (const std::vector<UUID>& ids), (override));
+    MOCK_METHOD(std::set<UUID>, existsMany, (const std::vector<UUID>& ids), (override));
     MOCK_METHOD(int, countByClientAndStatus, (const UUID&, AttendanceStatus), (override));
     MOCK_METHOD(int, countByTypeAndStatus, (AttendanceType, AttendanceStatus), (override));
     MOCK_METHOD((std::vector<std::pair<UUID, int>>), getTopClientsByVisits, (int), (override));
+    MOCK_METHOD(AttendanceBreakdown, aggregateCounts, (bool), (override));
+    MOCK_METHOD(AttendanceCounts, aggregateClientCounts, (const UUID&), (override));
+    MOCK_METHOD(std::vector<ClientAttendanceSummary>, findClientSummaries, (int), (override));
+    MOCK_METHOD(void, streamClientSummaries, (int, const ClientAttendanceSummaryConsumer&), (override));
 };
 
 #endif // MOCK_ATTENDANCE_REPOSITORY_HPP
\ No newline at end of file
@@ -8,9 +8,14 @@ public:
     MOCK_METHOD(std::vector<Booking>, findByClientId, (const UUID& clientId), (override));
     MOCK_METHOD(std::vector<Booking>, findByHallId, (const UUID& hallId), (override));
     MOCK_METHOD(std::vector<Booking>, findConflictingBookings, (const UUID& hallId, const TimeSlot& timeSlot), (override));
+    MOCK_METHOD(std::vector<Booking>, findConflictingBookingsInRange, (const std::vector<UUID>& hallIds, const std::chrono::system_clock::time_point& from, const std::chrono::system_clock::time_point& to), (override));
+    MOCK_METHOD(std::vector<Booking>, findByHallsAndRange, (const std::vector<UUID>& hallIds, const std::chrono::system_clock::time_point& from, const std::chrono::system_clock::time_point& to), (override));
+    MOCK_METHOD(std::vector<Booking>, findByBranchAndRange, (const UUID& branchId, const std::chrono::system_clock::time_point& from, const std::chrono::system_clock::time_point& to), (override));
     MOCK_METHOD(std::vector<Booking>, findAll, (), (override)); 
     MOCK_METHOD(bool, save, (const Booking& booking), (override));
     MOCK_METHOD(bool, update, (const Booking& booking), (override));
     MOCK_METHOD(bool, remove, (const UUID& id), (override));
     MOCK_METHOD(bool, exists, (const UUID& id), (override));
+    MOCK_METHOD(std::vector<Booking>, findByIds, (const std::vector<UUID>& ids), (override));
+    MOCK_METHOD(std::set<UUID>, existsMany, (const std::vector<UUID>& ids), (override));
 };
\ No newline at end of file
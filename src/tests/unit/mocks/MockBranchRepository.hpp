@@ -13,6 +13,8 @@ public:
     MOCK_METHOD(bool, update, (const Branch& branch), (override));
     MOCK_METHOD(bool, remove, (const UUID& id), (override));
     MOCK_METHOD(bool, exists, (const UUID& id), (override));
+    MOCK_METHOD(std::vector<Branch>, findByIds, (const std::vector<UUID>& ids), (override));
+    MOCK_METHOD(std::set<UUID>, existsMany, (const std::vector<UUID>& ids), (override));
 };
 
 #endif // MOCKBRANCHREPOSITORY_HPP
\ No newline at end of file
@@ -7,8 +7,11 @@ public:
     MOCK_METHOD(std::optional<Client>, findById, (const UUID& id), (override));
     MOCK_METHOD(std::optional<Client>, findByEmail, (const std::string& email), (override));
     MOCK_METHOD(std::vector<Client>, findAll, (), (override)); 
+    MOCK_METHOD(int, count, (), (override));
     MOCK_METHOD(bool, save, (const Client& client), (override));
     MOCK_METHOD(bool, update, (const Client& client), (override));
     MOCK_METHOD(bool, remove, (const UUID& id), (override));
     MOCK_METHOD(bool, exists, (const UUID& id), (override));
+    MOCK_METHOD(std::vector<Client>, findByIds, (const std::vector<UUID>& ids), (override));
+    MOCK_METHOD(std::set<UUID>, existsMany, (const std::vector<UUID>& ids), (override));
 };
\ No newline at end of file
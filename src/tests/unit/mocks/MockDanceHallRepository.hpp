@@ -7,6 +7,8 @@ public:
     MOCK_METHOD(std::optional<DanceHall>, findById, (const UUID& id), (override));  
     MOCK_METHOD(std::vector<DanceHall>, findByBranchId, (const UUID& branchId), (override));
     MOCK_METHOD(bool, exists, (const UUID& id), (override));
+    MOCK_METHOD(std::vector<DanceHall>, findByIds, (const std::vector<UUID>& ids), (override));
+    MOCK_METHOD(std::set<UUID>, existsMany, (const std::vector<UUID>& ids), (override));
     MOCK_METHOD(std::vector<DanceHall>, findAll, (), (override)); 
     MOCK_METHOD(bool, save, (const DanceHall& hall), (override));  
     MOCK_METHOD(bool, update, (const DanceHall& hall), (override));  
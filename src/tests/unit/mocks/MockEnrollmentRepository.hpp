@@ -16,6 +16,8 @@ public:
     MOCK_METHOD(bool, update, (const Enrollment&), (override));
     MOCK_METHOD(bool, remove, (const UUID&), (override));
     MOCK_METHOD(bool, exists, (const UUID&), (override));
+    MOCK_METHOD(std::vector<Enrollment>, findByIds, (const std::vector<UUID>& ids), (override));
+    MOCK_METHOD(std::set<UUID>, existsMany, (const std::vector<UUID>& ids), (override));
 };
 
 #endif // MOCK_ENROLLMENT_REPOSITORY_HPP
\ No newline at end of file
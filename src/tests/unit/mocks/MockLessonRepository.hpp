@@ -8,10 +8,15 @@ public:
     MOCK_METHOD(std::vector<Lesson>, findByTrainerId, (const UUID& trainerId), (override));
     MOCK_METHOD(std::vector<Lesson>, findByHallId, (const UUID& hallId), (override)); 
     MOCK_METHOD(std::vector<Lesson>, findConflictingLessons, (const UUID& hallId, const TimeSlot& timeSlot), (override));
+    MOCK_METHOD(std::vector<Lesson>, findConflictingLessonsInRange, (const std::vector<UUID>& hallIds, const std::chrono::system_clock::time_point& from, const std::chrono::system_clock::time_point& to), (override));
+    MOCK_METHOD(std::vector<Lesson>, findByHallsAndRange, (const std::vector<UUID>& hallIds, const std::chrono::system_clock::time_point& from, const std::chrono::system_clock::time_point& to), (override));
+    MOCK_METHOD(std::vector<Lesson>, findByBranchAndRange, (const UUID& branchId, const std::chrono::system_clock::time_point& from, const std::chrono::system_clock::time_point& to), (override));
     MOCK_METHOD(std::vector<Lesson>, findUpcomingLessons, (int days), (override)); 
     MOCK_METHOD(std::vector<Lesson>, findAll, (), (override));
     MOCK_METHOD(bool, save, (const Lesson& lesson), (override));
     MOCK_METHOD(bool, update, (const Lesson& lesson), (override));
     MOCK_METHOD(bool, remove, (const UUID& id), (override));
     MOCK_METHOD(bool, exists, (const UUID& id), (override));
+    MOCK_METHOD(std::vector<Lesson>, findByIds, (const std::vector<UUID>& ids), (override));
+    MOCK_METHOD(std::set<UUID>, existsMany, (const std::vector<UUID>& ids), (override));
 };
\ No newline at end of file
@@ -0,0 +1,12 @@
+#pragma once
+#include "../../../repositories/IMonthlyRollupRepository.hpp"
+#include <gmock/gmock.h>
+
+class MockMonthlyRollupRepository : public IMonthlyRollupRepository {
+public:
+    MOCK_METHOD(void, increment, (const YearMonth& month, const UUID& branchId, const std::string& metric, double delta), (override));
+    MOCK_METHOD(std::vector<MonthlyRollupEntry>, findByMonthRange, (const YearMonth& from, const YearMonth& to), (override));
+    MOCK_METHOD(void, rebuildMonth, (const YearMonth& month), (override));
+    MOCK_METHOD(std::optional<YearMonth>, getBackfillCursor, (const std::string& jobName), (override));
+    MOCK_METHOD(void, saveBackfillCursor, (const std::string& jobName, const YearMonth& month), (override));
+};
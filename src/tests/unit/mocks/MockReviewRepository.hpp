@@ -15,4 +15,6 @@ public:
     MOCK_METHOD(bool, update, (const Review& review), (override));
     MOCK_METHOD(bool, remove, (const UUID& id), (override));
     MOCK_METHOD(bool, exists, (const UUID& id), (override));
+    MOCK_METHOD(std::vector<Review>, findByIds, (const std::vector<UUID>& ids), (override));
+    MOCK_METHOD(std::set<UUID>, existsMany, (const std::vector<UUID>& ids), (override));
 };
\ No newline at end of file
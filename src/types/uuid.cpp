@@ -1,89 +1,160 @@
 #include "uuid.hpp"
-#include <regex>
+#include <cstring>
 #include <stdexcept>
-#include <sstream>
-#include <iomanip>
-#include <random>
 
 #ifdef _WIN32
     #include <windows.h>
     #include <rpcdce.h>
+    #pragma comment(lib, "rpcrt4.lib")
 #else
     #include <uuid/uuid.h>
 #endif
 
-UUID::UUID() : value_("00000000-0000-0000-0000-000000000000") {}
+// Позиции дефисов в строковой форме
+static constexpr std::size_t HYPHEN_POSITIONS[] = {8, 13, 18, 23};
 
-UUID::UUID(const std::string& uuid) : value_(uuid) {
-    if (!isValidUUIDFormat(uuid) && uuid != "00000000-0000-0000-0000-000000000000") {
-        throw std::invalid_argument("Invalid UUID format: " + uuid);
+// Позиция старшей цифры каждого байта в строковой форме (с учетом дефисов)
+static constexpr std::size_t BYTE_POSITIONS[] = {0, 2, 4, 6, 9, 11, 14, 16, 19, 21, 24, 26, 28, 30, 32, 34};
+
+static constexpr char HEX_DIGITS[] = "0123456789abcdef";
+
+// Таблица значений шестнадцатеричных цифр: 0xFF для недопустимых символов
+struct HexTable {
+    std::uint8_t values[256];
+
+    constexpr HexTable() : values() {
+        for (int i = 0; i < 256; ++i) {
+            values[i] = 0xFF;
+        }
+        for (int i = 0; i < 10; ++i) {
+            values['0' + i] = static_cast<std::uint8_t>(i);
+        }
+        for (int i = 0; i < 6; ++i) {
+            values['a' + i] = static_cast<std::uint8_t>(10 + i);
+            values['A' + i] = static_cast<std::uint8_t>(10 + i);
+        }
+    }
+};
+
+static constexpr HexTable HEX_TABLE{};
+
+UUID::UUID(std::string_view uuid) {
+    if (!parse(uuid, bytes_)) {
+        throw std::invalid_argument("Invalid UUID format: " + std::string(uuid));
     }
 }
 
+bool UUID::parse(std::string_view str, Bytes& out) {
+    if (str.size() != STRING_LENGTH) {
+        return false;
+    }
+    for (auto position : HYPHEN_POSITIONS) {
+        if (str[position] != '-') {
+            return false;
+        }
+    }
+
+    // Длина и дефисы проверены выше; в цикле по цифрам ошибки накапливаются через OR
+    // и проверяются один раз после разбора всех 32 символов
+    std::uint8_t invalid = 0;
+    for (std::size_t i = 0; i < BYTE_LENGTH; ++i) {
+        std::size_t pos = BYTE_POSITIONS[i];
+        std::uint8_t high = HEX_TABLE.values[static_cast<unsigned char>(str[pos])];
+        std::uint8_t low = HEX_TABLE.values[static_cast<unsigned char>(str[pos + 1])];
+        invalid |= (high | low) & 0xF0;
+        out[i] = static_cast<std::uint8_t>((high << 4) | (low & 0x0F));
+    }
+    return invalid == 0;
+}
+
 UUID UUID::generate() {
 #ifdef _WIN32
-    UUID uuid;
-    UuidCreate((::UUID*)&uuid);
-    
+    ::UUID native;
+    UuidCreate(&native);
+
     unsigned char* str;
-    UuidToStringA((::UUID*)&uuid, &str);
-    std::string result(reinterpret_cast<char*>(str));
+    UuidToStringA(&native, &str);
+    UUID result(reinterpret_cast<const char*>(str));
     RpcStringFreeA(&str);
-    
-    // Приводим к нижнему регистру для консистентности
-    std::transform(result.begin(), result.end(), result.begin(), ::tolower);
-    return UUID(result);
+    return result;
 #else
     uuid_t native_uuid;
     uuid_generate(native_uuid);
-    
-    char str[37];
-    uuid_unparse_lower(native_uuid, str);
-    
-    return UUID(std::string(str));
+
+    UUID result;
+    std::memcpy(result.bytes_.data(), native_uuid, BYTE_LENGTH);
+    return result;
 #endif
 }
 
-UUID UUID::fromString(const std::string& str) {
+UUID UUID::fromString(std::string_view str) {
     return UUID(str);
 }
 
-const std::string& UUID::toString() const {
-    return value_;
+UUID UUID::fromBytes(const Bytes& bytes) {
+    UUID result;
+    result.bytes_ = bytes;
+    return result;
 }
 
-bool UUID::isValid() const {
-    return isValidUUIDFormat(value_);
+void UUID::toChars(char* out) const {
+    std::size_t pos = 0;
+    for (std::size_t i = 0; i < BYTE_LENGTH; ++i) {
+        if (i == 4 || i == 6 || i == 8 || i == 10) {
+            out[pos++] = '-';
+        }
+        out[pos++] = HEX_DIGITS[bytes_[i] >> 4];
+        out[pos++] = HEX_DIGITS[bytes_[i] & 0x0F];
+    }
 }
 
-bool UUID::isValidUUIDFormat(const std::string& str) {
-    static const std::regex uuidRegex(
-        "^[0-9a-fA-F]{8}-[0-9a-fA-F]{4}-[0-9a-fA-F]{4}-[0-9a-fA-F]{4}-[0-9a-fA-F]{12}$"
-    );
-    return std::regex_match(str, uuidRegex);
+std::array<char, UUID::STRING_LENGTH> UUID::toChars() const {
+    std::array<char, STRING_LENGTH> result;
+    toChars(result.data());
+    return result;
 }
 
-bool UUID::isUUIDv4(const std::string& str) {
-    if (!isValidUUIDFormat(str)) {
-        return false;
-    }
-    
-    // Проверка версии (4-й бит 4-й группы должен быть '4')
-    return str[14] == '4' && (str[19] == '8' || str[19] == '9' || str[19] == 'a' || str[19] == 'b');
+std::string UUID::toString() const {
+    std::string result(STRING_LENGTH, '\0');
+    toChars(&result[0]);
+    return result;
 }
 
-bool UUID::operator==(const UUID& other) const {
-    return value_ == other.value_;
+bool UUID::isNull() const {
+    for (auto byte : bytes_) {
+        if (byte != 0) {
+            return false;
+        }
+    }
+    return true;
 }
 
-bool UUID::operator!=(const UUID& other) const {
-    return value_ != other.value_;
+bool UUID::isValidUUIDFormat(std::string_view str) {
+    Bytes ignored;
+    return parse(str, ignored);
 }
 
-bool UUID::operator<(const UUID& other) const {
-    return value_ < other.value_;
+bool UUID::isUUIDv4(std::string_view str) {
+    if (!isValidUUIDFormat(str)) {
+        return false;
+    }
+
+    // Проверка версии (4-й бит 4-й группы должен быть '4')
+    return str[14] == '4' && (str[19] == '8' || str[19] == '9' || str[19] == 'a' || str[19] == 'b');
 }
 
 std::size_t UUID::Hash::operator()(const UUID& uuid) const {
-    return std::hash<std::string>{}(uuid.toString());
-}
\ No newline at end of file
+    std::uint64_t high;
+    std::uint64_t low;
+    std::memcpy(&high, uuid.bytes_.data(), sizeof(high));
+    std::memcpy(&low, uuid.bytes_.data() + sizeof(high), sizeof(low));
+
+    // Перемешивание splitmix64: последовательные и вручную заданные UUID тоже распределяются равномерно
+    std::uint64_t h = high ^ (low + 0x9E3779B97F4A7C15ULL + (high << 6) + (high >> 2));
+    h ^= h >> 30;
+    h *= 0xBF58476D1CE4E5B9ULL;
+    h ^= h >> 27;
+    h *= 0x94D049BB133111EBULL;
+    h ^= h >> 31;
+    return static_cast<std::size_t>(h);
+}
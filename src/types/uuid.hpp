@@ -1,45 +1,70 @@
 #ifndef UUID_HPP
 #define UUID_HPP
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
 #include <string>
-#include <regex>
-
-#ifdef _WIN32
-    #include <windows.h>
-    #include <rpcdce.h>
-    #pragma comment(lib, "rpcrt4.lib")
-#else
-    #include <uuid/uuid.h>
-#endif
+#include <string_view>
 
+// UUID хранится в бинарном виде (16 байт) и тривиально копируется.
+// Строковая форма формируется только по запросу (toString/toChars),
+// поэтому маппинг строк БД, сравнения и поиск в хеш-таблицах не выделяют память.
 class UUID {
+public:
+    static constexpr std::size_t BYTE_LENGTH = 16;
+    static constexpr std::size_t STRING_LENGTH = 36;
+
+    using Bytes = std::array<std::uint8_t, BYTE_LENGTH>;
+
 private:
-    std::string value_;
+    Bytes bytes_{};
 
 public:
-    UUID();
-    UUID(const std::string& uuid);
-    
+    UUID() = default;
+    UUID(std::string_view uuid);
+    UUID(const std::string& uuid) : UUID(std::string_view(uuid)) {}
+    UUID(const char* uuid) : UUID(std::string_view(uuid)) {}
+
     static UUID generate();
-    static UUID fromString(const std::string& str);
-    
-    const std::string& toString() const;
-    bool isValid() const;
-    bool isNull() const { return value_ == "00000000-0000-0000-0000-000000000000"; }
-    
+    static UUID fromString(std::string_view str);
+    static UUID fromBytes(const Bytes& bytes);
+
+    // Каноническая форма в нижнем регистре: xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx
+    std::string toString() const;
+    // Форматирование в буфер без выделения памяти
+    std::array<char, STRING_LENGTH> toChars() const;
+    void toChars(char* out) const;
+
+    const Bytes& bytes() const { return bytes_; }
+    bool isValid() const { return true; }
+    bool isNull() const;
+
     // Валидация
-    static bool isValidUUIDFormat(const std::string& str);
-    static bool isUUIDv4(const std::string& str);
-    
-    // Операторы сравнения
-    bool operator==(const UUID& other) const;
-    bool operator!=(const UUID& other) const;
-    bool operator<(const UUID& other) const;
-    
+    static bool isValidUUIDFormat(std::string_view str);
+    static bool isUUIDv4(std::string_view str);
+
+    // Операторы сравнения (порядок совпадает с порядком строковой формы в нижнем регистре)
+    bool operator==(const UUID& other) const { return bytes_ == other.bytes_; }
+    bool operator!=(const UUID& other) const { return bytes_ != other.bytes_; }
+    bool operator<(const UUID& other) const { return bytes_ < other.bytes_; }
+
     // Для использования в unordered контейнерах
     struct Hash {
         std::size_t operator()(const UUID& uuid) const;
     };
+
+private:
+    static bool parse(std::string_view str, Bytes& out);
+};
+
+namespace std {
+template <>
+struct hash<UUID> {
+    std::size_t operator()(const UUID& uuid) const { return UUID::Hash{}(uuid); }
 };
+}
 
-#endif // UUID_HPP
\ No newline at end of file
+#endif // UUID_HPP
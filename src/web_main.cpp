@@ -2,15 +2,50 @@
 #include <iostream>
 #include <filesystem>
 #include "web_ui/WebApplication.hpp"
+#include "web_ui/ServiceContainer.hpp"
+#include "core/Config.hpp"
 #include "services/DatabaseHealthService.hpp"  
 
 namespace fs = std::filesystem;
 
+static void loadConfiguration() {
+    auto& config = Config::getInstance();
+    
+    std::vector<std::string> configPaths = {
+        "config/config.properties",
+        "../config/config.properties",
+        "../../config/config.properties",
+        "./config.properties"
+    };
+    
+    for (const auto& path : configPaths) {
+        if (fs::exists(path)) {
+            config.loadFromFile(path);
+            std::cout << "✅ Конфигурация загружена из: " << path << std::endl;
+            return;
+        }
+    }
+    std::cout << "⚠️  Конфигурационный файл не найден, используются значения по умолчанию" << std::endl;
+}
+
 int main(int argc, char** argv) {
     try {
+        loadConfiguration();
+        
         // Запускаем мониторинг здоровья БД
         DatabaseHealthService::startMonitoring();
         
+        // Пул соединений, репозитории и сервисы создаются один раз на процесс
+        auto services = ServiceContainer::create(Config::getInstance());
+        services->startMonitoring();
+        
+        // Перезагрузка конфигурации при изменении файла
+        try {
+            Config::getInstance().startWatching();
+        } catch (const std::exception& e) {
+            std::cerr << "⚠️  Отслеживание изменений конфигурации недоступно: " << e.what() << std::endl;
+        }
+        
         // Создаем аргументы командной строки с docroot
         std::vector<const char*> args;
         args.push_back(argv[0]); 
@@ -30,8 +65,8 @@ int main(int argc, char** argv) {
         Wt::WServer server(args.size(), const_cast<char**>(args.data()));
         
         server.addEntryPoint(Wt::EntryPointType::Application, 
-            [](const Wt::WEnvironment& env) {
-                return std::make_unique<WebApplication>(env);
+            [services](const Wt::WEnvironment& env) {
+                return std::make_unique<WebApplication>(env, services);
             });
         
         std::cout << "🚀 Сервер запущен: http://localhost:8080" << std::endl;
@@ -43,11 +78,14 @@ int main(int argc, char** argv) {
         }
         
         // Останавливаем мониторинг при завершении
+        Config::getInstance().stopWatching();
+        services->stopMonitoring();
         DatabaseHealthService::stopMonitoring();
         
         return 0;
     } catch (const std::exception& e) {
         std::cerr << "💥 Ошибка: " << e.what() << std::endl;
+        Config::getInstance().stopWatching();
         DatabaseHealthService::stopMonitoring();
         return 1;
     }
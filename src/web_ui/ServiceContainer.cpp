@@ -0,0 +1,115 @@
+#include "ServiceContainer.hpp"
+
+// Репозитории
+#include "../repositories/impl/PostgreSQLBookingRepository.hpp"
+#include "../repositories/impl/PostgreSQLClientRepository.hpp"
+#include "../repositories/impl/PostgreSQLDanceHallRepository.hpp"
+#include "../repositories/impl/PostgreSQLBranchRepository.hpp"
+#include "../repositories/impl/PostgreSQLSubscriptionRepository.hpp"
+#include "../repositories/impl/PostgreSQLSubscriptionTypeRepository.hpp"
+#include "../repositories/impl/PostgreSQLLessonRepository.hpp"
+#include "../repositories/impl/PostgreSQLTrainerRepository.hpp"
+#include "../repositories/impl/PostgreSQLEnrollmentRepository.hpp"
+#include "../repositories/impl/PostgreSQLAttendanceRepository.hpp"
+#include "../repositories/impl/PostgreSQLMonthlyRollupRepository.hpp"
+#include "../repositories/impl/CachedReferenceRepositories.hpp"
+#include "../repositories/impl/CachingRepositories.hpp"
+
+// Данные
+#include "../data/ResilientDatabaseConnection.hpp"
+#include "../data/CachingRepositoryFactory.hpp"
+
+#include <iostream>
+
+std::shared_ptr<ServiceContainer> ServiceContainer::create(const Config& config) {
+    return std::shared_ptr<ServiceContainer>(new ServiceContainer(config));
+}
+
+ServiceContainer::ServiceContainer(const Config& config) {
+    std::cout << "🔧 Инициализация общих сервисов..." << std::endl;
+
+    // Одно устойчивое подключение с пулом на весь процесс (размер пула - database.postgres.max_connections)
+    dbConnection_ = std::make_shared<ResilientDatabaseConnection>(config.getPostgresConnectionString());
+    std::cout << "✅ Пул соединений с БД создан" << std::endl;
+
+    std::shared_ptr<ILessonRepository> lessonRepo = std::make_shared<PostgreSQLLessonRepository>(dbConnection_);
+    auto enrollmentRepo = std::make_shared<PostgreSQLEnrollmentRepository>(dbConnection_);
+    auto trainerRepo = std::make_shared<PostgreSQLTrainerRepository>(dbConnection_);
+    auto subscriptionRepo = std::make_shared<PostgreSQLSubscriptionRepository>(dbConnection_);
+    auto bookingRepo = std::make_shared<PostgreSQLBookingRepository>(dbConnection_);
+    std::shared_ptr<IClientRepository> clientRepo = std::make_shared<PostgreSQLClientRepository>(dbConnection_);
+    auto attendanceRepo = std::make_shared<PostgreSQLAttendanceRepository>(dbConnection_);
+    auto monthlyRollupRepo = std::make_shared<PostgreSQLMonthlyRollupRepository>(dbConnection_);
+
+    // Кеш клиентов и занятий по UUID, как в CachingRepositoryFactory
+    auto cacheSettings = config.getRepositoryCacheSettings();
+    if (cacheSettings.enabled) {
+        clientRepo = std::make_shared<CachingClientRepository>(clientRepo, CachingRepositoryFactory::clientPolicy(cacheSettings));
+        lessonRepo = std::make_shared<CachingLessonRepository>(lessonRepo, CachingRepositoryFactory::lessonPolicy(cacheSettings));
+        std::cout << "✅ Кеш репозиториев клиентов и занятий включен" << std::endl;
+    }
+
+    // Филиалы, залы и типы абонементов читаются из памяти; запись через обертки сбрасывает кеш,
+    // записи TechUI подхватываются фоновой перезагрузкой (startMonitoring)
+    auto dbBranchRepo = std::make_shared<PostgreSQLBranchRepository>(dbConnection_);
+    auto dbHallRepo = std::make_shared<PostgreSQLDanceHallRepository>(dbConnection_);
+    auto dbSubscriptionTypeRepo = std::make_shared<PostgreSQLSubscriptionTypeRepository>(dbConnection_);
+    referenceData_ = std::make_shared<ReferenceDataCache>(
+        dbBranchRepo, dbHallRepo, dbSubscriptionTypeRepo,
+        std::chrono::seconds(config.getReferenceDataRefreshIntervalSeconds()));
+    try {
+        referenceData_->load();
+    } catch (const std::exception& e) {
+        std::cerr << "⚠️ Справочные данные не загружены (загрузятся при первом обращении): " << e.what() << std::endl;
+    }
+    auto branchRepo = std::make_shared<CachedBranchRepository>(dbBranchRepo, referenceData_);
+    auto hallRepo = std::make_shared<CachedDanceHallRepository>(dbHallRepo, referenceData_);
+    auto subscriptionTypeRepo = std::make_shared<CachedSubscriptionTypeRepository>(dbSubscriptionTypeRepo, referenceData_);
+
+    monthlyRollups_ = std::make_shared<MonthlyRollupService>(monthlyRollupRepo, hallRepo);
+    authService_ = std::make_shared<AuthService>(clientRepo, monthlyRollups_);
+    attendanceCounters_ = std::make_shared<AttendanceCounters>(
+        attendanceRepo, std::chrono::seconds(config.getStatisticsReconcileIntervalSeconds()));
+    attendanceService_ = std::make_shared<AttendanceService>(
+        attendanceRepo, bookingRepo, enrollmentRepo, lessonRepo, attendanceCounters_, monthlyRollups_);
+    branchService_ = std::make_shared<BranchService>(branchRepo, hallRepo, referenceData_);
+    lessonService_ = std::make_shared<LessonService>(lessonRepo, enrollmentRepo, trainerRepo, hallRepo, monthlyRollups_);
+    enrollmentService_ = std::make_shared<EnrollmentService>(enrollmentRepo, clientRepo, lessonRepo, attendanceService_);
+    subscriptionService_ = std::make_shared<SubscriptionService>(
+        subscriptionRepo, subscriptionTypeRepo, clientRepo, monthlyRollups_);
+    bookingService_ = std::make_shared<BookingService>(
+        bookingRepo,
+        clientRepo,
+        hallRepo,
+        branchRepo,
+        branchService_,
+        lessonRepo,
+        attendanceService_
+    );
+
+    monitor_ = std::make_unique<DatabaseMonitorService>(dbConnection_);
+
+    std::cout << "✅ Общие сервисы инициализированы" << std::endl;
+}
+
+ServiceContainer::~ServiceContainer() {
+    stopMonitoring();
+}
+
+void ServiceContainer::startMonitoring() {
+    monitor_->start();
+    attendanceCounters_->start();
+    referenceData_->start();
+}
+
+void ServiceContainer::stopMonitoring() {
+    if (referenceData_) {
+        referenceData_->stop();
+    }
+    if (attendanceCounters_) {
+        attendanceCounters_->stop();
+    }
+    if (monitor_) {
+        monitor_->stop();
+    }
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <memory>
+#include "../core/Config.hpp"
+#include "../services/AuthService.hpp"
+#include "../services/BookingService.hpp"
+#include "../services/SubscriptionService.hpp"
+#include "../services/LessonService.hpp"
+#include "../services/BranchService.hpp"
+#include "../services/EnrollmentService.hpp"
+#include "../services/AttendanceService.hpp"
+#include "../services/AttendanceCounters.hpp"
+#include "../services/MonthlyRollupService.hpp"
+#include "../services/ReferenceDataCache.hpp"
+#include "../services/DatabaseMonitorService.hpp"
+
+class DatabaseConnection;
+
+// Общие для всех сессий Wt объекты: пул соединений, репозитории и сервисы.
+// Создается один раз в web_main.cpp; сессии получают только указатели на сервисы.
+// Сервисы не хранят состояния между вызовами, а соединения выдаются пулом,
+// поэтому их можно вызывать одновременно из потоков разных сессий.
+class ServiceContainer {
+private:
+    std::shared_ptr<DatabaseConnection> dbConnection_;
+    std::unique_ptr<DatabaseMonitorService> monitor_;
+    std::shared_ptr<AttendanceCounters> attendanceCounters_;
+    std::shared_ptr<MonthlyRollupService> monthlyRollups_;
+    std::shared_ptr<ReferenceDataCache> referenceData_;
+
+    std::shared_ptr<AuthService> authService_;
+    std::shared_ptr<AttendanceService> attendanceService_;
+    std::shared_ptr<BranchService> branchService_;
+    std::shared_ptr<LessonService> lessonService_;
+    std::shared_ptr<EnrollmentService> enrollmentService_;
+    std::shared_ptr<SubscriptionService> subscriptionService_;
+    std::shared_ptr<BookingService> bookingService_;
+
+    explicit ServiceContainer(const Config& config);
+
+public:
+    ~ServiceContainer();
+
+    ServiceContainer(const ServiceContainer&) = delete;
+    ServiceContainer& operator=(const ServiceContainer&) = delete;
+
+    static std::shared_ptr<ServiceContainer> create(const Config& config);
+
+    // Фоновая проверка БД, закрытие простаивающих соединений пула и сверка счетчиков посещаемости
+    void startMonitoring();
+    void stopMonitoring();
+
+    std::shared_ptr<DatabaseConnection> getConnection() const { return dbConnection_; }
+
+    std::shared_ptr<AuthService> getAuthService() const { return authService_; }
+    std::shared_ptr<AttendanceService> getAttendanceService() const { return attendanceService_; }
+    // Снимки счетчиков для панели администратора
+    std::shared_ptr<AttendanceCounters> getAttendanceCounters() const { return attendanceCounters_; }
+    std::shared_ptr<MonthlyRollupService> getMonthlyRollups() const { return monthlyRollups_; }
+    std::shared_ptr<ReferenceDataCache> getReferenceData() const { return referenceData_; }
+    std::shared_ptr<BranchService> getBranchService() const { return branchService_; }
+    std::shared_ptr<LessonService> getLessonService() const { return lessonService_; }
+    std::shared_ptr<EnrollmentService> getEnrollmentService() const { return enrollmentService_; }
+    std::shared_ptr<SubscriptionService> getSubscriptionService() const { return subscriptionService_; }
+    std::shared_ptr<BookingService> getBookingService() const { return bookingService_; }
+};
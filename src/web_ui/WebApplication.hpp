@@ -8,6 +8,7 @@
 #include "controllers/SubscriptionController.hpp"
 #include "controllers/LessonController.hpp"
 #include "models/UserSession.hpp"
+#include "ServiceContainer.hpp"
 
 class LoginWidget;
 class ClientDashboard;
@@ -20,7 +21,7 @@ class LessonView;
 
 class WebApplication : public Wt::WApplication {
 public:
-    WebApplication(const Wt::WEnvironment& env);
+    WebApplication(const Wt::WEnvironment& env, std::shared_ptr<ServiceContainer> services);
     
     void showLogin();
     void showDashboard();
@@ -50,6 +51,8 @@ private:
     SubscriptionView* subscriptionView_;
     LessonView* lessonView_;
     
+    // Общие для процесса сервисы; контроллеры сессии только ссылаются на них
+    std::shared_ptr<ServiceContainer> services_;
     std::unique_ptr<AuthController> authController_;
     std::unique_ptr<BookingController> bookingController_;
     std::unique_ptr<SubscriptionController> subscriptionController_;
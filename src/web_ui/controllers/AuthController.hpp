@@ -8,10 +8,10 @@
 
 class AuthController {
 private:
-    std::unique_ptr<AuthService> authService_;
+    std::shared_ptr<AuthService> authService_;
 
 public:
-    AuthController();
+    explicit AuthController(std::shared_ptr<AuthService> authService);
     
     bool login(const std::string& email, const std::string& password, AuthResponseDTO& response);
     bool registerClient(const std::string& name, const std::string& email,
@@ -20,7 +20,4 @@ public:
     bool changePassword(const std::string& clientId, const std::string& oldPassword, 
                        const std::string& newPassword);
     void resetPassword(const std::string& email);
-    
-private:
-    void initializeServices();
 };
\ No newline at end of file
@@ -90,6 +90,29 @@ std::vector<TimeSlot> BookingController::getAvailableTimeSlots(const UUID& hallI
     }
 }
 
+std::vector<HallDayAvailabilityDTO> BookingController::getBranchAvailability(
+    const UUID& branchId, const std::chrono::system_clock::time_point& fromDate, int days) {
+    try {
+        std::cout << "🗓️ Получение доступности залов филиала: " << branchId.toString() 
+                  << " на " << days << " дн." << std::endl;
+        return bookingService_->getBranchAvailability(branchId, fromDate, days);
+    } catch (const std::exception& e) {
+        std::cerr << "❌ Ошибка получения доступности филиала: " << e.what() << std::endl;
+        return {};
+    }
+}
+
+std::optional<DanceHall> BookingController::findAnyFreeHall(const UUID& branchId, const TimeSlot& timeSlot) {
+    try {
+        std::cout << "🔍 Поиск свободного зала филиала: " << branchId.toString() 
+                  << " в " << DateTimeUtils::formatTime(timeSlot.getStartTime()) << std::endl;
+        return bookingService_->findAnyFreeHall(branchId, timeSlot);
+    } catch (const std::exception& e) {
+        std::cerr << "❌ Ошибка поиска свободного зала: " << e.what() << std::endl;
+        return std::nullopt;
+    }
+}
+
 bool BookingController::validateBookingRequest(const BookingRequestDTO& request) const {
     return request.validate();
 }
@@ -124,6 +147,22 @@ std::string BookingController::getHallName(const UUID& hallId) {
     }
 }
 
+std::map<UUID, std::string> BookingController::getHallNames(const std::vector<UUID>& hallIds) {
+    std::map<UUID, std::string> names;
+    try {
+        std::cout << "🏷️ Получение названий залов: " << hallIds.size() << std::endl;
+        
+        if (bookingService_) {
+            for (const auto& hall : bookingService_->getHallsByIds(hallIds)) {
+                names.emplace(hall.getId(), hall.getName());
+            }
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "❌ Ошибка получения названий залов: " << e.what() << std::endl;
+    }
+    return names;
+}
+
 std::vector<Branch> BookingController::getBranches() {
     try {
         std::cout << "🏢 Получение списка филиалов" << std::endl;
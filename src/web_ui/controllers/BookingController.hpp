@@ -2,6 +2,7 @@
 
 #include "../../services/BookingService.hpp"
 #include "../../dtos/BookingDTO.hpp"
+#include <map>
 #include <memory>
 #include <vector>
 
@@ -19,8 +20,14 @@ public:
     std::vector<DanceHall> getAvailableHalls();
     std::vector<TimeSlot> getAvailableTimeSlots(const UUID& hallId, const std::chrono::system_clock::time_point& date);
     std::string getHallName(const UUID& hallId);
+    // Названия залов по списку ID одним запросом
+    std::map<UUID, std::string> getHallNames(const std::vector<UUID>& hallIds);
     std::vector<int> getAvailableDurations(const UUID& hallId, 
                                           const std::chrono::system_clock::time_point& startTime);
+    std::vector<HallDayAvailabilityDTO> getBranchAvailability(const UUID& branchId,
+                                                             const std::chrono::system_clock::time_point& fromDate,
+                                                             int days);
+    std::optional<DanceHall> findAnyFreeHall(const UUID& branchId, const TimeSlot& timeSlot);
     std::vector<Branch> getBranches();
     std::vector<DanceHall> getHallsByBranch(const UUID& branchId);
     std::chrono::minutes getTimezoneOffsetForHall(const UUID& hallId);
@@ -16,18 +16,12 @@ std::vector<LessonResponseDTO> LessonController::getUpcomingLessons(int days) {
     }
 }
 
-std::vector<LessonResponseDTO> LessonController::getLessonsByBranch(const UUID& branchId) {
+std::vector<LessonResponseDTO> LessonController::getLessonsByBranch(
+    const UUID& branchId,
+    const std::chrono::system_clock::time_point& from,
+    const std::chrono::system_clock::time_point& to) {
     try {
-        // Получаем все залы филиала и затем занятия для этих залов
-        auto halls = branchService_->getHallsByBranch(branchId);
-        std::vector<LessonResponseDTO> allLessons;
-        
-        for (const auto& hall : halls) {
-            auto lessons = lessonService_->getLessonsByHall(hall.getId());
-            allLessons.insert(allLessons.end(), lessons.begin(), lessons.end());
-        }
-        
-        return allLessons;
+        return lessonService_->getLessonsByBranchAndRange(branchId, from, to);
     } catch (const std::exception& e) {
         throw std::runtime_error("Failed to get lessons by branch: " + std::string(e.what()));
     }
@@ -41,6 +35,18 @@ LessonResponseDTO LessonController::getLesson(const UUID& lessonId) {
     }
 }
 
+std::map<UUID, LessonResponseDTO> LessonController::getLessonsByIds(const std::vector<UUID>& lessonIds) {
+    try {
+        std::map<UUID, LessonResponseDTO> lessons;
+        for (auto& lesson : lessonService_->getLessonsByIds(lessonIds)) {
+            lessons.emplace(lesson.lessonId, std::move(lesson));
+        }
+        return lessons;
+    } catch (const std::exception& e) {
+        throw std::runtime_error("Failed to get lessons: " + std::string(e.what()));
+    }
+}
+
 EnrollmentResponseDTO LessonController::enrollInLesson(const UUID& clientId, const UUID& lessonId) {
     try {
         EnrollmentRequestDTO request{clientId, lessonId};
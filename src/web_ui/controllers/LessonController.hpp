@@ -6,6 +6,7 @@
 #include "../../dtos/LessonDTO.hpp"
 #include "../../dtos/EnrollmentDTO.hpp"
 #include "../../types/uuid.hpp"
+#include <map>
 #include <memory>
 #include <vector>
 
@@ -24,8 +25,12 @@ public:
 
     // Методы для занятий
     std::vector<LessonResponseDTO> getUpcomingLessons(int days = 7);
-    std::vector<LessonResponseDTO> getLessonsByBranch(const UUID& branchId);
+    std::vector<LessonResponseDTO> getLessonsByBranch(const UUID& branchId,
+                                                      const std::chrono::system_clock::time_point& from,
+                                                      const std::chrono::system_clock::time_point& to);
     LessonResponseDTO getLesson(const UUID& lessonId);
+    // Занятия по списку ID одним запросом (для таблиц записей)
+    std::map<UUID, LessonResponseDTO> getLessonsByIds(const std::vector<UUID>& lessonIds);
     
     // Методы для записи на занятия
     EnrollmentResponseDTO enrollInLesson(const UUID& clientId, const UUID& lessonId);
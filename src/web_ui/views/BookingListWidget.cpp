@@ -80,6 +80,8 @@ void BookingListWidget::loadBookings() {
             return;
         }
         
+        loadHallNames(bookings);
+        
         int row = 1;
         for (const auto& booking : bookings) {
             // Название зала (убираем ID)
@@ -270,13 +272,26 @@ UUID BookingListWidget::getCurrentClientId() {
     return app_->getCurrentClientId();
 }
 
-std::string BookingListWidget::getHallNameById(const UUID& hallId) {
+void BookingListWidget::loadHallNames(const std::vector<BookingResponseDTO>& bookings) {
+    std::vector<UUID> hallIds;
+    for (const auto& booking : bookings) {
+        hallIds.push_back(booking.hallId);
+    }
+    
     try {
-        return app_->getBookingController()->getHallName(hallId);
+        hallNames_ = app_->getBookingController()->getHallNames(hallIds);
     } catch (const std::exception& e) {
-        std::cerr << "Ошибка получения названия зала: " << e.what() << std::endl;
-        return "Неизвестный зал";
+        std::cerr << "Ошибка получения названий залов: " << e.what() << std::endl;
+        hallNames_.clear();
+    }
+}
+
+std::string BookingListWidget::getHallNameById(const UUID& hallId) {
+    auto it = hallNames_.find(hallId);
+    if (it != hallNames_.end()) {
+        return it->second;
     }
+    return "Неизвестный зал";
 }
 
 std::string BookingListWidget::formatDateTime(const std::chrono::system_clock::time_point& timePoint, const UUID& hallId) {
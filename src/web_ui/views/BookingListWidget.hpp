@@ -7,6 +7,7 @@
 #include "../../types/uuid.hpp"
 #include "../../dtos/BookingDTO.hpp"
 #include "../../data/DateTimeUtils.hpp"
+#include <map>
 
 class WebApplication;
 
@@ -19,6 +20,7 @@ private:
     WebApplication* app_;
     Wt::WTable* bookingsTable_;
     Wt::WText* statusText_;
+    std::map<UUID, std::string> hallNames_; // заполняется в loadBookings одним запросом
 
     void setupUI();
     void handleCancelBooking(const UUID& bookingId);
@@ -29,6 +31,7 @@ private:
     std::vector<BookingResponseDTO> getClientBookingsFromService();
     bool cancelBookingThroughService(const UUID& bookingId);
     UUID getCurrentClientId();
+    void loadHallNames(const std::vector<BookingResponseDTO>& bookings);
     std::string getHallNameById(const UUID& hallId);
     std::string formatDateTime(const std::chrono::system_clock::time_point& timePoint, const UUID& hallId);
     std::string getStatusDisplayName(const std::string& status);
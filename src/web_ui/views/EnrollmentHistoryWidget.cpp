@@ -66,10 +66,21 @@ void EnrollmentHistoryWidget::loadHistory() {
         historyTable_->elementAt(0, 2)->addNew<Wt::WText>("<strong>Статус посещения</strong>")->setTextFormat(Wt::TextFormat::UnsafeXHTML);
         historyTable_->elementAt(0, 3)->addNew<Wt::WText>("<strong>Дата записи</strong>")->setTextFormat(Wt::TextFormat::UnsafeXHTML);
         
+        // Все занятия из истории загружаем одним запросом
+        std::vector<UUID> lessonIds;
+        for (const auto& enrollment : enrollments) {
+            lessonIds.push_back(enrollment.lessonId);
+        }
+        auto lessons = app_->getLessonController()->getLessonsByIds(lessonIds);
+        
         int row = 1;
         for (const auto& enrollment : enrollments) {
             // Получаем информацию о занятии
-            auto lesson = app_->getLessonController()->getLesson(enrollment.lessonId);
+            auto lessonIt = lessons.find(enrollment.lessonId);
+            if (lessonIt == lessons.end()) {
+                throw std::runtime_error("Lesson not found");
+            }
+            const auto& lesson = lessonIt->second;
             
             // Название занятия
             historyTable_->elementAt(row, 0)->addNew<Wt::WText>(lesson.name);
@@ -110,15 +110,17 @@ void LessonScheduleWidget::handleSearch() {
         // Получаем часовой пояс филиала
         auto branchTimezoneOffset = app_->getLessonController()->getTimezoneOffsetForBranch(branchId);
         
-        // Получаем занятия для выбранного филиала
-        auto allLessons = app_->getLessonController()->getLessonsByBranch(branchId);
-        
-        // Фильтруем занятия по выбранной дате
-        std::vector<LessonResponseDTO> filteredLessons;
         auto selectedTimePoint = DateTimeUtils::createDateTime(
             selectedDate.year(), selectedDate.month(), selectedDate.day(), 0, 0, 0
         );
         
+        // Получаем занятия филиала только за выбранные сутки
+        auto allLessons = app_->getLessonController()->getLessonsByBranch(
+            branchId, selectedTimePoint, selectedTimePoint + std::chrono::hours(24));
+        
+        // Фильтруем занятия по выбранной дате
+        std::vector<LessonResponseDTO> filteredLessons;
+        
         for (const auto& lesson : allLessons) {
             // Проверяем, что занятие в выбранный день и еще не прошло
             if (DateTimeUtils::isSameDay(lesson.timeSlot.getStartTime(), selectedTimePoint) &&
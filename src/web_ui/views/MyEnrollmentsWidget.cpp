@@ -55,13 +55,27 @@ void MyEnrollmentsWidget::loadEnrollments() {
         UUID clientId = app_->getCurrentClientId();
         auto enrollments = app_->getLessonController()->getClientEnrollments(clientId);
         
+        // Все занятия из записей загружаем одним запросом
+        std::vector<UUID> lessonIds;
+        for (const auto& enrollment : enrollments) {
+            lessonIds.push_back(enrollment.lessonId);
+        }
+        auto lessons = app_->getLessonController()->getLessonsByIds(lessonIds);
+        auto lessonFor = [&lessons](const UUID& lessonId) -> const LessonResponseDTO& {
+            auto it = lessons.find(lessonId);
+            if (it == lessons.end()) {
+                throw std::runtime_error("Lesson not found");
+            }
+            return it->second;
+        };
+        
         // ФИЛЬТРАЦИЯ: оставляем только будущие занятия
         std::vector<EnrollmentResponseDTO> futureEnrollments;
         auto now = std::chrono::system_clock::now();
         
         for (const auto& enrollment : enrollments) {
             // Получаем информацию о занятии
-            auto lesson = app_->getLessonController()->getLesson(enrollment.lessonId);
+            const auto& lesson = lessonFor(enrollment.lessonId);
             
             // Проверяем, что занятие в будущем и статус "REGISTERED"
             if (lesson.timeSlot.getStartTime() > now && enrollment.status == "REGISTERED") {
@@ -86,7 +100,7 @@ void MyEnrollmentsWidget::loadEnrollments() {
         int row = 1;
         for (const auto& enrollment : futureEnrollments) {
             // Получаем информацию о занятии
-            auto lesson = app_->getLessonController()->getLesson(enrollment.lessonId);
+            const auto& lesson = lessonFor(enrollment.lessonId);
             
             // Название занятия
             enrollmentsTable_->elementAt(row, 0)->addNew<Wt::WText>(lesson.name);